@@ -0,0 +1,115 @@
+#!python3
+# Builds the asset pack: the fonts and icons of the dashboard in one blob for the "assets" flash partition, which the
+# firmware maps with esp_partition_mmap() instead of compiling them into the app image (-DASSET_PACK, see
+# src/assetpack.h for the format).
+#
+#   python assetpack.py <output directory> [--fonts <directory of fontsubset.py>]
+#
+# writes assets.bin and assetpack_index.h, the names of the assets the firmware is built with. The fonts are taken
+# from the --fonts directory where fontsubset.py wrote a subset, from lib/ otherwise, the icons from src/icons/.
+# The pre-script pio_assetpack.py runs this in the *_assets environments of platformio.ini.
+
+from argparse import ArgumentParser
+import glob
+import os
+import re
+import struct
+
+from fontsubset import parse_font, read
+
+MAGIC = 0x31414148 # "HAA1"
+ASSET_FONT = 0
+ASSET_ICON = 1
+NAME_SIZE = 24
+
+HEADER = struct.Struct("<4I")          # magic, count, size, version
+ENTRY = struct.Struct("<24s3I")        # name, type, offset, size
+FONT = struct.Struct("<5I3i")          # glyphs, intervals, bitmap, interval_count, compressed, advance_y, ascender, descender
+GLYPH = struct.Struct("<3Bx2hH2xI")    # GFXglyph as laid out by the ESP32 compiler
+INTERVAL = struct.Struct("<3I")        # UnicodeInterval
+ICON = struct.Struct("<2H2Ii")         # width, height, size, data, base entry (-1 for none)
+
+def align(data):
+    data += bytes(-len(data) % 4)
+
+def font_blob(path):
+    name, bitmaps, code_points, _, metrics = parse_font(path)
+    glyphs = bytearray()
+    intervals = bytearray()
+    count = 0
+    for cp in sorted(code_points):
+        glyphs += GLYPH.pack(*code_points[cp])
+        if count and previous == cp - 1:
+            intervals[-INTERVAL.size:] = INTERVAL.pack(first, cp, offset)
+        else:
+            first, offset = cp, len(glyphs) // GLYPH.size - 1
+            intervals += INTERVAL.pack(cp, cp, offset)
+            count += 1
+        previous = cp
+    compressed, advance_y, ascender, descender = [int(m in ("1", "true")) if i == 0 else int(m) for i, m in enumerate(metrics)]
+    blob = bytearray(FONT.size)
+    blob += glyphs + intervals + bitmaps
+    FONT.pack_into(blob, 0, FONT.size, FONT.size + len(glyphs), FONT.size + len(glyphs) + len(intervals), count,
+                   compressed, advance_y, ascender, descender)
+    return name, blob
+
+def parse_icon(path):
+    header = read(path)
+    name = re.search(r"const Icon (\w+)_icon = \{", header).group(1)
+    width = int(re.search(r"{}_width = (\d+)".format(name), header).group(1))
+    height = int(re.search(r"{}_height = (\d+)".format(name), header).group(1))
+    start = header.index("{", header.index("{}_data[".format(name)))
+    data = bytes(int(b, 16) for b in re.findall(r"0x([0-9A-Fa-f]{2})", header[start:header.index("};", start)]))
+    base = re.search(r"const Icon \w+_icon = \{[^}]*, &(\w+)_icon\}", header)
+    return name, width, height, data, base.group(1) if base else None
+
+def main(args):
+    fonts = []
+    for path in sorted(glob.glob(os.path.join(args.lib, "opensans*", "*.h"))):
+        subset = os.path.join(args.fonts or "", os.path.splitext(os.path.basename(path))[0] + "_subset.h")
+        fonts.append(font_blob(subset if args.fonts and os.path.exists(subset) else path))
+    icons = [parse_icon(path) for path in sorted(glob.glob(os.path.join(args.src, "icons", "*.h")))]
+
+    entries = [(name, ASSET_FONT, blob) for name, blob in fonts]
+    index = {icon[0]: len(entries) + i for i, icon in enumerate(icons)}
+    for name, width, height, data, base in icons:
+        blob = bytearray(ICON.pack(width, height, len(data), ICON.size, index[base] if base else -1)) + data
+        entries.append((name, ASSET_ICON, blob))
+
+    pack = bytearray(HEADER.size + ENTRY.size * len(entries))
+    for i, (name, kind, blob) in enumerate(entries):
+        align(pack)
+        ENTRY.pack_into(pack, HEADER.size + i * ENTRY.size, name.encode()[:NAME_SIZE - 1], kind, len(pack), len(blob))
+        pack += blob
+    HEADER.pack_into(pack, 0, MAGIC, len(entries), len(pack), 1)
+
+    os.makedirs(args.outputdir, exist_ok=True)
+    with open(os.path.join(args.outputdir, "assets.bin"), "wb") as f:
+        f.write(pack)
+    lines = ["#pragma once",
+             "// The assets the firmware is built with, written by scripts/assetpack.py. loadAssetPack() fills them from the pack.",
+             "#define ASSET_FONTS {}".format(len(fonts)),
+             "#define ASSET_ICONS {}".format(len(icons)),
+             "const char* const assetFontNames[ASSET_FONTS] = {{{}}};".format(", ".join('"{}"'.format(n) for n, _ in fonts)),
+             "const char* const assetIconNames[ASSET_ICONS] = {{{}}};".format(", ".join('"{}"'.format(i[0]) for i in icons)),
+             "GFXfont assetFonts[ASSET_FONTS];",
+             "Icon    assetIcons[ASSET_ICONS];"]
+    lines += ["const GFXfont& {} = assetFonts[{}];".format(name, i) for i, (name, _) in enumerate(fonts)]
+    lines += ["const Icon& {}_icon = assetIcons[{}];".format(icon[0], i) for i, icon in enumerate(icons)]
+    text = "\n".join(lines) + "\n"
+    path = os.path.join(args.outputdir, "assetpack_index.h")
+    if not os.path.exists(path) or read(path) != text:
+        with open(path, "w") as f:
+            f.write(text)
+    font_bytes = sum(len(blob) for _, blob in fonts)
+    print("Asset pack: {} fonts ({} bytes) and {} icons ({} bytes), {} bytes".format(
+        len(fonts), font_bytes, len(icons), len(pack) - font_bytes - HEADER.size - ENTRY.size * len(entries), len(pack)))
+
+if __name__ == "__main__":
+    parser = ArgumentParser()
+    parser.add_argument("outputdir", help="directory assets.bin and assetpack_index.h are written to")
+    parser.add_argument("--fonts", help="directory fontsubset.py wrote the subsets to")
+    parser.add_argument("--src", default=os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "src"))
+    parser.add_argument("--lib", default=os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "lib"))
+    args = parser.parse_args()
+    main(args)
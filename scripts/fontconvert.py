@@ -12,6 +12,7 @@ parser.add_argument("name", action="store", help="name of the font.")
 parser.add_argument("size", type=int, help="font size to use.")
 parser.add_argument("fontstack", action="store", nargs='+', help="list of font files, ordered by descending priority.")
 parser.add_argument("--compress", dest="compress", action="store_true", help="compress glyph bitmaps.")
+parser.add_argument("--chars", dest="chars", action="store", help="only convert these characters, see fontsubset.py.")
 args = parser.parse_args()
 
 GlyphProps = namedtuple("GlyphProps", ["width", "height", "advance_x", "left", "top", "compressed_size", "data_offset", "code_point"])
@@ -34,6 +35,15 @@ intervals = [
     # (0x1F600, 0x1F680),
 ]
 
+if args.chars:
+    # one interval per run of consecutive code points, '?' is drawn for missing characters
+    intervals = []
+    for code_point in sorted(set(ord(c) for c in args.chars + "?")):
+        if intervals and intervals[-1][1] == code_point - 1:
+            intervals[-1] = (intervals[-1][0], code_point)
+        else:
+            intervals.append((code_point, code_point))
+
 
 def norm_floor(val):
     return int(math.floor(val / (1 << 6)))
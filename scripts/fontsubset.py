@@ -0,0 +1,328 @@
+#!python3
+# Subsets the fonts in lib/ to the characters the dashboard can draw with them.
+#
+# The drawString() calls in src/dashboard.h are scanned with the font that is set when they run (setFont() in the
+# same function or, if there is none, at the call sites of the function). The text of every call is resolved to the
+# characters it can hold: string literals and their Strings, numbers formatted with String(), the configured entity
+# names, and for function parameters whatever the callers pass. A font is only subset if all of its texts resolve,
+# anything known at run time only (states, dates, ...) keeps the whole font.
+#
+#   python fontsubset.py <output directory> [--compress]
+#
+# writes <font header>_subset.h for every font that can be subset, with the same names as the full font, and removes
+# the ones that cannot be subset (anymore). --compress zlib compresses the glyphs, like fontconvert.py --compress, and
+# writes the whole fonts that are used as well; drawString() inflates them into a glyph cache. src/fonts.h includes a
+# subset instead of the full font if there is one.
+# The pre-script pio_fontsubset.py runs this before every PlatformIO build.
+
+from argparse import ArgumentParser
+import glob
+import os
+import re
+import sys
+import zlib
+
+# String() of a number, the characters of a float or int
+NUMBER = set("0123456789.-")
+# lookupGlyph() draws '?' for characters the font does not have
+ALWAYS = set("?")
+
+def read(path, encoding="utf-8"):
+    with open(path, encoding=encoding) as f:
+        return f.read()
+
+def strip_comments(code):
+    return re.sub(r"//[^\n]*|/\*.*?\*/", lambda m: " " * len(m.group(0)) if '"' not in m.group(0) else m.group(0), code, flags=re.S)
+
+def literal_chars(literal):
+    return set(bytes(literal, "utf-8").decode("unicode_escape").encode("latin-1").decode("utf-8"))
+
+def closing(code, i, open_char="(", close_char=")"):
+    """index after the bracket that closes the one at code[i]"""
+    depth = 0
+    while i < len(code):
+        c = code[i]
+        if c == '"':
+            i = code.index('"', i + 1)
+            while code[i - 1] == "\\":
+                i = code.index('"', i + 1)
+        elif c == open_char:
+            depth += 1
+        elif c == close_char:
+            depth -= 1
+            if depth == 0:
+                return i + 1
+        i += 1
+    raise ValueError("unbalanced " + open_char)
+
+def split_top(text, separator):
+    """splits at separator outside of brackets and strings"""
+    parts, depth, start, i = [], 0, 0, 0
+    while i < len(text):
+        c = text[i]
+        if c == '"':
+            i = closing_quote(text, i)
+            continue
+        if c in "([{":
+            depth += 1
+        elif c in ")]}":
+            depth -= 1
+        elif c == separator and depth == 0:
+            parts.append(text[start:i])
+            start = i + 1
+        i += 1
+    parts.append(text[start:])
+    return [p.strip() for p in parts if p.strip()]
+
+def closing_quote(text, i):
+    i += 1
+    while text[i] != '"':
+        i += 2 if text[i] == "\\" else 1
+    return i + 1
+
+class Function:
+    def __init__(self, name, params, body):
+        self.name = name
+        self.params = params
+        self.body = body
+        self.calls = []   # (callee key, arguments, font at the call)
+        self.draws = []   # (text expression, font)
+
+FUNCTION = re.compile(r"^[A-Za-z_][\w:<>&\* ]*?\b(\w+)\s*\(([^;{}]*?)\)\s*\{", re.M)
+
+def parse_functions(code):
+    functions = {}
+    for m in FUNCTION.finditer(code):
+        if m.group(1) in ("if", "for", "while", "switch"):
+            continue
+        start = m.end() - 1
+        body = code[start:closing(code, start, "{", "}")]
+        params = [re.findall(r"\w+", p)[-1] for p in split_top(m.group(2), ",")]
+        functions[(m.group(1), len(params))] = Function(m.group(1), params, body)
+    return functions
+
+FONT_CALL = re.compile(r"\bsetFont\s*\(\s*(\w+)\s*\)")
+CALL = re.compile(r"\b(\w+)\s*\(")
+INHERITED = None
+
+def scan_function(function, functions, fonts):
+    font = INHERITED
+    names = {name for name, _ in functions}
+    for m in CALL.finditer(function.body):
+        name = m.group(1)
+        if name == "setFont":
+            font = FONT_CALL.match(function.body, m.start()).group(1)
+            if font not in fonts:
+                font = INHERITED   # restores the font of the caller
+            continue
+        if name != "drawString" and name not in names:
+            continue
+        arguments = split_top(function.body[m.end():closing(function.body, m.end() - 1) - 1], ",")
+        if name == "drawString":
+            function.draws.append((arguments[2], font))
+        elif (name, len(arguments)) in functions:
+            function.calls.append(((name, len(arguments)), arguments, font))
+
+def callers(key, functions):
+    for caller in functions.values():
+        for callee, arguments, font in caller.calls:
+            if callee == key:
+                yield caller, arguments, font
+
+def fonts_of(function, font, functions, default_font, seen=()):
+    """the fonts a drawString with font (INHERITED for the font of the caller) can run with"""
+    if font is not INHERITED:
+        return {font}
+    key = (function.name, len(function.params))
+    if key in seen:
+        return set()
+    result = set()
+    found = False
+    for caller, _, caller_font in callers(key, functions):
+        found = True
+        result |= fonts_of(caller, caller_font, functions, default_font, seen + (key,))
+    return result if found else {default_font}
+
+class Unknown(Exception):
+    pass
+
+def resolve(expression, function, functions, globals_, labels, seen=()):
+    """characters the String expression can hold, Unknown if they are only known at run time"""
+    chars = set()
+    for term in split_top(expression, "+"):
+        while term.startswith("(") and closing(term, 0) == len(term):
+            term = term[1:-1].strip()
+        if term.startswith('"'):
+            for literal in re.findall(r'"((?:[^"\\]|\\.)*)"', term):
+                chars |= literal_chars(literal)
+        elif term.startswith("String("):
+            inner = split_top(term[len("String("):-1], ",")
+            if inner and inner[0].startswith('"'):
+                chars |= resolve(inner[0], function, functions, globals_, labels, seen)
+            else:
+                chars |= NUMBER
+        elif term.endswith(".entityName"):
+            chars |= labels
+        elif re.fullmatch(r"\w+", term):
+            chars |= resolve_name(term, function, functions, globals_, labels, seen)
+        else:
+            raise Unknown("{} in {}()".format(term, function.name))
+    return chars
+
+def resolve_name(name, function, functions, globals_, labels, seen):
+    if (function.name, name) in seen:
+        return set()
+    seen = seen + ((function.name, name),)
+    if name in function.params:
+        index = function.params.index(name)
+        found = callers((function.name, len(function.params)), functions)
+        chars = set()
+        for caller, arguments, _ in found:
+            chars |= resolve(arguments[index], caller, functions, globals_, labels, seen)
+        return chars
+    assignments = re.findall(r"\b{}\s*=\s*([^;=][^;]*);".format(name), function.body)
+    if assignments or re.search(r"\bString\s+{}\s*;".format(name), function.body):
+        chars = set()
+        for value in assignments:
+            chars |= resolve(value, function, functions, globals_, labels, seen)
+        return chars
+    if name in globals_:
+        return literal_chars(globals_[name])
+    raise Unknown("{} in {}()".format(name, function.name))
+
+def configured_labels(src):
+    path = os.path.join(src, "configurations.h")
+    if not os.path.exists(path):
+        path = os.path.join(src, "configurations.h.in")
+    labels = set()
+    for name in re.findall(r'^\s*\{\s*"((?:[^"\\]|\\.)*)"\s*,\s*"[\w.]+"\s*,\s*[A-Z]', strip_comments(read(path)), re.M):
+        labels |= literal_chars(name)
+    return labels
+
+# --- the fonts in lib/
+
+def parse_font(path):
+    header = read(path, "latin-1")
+    name = re.search(r"const GFXfont (\w+) = \{", header).group(1)
+    bitmap_start = header.index("{", header.index("Bitmaps["))
+    bitmaps = bytes(int(b, 16) for b in re.findall(r"0x([0-9A-F]{2})", header[bitmap_start:header.index("};", bitmap_start)]))
+    glyphs = [tuple(int(v) for v in g.split(","))
+              for g in re.findall(r"^\s*\{ ([-\d, ]+) \},", header[header.index("Glyphs[]"):header.index("Intervals[]")], re.M)]
+    intervals = [(int(a, 16), int(b, 16), int(c, 16)) for a, b, c in
+                 re.findall(r"\{ 0x([0-9A-F]+), 0x([0-9A-F]+), 0x([0-9A-F]+) \}", header[header.index("Intervals[]"):])]
+    code_points = {}
+    for first, last, offset in intervals:
+        for cp in range(first, last + 1):
+            code_points[cp] = glyphs[offset + cp - first]
+    metrics = header[header.index("const GFXfont"):]
+    metrics = [v.strip() for v in metrics[metrics.index("{") + 1:metrics.index("}")].split(",") if v.strip()][4:]
+    return name, bitmaps, code_points, len(intervals), metrics
+
+GLYPH_BYTES = 16 # sizeof(GFXglyph) on the ESP32: 3 x uint8_t, 2 x int16_t, uint16_t, uint32_t with padding
+INTERVAL_BYTES = 12
+
+def write_subset(path, name, bitmaps, code_points, metrics, chars, compress):
+    kept = sorted(cp for cp in code_points if chars is None or chr(cp) in chars)
+    compressed = metrics[0] not in ("0", "false")
+    data = bytearray()
+    glyphs = []
+    for cp in kept:
+        width, height, advance_x, left, top, size, offset = code_points[cp]
+        bitmap = bitmaps[offset:offset + size]
+        if compressed and not compress:
+            bitmap = zlib.decompress(bitmap)
+        elif compress and not compressed:
+            bitmap = zlib.compress(bitmap, 9)
+        glyphs.append((width, height, advance_x, left, top, len(bitmap), len(data), cp))
+        data += bitmap
+    metrics = ["1" if compress else "0"] + metrics[1:]
+    intervals = []
+    for index, cp in enumerate(kept):
+        if intervals and intervals[-1][1] == cp - 1:
+            intervals[-1][1] = cp
+        else:
+            intervals.append([cp, cp, index])
+    lines = ["#pragma once",
+             "// {} of {}{}, written by scripts/fontsubset.py".format(
+                 "All glyphs" if chars is None else "Subset to the characters the dashboard draws with it",
+                 name, ", compressed" if compress else ""),
+             "#include \"epd_driver.h\"",
+             "const uint8_t {}Bitmaps[{}] = {{".format(name, len(data))]
+    for i in range(0, len(data), 16):
+        lines.append("    " + " ".join("0x{:02X},".format(b) for b in data[i:i + 16]))
+    lines.append("};")
+    lines.append("const GFXglyph {}Glyphs[] = {{".format(name))
+    for g in glyphs:
+        lines.append("    {{ {} }}, // U+{:04X}".format(", ".join(str(v) for v in g[:-1]), g[-1]))
+    lines.append("};")
+    lines.append("const UnicodeInterval {}Intervals[] = {{".format(name))
+    for first, last, offset in intervals:
+        lines.append("    {{ 0x{:X}, 0x{:X}, 0x{:X} }},".format(first, last, offset))
+    lines.append("};")
+    lines.append("const GFXfont {} = {{".format(name))
+    lines += ["    (uint8_t*){}Bitmaps,".format(name), "    (GFXglyph*){}Glyphs,".format(name),
+              "    (UnicodeInterval*){}Intervals,".format(name), "    {},".format(len(intervals))]
+    lines += ["    {},".format(m) for m in metrics]
+    lines.append("};")
+    text = "\n".join(lines) + "\n"
+    # only touch the file if it changed, so the firmware is not rebuilt every time
+    if not os.path.exists(path) or read(path) != text:
+        with open(path, "w", encoding="utf-8") as f:
+            f.write(text)
+    return len(glyphs), len(data), len(intervals)
+
+def main(args):
+    code = strip_comments(read(os.path.join(args.src, "dashboard.h")))
+    functions = parse_functions(code)
+    globals_ = dict(re.findall(r'^(?:const )?String (\w+)\s*=\s*"((?:[^"\\]|\\.)*)";', code, re.M))
+    labels = configured_labels(args.src)
+
+    fonts = {}
+    for path in sorted(glob.glob(os.path.join(args.lib, "*", "*.h"))):
+        font = re.search(r"const GFXfont (\w+) = \{", read(path, "latin-1"))
+        if font:
+            fonts[font.group(1)] = path
+    default_font = FONT_CALL.search(strip_comments(read(os.path.join(args.src, "main.cpp")))).group(1)
+
+    for function in functions.values():
+        scan_function(function, functions, fonts)
+
+    used = {}     # font -> characters
+    reasons = {}  # font -> why it is kept whole
+    for function in functions.values():
+        for expression, font in function.draws:
+            for f in fonts_of(function, font, functions, default_font):
+                try:
+                    used.setdefault(f, set()).update(resolve(expression, function, functions, globals_, labels))
+                except Unknown as e:
+                    reasons.setdefault(f, str(e))
+
+    os.makedirs(args.outputdir, exist_ok=True)
+    for font, path in fonts.items():
+        output = os.path.join(args.outputdir, os.path.splitext(os.path.basename(path))[0] + "_subset.h")
+        if font not in used or (font in reasons and not args.compress):
+            if os.path.exists(output):
+                os.remove(output)
+            if font in reasons:
+                print("{}: whole font, {} is only known at run time".format(font, reasons[font]))
+            else:
+                print("{}: not used".format(font))
+            continue
+        name, bitmaps, code_points, full_intervals, metrics = parse_font(path)
+        chars = None if font in reasons else used[font] | ALWAYS
+        glyphs, data, intervals = write_subset(output, name, bitmaps, code_points, metrics, chars, args.compress)
+        before = len(bitmaps) + len(code_points) * GLYPH_BYTES + full_intervals * INTERVAL_BYTES
+        after = data + glyphs * GLYPH_BYTES + intervals * INTERVAL_BYTES
+        kept = "whole font, {} is only known at run time".format(reasons[font]) if chars is None else "".join(sorted(chars))
+        print("{}: {} of {} glyphs{} ({}), {} -> {} bytes of flash ({:.0f}% less)".format(
+            font, glyphs, len(code_points), ", compressed" if args.compress else "", kept, before, after,
+            100.0 * (before - after) / before))
+
+if __name__ == "__main__":
+    parser = ArgumentParser()
+    parser.add_argument("outputdir", help="directory the subset headers are written to")
+    parser.add_argument("--src", default=os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "src"))
+    parser.add_argument("--compress", action="store_true", help="compress the glyph bitmaps")
+    parser.add_argument("--lib", default=os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "lib"))
+    args = parser.parse_args()
+    main(args)
@@ -1,9 +1,10 @@
 #!python3
 
-from PIL import Image, ImageOps
 from argparse import ArgumentParser
 import sys
 import math
+import os
+import re
 
 SCREEN_WIDTH = 1200
 SCREEN_HEIGHT = 825
@@ -16,34 +17,166 @@ parser = ArgumentParser()
 parser.add_argument('-i', action="store", dest="inputfile")
 parser.add_argument('-n', action="store", dest="name")
 parser.add_argument('-o', action="store", dest="outputfile")
+parser.add_argument('-r', action="store_true", dest="rle", help="run length encode the image, draw it with drawIcon()")
+parser.add_argument('-b', action="store", dest="basefile",
+                    help="run length encoded header of a similar icon, the image is stored as delta to it if that is smaller (implies -r)")
 
 args = parser.parse_args()
 
-im = Image.open(args.inputfile)
-# convert to grayscale
-im = im.convert(mode='L')
-im.thumbnail((SCREEN_WIDTH, SCREEN_HEIGHT), Image.ANTIALIAS)
+RLE_MIN_RUN = 3
+RLE_MAX_RUN = 0x7F + RLE_MIN_RUN
+RLE_MAX_LITERAL = 0x80
+DELTA_MAX_RUN = 0x3F + RLE_MIN_RUN
+DELTA_MAX_KEEP = 0x40
 
-# Write out the output file.
-with open(args.outputfile, 'w') as f:
-    f.write("const uint32_t {}_width = {};\n".format(args.name, im.size[0]))
-    f.write("const uint32_t {}_height = {};\n".format(args.name, im.size[1]))
-    f.write(
-        "const uint8_t {}_data[({}*{})/2] = {{\n".format(args.name, math.ceil(im.size[0] / 2) * 2, im.size[1])
-    )
-    for y in range(0, im.size[1]):
+def run_length(data, i, limit=RLE_MAX_RUN):
+    run = 1
+    while i + run < len(data) and run < limit and data[i + run] == data[i]:
+        run += 1
+    return run
+
+def keep_length(base, data, i):
+    keep = 0
+    while i + keep < len(data) and keep < DELTA_MAX_KEEP and base[i + keep] == data[i + keep]:
+        keep += 1
+    return keep
+
+# Run length encoding in bytes of two pixels, row after row (see drawIcon() in epd_drawing.h):
+#   0ccccccc           literal, the next c + 1 bytes are copied
+#   1ccccccc vvvvvvvv  repeat, v is repeated c + 3 times
+def rle_encode(data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        run = run_length(data, i)
+        if run >= RLE_MIN_RUN:
+            out += bytes([0x80 | (run - RLE_MIN_RUN), data[i]])
+            i += run
+            continue
+        start = i
+        while i < len(data) and i - start < RLE_MAX_LITERAL and run_length(data, i) < RLE_MIN_RUN:
+            i += 1
+        out.append(i - start - 1)
+        out += data[start:i]
+    return out
+
+def rle_decode(encoded, size):
+    data = bytearray()
+    i = 0
+    while len(data) < size:
+        control = encoded[i]
+        if control & 0x80:
+            data += bytes([encoded[i + 1]]) * ((control & 0x7F) + RLE_MIN_RUN)
+            i += 2
+        else:
+            data += encoded[i + 1:i + 2 + control]
+            i += control + 2
+    return data
+
+# Delta to a base image, the bytes that equal the base are kept:
+#   0ccccccc           literal, the next c + 1 bytes are copied
+#   10cccccc vvvvvvvv  repeat, v is repeated c + 3 times
+#   11cccccc           keep c + 1 bytes of the base
+def delta_encode(base, data):
+    out = bytearray()
+    i = 0
+    while i < len(data):
+        keep = keep_length(base, data, i)
+        run = run_length(data, i, DELTA_MAX_RUN)
+        if keep >= 2 or (keep == 1 and run < RLE_MIN_RUN):
+            out.append(0xC0 | (keep - 1))
+            i += keep
+            continue
+        if run >= RLE_MIN_RUN:
+            out += bytes([0x80 | (run - RLE_MIN_RUN), data[i]])
+            i += run
+            continue
+        start = i
+        while i < len(data) and i - start < RLE_MAX_LITERAL and run_length(data, i, DELTA_MAX_RUN) < RLE_MIN_RUN and keep_length(base, data, i) < 2:
+            i += 1
+        out.append(i - start - 1)
+        out += data[start:i]
+    return out
+
+def read_header(path):
+    """name, width, height and pixel data of a header written by this script"""
+    with open(path) as f:
+        header = f.read()
+    name = re.search(r"const uint8_t (\w+)_data\[", header).group(1)
+    body = bytearray(int(b, 16) for b in re.findall(r"0x([0-9A-Fa-f]{2})", header[header.index("{"):]))
+    size = re.search(r"_data\[\((\d+)\*(\d+)\)/2\]", header)
+    if size:
+        return name, int(size.group(1)), int(size.group(2)), body
+    if "delta to" in header:
+        sys.exit("{} is a delta, it cannot be used as input or base".format(path))
+    width = int(re.search(r"_width = (\d+);", header).group(1))
+    height = int(re.search(r"_height = (\d+);", header).group(1))
+    return name, width, height, rle_decode(body, (width + 1) // 2 * height)
+
+if args.inputfile.endswith(".h"):
+    # a header written by this script, e.g. to run length encode an existing icon
+    _, width, height, data = read_header(args.inputfile)
+else:
+    from PIL import Image, ImageOps
+    im = Image.open(args.inputfile)
+    # convert to grayscale
+    im = im.convert(mode='L')
+    im.thumbnail((SCREEN_WIDTH, SCREEN_HEIGHT), Image.ANTIALIAS)
+    width, height = im.size
+    data = bytearray()
+    for y in range(0, height):
         byte = 0
         done = True
-        for x in range(0, im.size[0]):
+        for x in range(0, width):
             l = im.getpixel((x, y))
             if x % 2 == 0:
                 byte = l >> 4
                 done = False;
             else:
                 byte |= l & 0xF0
-                f.write("0x{:02X}, ".format(byte))
+                data.append(byte)
                 done = True
         if not done:
-            f.write("0x{:02X}, ".format(byte))
+            data.append(byte)
+
+base = None
+if args.basefile:
+    args.rle = True
+    base_name, base_width, base_height, base_data = read_header(args.basefile)
+    if (base_width, base_height) != (width, height):
+        sys.exit("{} is {}x{}, not {}x{}".format(args.basefile, base_width, base_height, width, height))
+    delta = delta_encode(base_data, data)
+    encoded = rle_encode(data)
+    if len(delta) < len(encoded):
+        base = base_name
+    print("{}: {} bytes as delta to {}, {} bytes run length encoded, {}".format(
+        args.name, len(delta), base_name, len(encoded), "stored as delta" if base else "delta not used"), file=sys.stderr)
+
+# Write out the output file.
+with open(args.outputfile, 'w') as f:
+    if args.rle:
+        f.write("#pragma once\n")
+    if base:
+        f.write("#include \"{}\"\n".format(os.path.basename(args.basefile)))
+    f.write("const uint32_t {}_width = {};\n".format(args.name, width))
+    f.write("const uint32_t {}_height = {};\n".format(args.name, height))
+    if base:
+        data = delta
+        f.write("const uint8_t {}_data[{}] = {{ // delta to {}, run length encoded\n".format(args.name, len(data), base_name))
+        row = 50
+    elif args.rle:
+        data = rle_encode(data)
+        f.write("const uint8_t {}_data[{}] = {{ // run length encoded\n".format(args.name, len(data)))
+        row = 50
+    else:
+        f.write(
+            "const uint8_t {}_data[({}*{})/2] = {{\n".format(args.name, math.ceil(width / 2) * 2, height)
+        )
+        row = math.ceil(width / 2)
+    for i in range(0, len(data), row):
+        f.write("".join("0x{:02X}, ".format(b) for b in data[i:i + row]))
         f.write("\n\t");
-    f.write("};\n")
\ No newline at end of file
+    f.write("};\n")
+    if args.rle:
+        f.write("const Icon {0}_icon = {{{0}_width, {0}_height, sizeof({0}_data), {0}_data, {1}}};\n".format(
+            args.name, "&{}_icon".format(base) if base else "NULL"))
@@ -0,0 +1,30 @@
+# PlatformIO pre-script of the *_assets environments (extra_scripts in platformio.ini, after pio_fontsubset.py):
+# builds the asset pack with assetpack.py, defines ASSET_PACK so the fonts and icons are read from it, and adds the
+# target uploadassets, which writes the pack to the "assets" partition:
+#   pio run -e esp32dev_assets -t uploadassets
+import csv
+import os
+import subprocess
+
+Import("env")
+
+build = env.subst("$BUILD_DIR")
+output = os.path.join(build, "assetpack")
+script = os.path.join(env.subst("$PROJECT_DIR"), "scripts", "assetpack.py")
+subprocess.check_call([env.subst("$PYTHONEXE"), script, output, "--fonts", os.path.join(build, "fontsubsets")])
+env.Prepend(CPPPATH=[output])
+env.Append(CPPDEFINES=["ASSET_PACK"])
+
+if env.subst("$PIOPLATFORM") != "native":
+    offset = None
+    with open(os.path.join(env.subst("$PROJECT_DIR"), env.GetProjectOption("board_build.partitions"))) as f:
+        for row in csv.reader(line for line in f if not line.startswith("#")):
+            if row and row[0].strip() == "assets":
+                offset = row[3].strip()
+    env.AddCustomTarget(
+        name="uploadassets",
+        dependencies=None,
+        actions=['"$PYTHONEXE" "$UPLOADER" --chip $BOARD_MCU --port "$UPLOAD_PORT" --baud $UPLOAD_SPEED write_flash {} "{}"'.format(
+            offset, os.path.join(output, "assets.bin"))],
+        title="Upload assets",
+        description="Writes the fonts and icons to the assets partition")
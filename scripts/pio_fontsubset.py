@@ -0,0 +1,15 @@
+# PlatformIO pre-script (extra_scripts in platformio.ini): subsets the fonts to the characters the dashboard draws
+# with them, see fontsubset.py, and puts the subsets on the include path ahead of the full fonts. The glyphs are
+# compressed unless the environment sets custom_compress_fonts = no.
+import os
+import subprocess
+
+Import("env")
+
+output = os.path.join(env.subst("$BUILD_DIR"), "fontsubsets")
+script = os.path.join(env.subst("$PROJECT_DIR"), "scripts", "fontsubset.py")
+command = [env.subst("$PYTHONEXE"), script, output]
+if env.GetProjectOption("custom_compress_fonts", "yes") != "no":
+    command.append("--compress")
+subprocess.check_call(command)
+env.Prepend(CPPPATH=[output])
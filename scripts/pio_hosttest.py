@@ -0,0 +1,25 @@
+# PlatformIO post-script of the native environments (extra_scripts in platformio.ini): adds the target hosttest, which
+# builds the host program and runs its checks (--test, with the state parser corpus in src/native/fixtures/parser) and
+# the tile catalogue check against the golden tiles in test/golden, straight into the framebuffer and in bands:
+#   pio run -e native -t hosttest
+# The golden tiles are compared pixel by pixel only, their timings are those of the machine they were written on.
+# After an intended change of the tiles, write them again with --catalogue test/golden.
+import os
+
+Import("env")
+
+program = '"$BUILD_DIR/${PROGNAME}${PROGSUFFIX}"'
+golden = os.path.join(env.subst("$PROJECT_DIR"), "test", "golden")
+corpus = os.path.join(env.subst("$PROJECT_DIR"), "src", "native", "fixtures", "parser")
+assets = ""
+if "ASSET_PACK" in env.get("CPPDEFINES", []):
+    assets = ' --assets "{}"'.format(os.path.join(env.subst("$BUILD_DIR"), "assetpack", "assets.bin"))
+
+env.AddCustomTarget(
+    name="hosttest",
+    dependencies="$BUILD_DIR/${PROGNAME}${PROGSUFFIX}",
+    actions=[program + ' --test --corpus "{}"'.format(corpus) + assets,
+             program + ' --check "{}" --no-timing'.format(golden) + assets,
+             program + ' --check "{}" --no-timing --banded'.format(golden) + assets],
+    title="Host test",
+    description="Runs the host checks and checks the tiles against test/golden")
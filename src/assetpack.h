@@ -0,0 +1,122 @@
+// Asset pack: with ASSET_PACK defined (by scripts/pio_assetpack.py in the *_assets environments of platformio.ini)
+// the fonts and icons are not compiled into the app image, they are read from the "assets" flash partition.
+// scripts/assetpack.py builds the pack and assetpack_index.h, which declares every font and icon under its usual name
+// as reference into assetFonts and assetIcons. openAssetPack() in main.cpp maps the partition, loadAssetPack() points
+// the glyph tables, bitmaps and icon data straight into the mapping, nothing is copied. The host build maps a pack
+// file with mmap() instead (--assets <file>).
+//
+// Layout, little endian, all offsets from the start of the pack or of the asset:
+//   AssetPackHeader, AssetEntry[count], the assets 4 byte aligned
+//   font: AssetFont, GFXglyph[], UnicodeInterval[interval_count], the glyph bitmaps
+//   icon: AssetIcon, the encoded icon
+
+#include "assetpack_index.h"
+
+#define ASSET_MAGIC 0x31414148 // "HAA1"
+#define ASSET_NAME_SIZE 24
+#define ASSET_PARTITION_SUBTYPE 0x41 // custom data subtype of the "assets" partition in partitions.csv
+
+enum asset_type {ASSET_FONT, ASSET_ICON};
+
+struct AssetPackHeader{
+    uint32_t magic;
+    uint32_t count;   // entries
+    uint32_t size;    // bytes of the whole pack
+    uint32_t version;
+};
+
+struct AssetEntry{
+    char     name[ASSET_NAME_SIZE];
+    uint32_t type;
+    uint32_t offset;
+    uint32_t size;
+};
+
+struct AssetFont{
+    uint32_t glyphs;
+    uint32_t intervals;
+    uint32_t bitmap;
+    uint32_t interval_count;
+    uint32_t compressed;
+    int32_t  advance_y;
+    int32_t  ascender;
+    int32_t  descender;
+};
+
+struct AssetIcon{
+    uint16_t width;
+    uint16_t height;
+    uint32_t size;
+    uint32_t data;
+    int32_t  base; // entry of the icon this one is a delta to, -1 for none
+};
+
+const AssetEntry* findAsset(const uint8_t* pack, const char* name, uint32_t type)
+{
+    const AssetPackHeader* header = (const AssetPackHeader*)pack;
+    const AssetEntry* entries = (const AssetEntry*)(pack + sizeof(AssetPackHeader));
+    for (uint32_t i = 0; i < header->count; i++)
+    {
+        if (entries[i].type == type && strncmp(entries[i].name, name, ASSET_NAME_SIZE) == 0)
+            return &entries[i];
+    }
+    return NULL;
+}
+
+// fills assetFonts and assetIcons from the pack, false if it is not a pack or lacks an asset
+bool loadAssetPack(const uint8_t* pack, size_t size)
+{
+    const AssetPackHeader* header = (const AssetPackHeader*)pack;
+    if (size < sizeof(AssetPackHeader) || header->magic != ASSET_MAGIC || header->size > size ||
+        sizeof(AssetPackHeader) + header->count * sizeof(AssetEntry) > header->size)
+    {
+        Serial.println("Not an asset pack");
+        return false;
+    }
+    const AssetEntry* entries = (const AssetEntry*)(pack + sizeof(AssetPackHeader));
+    for (uint32_t i = 0; i < header->count; i++)
+    {
+        if (entries[i].offset % 4 != 0 || entries[i].offset + entries[i].size > header->size)
+        {
+            Serial.println("Asset " + String(i) + " is out of the pack");
+            return false;
+        }
+    }
+    bool complete = true;
+    for (int i = 0; i < ASSET_FONTS; i++)
+    {
+        const AssetEntry* entry = findAsset(pack, assetFontNames[i], ASSET_FONT);
+        const uint8_t* asset = entry != NULL ? pack + entry->offset : NULL;
+        const AssetFont* font = (const AssetFont*)asset;
+        if (entry == NULL || entry->size < sizeof(AssetFont) || font->bitmap > entry->size ||
+            font->intervals + font->interval_count * sizeof(UnicodeInterval) > font->bitmap)
+        {
+            Serial.println("Asset pack lacks font " + String(assetFontNames[i]));
+            complete = false;
+            continue;
+        }
+        assetFonts[i] = {(uint8_t*)(asset + font->bitmap), (GFXglyph*)(asset + font->glyphs), (UnicodeInterval*)(asset + font->intervals),
+                         font->interval_count, font->compressed != 0, (uint8_t)font->advance_y, font->ascender, font->descender};
+    }
+    for (int i = 0; i < ASSET_ICONS; i++)
+    {
+        const AssetEntry* entry = findAsset(pack, assetIconNames[i], ASSET_ICON);
+        const uint8_t* asset = entry != NULL ? pack + entry->offset : NULL;
+        const AssetIcon* icon = (const AssetIcon*)asset;
+        if (entry == NULL || entry->size < sizeof(AssetIcon) || icon->data + icon->size > entry->size ||
+            icon->base >= (int32_t)header->count)
+        {
+            Serial.println("Asset pack lacks icon " + String(assetIconNames[i]));
+            complete = false;
+            continue;
+        }
+        const Icon* base = NULL;
+        for (int b = 0; icon->base >= 0 && b < ASSET_ICONS; b++)
+        {
+            if (strncmp(entries[icon->base].name, assetIconNames[b], ASSET_NAME_SIZE) == 0)
+                base = &assetIcons[b];
+        }
+        assetIcons[i] = {icon->width, icon->height, icon->size, asset + icon->data, base};
+    }
+    return complete;
+}
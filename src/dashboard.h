@@ -0,0 +1,493 @@
+// Dashboard layout and tile drawing. Only depends on the entity getters, the drawing primitives and the values below,
+// so it is shared by the firmware (main.cpp) and the host build (native/main.cpp).
+
+#ifdef ASSET_PACK
+#include "assetpack.h"
+#else
+// Icons for Home Assistant
+#include "icons/waterheateron.h"
+#include "icons/waterheateroff.h"
+#include "icons/lightbulbon.h"
+#include "icons/lightbulboff.h"
+#include "icons/exhaustfanon.h"
+#include "icons/exhaustfanoff.h"
+#include "icons/fanoff.h"
+#include "icons/fanon.h"
+#include "icons/airpurifieron.h"
+#include "icons/airpurifieroff.h"
+#include "icons/plugon.h"
+#include "icons/plugoff.h"
+#include "icons/switchon.h"
+#include "icons/switchoff.h"
+#include "icons/airconditioneron.h"
+#include "icons/airconditioneroff.h"
+#include "icons/warning.h"
+#include "icons/plantwateringlow.h"
+#include "icons/plantwateringok.h"
+#include "icons/batteryempty.h"
+
+// sensor icons
+#include "icons/dooropen.h"
+#include "icons/doorclosed.h"
+#include "icons/windowopen.h"
+#include "icons/windowclosed.h"
+#include "icons/motionsensoron.h"
+#include "icons/motionsensoroff.h"
+#include "icons/sensorerror.h"
+#endif
+
+#define White 0xFF
+#define LightGrey 0xBB
+#define Grey 0x88
+#define DarkGrey 0x44
+#define Black 0x00
+
+#define TILE_IMG_WIDTH  100
+#define TILE_IMG_HEIGHT 100
+#define TILE_WIDTH      160
+#define TILE_HEIGHT     160
+#define TILE_GAP        6
+#define SENSOR_TILE_WIDTH      120
+#define SENSOR_TILE_HEIGHT     110
+#define SENSOR_TILE_IMG_WIDTH  64
+#define SENSOR_TILE_IMG_HEIGHT 64
+#define BOTTOM_TILE_WIDTH      240 // 4x = 240, 3x = 320
+#define BOTTOM_TILE_HEIGHT     90
+
+// if below, plant icon is changed to watering can icon
+#define WATERING_SOIL_LIMIT 75
+
+// status values and the current day of month (for the HIGROW update check), set by main.cpp before drawing
+int wifi_signal = 0;
+float battery_voltage = 0;
+uint8_t battery_percentage = 100;
+String dateStamp;
+String timeStamp;
+int    CurrentDay = 0;
+
+// defualt strings
+String str_unavail = "unavail.";
+
+void DrawBattery(int x, int y, uint8_t percentage)
+{
+  drawRect(x + 55, y - 15 , 40, 15, Black);
+  fillRect(x + 95, y - 9, 4, 6, Black);
+  if (percentage > 0)
+    fillRect(x + 57, y - 13, 36 * percentage / 100.0, 11, Black);
+}
+
+void DrawTileHigrow(int x, int y, int width, int height, const Icon &icon, String label, String soil, String temp, String batt)
+{
+  // the soil moisture is written over the icon, so the icon is always drawn as a whole
+  if (tileUnchanged(x, y, width, height, tileHash(currentFont, width, height, &icon, label, soil, temp, batt), &icon))
+    return;
+  drawRect(x, y, width, height, Black);
+  drawRect(x + 1, y + 1, width - 2, height - 2, Black);
+
+    // this assumes images are 100x100px size. make sure images are cropped to 100x100 before converting
+  int image_x = int((width - TILE_IMG_WIDTH)/2) + x;
+  int image_y = int((height - TILE_IMG_HEIGHT)/2) + y;
+  drawIcon(image_x, image_y, icon);
+
+  int label_txt_cursor_x = int(width / 2) + x;
+  int label_txt_cursor_y = y + 21;
+  drawString(label_txt_cursor_x, label_txt_cursor_y, label, CENTER);
+
+  if (batt != "-1")
+  {
+    int state_txt_cursor_x = width / 2 + x - 1;
+    int state_txt_cursor_y = image_y + TILE_IMG_HEIGHT - 21;
+    if (soil.toInt() < WATERING_SOIL_LIMIT)
+      state_txt_cursor_x += 15;
+    drawString(state_txt_cursor_x, state_txt_cursor_y, soil + "%", CENTER);
+
+    state_txt_cursor_x = x + 5;
+    state_txt_cursor_y = image_y + TILE_IMG_HEIGHT + 22;
+    drawString(state_txt_cursor_x, state_txt_cursor_y, temp + "° C", LEFT);
+
+    state_txt_cursor_x = x + width - 105;
+    DrawBattery(state_txt_cursor_x, state_txt_cursor_y, batt.toInt());
+    state_txt_cursor_x = x + width - 5;
+    state_txt_cursor_y -= 20;
+    GFXfont lastFont = currentFont;
+    setFont(OpenSans8B);
+    drawString(state_txt_cursor_x, state_txt_cursor_y, batt + "%", RIGHT);
+    setFont(lastFont);
+  }
+}
+
+// this will place a tile on screen that includes icon, staus and name of the HA entity, temperature and battery level
+void DrawTile(int x, int y, int width, int height, const Icon &icon, String label, String state)
+{
+  // this assumes images are 100x100px size. make sure images are cropped to 100x100 before converting
+  int image_x = int((width - TILE_IMG_WIDTH)/2) + x;
+  int image_y = int((height - TILE_IMG_HEIGHT)/2) + y;
+  const Icon *patchFrom;
+  if (tileUnchanged(x, y, width, height, tileHash(currentFont, width, height, &icon, label, state), &icon, &patchFrom, {image_x, image_y, TILE_IMG_WIDTH, TILE_IMG_HEIGHT}))
+    return;
+  drawRect(x, y, width, height, Black);
+  drawRect(x + 1, y + 1, width - 2, height - 2, Black);
+
+  if (patchFrom != NULL)
+    patchIcon(image_x, image_y, icon, *patchFrom);
+  else
+    drawIcon(image_x, image_y, icon);
+
+  int label_txt_cursor_x = int(width / 2) + x;
+  int label_txt_cursor_y = y + 21;
+  drawString(label_txt_cursor_x, label_txt_cursor_y, label, CENTER);
+
+  int state_txt_cursor_x = width / 2 + x;
+  int state_txt_cursor_y = image_y + TILE_IMG_HEIGHT + 10 + 12;
+  drawString(state_txt_cursor_x, state_txt_cursor_y, state, CENTER);
+}
+
+void DrawTempSensorTile(int x, int y, float temp, String label)
+{
+  int tile_width = SENSOR_TILE_WIDTH - TILE_GAP;
+  int tile_height = SENSOR_TILE_HEIGHT - TILE_GAP;
+  // the label is drawn in OpenSans9B, the temperature in OpenSans18B
+  if (tileUnchanged(x, y, tile_width, tile_height, tileHash(OpenSans18B, tile_width, tile_height, NULL, label, String(temp, 1))))
+    return;
+  drawRect(x, y, tile_width, tile_height, Black);
+  drawRect(x + 1, y + 1, tile_width - 2, tile_height - 2, Black);
+
+  int temp_x = int(tile_width / 2) + x;
+  int temp_y = int(tile_height / 2) + y + 10;
+  if (temp != 0)
+  {
+    setFont(OpenSans18B);
+    drawString(temp_x, temp_y, String(temp, 1) + "°", CENTER);
+  }
+  else
+  {
+    setFont(OpenSans9B);
+    drawString(temp_x, temp_y, str_unavail, CENTER);
+  }
+
+  int txt_cursor_x = int(tile_width / 2) + x;
+  int txt_cursor_y = y + 10 + SENSOR_TILE_IMG_HEIGHT + 10 + 12;
+  setFont(OpenSans9B);
+  drawString(txt_cursor_x, txt_cursor_y, label, CENTER);
+}
+
+// this will place a tile on screen that includes icon, staus and name of the HA entity
+void DrawSensorTile(int x, int y, int width, int height, const Icon &icon, String label)
+{
+  // this assumes images are 128x128px size. make sure images are cropped to 128x128 before converting
+  int image_x = int((width - SENSOR_TILE_IMG_WIDTH)/2) + x;
+  int image_y = y + 10;
+  const Icon *patchFrom;
+  if (tileUnchanged(x, y, width, height, tileHash(currentFont, width, height, &icon, label), &icon, &patchFrom, {image_x, image_y, SENSOR_TILE_IMG_WIDTH, SENSOR_TILE_IMG_HEIGHT}))
+    return;
+  drawRect(x, y, width, height, Black);
+  drawRect(x+1, y+1, width-2, height-2, Black);
+
+  if (patchFrom != NULL)
+    patchIcon(image_x, image_y, icon, *patchFrom);
+  else
+    drawIcon(image_x, image_y, icon);
+
+  int txt_cursor_x = int(width/2) + x;
+  int txt_cursor_y = image_y + SENSOR_TILE_IMG_HEIGHT + 10 + 12;
+  drawString(txt_cursor_x, txt_cursor_y, label, CENTER);
+}
+
+void DrawTile(int x, int y, int state, int type, String name, String value)
+{
+    int tile_width = TILE_WIDTH - TILE_GAP;
+    int tile_height = TILE_HEIGHT - TILE_GAP;
+
+    String state_txt = "OFF";
+    if (state == entity_state::ON) state_txt = "ON";
+    else if (state == entity_state::UNAVAILABLE) state_txt = "UNAVAILABLE";
+    switch (type)
+    {
+      case entity_type::SWITCH:
+        if (state == entity_state::ON) DrawTile(x,y,tile_width,tile_height,switchon_icon, name, state_txt);
+        else if (state == entity_state::OFF) DrawTile(x,y,tile_width,tile_height,switchoff_icon, name, state_txt);
+        else DrawTile(x,y,tile_width,tile_height,warning_icon, name, "SWITCH");
+        break;
+      case entity_type::LIGHT:
+        if (state == entity_state::ON)  DrawTile(x,y,tile_width,tile_height,lightbulbon_icon,name, state_txt);
+        else if (state == entity_state::OFF)  DrawTile(x,y,tile_width,tile_height,lightbulboff_icon,name, state_txt);
+        else DrawTile(x,y,tile_width,tile_height,warning_icon, name, "LIGHT");
+        break;
+      case entity_type::FAN:
+        if (state == entity_state::ON)  DrawTile(x,y,tile_width,tile_height,fanon_icon,name, state_txt);
+        else if (state == entity_state::OFF)  DrawTile(x,y,tile_width,tile_height,fanoff_icon,name, state_txt);
+        else DrawTile(x,y,tile_width,tile_height,warning_icon, name, "FAN");
+        break;
+    case entity_type::EXFAN:
+        if (state == entity_state::ON)  DrawTile(x,y,tile_width,tile_height,exhaustfanon_icon,name, state_txt);
+        else if (state == entity_state::OFF)  DrawTile(x,y,tile_width,tile_height,exhaustfanoff_icon,name, state_txt);
+        else DrawTile(x,y,tile_width,tile_height,warning_icon, name, "EXHAUST FAN");
+        break;
+      case entity_type::AIRPURIFIER:
+        if (state == entity_state::ON)  DrawTile(x,y,tile_width,tile_height,airpurifieron_icon,name, state_txt);
+        else if (state == entity_state::OFF)  DrawTile(x,y,tile_width,tile_height,airpurifieroff_icon,name, state_txt);
+        else DrawTile(x,y,tile_width,tile_height,warning_icon, name, "AIR PURIFIER");
+        break;
+      case entity_type::WATERHEATER:
+        if (state == entity_state::ON)  DrawTile(x,y,tile_width,tile_height,waterheateron_icon,name, state_txt);
+        else if (state == entity_state::OFF)  DrawTile(x,y,tile_width,tile_height,waterheateroff_icon,name, state_txt);
+        else DrawTile(x,y,tile_width,tile_height,warning_icon, name, "WATER HEATER");
+        break;
+      case entity_type::PLUG:
+        if (state == entity_state::ON)  DrawTile(x,y,tile_width,tile_height,plugon_icon,name, state_txt);
+        else if (state == entity_state::OFF)  DrawTile(x,y,tile_width,tile_height,plugoff_icon,name, state_txt);
+        else DrawTile(x,y,tile_width,tile_height,warning_icon, name, "PLUG");
+        break;
+      case entity_type::AIRCONDITIONER:
+        if (state == entity_state::ON)  DrawTile(x,y,tile_width,tile_height,airconditioneron_icon,name, state_txt);
+        else if (state == entity_state::OFF)  DrawTile(x,y,tile_width,tile_height,airconditioneroff_icon,name, state_txt);
+        else DrawTile(x,y,tile_width,tile_height,warning_icon, name, "AIR CONDITIONER");
+        break;
+      case entity_type::PLANT:
+        if (value.toInt() >= WATERING_SOIL_LIMIT) DrawTile(x, y, tile_width, tile_height, plantwateringok_icon, name, value + "%");
+        else if (value.toInt() > 5) DrawTile(x, y, tile_width, tile_height, plantwateringlow_icon, name, value + "%");
+        else DrawTile(x, y, tile_width, tile_height, warning_icon, name, value + "%");
+        break;
+      default:
+        break;
+    }
+}
+
+void DrawTileHigrow(int x, int y, int state, int type, String name, String soil, String temp, String batt)
+{
+    int tile_width = TILE_WIDTH - TILE_GAP;
+    int tile_height = TILE_HEIGHT - TILE_GAP;
+
+    if (batt.toInt() == -1) DrawTileHigrow(x, y, tile_width, tile_height, batteryempty_icon, name, soil, temp, batt);
+    else if (soil.toInt() >= WATERING_SOIL_LIMIT) DrawTileHigrow(x, y, tile_width, tile_height, plantwateringok_icon, name, soil, temp, batt);
+    else if (soil.toInt() > 5) DrawTileHigrow(x, y, tile_width, tile_height, plantwateringlow_icon, name, soil, temp, batt);
+    else DrawTileHigrow(x, y, tile_width, tile_height, warning_icon, name, soil, temp, batt);
+}
+
+void DrawSensorTile(int x, int y, int state, int type, String name)
+{
+    int tile_width = SENSOR_TILE_WIDTH - TILE_GAP;
+    int tile_height = SENSOR_TILE_HEIGHT - TILE_GAP;
+    switch (type)
+    {
+      case sensor_type::DOOR:
+        if (state == entity_state::ON) DrawSensorTile(x,y,tile_width,tile_height,dooropen_icon, name);
+        else if (state == entity_state::OFF) DrawSensorTile(x,y,tile_width,tile_height,doorclosed_icon, name);
+        else DrawSensorTile(x,y,tile_width,tile_height,sensorerror_icon, name);
+        break;
+      case sensor_type::WINDOW:
+        if (state == entity_state::ON) DrawSensorTile(x,y,tile_width,tile_height,windowopen_icon, name);
+        else if (state == entity_state::OFF) DrawSensorTile(x,y,tile_width,tile_height,windowclosed_icon, name);
+        else DrawSensorTile(x,y,tile_width,tile_height,sensorerror_icon, name);
+        break;
+      case sensor_type::MOTION:
+        if (state == entity_state::ON) DrawSensorTile(x,y,tile_width,tile_height,motionsensoron_icon, name);
+        else if (state == entity_state::OFF) DrawSensorTile(x,y,tile_width,tile_height,motionsensoroff_icon, name);
+        else DrawSensorTile(x,y,tile_width,tile_height,sensorerror_icon, name);
+        break;
+      default:
+        break;
+    }
+}
+
+void DrawBottomTile(int x, int y, String value, String name)
+{
+    int tile_width = BOTTOM_TILE_WIDTH - TILE_GAP;
+    int tile_height = BOTTOM_TILE_HEIGHT - TILE_GAP;
+    // the value is drawn in OpenSans24B, the name in OpenSans9B
+    if (tileUnchanged(x, y, tile_width, tile_height, tileHash(OpenSans24B, tile_width, tile_height, NULL, value, name)))
+        return;
+    drawRect(x, y, tile_width, tile_height, Black);
+    drawRect(x+1, y+1, tile_width-2, tile_height-2, Black);
+    setFont(OpenSans24B);
+    drawString(int(tile_width/2) + x, 508, value, CENTER);
+    setFont(OpenSans9B);
+    drawString(int(tile_width/2) + x, 532, name, CENTER);
+}
+
+void DrawBottomBar()
+{
+    int tiles = sizeof(haFloatSensors);
+    float totalEnergy = 0;
+    float totalPower  = 0;
+    String totalEnergyName;
+    String totaPowerName;
+    for (int i = 0; i < (sizeof(haFloatSensors) / sizeof(haFloatSensors[0])); i++){
+        if (haFloatSensors[i].entityType == sensor_type::ENERGYMETER)
+        {
+            if (!haAggregates.valid)
+                totalEnergy = totalEnergy + getSensorFloatValue(haFloatSensors[i].entityID);
+            totalEnergyName = haFloatSensors[i].entityName;
+        }
+        else if (haFloatSensors[i].entityType == sensor_type::ENERGYMETERPWR)
+        {
+            if (!haAggregates.valid)
+                totalPower = totalPower + getSensorFloatValue(haFloatSensors[i].entityID);
+            totaPowerName = haFloatSensors[i].entityName;
+        }
+    }
+    if (haAggregates.valid)
+    {
+        totalEnergy = haAggregates.totalEnergy;
+        totalPower  = haAggregates.totalPower;
+    }
+    int x = 3;
+    int y = 456;
+    // first one
+    if (totalEnergy != 0)
+    {
+        DrawBottomTile(x, y, String(totalEnergy) + " kWh", totalEnergyName);
+        x = x + BOTTOM_TILE_WIDTH;
+        tiles--;
+    }
+    if (totalPower != 0)
+    {
+        DrawBottomTile(x, y, String((int)totalPower) + " W", totaPowerName);
+        x = x + BOTTOM_TILE_WIDTH;
+        tiles--;
+    }
+
+    for (int i = 0; i < (sizeof(haFloatSensors) / sizeof(haFloatSensors[0])); i++){
+        if (haFloatSensors[i].entityType == sensor_type::TEMP && tiles >= 1)
+        {
+            float temp = 0;
+            if (haAggregates.valid)
+                temp = haAggregates.temperatures[i];
+            else
+            {
+                temp = getSensorAttributeValue(haFloatSensors[i].entityID, "current_temperature").toFloat();
+                if (temp == 0)
+                    temp = getSensorFloatValue(haFloatSensors[i].entityID);
+            }
+            if (temp != 0)
+              DrawBottomTile(x, y, String(temp, 1) + "° C", haFloatSensors[i].entityName);
+            else
+              DrawBottomTile(x, y, str_unavail, haFloatSensors[i].entityName);
+            x = x + BOTTOM_TILE_WIDTH;
+            tiles--;
+        }
+    }
+    // positions that are no longer used would keep the tiles of the previous frame
+    if (x < EPD_WIDTH)
+        clearTileArea({.x = x, .y = y, .width = EPD_WIDTH - x, .height = BOTTOM_TILE_HEIGHT - TILE_GAP});
+}
+
+void DrawSwitchBarTile(int i)
+{
+    setFont(OpenSans9B);
+    int x = 3 + (i % 6) * TILE_WIDTH;  // 6 columns
+    int y = 23 + (i / 6) * TILE_HEIGHT; // 2 rows
+    if (haEntities[i].entityName != "") {
+      if (haEntities[i].entityType == entity_type::SWITCH ||
+          haEntities[i].entityType == entity_type::LIGHT ||
+          haEntities[i].entityType == entity_type::PLUG ||
+          haEntities[i].entityType == entity_type::EXFAN ||
+          haEntities[i].entityType == entity_type::FAN ||
+          haEntities[i].entityType == entity_type::AIRPURIFIER ||
+          haEntities[i].entityType == entity_type::WATERHEATER ||
+          haEntities[i].entityType == entity_type::AIRCONDITIONER)
+      {
+          DrawTile(x, y, checkOnOffState(haEntities[i].entityID), haEntities[i].entityType, haEntities[i].entityName, "");
+      }
+      else if (haEntities[i].entityType == entity_type::HIGROW)
+      {
+          String soilVal = getSensorValue(haEntities[i].entityID+"_soil");
+          String tempVal = String(getSensorFloatValue(haEntities[i].entityID+"_temperature"), 1);
+          String battVal = getSensorValue(haEntities[i].entityID+"_battery");
+
+          String lastUpdate = getSensorValue(haEntities[i].entityID+"_updated");
+          int splitT = lastUpdate.indexOf("T");
+          String lastUpdateDate = lastUpdate.substring(0, splitT);
+          String lastUpdateDayStr = lastUpdateDate.substring(8,10);
+          int lastUpdateDay = lastUpdateDayStr.toInt();
+          if (lastUpdateDay != CurrentDay && lastUpdateDay != CurrentDay-1) // todo: what about end of month? Let's ignore that for now
+          {
+            Serial.println("Batt of " + haEntities[i].entityID + " last value " + battVal + ", last update on day " + lastUpdateDay + " != today (" + CurrentDay + ") or yesterday (" + (CurrentDay - 1) + ") - battery might be empty");
+            DrawTileHigrow(x, y, 0, haEntities[i].entityType, haEntities[i].entityName, soilVal, tempVal, "-1"); // presume battery empty
+          }
+          else
+          {
+            DrawTileHigrow(x, y, 0, haEntities[i].entityType, haEntities[i].entityName, soilVal, tempVal, battVal);
+          }
+      }
+      else
+      {
+          String val = getSensorValue(haEntities[i].entityID);
+          DrawTile(x, y, 0, haEntities[i].entityType, haEntities[i].entityName, val);
+      }
+    }
+}
+
+void DrawSensorBarTile(int i)
+{
+    setFont(OpenSans9B);
+    int x = 3 + i * SENSOR_TILE_WIDTH;
+    int y = 345;
+    if ((haSensors[i].entityType == sensor_type::DOOR ||
+        haSensors[i].entityType == sensor_type::WINDOW ||
+        haSensors[i].entityType == sensor_type::MOTION ) && haSensors[i].entityName != "")
+    {
+        DrawSensorTile(x,y,checkOnOffState(haSensors[i].entityID),haSensors[i].entityType, haSensors[i].entityName);
+    }
+    if (haSensors[i].entityType == sensor_type::TEMP && haSensors[i].entityName != "")
+    {
+        float temp = getSensorAttributeValue(haSensors[i].entityID, "current_temperature").toFloat();
+        if (temp == 0)
+            temp = getSensorFloatValue(haSensors[i].entityID);
+        DrawTempSensorTile(x, y, temp, haSensors[i].entityName);
+    }
+}
+
+void DrawRSSI(int x, int y, int rssi) {
+  int WIFIsignal = 0;
+  int xpos = 1;
+  for (int _rssi = -100; _rssi <= rssi; _rssi = _rssi + 20) {
+    if (_rssi <= -20)  WIFIsignal = 20; //            <-20dbm displays 5-bars
+    if (_rssi <= -40)  WIFIsignal = 16; //  -40dbm to  -21dbm displays 4-bars
+    if (_rssi <= -60)  WIFIsignal = 12; //  -60dbm to  -41dbm displays 3-bars
+    if (_rssi <= -80)  WIFIsignal = 8; //  -80dbm to  -61dbm displays 2-bars
+    if (_rssi <= -100) WIFIsignal = 4;  // -100dbm to  -81dbm displays 1-bar
+
+    if (rssi != 0)
+      fillRect(x + xpos * 8, y - WIFIsignal, 6, WIFIsignal, Black);
+    else // draw empty bars
+      drawRect(x + xpos * 8, y - WIFIsignal, 6, WIFIsignal, Black);
+    xpos++;
+  }
+  if (rssi == 0)
+    drawString(x , y, "x", LEFT);
+}
+
+void DrawBattery(int x, int y) {
+  if (battery_voltage > 0) {
+    DrawBattery(x, y, battery_percentage);
+    drawString(x, y, String(battery_percentage) + "%", LEFT);
+    drawString(x + 130, y,  String(battery_voltage, 2) + "v", CENTER);
+  }
+}
+
+// number of filled bars drawn by DrawRSSI
+int RSSIBars(int rssi) {
+  if (rssi == 0 || rssi < -100)
+    return 0;
+  return (rssi + 100) / 20 + 1;
+}
+
+void DisplayGeneralInfoSection(const HAConfigurations& haConfigs)
+{
+    setFont(OpenSans8B);
+    Serial.println("drawing status line...");
+    drawString(EPD_WIDTH/2, 18, dateStamp + " - " +  timeStamp + " (HA Ver:" + haConfigs.version + "/" + haConfigs.haStatus + ", TZ:" + haConfigs.timeZone + ")", CENTER);
+}
+
+void DisplayStatusSection() {
+  setFont(OpenSans8B);
+  DrawBattery(5, 18);
+  DrawRSSI(900, 18, wifi_signal);
+}
+
+// the screen shown when there is no WiFi: only the battery and signal in the status line
+void DrawWifiErrorFrame() {
+  fillRect(0, 0, EPD_WIDTH, EPD_HEIGHT, White);
+  DisplayStatusSection();
+}
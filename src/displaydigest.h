@@ -0,0 +1,90 @@
+// Change detection between wakes: a FNV-1a digest of everything that is shown on the panel is kept in RTC slow memory,
+// which survives deep sleep. When the digest of the freshly fetched values matches, the redraw is skipped and the
+// panel is not powered at all. The clock in the status line is not part of the digest.
+
+RTC_DATA_ATTR uint32_t lastDisplayDigest = 0;
+RTC_DATA_ATTR bool     lastDisplayDigestValid = false; // false after power on and after anything else was drawn
+RTC_DATA_ATTR unsigned long lastRedrawEpoch = 0;
+
+#define FNV_OFFSET_BASIS 2166136261u
+#define FNV_PRIME        16777619u
+
+uint32_t fnv1a(uint32_t hash, const void* data, size_t length)
+{
+    const uint8_t* bytes = (const uint8_t*)data;
+    for (size_t i = 0; i < length; i++)
+    {
+        hash ^= bytes[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+uint32_t fnv1a(uint32_t hash, const char* text)
+{
+    // including the terminator, so "ab","c" and "a","bc" differ
+    return fnv1a(hash, text, strlen(text) + 1);
+}
+
+uint32_t fnv1a(uint32_t hash, const String& text)
+{
+    return fnv1a(hash, text.c_str());
+}
+
+// digest of the cached entities, the server side aggregates and the HA config, plus the given status values
+uint32_t computeDisplayDigest(const HAConfigurations& haConfigs, int batteryPercentage, int wifiBars)
+{
+    uint32_t hash = FNV_OFFSET_BASIS;
+    for (int i = 0; i < haCacheCount; i++)
+    {
+        const HAEntityCacheEntry& entry = haCache[i];
+        hash = fnv1a(hash, entry.entityID);
+        hash = fnv1a(hash, &entry.found, sizeof(entry.found));
+        if (!entry.found)
+            continue;
+        hash = fnv1a(hash, entry.value.state);
+        hash = fnv1a(hash, entry.value.lastChanged);
+        for (int a = 0; a < HA_CACHED_ATTRIBUTES; a++)
+            hash = fnv1a(hash, entry.value.attributes[a]);
+    }
+    hash = fnv1a(hash, &haAggregates.valid, sizeof(haAggregates.valid));
+    if (haAggregates.valid)
+    {
+        // compared as rounded in the bottom bar
+        hash = fnv1a(hash, String(haAggregates.totalEnergy, 2));
+        hash = fnv1a(hash, String((int)haAggregates.totalPower));
+        for (int i = 0; i < ARRAY_SIZE(haFloatSensors); i++)
+            hash = fnv1a(hash, String(haAggregates.temperatures[i], 1));
+    }
+    hash = fnv1a(hash, haConfigs.haStatus);
+    hash = fnv1a(hash, haConfigs.timeZone);
+    hash = fnv1a(hash, haConfigs.version);
+    hash = fnv1a(hash, &batteryPercentage, sizeof(batteryPercentage));
+    hash = fnv1a(hash, &wifiBars, sizeof(wifiBars));
+    return hash;
+}
+
+// true if the panel has to be redrawn: the digest differs, there is no digest yet or the last redraw is too old
+bool displayChanged(uint32_t digest, unsigned long epoch)
+{
+    if (!lastDisplayDigestValid || digest != lastDisplayDigest)
+        return true;
+    if (redraw_max_interval_sec == 0 || epoch - lastRedrawEpoch >= redraw_max_interval_sec)
+    {
+        Serial.println("Nothing changed, but last redraw was " + String(epoch - lastRedrawEpoch) + "s ago");
+        return true;
+    }
+    return false;
+}
+
+void storeDisplayDigest(uint32_t digest, unsigned long epoch)
+{
+    lastDisplayDigest = digest;
+    lastDisplayDigestValid = true;
+    lastRedrawEpoch = epoch;
+}
+
+void invalidateDisplayDigest()
+{
+    lastDisplayDigestValid = false;
+}
@@ -2,68 +2,1051 @@ enum alignment {LEFT, RIGHT, CENTER};
 uint8_t *framebuffer;
 GFXfont  currentFont;
 
+// Damage tracking: every primitive records its bounding box, overlapping boxes are merged. epd_update() compares
+// the damaged areas of the framebuffer with the frame that is on the panel and only pushes what really changed.
+#define MAX_DAMAGE_RECTS 32
+
+uint8_t *previousFramebuffer;         // what the panel shows, only valid if previousFramebufferValid
+bool     previousFramebufferValid = false;
+bool     panelUpdated = false;        // epd_update() changed the panel during this wake
+Rect_t   damageRects[MAX_DAMAGE_RECTS];
+int      damageCount = 0;
+RTC_DATA_ATTR int partialUpdateCount = 0; // partial updates since the last full refresh
+// Areas of the frame on the panel that can hold anything but white. The framebuffer starts white on every wake,
+// so when the previous frame was restored from the frame store these areas have to be compared as well.
+RTC_DATA_ATTR Rect_t panelContentRects[MAX_DAMAGE_RECTS];
+RTC_DATA_ATTR int    panelContentCount = 0;
+
+bool rectsOverlap(const Rect_t &a, const Rect_t &b) {
+  return a.x < b.x + b.width && b.x < a.x + a.width && a.y < b.y + b.height && b.y < a.y + a.height;
+}
+
+Rect_t rectUnion(const Rect_t &a, const Rect_t &b) {
+  int x = min(a.x, b.x);
+  int y = min(a.y, b.y);
+  return {.x = x, .y = y, .width = max(a.x + a.width, b.x + b.width) - x, .height = max(a.y + a.height, b.y + b.height) - y};
+}
+
+void markDamage(int x, int y, int width, int height) {
+  // clip to the screen and widen to even x/width, the framebuffer holds two pixels per byte
+  int x2 = min(x + width, EPD_WIDTH);
+  int y2 = min(y + height, EPD_HEIGHT);
+  x = max(x, 0) & ~1;
+  y = max(y, 0);
+  x2 = min(x2 + (x2 & 1), EPD_WIDTH);
+  if (x2 <= x || y2 <= y)
+    return;
+  Rect_t rect = {.x = x, .y = y, .width = x2 - x, .height = y2 - y};
+
+  // merge with every overlapping rect, the union may overlap further ones
+  for (int i = 0; i < damageCount; i++) {
+    if (rectsOverlap(rect, damageRects[i])) {
+      rect = rectUnion(rect, damageRects[i]);
+      damageRects[i] = damageRects[--damageCount];
+      i = -1;
+    }
+  }
+  if (damageCount == MAX_DAMAGE_RECTS) {
+    // full, merge into the rect that grows the least
+    int best = 0;
+    long bestGrowth = LONG_MAX;
+    for (int i = 0; i < damageCount; i++) {
+      Rect_t merged = rectUnion(rect, damageRects[i]);
+      long growth = (long)merged.width * merged.height - (long)damageRects[i].width * damageRects[i].height;
+      if (growth < bestGrowth) {
+        bestGrowth = growth;
+        best = i;
+      }
+    }
+    rect = rectUnion(rect, damageRects[best]);
+    damageRects[best] = damageRects[--damageCount];
+    markDamage(rect.x, rect.y, rect.width, rect.height);
+    return;
+  }
+  damageRects[damageCount++] = rect;
+}
+
+// Rows the primitives draw to: the framebuffer, or the strip of the band while a display list is rasterised
+uint8_t *band = NULL;
+int      bandTop = 0;
+int      bandBottom = EPD_HEIGHT;
+
+uint8_t *framebufferRow(int y) {
+  return band != NULL ? band + (y - bandTop) * EPD_WIDTH / 2 : framebuffer + y * EPD_WIDTH / 2;
+}
+
+// Display list: between beginDisplayList() and endDisplayList() the drawing functions record commands instead of
+// drawing. The list is then rasterised one band of band_height rows at a time into a strip in internal SRAM, every
+// finished strip is copied to the framebuffer in PSRAM, so the blits do not pay the PSRAM latency. Lines, circles
+// and triangles are drawn by the library straight into the framebuffer, they rasterise what was recorded so far
+// first. A full list is rasterised as well and recording goes on.
+// Before rasterising, commands whose bounds a later fill, image or icon paints over completely are culled, and the
+// rest is bucketed by band in the order they were recorded. The damage is marked from the bounds of the commands
+// that are drawn. A rect outline right inside the previous one of the same color widens that outline.
+#define DISPLAY_LIST_COMMANDS 256
+#define DISPLAY_LIST_TEXT     2048
+#define DISPLAY_LIST_ICONS    64
+#define DISPLAY_LIST_FONTS    8
+#define DISPLAY_LIST_ENTRIES  1024 // commands in all band buckets together, a command is in every band it touches
+
+enum draw_op {DRAW_FILL, DRAW_RECT, DRAW_VLINE, DRAW_TEXT, DRAW_IMAGE, DRAW_ICON, DRAW_PATCH};
+
+struct DrawCommand {
+  Rect_t      bounds; // every pixel the command draws, clipped to the screen
+  uint8_t     op;
+  uint8_t     color;
+  uint8_t     font;   // DRAW_TEXT: index into displayListFonts
+  uint8_t     thickness; // DRAW_RECT: rows and columns of the outline
+  bool        culled; // painted over by a later command
+  int16_t     x, y;   // DRAW_TEXT: left end of the baseline
+  int16_t     width;  // DRAW_TEXT: bytes of text, DRAW_ICON/DRAW_PATCH: index into iconCursors
+  int16_t     height;
+  const void *data;   // text, image or Icon
+};
+
+bool          displayListRecording = false;
+DrawCommand   displayList[DISPLAY_LIST_COMMANDS];
+int           displayListCount = 0;
+char          displayListText[DISPLAY_LIST_TEXT];
+int           displayListTextUsed = 0;
+GFXfont       displayListFonts[DISPLAY_LIST_FONTS];
+int           displayListFontCount = 0;
+int           displayListIcons = 0;
+int           displayListEntries = 0;
+uint16_t      bandBuckets[DISPLAY_LIST_ENTRIES]; // the commands of every band, band after band
+uint16_t      bandStarts[EPD_HEIGHT + 1];         // first entry of every band in bandBuckets
+uint16_t      bandEnds[EPD_HEIGHT];
+uint8_t      *bandBuffer = NULL;
+unsigned long displayListUs = 0; // time spent rasterising since beginDisplayList()
+int           displayListBands = 0;
+int           displayListCommands = 0;
+int           displayListCulled = 0;
+int           displayListMerged = 0;
+
+void rasteriseDisplayList();
+
+int findDisplayListFont() {
+  for (int i = 0; i < displayListFontCount; i++) {
+    if (displayListFonts[i].glyph == currentFont.glyph)
+      return i;
+  }
+  return -1;
+}
+
+// clips the bounds to the screen, false if nothing is left
+bool clipToScreen(Rect_t &bounds) {
+  int x2 = min(bounds.x + bounds.width, EPD_WIDTH);
+  int y2 = min(bounds.y + bounds.height, EPD_HEIGHT);
+  bounds.x = max(bounds.x, 0);
+  bounds.y = max(bounds.y, 0);
+  bounds.width = x2 - bounds.x;
+  bounds.height = y2 - bounds.y;
+  return bounds.width > 0 && bounds.height > 0;
+}
+
+int bandsSpanned(const Rect_t &bounds) {
+  return (bounds.y + bounds.height - 1) / band_height - bounds.y / band_height + 1;
+}
+
+// appends a command, the list is rasterised first if it has no room for the command, its text, icon or font
+DrawCommand &recordCommand(uint8_t op, const Rect_t &bounds, int text = 0) {
+  if (displayListCount == DISPLAY_LIST_COMMANDS || displayListTextUsed + text > DISPLAY_LIST_TEXT ||
+      displayListEntries + bandsSpanned(bounds) > DISPLAY_LIST_ENTRIES ||
+      ((op == DRAW_ICON || op == DRAW_PATCH) && displayListIcons == DISPLAY_LIST_ICONS) ||
+      (op == DRAW_TEXT && displayListFontCount == DISPLAY_LIST_FONTS && findDisplayListFont() < 0))
+    rasteriseDisplayList();
+  DrawCommand &command = displayList[displayListCount++];
+  command.op = op;
+  command.bounds = bounds;
+  command.thickness = 1;
+  displayListEntries += bandsSpanned(bounds);
+  return command;
+}
+
+void recordShape(uint8_t op, int x, int y, int w, int h, uint8_t color) {
+  Rect_t bounds = {.x = x, .y = y, .width = w, .height = h};
+  if (!clipToScreen(bounds))
+    return;
+  if (op == DRAW_RECT && displayListCount > 0 && w > 0 && h > 0) {
+    // the tiles draw their border as two outlines, one inside the other
+    DrawCommand &previous = displayList[displayListCount - 1];
+    int t = previous.thickness;
+    if (previous.op == DRAW_RECT && previous.color == color && x == previous.x + t && y == previous.y + t &&
+        w == previous.width - 2 * t && h == previous.height - 2 * t) {
+      previous.thickness++;
+      displayListMerged++;
+      return;
+    }
+  }
+  DrawCommand &command = recordCommand(op, bounds);
+  command.color = color;
+  command.x = x;
+  command.y = y;
+  command.width = w;
+  command.height = h;
+}
+
 void setFont(GFXfont const & font) {
   currentFont = font;
 }
 
-void drawString(int x, int y, String text, alignment align) {
-  char * data  = const_cast<char*>(text.c_str());
-  int  x1, y1; //the bounds of x,y and w and h of the variable 'text' in pixels.
-  int w, h;
-  int xx = x, yy = y;
-  get_text_bounds(&currentFont, data, &xx, &yy, &x1, &y1, &w, &h, NULL);
+// Text layout: the glyphs of a string are looked up once, which gives the width for the alignment, and then blitted
+// straight into the framebuffer. Lookups of printable ASCII are cached per font, the interval table of a font is
+// only searched when its cache slot is filled and for anything outside of ASCII.
+#define GLYPH_CACHE_FONTS 8
+#define GLYPH_CACHE_FIRST 0x20
+#define GLYPH_CACHE_LAST  0x7E
+#define MAX_TEXT_GLYPHS   96
+
+struct GlyphCache {
+  const GFXglyph *font; // glyph table of the font the slot was filled for
+  const GFXglyph *glyphs[GLYPH_CACHE_LAST - GLYPH_CACHE_FIRST + 1];
+};
+
+GlyphCache glyphCaches[GLYPH_CACHE_FONTS];
+
+const GFXglyph *findGlyph(const GFXfont &font, uint32_t cp) {
+  for (uint32_t i = 0; i < font.interval_count; i++) {
+    const UnicodeInterval &interval = font.intervals[i];
+    if (cp >= interval.first && cp <= interval.last)
+      return &font.glyph[interval.offset + (cp - interval.first)];
+    if (cp < interval.first)
+      break;
+  }
+  return NULL;
+}
+
+GlyphCache &glyphCache(const GFXfont &font) {
+  GlyphCache &cache = glyphCaches[((uintptr_t)font.glyph >> 4) % GLYPH_CACHE_FONTS];
+  if (cache.font != font.glyph) {
+    cache.font = font.glyph;
+    for (uint32_t cp = GLYPH_CACHE_FIRST; cp <= GLYPH_CACHE_LAST; cp++)
+      cache.glyphs[cp - GLYPH_CACHE_FIRST] = findGlyph(font, cp);
+  }
+  return cache;
+}
+
+// glyph of the code point, '?' for code points the font does not have
+const GFXglyph *lookupGlyph(const GFXfont &font, GlyphCache &cache, uint32_t cp) {
+  const GFXglyph *glyph = cp >= GLYPH_CACHE_FIRST && cp <= GLYPH_CACHE_LAST ? cache.glyphs[cp - GLYPH_CACHE_FIRST] : findGlyph(font, cp);
+  return glyph != NULL ? glyph : cache.glyphs['?' - GLYPH_CACHE_FIRST];
+}
+
+// decodes the UTF-8 sequence at text, advances text
+uint32_t nextCodePoint(const char *&text, const char *end) {
+  uint32_t cp = (uint8_t)*text++;
+  int follow = cp >= 0xF0 ? 3 : cp >= 0xE0 ? 2 : cp >= 0xC0 ? 1 : 0;
+  if (follow)
+    cp &= 0x3F >> follow;
+  while (follow-- && text < end && (*text & 0xC0) == 0x80)
+    cp = (cp << 6) | (*text++ & 0x3F);
+  return cp;
+}
+
+// A glyph byte holds two pixels with their coverage, like a framebuffer byte holds two pixels. Pixels with coverage
+// are drawn as 15 - coverage, the others keep the framebuffer: byte = (byte & glyphKeep[b]) | glyphInk[b].
+uint8_t glyphInk[256];
+uint8_t glyphKeep[256];
+bool    glyphMasksReady = false;
+
+void initGlyphMasks() {
+  for (int b = 0; b < 256; b++) {
+    glyphInk[b] = 0;
+    glyphKeep[b] = 0xFF;
+    if (b & 0x0F) {
+      glyphInk[b] |= 15 - (b & 0x0F);
+      glyphKeep[b] &= 0xF0;
+    }
+    if (b & 0xF0) {
+      glyphInk[b] |= (15 - (b >> 4)) << 4;
+      glyphKeep[b] &= 0x0F;
+    }
+  }
+  glyphMasksReady = true;
+}
+
+// Compressed fonts (fontconvert.py or fontsubset.py --compress) hold every glyph as zlib stream, which the library
+// inflates on every draw. They are inflated into a cache in internal RAM instead. When it is full, the least recently
+// used glyph goes first, the hot ones (digits, uppercase, '%' and '°' of the values) only when nothing else is left.
+#define GLYPH_BITMAP_CACHE_BYTES   16384
+#define GLYPH_BITMAP_CACHE_ENTRIES 128
+
+struct CachedGlyph {
+  const GFXglyph *glyph;
+  uint32_t offset; // of the bitmap in glyphBitmapCache
+  uint16_t size;
+  bool     hot;
+  uint32_t lastUse;
+};
+
+uint8_t            *glyphBitmapCache = NULL;
+tinfl_decompressor *glyphInflater = NULL;
+CachedGlyph         cachedGlyphs[GLYPH_BITMAP_CACHE_ENTRIES];
+int                 cachedGlyphCount = 0;
+uint32_t            glyphBitmapCacheUsed = 0;
+uint32_t            glyphCacheClock = 0;
+unsigned long       glyphCacheHits = 0, glyphCacheMisses = 0, glyphInflateUs = 0;
+
+bool hotCodePoint(const GFXfont &font, const GFXglyph *glyph) {
+  uint32_t index = glyph - font.glyph;
+  for (uint32_t i = 0; i < font.interval_count; i++) {
+    const UnicodeInterval &interval = font.intervals[i];
+    if (index >= interval.offset && index <= interval.offset + interval.last - interval.first) {
+      uint32_t cp = interval.first + index - interval.offset;
+      return (cp >= '0' && cp <= '9') || (cp >= 'A' && cp <= 'Z') || cp == '%' || cp == 0xB0;
+    }
+  }
+  return false;
+}
+
+// drops a glyph and moves the bitmaps behind it down, so the free space stays in one piece
+void evictCachedGlyph() {
+  int victim = 0;
+  for (int i = 1; i < cachedGlyphCount; i++) {
+    const CachedGlyph &entry = cachedGlyphs[i];
+    if (entry.hot != cachedGlyphs[victim].hot ? !entry.hot : entry.lastUse < cachedGlyphs[victim].lastUse)
+      victim = i;
+  }
+  CachedGlyph removed = cachedGlyphs[victim];
+  memmove(glyphBitmapCache + removed.offset, glyphBitmapCache + removed.offset + removed.size,
+          glyphBitmapCacheUsed - removed.offset - removed.size);
+  glyphBitmapCacheUsed -= removed.size;
+  cachedGlyphs[victim] = cachedGlyphs[--cachedGlyphCount];
+  for (int i = 0; i < cachedGlyphCount; i++)
+    if (cachedGlyphs[i].offset > removed.offset)
+      cachedGlyphs[i].offset -= removed.size;
+}
+
+// the uncompressed bitmap of a glyph of the current font, NULL if it cannot be inflated
+const uint8_t *glyphBitmap(const GFXglyph *glyph) {
+  if (!currentFont.compressed)
+    return currentFont.bitmap + glyph->data_offset;
+  size_t size = (glyph->width + 1) / 2 * glyph->height;
+  if (size == 0)
+    return currentFont.bitmap;
+  if (size > GLYPH_BITMAP_CACHE_BYTES)
+    return NULL;
+  glyphCacheClock++;
+  for (int i = 0; i < cachedGlyphCount; i++) {
+    if (cachedGlyphs[i].glyph == glyph) {
+      cachedGlyphs[i].lastUse = glyphCacheClock;
+      glyphCacheHits++;
+      return glyphBitmapCache + cachedGlyphs[i].offset;
+    }
+  }
+  if (glyphBitmapCache == NULL) {
+    glyphBitmapCache = (uint8_t *)heap_caps_malloc(GLYPH_BITMAP_CACHE_BYTES, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (glyphBitmapCache == NULL)
+      return NULL;
+  }
+  if (glyphInflater == NULL) {
+    glyphInflater = (tinfl_decompressor *)heap_caps_malloc(sizeof(tinfl_decompressor), MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+    if (glyphInflater == NULL)
+      return NULL;
+  }
+  while (cachedGlyphCount == GLYPH_BITMAP_CACHE_ENTRIES || glyphBitmapCacheUsed + size > GLYPH_BITMAP_CACHE_BYTES)
+    evictCachedGlyph();
+  unsigned long start = micros();
+  uint8_t *bitmap = glyphBitmapCache + glyphBitmapCacheUsed;
+  size_t in = glyph->compressed_size, out = size;
+  tinfl_init(glyphInflater);
+  tinfl_status status = tinfl_decompress(glyphInflater, currentFont.bitmap + glyph->data_offset, &in, bitmap, bitmap, &out,
+                                         TINFL_FLAG_PARSE_ZLIB_HEADER | TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF);
+  glyphInflateUs += micros() - start;
+  glyphCacheMisses++;
+  if (status != TINFL_STATUS_DONE || out != size)
+    return NULL;
+  cachedGlyphs[cachedGlyphCount++] = {glyph, glyphBitmapCacheUsed, (uint16_t)size, hotCodePoint(currentFont, glyph), glyphCacheClock};
+  glyphBitmapCacheUsed += size;
+  return bitmap;
+}
+
+void printGlyphCacheStats() {
+  Serial.println("Glyph cache: " + String(cachedGlyphCount) + " glyphs in " + String(glyphBitmapCacheUsed) + " bytes, " +
+                 String(glyphCacheHits) + " hits, " + String(glyphCacheMisses) + " misses, inflated in " + String(glyphInflateUs) + "us");
+}
+
+// draws a glyph with its origin at cursor_x/cursor_y, like the library does
+void blitGlyph(const GFXglyph *glyph, int cursor_x, int cursor_y) {
+  const uint8_t *bitmap = glyphBitmap(glyph);
+  if (bitmap == NULL)
+    return;
+  int width = glyph->width;
+  int byte_width = (width + 1) / 2;
+  int x0 = cursor_x + glyph->left;
+  bool clipped = x0 < 0 || x0 + width > EPD_WIDTH;
+  for (int row = 0; row < glyph->height; row++) {
+    int yy = cursor_y - glyph->top + row;
+    if (yy < bandTop || yy >= bandBottom)
+      continue;
+    const uint8_t *src = bitmap + row * byte_width;
+    uint8_t *line = framebufferRow(yy);
+    if (clipped) {
+      for (int col = max(0, -x0); col < min(width, EPD_WIDTH - x0); col++) {
+        uint8_t bm = (col & 1) ? src[col / 2] >> 4 : src[col / 2] & 0x0F;
+        if (bm == 0)
+          continue;
+        int xx = x0 + col;
+        uint8_t *pixels = line + xx / 2;
+        *pixels = (xx & 1) ? (*pixels & 0x0F) | ((15 - bm) << 4) : (*pixels & 0xF0) | (15 - bm);
+      }
+      continue;
+    }
+    uint8_t *dst = line + x0 / 2;
+    if (!(x0 & 1)) {
+      // glyph bytes line up with framebuffer bytes, the padding nibble of odd widths is left out
+      for (int i = 0; i < byte_width; i++) {
+        uint8_t b = (width & 1) && i == byte_width - 1 ? src[i] & 0x0F : src[i];
+        dst[i] = (dst[i] & glyphKeep[b]) | glyphInk[b];
+      }
+    }
+    else {
+      // every framebuffer byte takes the high nibble of one glyph byte and the low nibble of the next
+      uint8_t previous = 0;
+      for (int i = 0; i < byte_width + !(width & 1); i++) {
+        uint8_t next = i < byte_width ? src[i] : 0;
+        uint8_t b = (previous >> 4) | (next << 4);
+        dst[i] = (dst[i] & glyphKeep[b]) | glyphInk[b];
+        previous = next;
+      }
+    }
+  }
+}
+
+void drawString(int x, int y, const char *text, size_t length, alignment align) {
+  if (!glyphMasksReady)
+    initGlyphMasks();
+  GlyphCache &cache = glyphCache(currentFont);
+  // the first MAX_TEXT_GLYPHS glyphs are kept for the blit, longer strings look the rest up again from more on
+  const GFXglyph *glyphs[MAX_TEXT_GLYPHS];
+  const char *more = NULL;
+  int count = 0;
+  int cursor = 0, minx = 0, maxx = 0, top = 0, bottom = 0;
+  const char *start = text;
+  const char *end = text + length;
+  // a recorded text has to fit into the text buffer of the display list, a code point takes up to 4 bytes
+  while (text < end && (!displayListRecording || text - start + 4 <= DISPLAY_LIST_TEXT)) {
+    const GFXglyph *glyph = lookupGlyph(currentFont, cache, nextCodePoint(text, end));
+    if (glyph == NULL)
+      continue;
+    minx = min(minx, cursor + glyph->left); // the bounds start at the origin at the latest
+    maxx = max(maxx, cursor + glyph->left + glyph->width);
+    top = max(top, (int)glyph->top);
+    bottom = max(bottom, glyph->height - glyph->top);
+    cursor += glyph->advance_x;
+    if (count < MAX_TEXT_GLYPHS)
+      glyphs[count] = glyph;
+    if (++count == MAX_TEXT_GLYPHS)
+      more = text;
+  }
+  if (text < end)
+    Serial.println("Text cut to " + String(text - start) + " of " + String(length) + " bytes");
+  if (count == 0)
+    return;
+  int w = maxx - minx;
   if (align == RIGHT)  x = x - w;
   if (align == CENTER) x = x - w / 2;
-  write_string(&currentFont, data, &x, &y, framebuffer);
+  if (displayListRecording) {
+    Rect_t bounds = {.x = x + minx, .y = y - top, .width = w, .height = top + bottom};
+    if (!clipToScreen(bounds))
+      return;
+    length = text - start;
+    DrawCommand &command = recordCommand(DRAW_TEXT, bounds, length);
+    int font = findDisplayListFont();
+    if (font < 0) {
+      font = displayListFontCount++;
+      displayListFonts[font] = currentFont;
+    }
+    command.font = font;
+    command.x = x;
+    command.y = y;
+    command.width = length;
+    command.data = memcpy(displayListText + displayListTextUsed, start, length);
+    displayListTextUsed += length;
+    return;
+  }
+  // the vertical bounds of the glyphs vary with the text, use the font metrics instead
+  markDamage(x + minx - 2, y - currentFont.ascender - 2, w + 4, currentFont.ascender - currentFont.descender + 4);
+  for (int i = 0; i < min(count, MAX_TEXT_GLYPHS); i++) {
+    blitGlyph(glyphs[i], x, y);
+    x += glyphs[i]->advance_x;
+  }
+  while (more != NULL && more < end) {
+    const GFXglyph *glyph = lookupGlyph(currentFont, cache, nextCodePoint(more, end));
+    if (glyph == NULL)
+      continue;
+    blitGlyph(glyph, x, y);
+    x += glyph->advance_x;
+  }
+}
+
+void drawString(int x, int y, const char *text, alignment align) {
+  drawString(x, y, text, strlen(text), align);
+}
+
+void drawString(int x, int y, const String &text, alignment align) {
+  drawString(x, y, text.c_str(), text.length(), align);
+}
+
+// 4bpp primitives: a framebuffer row holds two pixels per byte, the even pixel in the low nibble. The library draws
+// everything pixel by pixel, these write a nibble at an odd start or end on its own and the whole bytes in between
+// with 32 bit stores. Colors are given like for the library, the gray level in the high nibble.
+
+// fills pixels x to x + length - 1 of a framebuffer row, the span has to be on screen
+void fillSpan(uint8_t *row, int x, int length, uint8_t nibble) {
+  if (length <= 0)
+    return;
+  if (x & 1) {
+    row[x / 2] = (row[x / 2] & 0x0F) | (nibble << 4);
+    x++;
+    length--;
+  }
+  uint8_t *dst = row + x / 2;
+  uint8_t value = nibble * 0x11;
+  int bytes = length / 2;
+  for (; bytes > 0 && ((uintptr_t)dst & 3); bytes--)
+    *dst++ = value;
+  uint32_t word = value * 0x01010101u;
+  for (; bytes >= 4; bytes -= 4, dst += 4)
+    *(uint32_t *)dst = word;
+  for (; bytes > 0; bytes--)
+    *dst++ = value;
+  if (length & 1)
+    *dst = (*dst & 0xF0) | nibble;
+}
+
+// copies pixels c to end - 1 of a 4bpp image row to the framebuffer row at x + c, the span has to be on screen
+void copySpan(uint8_t *row, int x, const uint8_t *src, int c, int end) {
+  if (c >= end)
+    return;
+  if ((x + c) & 1) {
+    uint8_t pixel = (c & 1) ? src[c / 2] >> 4 : src[c / 2] & 0x0F;
+    row[(x + c) / 2] = (row[(x + c) / 2] & 0x0F) | (pixel << 4);
+    c++;
+  }
+  uint8_t *dst = row + (x + c) / 2;
+  int bytes = (end - c) / 2;
+  if (!(c & 1)) {
+    // image bytes line up with framebuffer bytes
+    memcpy(dst, src + c / 2, bytes);
+    dst += bytes;
+    c += bytes * 2;
+  }
+  else {
+    // every framebuffer byte takes the high nibble of one image byte and the low nibble of the next
+    const uint8_t *in = src + c / 2;
+    for (; bytes >= 4; bytes -= 4, in += 4, dst += 4, c += 8) {
+      uint32_t word;
+      memcpy(&word, in, 4);
+      word = (word >> 4) | ((uint32_t)in[4] << 28);
+      memcpy(dst, &word, 4);
+    }
+    for (; bytes > 0; bytes--, in++, c += 2)
+      *dst++ = (in[0] >> 4) | (in[1] << 4);
+  }
+  if (c < end)
+    *dst = (*dst & 0xF0) | ((c & 1) ? src[c / 2] >> 4 : src[c / 2] & 0x0F);
+}
+
+// copies a 4bpp image with rows padded to whole bytes, like epd_copy_to_framebuffer, clipped to the screen
+void copyToFramebuffer(Rect_t area, const uint8_t *data) {
+  int c0 = max(0, -area.x);
+  int c1 = min(area.width, EPD_WIDTH - area.x);
+  int row_bytes = (area.width + 1) / 2;
+  for (int row = max(0, bandTop - area.y); row < min(area.height, bandBottom - area.y); row++)
+    copySpan(framebufferRow(area.y + row), area.x, data + row * row_bytes, c0, c1);
+}
+
+void fillArea(int x, int y, int w, int h, uint8_t color) {
+  int x2 = min(x + w, EPD_WIDTH);
+  int y2 = min(y + h, bandBottom);
+  x = max(x, 0);
+  for (int row = max(y, bandTop); row < y2; row++)
+    fillSpan(framebufferRow(row), x, x2 - x, color >> 4);
+}
+
+void verticalLine(int x, int y, int length, uint8_t color) {
+  if (x < 0 || x >= EPD_WIDTH)
+    return;
+  uint8_t keep = (x & 1) ? 0x0F : 0xF0;
+  uint8_t ink = (x & 1) ? (color & 0xF0) : (color >> 4);
+  for (int row = max(y, bandTop); row < min(y + length, bandBottom); row++) {
+    uint8_t *pixels = framebufferRow(row) + x / 2;
+    *pixels = (*pixels & keep) | ink;
+  }
 }
 
 void fillCircle(int x, int y, int r, uint8_t color) {
+  markDamage(x - r, y - r, 2 * r + 1, 2 * r + 1);
+  if (displayListRecording)
+    rasteriseDisplayList();
   epd_fill_circle(x, y, r, color, framebuffer);
 }
 
 void drawFastHLine(int16_t x0, int16_t y0, int length, uint16_t color) {
-  epd_draw_hline(x0, y0, length, color, framebuffer);
+  if (displayListRecording)
+    recordShape(DRAW_FILL, x0, y0, length, 1, color);
+  else {
+    markDamage(x0, y0, length, 1);
+    fillArea(x0, y0, length, 1, color);
+  }
 }
 
 void drawFastVLine(int16_t x0, int16_t y0, int length, uint16_t color) {
-  epd_draw_vline(x0, y0, length, color, framebuffer);
+  if (displayListRecording)
+    recordShape(DRAW_VLINE, x0, y0, 1, length, color);
+  else {
+    markDamage(x0, y0, 1, length);
+    verticalLine(x0, y0, length, color);
+  }
 }
 
 void drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color) {
+  markDamage(min(x0, x1), min(y0, y1), abs(x1 - x0) + 1, abs(y1 - y0) + 1);
+  if (displayListRecording)
+    rasteriseDisplayList();
   epd_write_line(x0, y0, x1, y1, color, framebuffer);
 }
 
 void drawCircle(int x0, int y0, int r, uint8_t color) {
+  markDamage(x0 - r, y0 - r, 2 * r + 1, 2 * r + 1);
+  if (displayListRecording)
+    rasteriseDisplayList();
   epd_draw_circle(x0, y0, r, color, framebuffer);
 }
 
+void rectOutline(int x, int y, int w, int h, uint8_t color, int thickness = 1) {
+  if (thickness == 1) {
+    fillArea(x, y, w, 1, color);
+    fillArea(x, y + h - 1, w, 1, color);
+    verticalLine(x, y, h, color);
+    verticalLine(x + w - 1, y, h, color);
+    return;
+  }
+  fillArea(x, y, w, thickness, color);
+  fillArea(x, y + h - thickness, w, thickness, color);
+  fillArea(x, y + thickness, thickness, h - 2 * thickness, color);
+  fillArea(x + w - thickness, y + thickness, thickness, h - 2 * thickness, color);
+}
+
 void drawRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
-  epd_draw_rect(x, y, w, h, color, framebuffer);
+  if (displayListRecording)
+    recordShape(DRAW_RECT, x, y, w, h, color);
+  else {
+    markDamage(x, y, w, h);
+    rectOutline(x, y, w, h, color);
+  }
 }
 
 void fillRect(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
-  epd_fill_rect(x, y, w, h, color, framebuffer);
+  if (displayListRecording)
+    recordShape(DRAW_FILL, x, y, w, h, color);
+  else {
+    markDamage(x, y, w, h);
+    fillArea(x, y, w, h, color);
+  }
 }
 
 void fillTriangle(int16_t x0, int16_t y0, int16_t x1, int16_t y1,
                   int16_t x2, int16_t y2, uint16_t color) {
+  int min_x = min(x0, min(x1, x2));
+  int min_y = min(y0, min(y1, y2));
+  markDamage(min_x, min_y, max(x0, max(x1, x2)) - min_x + 1, max(y0, max(y1, y2)) - min_y + 1);
+  if (displayListRecording)
+    rasteriseDisplayList();
   epd_fill_triangle(x0, y0, x1, y1, x2, y2, color, framebuffer);
 }
 
 void drawPixel(int x, int y, uint8_t color) {
-  epd_draw_pixel(x, y, color, framebuffer);
+  if (displayListRecording)
+    recordShape(DRAW_FILL, x, y, 1, 1, color);
+  else {
+    markDamage(x, y, 1, 1);
+    fillArea(x, y, 1, 1, color);
+  }
 }
 
 void drawImage(int x, int y, int width, int height, const uint8_t* image_data) {
-    Rect_t image_area = {
-      .x = x,
-      .y = y,
-      .width = width,
-      .height = height,
-  };
-  epd_copy_to_framebuffer(image_area, (uint8_t *)image_data, framebuffer);  
+  if (displayListRecording) {
+    Rect_t bounds = {.x = x, .y = y, .width = width, .height = height};
+    if (!clipToScreen(bounds))
+      return;
+    DrawCommand &command = recordCommand(DRAW_IMAGE, bounds);
+    command.x = x;
+    command.y = y;
+    command.width = width;
+    command.height = height;
+    command.data = image_data;
+    return;
+  }
+  markDamage(x, y, width, height);
+  copyToFramebuffer({.x = x, .y = y, .width = width, .height = height}, image_data);
+}
+
+// Icons written by scripts/imageconvert.py -r are run length encoded in bytes of two pixels, row after row:
+//   0ccccccc           literal, the next c + 1 bytes are copied
+//   1ccccccc vvvvvvvv  repeat, v is repeated c + 3 times
+// An icon with a base (-b, the other icon of an on/off pair) only stores where it differs from the base:
+//   0ccccccc           literal, the next c + 1 bytes are copied
+//   10cccccc vvvvvvvv  repeat, v is repeated c + 3 times
+//   11cccccc           keep c + 1 bytes of the base
+// Runs continue across rows, the decoder keeps the open run between rows.
+#define IMAGE_RLE_MIN_RUN 3
+
+struct Icon {
+  uint16_t       width;
+  uint16_t       height;
+  uint32_t       size; // bytes of data
+  const uint8_t *data;
+  const Icon    *base; // data is a delta to this icon, NULL if data is the whole icon
+};
+
+enum rle_run {RLE_LITERAL, RLE_REPEAT, RLE_KEEP};
+
+struct RLEDecoder {
+  const uint8_t *in;
+  bool           delta;
+  int            run;   // bytes left of the open run
+  uint8_t        type;
+  uint8_t        value;
+};
+
+// decodes the next row, keep runs of a delta leave the bytes in row alone
+void decodeRLERow(RLEDecoder &decoder, uint8_t *row, int bytes) {
+  int i = 0;
+  while (i < bytes) {
+    if (decoder.run == 0) {
+      uint8_t control = *decoder.in++;
+      if (!(control & 0x80)) {
+        decoder.type = RLE_LITERAL;
+        decoder.run = control + 1;
+      }
+      else if (decoder.delta && (control & 0x40)) {
+        decoder.type = RLE_KEEP;
+        decoder.run = (control & 0x3F) + 1;
+      }
+      else {
+        decoder.type = RLE_REPEAT;
+        decoder.run = (control & (decoder.delta ? 0x3F : 0x7F)) + IMAGE_RLE_MIN_RUN;
+        decoder.value = *decoder.in++;
+      }
+    }
+    int count = min(decoder.run, bytes - i);
+    if (decoder.type == RLE_LITERAL) {
+      memcpy(row + i, decoder.in, count);
+      decoder.in += count;
+    }
+    else if (decoder.type == RLE_REPEAT)
+      memset(row + i, decoder.value, count);
+    decoder.run -= count;
+    i += count;
+  }
+}
+
+// icons at an even x that are completely on screen are decoded straight into the framebuffer rows
+bool iconInFramebuffer(int x, int y, const Icon &icon) {
+  return !(x & 1) && !(icon.width & 1) && x >= 0 && y >= 0 && x + icon.width <= EPD_WIDTH && y + icon.height <= EPD_HEIGHT;
+}
+
+// where decoding an icon goes on, a display list decodes its icons band by band
+struct IconCursor {
+  RLEDecoder base;  // the whole icon, or its base if it is a delta
+  RLEDecoder delta;
+  int        row;   // next row to decode
+};
+
+IconCursor iconCursors[DISPLAY_LIST_ICONS];
+
+IconCursor iconCursor(const Icon &icon) {
+  return {{icon.base != NULL ? icon.base->data : icon.data, false, 0, RLE_LITERAL, 0}, {icon.data, true, 0, RLE_LITERAL, 0}, 0};
+}
+
+// Decodes the rows of the icon from cursor.row to the end of the icon or of the band. A patch only applies the delta,
+// the framebuffer holds the base already. Icons that are not completely in the framebuffer go through a row buffer
+// and copyToFramebuffer.
+void decodeIconRows(int x, int y, const Icon &icon, IconCursor &cursor, bool patch) {
+  int row_bytes = (icon.width + 1) / 2;
+  bool direct = iconInFramebuffer(x, y, icon);
+  uint8_t line[direct ? 1 : row_bytes];
+  for (int end = min((int)icon.height, bandBottom - y); cursor.row < end; cursor.row++) {
+    uint8_t *dst = direct ? framebufferRow(y + cursor.row) + x / 2 : line;
+    if (!patch)
+      decodeRLERow(cursor.base, dst, row_bytes);
+    if (icon.base != NULL)
+      decodeRLERow(cursor.delta, dst, row_bytes);
+    if (!direct)
+      copyToFramebuffer({.x = x, .y = y + cursor.row, .width = icon.width, .height = 1}, line);
+  }
+}
+
+void decodeIcon(int x, int y, const Icon &icon, bool patch) {
+  if (!displayListRecording) {
+    markDamage(x, y, icon.width, icon.height);
+    IconCursor cursor = iconCursor(icon);
+    decodeIconRows(x, y, icon, cursor, patch);
+    return;
+  }
+  Rect_t bounds = {.x = x, .y = y, .width = icon.width, .height = icon.height};
+  if (!clipToScreen(bounds))
+    return;
+  DrawCommand &command = recordCommand(patch ? DRAW_PATCH : DRAW_ICON, bounds);
+  iconCursors[displayListIcons] = iconCursor(icon);
+  command.x = x;
+  command.y = y;
+  command.width = displayListIcons++;
+  command.data = &icon;
+}
+
+// draws an icon, with its base underneath if it is a delta
+void drawIcon(int x, int y, const Icon &icon) {
+  decodeIcon(x, y, icon, false);
+}
+
+// Turns the icon from, which the framebuffer holds at x/y, into icon. If icon is the delta of from, only the bytes
+// that differ are written, otherwise it is drawn as a whole.
+void patchIcon(int x, int y, const Icon &icon, const Icon &from) {
+  if (&icon == &from)
+    return;
+  decodeIcon(x, y, icon, icon.base == &from && iconInFramebuffer(x, y, icon));
+}
+
+void rasteriseText(const DrawCommand &command) {
+  GFXfont font = currentFont;
+  currentFont = displayListFonts[command.font];
+  GlyphCache &cache = glyphCache(currentFont);
+  const char *text = (const char *)command.data;
+  const char *end = text + command.width;
+  int x = command.x;
+  while (text < end) {
+    const GFXglyph *glyph = lookupGlyph(currentFont, cache, nextCodePoint(text, end));
+    if (glyph == NULL)
+      continue;
+    blitGlyph(glyph, x, command.y);
+    x += glyph->advance_x;
+  }
+  currentFont = font;
+}
+
+void rasteriseCommand(const DrawCommand &command) {
+  switch (command.op) {
+    case DRAW_FILL:
+      fillArea(command.x, command.y, command.width, command.height, command.color);
+      break;
+    case DRAW_RECT:
+      rectOutline(command.x, command.y, command.width, command.height, command.color, command.thickness);
+      break;
+    case DRAW_VLINE:
+      verticalLine(command.x, command.y, command.height, command.color);
+      break;
+    case DRAW_TEXT:
+      rasteriseText(command);
+      break;
+    case DRAW_IMAGE:
+      copyToFramebuffer({.x = command.x, .y = command.y, .width = command.width, .height = command.height}, (const uint8_t *)command.data);
+      break;
+    case DRAW_ICON:
+    case DRAW_PATCH:
+      decodeIconRows(command.x, command.y, *(const Icon *)command.data, iconCursors[command.width], command.op == DRAW_PATCH);
+      break;
+  }
+}
+
+bool rectContains(const Rect_t &outer, const Rect_t &inner) {
+  return inner.x >= outer.x && inner.y >= outer.y && inner.x + inner.width <= outer.x + outer.width &&
+         inner.y + inner.height <= outer.y + outer.height;
+}
+
+// Culls the commands a later fill, image or icon paints over completely and marks the damage of the others
+void cullDisplayList() {
+  for (int i = displayListCount - 1; i >= 0; i--) {
+    DrawCommand &command = displayList[i];
+    command.culled = false;
+    for (int j = i + 1; j < displayListCount && !command.culled; j++) {
+      const DrawCommand &later = displayList[j];
+      command.culled = !later.culled && (later.op == DRAW_FILL || later.op == DRAW_IMAGE || later.op == DRAW_ICON) &&
+                       rectContains(later.bounds, command.bounds);
+    }
+    if (command.culled)
+      displayListCulled++;
+    else
+      markDamage(command.bounds.x, command.bounds.y, command.bounds.width, command.bounds.height);
+  }
+}
+
+// Puts every command that is drawn into the bucket of each band it touches, in the order they were recorded
+void bucketDisplayList(int bands) {
+  memset(bandStarts, 0, (bands + 1) * sizeof(bandStarts[0]));
+  for (int i = 0; i < displayListCount; i++) {
+    const Rect_t &bounds = displayList[i].bounds;
+    if (displayList[i].culled)
+      continue;
+    for (int b = bounds.y / band_height; b <= (bounds.y + bounds.height - 1) / band_height; b++)
+      bandStarts[b + 1]++;
+  }
+  for (int b = 0; b < bands; b++) {
+    bandStarts[b + 1] += bandStarts[b];
+    bandEnds[b] = bandStarts[b];
+  }
+  for (int i = 0; i < displayListCount; i++) {
+    const Rect_t &bounds = displayList[i].bounds;
+    if (displayList[i].culled)
+      continue;
+    for (int b = bounds.y / band_height; b <= (bounds.y + bounds.height - 1) / band_height; b++)
+      bandBuckets[bandEnds[b]++] = i;
+  }
+}
+
+// Draws the recorded commands band by band: the columns of the framebuffer the commands of a band touch are copied
+// into the strip, the commands are drawn into it and the strip is copied back.
+void rasteriseDisplayList() {
+  unsigned long start = micros();
+  int bands = (EPD_HEIGHT + band_height - 1) / band_height;
+  cullDisplayList();
+  bucketDisplayList(bands);
+  for (int b = 0; b < bands; b++) {
+    if (bandStarts[b] == bandEnds[b])
+      continue;
+    int top = b * band_height;
+    int bottom = min(top + band_height, EPD_HEIGHT);
+    int x1 = EPD_WIDTH, x2 = 0;
+    for (int e = bandStarts[b]; e < bandEnds[b]; e++) {
+      const Rect_t &bounds = displayList[bandBuckets[e]].bounds;
+      x1 = min(x1, bounds.x);
+      x2 = max(x2, bounds.x + bounds.width);
+    }
+    x1 &= ~1;
+    x2 = min(x2 + (x2 & 1), EPD_WIDTH);
+    for (int row = top; row < bottom; row++)
+      memcpy(bandBuffer + (row - top) * EPD_WIDTH / 2 + x1 / 2, framebuffer + row * EPD_WIDTH / 2 + x1 / 2, (x2 - x1) / 2);
+    band = bandBuffer;
+    bandTop = top;
+    bandBottom = bottom;
+    for (int e = bandStarts[b]; e < bandEnds[b]; e++)
+      rasteriseCommand(displayList[bandBuckets[e]]);
+    band = NULL;
+    bandTop = 0;
+    bandBottom = EPD_HEIGHT;
+    for (int row = top; row < bottom; row++)
+      memcpy(framebuffer + row * EPD_WIDTH / 2 + x1 / 2, bandBuffer + (row - top) * EPD_WIDTH / 2 + x1 / 2, (x2 - x1) / 2);
+    displayListBands++;
+  }
+  displayListCommands += displayListCount;
+  displayListCount = 0;
+  displayListTextUsed = 0;
+  displayListFontCount = 0;
+  displayListIcons = 0;
+  displayListEntries = 0;
+  displayListUs += micros() - start;
+}
+
+// Starts recording, false if banded rendering is off or there is no internal memory for the strip, everything is
+// drawn straight into the framebuffer then.
+bool beginDisplayList() {
+  if (band_height <= 0 || band_height > EPD_HEIGHT)
+    return false;
+  if (bandBuffer == NULL)
+    bandBuffer = (uint8_t *)heap_caps_malloc(band_height * EPD_WIDTH / 2, MALLOC_CAP_INTERNAL | MALLOC_CAP_8BIT);
+  if (bandBuffer == NULL) {
+    Serial.println("No internal memory for the band buffer, drawing straight into the framebuffer");
+    return false;
+  }
+  displayListRecording = true;
+  displayListUs = 0;
+  displayListBands = 0;
+  displayListCommands = 0;
+  displayListCulled = 0;
+  displayListMerged = 0;
+  return true;
+}
+
+void endDisplayList() {
+  if (!displayListRecording)
+    return;
+  rasteriseDisplayList();
+  displayListRecording = false;
+  Serial.println("Display list: " + String(displayListCommands) + " commands (" + String(displayListCulled) + " culled, " +
+                 String(displayListMerged) + " outlines merged) rasterised in " + String(displayListBands) + " bands of " +
+                 String(band_height) + " rows in " + String(displayListUs) + "us");
+}
+
+// Update only the given area of the screen from the framebuffer. The area is widened to even x/width,
+// because the framebuffer holds two pixels per byte.
+void epd_update_area(Rect_t area) {
+  if (area.x % 2) {
+    area.x--;
+    area.width++;
+  }
+  area.width += area.width % 2;
+  int row_bytes = area.width / 2;
+  uint8_t *area_data = (uint8_t *)ps_malloc(row_bytes * area.height);
+  if (!area_data) {
+    Serial.println("Memory alloc failed!");
+    return;
+  }
+  for (int row = 0; row < area.height; row++) {
+    memcpy(area_data + row * row_bytes, framebuffer + (area.y + row) * EPD_WIDTH / 2 + area.x / 2, row_bytes);
+  }
+  epd_clear_area(area);
+  epd_draw_grayscale_image(area, area_data);
+  free(area_data);
+}
+
+// Shrinks the area to the bounding box of the bytes that differ from the previous frame, false if nothing changed
+bool changedArea(Rect_t &area) {
+  int first_byte = area.x / 2, last_byte = (area.x + area.width) / 2 - 1;
+  int min_byte = EPD_WIDTH, max_byte = -1, min_row = EPD_HEIGHT, max_row = -1;
+  for (int row = area.y; row < area.y + area.height; row++) {
+    const uint8_t *current = framebuffer + row * EPD_WIDTH / 2;
+    const uint8_t *previous = previousFramebuffer + row * EPD_WIDTH / 2;
+    if (memcmp(current + first_byte, previous + first_byte, last_byte - first_byte + 1) == 0)
+      continue;
+    for (int b = first_byte; b <= last_byte; b++) {
+      if (current[b] != previous[b]) {
+        min_byte = min(min_byte, b);
+        max_byte = max(max_byte, b);
+      }
+    }
+    min_row = min(min_row, row);
+    max_row = row;
+  }
+  if (max_row < 0)
+    return false;
+  area = {.x = min_byte * 2, .y = min_row, .width = (max_byte - min_byte + 1) * 2, .height = max_row - min_row + 1};
+  return true;
 }
 
+// Push the framebuffer to the screen. Only the damaged areas that differ from the previous frame are cleared and
+// redrawn. A full refresh (with the flashing that removes ghosting) is done when there is no previous frame and
+// after every full_refresh_every partial updates.
 void epd_update() {
-  epd_draw_grayscale_image(epd_full_screen(), framebuffer); // Update the screen
+  if (!previousFramebuffer)
+    previousFramebuffer = (uint8_t *)ps_malloc(EPD_WIDTH * EPD_HEIGHT / 2);
+  if (!previousFramebuffer || !previousFramebufferValid || partialUpdateCount >= full_refresh_every) {
+    epd_clear();
+    epd_draw_grayscale_image(epd_full_screen(), framebuffer); // Update the screen
+    partialUpdateCount = 0;
+  }
+  else {
+    int updated = 0;
+    for (int i = 0; i < panelContentCount; i++)
+      markDamage(panelContentRects[i].x, panelContentRects[i].y, panelContentRects[i].width, panelContentRects[i].height);
+    for (int i = 0; i < damageCount; i++) {
+      Rect_t area = damageRects[i];
+      if (changedArea(area)) {
+        epd_update_area(area);
+        updated++;
+      }
+    }
+    Serial.println("Partial update of " + String(updated) + "/" + String(damageCount) + " damaged areas");
+    if (updated > 0)
+      partialUpdateCount++;
+  }
+  if (previousFramebuffer) {
+    memcpy(previousFramebuffer, framebuffer, EPD_WIDTH * EPD_HEIGHT / 2);
+    previousFramebufferValid = true;
+  }
+  memcpy(panelContentRects, damageRects, sizeof(damageRects));
+  panelContentCount = damageCount;
+  damageCount = 0;
+  panelUpdated = true;
 }
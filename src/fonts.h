@@ -0,0 +1,38 @@
+#pragma once
+// The fonts of the dashboard. scripts/fontsubset.py, run before every PlatformIO build, writes subsets of the fonts
+// with only the characters the dashboard draws with them; the full font is included where there is no subset, e.g.
+// for fonts that draw Home Assistant states or when building with the Arduino IDE. With ASSET_PACK the fonts are
+// read from the asset pack instead, see assetpack.h.
+#ifndef ASSET_PACK
+
+#if __has_include("opensans8b_subset.h")
+#include "opensans8b_subset.h"
+#else
+#include "opensans8b.h"
+#endif
+#if __has_include("opensans9b_subset.h")
+#include "opensans9b_subset.h"
+#else
+#include "opensans9b.h"
+#endif
+#if __has_include("opensans10b_subset.h")
+#include "opensans10b_subset.h"
+#else
+#include "opensans10b.h"
+#endif
+#if __has_include("opensans12b_subset.h")
+#include "opensans12b_subset.h"
+#else
+#include "opensans12b.h"
+#endif
+#if __has_include("opensans18b_subset.h")
+#include "opensans18b_subset.h"
+#else
+#include "opensans18b.h"
+#endif
+#if __has_include("opensans24b_subset.h")
+#include "opensans24b_subset.h"
+#else
+#include "opensans24b.h"
+#endif
+#endif
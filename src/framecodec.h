@@ -0,0 +1,92 @@
+// Run length codec for 4bpp frames. Dashboard frames are mostly white (0xFF) with some borders, text and icons,
+// so long runs of equal bytes are stored as a 3 byte repeat and everything else as literal blocks:
+//   0xxxxxxx                      literal, the next x + 1 bytes are copied
+//   1xxxxxxx yyyyyyyy vvvvvvvv    repeat, byte v is repeated ((x << 8) | y) + FRAME_MIN_RUN times
+// Encoding and decoding are single pass, without any state besides the output position.
+
+#define FRAME_MIN_RUN     4
+#define FRAME_MAX_RUN     (0x7FFF + FRAME_MIN_RUN)
+#define FRAME_MAX_LITERAL 128
+
+// encoded frames and differences up to this size are kept in RTC slow memory by framestore.h
+#define FRAME_RTC_SIZE    4096
+
+// With a base frame the codec works on the difference of the frame to it (the XOR of both), which is all zeros
+// where they are equal: the frame is encoded relative to base and decoded onto a copy of base.
+inline uint8_t frameByte(const uint8_t *data, const uint8_t *base, size_t position) {
+  return base ? data[position] ^ base[position] : data[position];
+}
+
+size_t runLength(const uint8_t *data, const uint8_t *base, size_t position, size_t length) {
+  size_t run = 1;
+  uint8_t value = frameByte(data, base, position);
+  while (position + run < length && run < FRAME_MAX_RUN && frameByte(data, base, position + run) == value)
+    run++;
+  return run;
+}
+
+// returns the encoded size, 0 if it does not fit into capacity
+size_t encodeFrame(const uint8_t *data, size_t length, uint8_t *encoded, size_t capacity, const uint8_t *base = NULL) {
+  size_t in = 0, out = 0;
+  while (in < length) {
+    size_t run = runLength(data, base, in, length);
+    if (run >= FRAME_MIN_RUN) {
+      if (out + 3 > capacity)
+        return 0;
+      size_t count = run - FRAME_MIN_RUN;
+      encoded[out++] = 0x80 | (count >> 8);
+      encoded[out++] = count & 0xFF;
+      encoded[out++] = frameByte(data, base, in);
+      in += run;
+      continue;
+    }
+    // literal block up to the next run that is worth a repeat
+    size_t start = in;
+    while (in < length && in - start < FRAME_MAX_LITERAL && runLength(data, base, in, length) < FRAME_MIN_RUN)
+      in++;
+    size_t count = in - start;
+    if (out + 1 + count > capacity)
+      return 0;
+    encoded[out++] = count - 1;
+    for (size_t i = start; i < in; i++)
+      encoded[out++] = frameByte(data, base, i);
+  }
+  return out;
+}
+
+// Returns false if the encoded data is corrupt or does not decode to exactly length bytes. With onBase, data holds
+// the base frame the data was encoded relative to and the difference is applied to it.
+bool decodeFrame(const uint8_t *encoded, size_t encodedLength, uint8_t *data, size_t length, bool onBase = false) {
+  size_t in = 0, out = 0;
+  while (in < encodedLength) {
+    uint8_t control = encoded[in++];
+    if (control & 0x80) {
+      if (in + 2 > encodedLength)
+        return false;
+      size_t count = (((control & 0x7F) << 8) | encoded[in]) + FRAME_MIN_RUN;
+      uint8_t value = encoded[in + 1];
+      if (out + count > length)
+        return false;
+      if (!onBase)
+        memset(data + out, value, count);
+      else if (value != 0)
+        for (size_t i = 0; i < count; i++)
+          data[out + i] ^= value;
+      in += 2;
+      out += count;
+    }
+    else {
+      size_t count = control + 1;
+      if (in + count > encodedLength || out + count > length)
+        return false;
+      if (!onBase)
+        memcpy(data + out, encoded + in, count);
+      else
+        for (size_t i = 0; i < count; i++)
+          data[out + i] ^= encoded[in + i];
+      in += count;
+      out += count;
+    }
+  }
+  return out == length;
+}
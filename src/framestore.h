@@ -0,0 +1,239 @@
+// Frame store: keeps the frame that is on the panel across deep sleep, so the next wake can restore it as the previous
+// frame and only push what changed. The frame is kept as a key frame plus the difference of the frame to it, both run
+// length encoded (framecodec.h). From wake to wake mostly a few values and the status line change, so the difference
+// stays small and is kept in RTC slow memory: most stores do not write to flash at all. A whole dashboard (about
+// 100 KB) never fits there; once its difference outgrows RTC memory the frame becomes the new key frame. Key frames
+// are appended to a log in the "frames" partition, which is erased sector by sector just ahead of the writes, so
+// every sector is erased once per pass through the partition.
+// Flash writes are limited to FRAME_FLASH_PASSES_PER_DAY passes a day; a store over that budget is dropped and the
+// next wake does a full refresh.
+
+#define FRAME_MAGIC     0x46524D32 // "FRM2"
+#define FRAME_SIZE      (EPD_WIDTH * EPD_HEIGHT / 2)
+#define FRAME_SECTOR    4096
+#define FRAME_PARTITION_SUBTYPE 0x40 // custom data subtype of the "frames" partition in partitions.csv
+
+#define FRAME_FLASH_PASSES_PER_DAY 24           // erases of every sector a day, plus the burst: 100k cycles last 11 years
+#define FRAME_FLASH_BURST          (256 * 1024) // bytes of the flash budget that can be saved up
+
+enum frame_location {FRAME_NONE, FRAME_RTC, FRAME_FLASH, FRAME_KEY};
+
+struct FrameHeader{
+    uint32_t magic;
+    uint32_t sequence;
+    uint32_t length;   // encoded bytes following the header
+    uint32_t checksum; // FNV-1a of the encoded bytes
+};
+
+// An encoded frame, or the difference of a frame to the key frame. In flash the header is written in front of the
+// encoded bytes, the copy here has to match it.
+struct FrameRecord{
+    uint8_t     location; // FRAME_RTC (rtcFrame), FRAME_FLASH, FRAME_KEY (the frame is the key frame) or FRAME_NONE
+    bool        onKey;    // difference to the key frame
+    uint32_t    offset;   // in the partition
+    FrameHeader header;
+};
+
+RTC_DATA_ATTR FrameRecord frameKey = {FRAME_NONE};   // whole frame in flash
+RTC_DATA_ATTR FrameRecord frameStored = {FRAME_NONE}; // the frame on the panel
+RTC_DATA_ATTR uint8_t     rtcFrame[FRAME_RTC_SIZE];
+RTC_DATA_ATTR uint32_t    frameSequence = 0;
+RTC_DATA_ATTR uint32_t    frameLogHead = 0;   // where the next record is written
+RTC_DATA_ATTR uint32_t    frameLogErased = 0; // the partition is erased from frameLogHead up to here
+RTC_DATA_ATTR uint32_t    frameBudget = FRAME_FLASH_BURST; // bytes that may be written to flash
+RTC_DATA_ATTR unsigned long frameBudgetEpoch = 0;
+
+uint8_t* frameKeyPixels = NULL; // the key frame decoded during this wake
+
+const esp_partition_t* framePartition()
+{
+    static const esp_partition_t* partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)FRAME_PARTITION_SUBTYPE, "frames");
+    return partition;
+}
+
+// decodes the record into frame, which holds the key frame for a difference; false if it is gone or corrupt
+bool decodeFrameRecord(const FrameRecord& record, uint8_t* frame)
+{
+    const FrameHeader& header = record.header;
+    if (header.magic != FRAME_MAGIC)
+        return false;
+    if (record.location == FRAME_RTC)
+    {
+        return header.length <= FRAME_RTC_SIZE && fnv1a(FNV_OFFSET_BASIS, rtcFrame, header.length) == header.checksum &&
+               decodeFrame(rtcFrame, header.length, frame, FRAME_SIZE, record.onKey);
+    }
+    const esp_partition_t* partition = framePartition();
+    FrameHeader written;
+    if (record.location != FRAME_FLASH || partition == NULL || record.offset + sizeof(header) + header.length > partition->size ||
+        esp_partition_read(partition, record.offset, &written, sizeof(written)) != ESP_OK || memcmp(&written, &header, sizeof(header)) != 0)
+        return false;
+    uint8_t* encoded = (uint8_t*)ps_malloc(header.length);
+    bool ok = encoded && esp_partition_read(partition, record.offset + sizeof(header), encoded, header.length) == ESP_OK &&
+              fnv1a(FNV_OFFSET_BASIS, encoded, header.length) == header.checksum &&
+              decodeFrame(encoded, header.length, frame, FRAME_SIZE, record.onKey);
+    free(encoded);
+    return ok;
+}
+
+// the key frame in frameKeyPixels, false if there is none
+bool loadFrameKey()
+{
+    if (frameKey.location != FRAME_FLASH)
+        return false;
+    if (frameKeyPixels != NULL)
+        return true;
+    frameKeyPixels = (uint8_t*)ps_malloc(FRAME_SIZE);
+    if (frameKeyPixels && decodeFrameRecord(frameKey, frameKeyPixels))
+        return true;
+    Serial.println("Key frame is gone");
+    free(frameKeyPixels);
+    frameKeyPixels = NULL;
+    frameKey.location = FRAME_NONE;
+    return false;
+}
+
+// Where a record of size bytes goes in the log: at the head, or at the start after a wrap. The sectors from
+// eraseFrom to eraseTo have to be erased first. cost is what it takes from the flash budget, including the end of
+// the partition skipped by a wrap, so a pass through the partition always costs its size.
+size_t placeFrameRecord(size_t size, size_t& eraseFrom, size_t& eraseTo, size_t& cost)
+{
+    size_t end = framePartition()->size;
+    size_t head = (frameLogHead + 3) / 4 * 4;
+    eraseFrom = frameLogErased;
+    cost = head + size - frameLogHead;
+    if (head + size > end)
+    {
+        cost = end - frameLogHead + size;
+        head = eraseFrom = 0;
+    }
+    eraseTo = max(eraseFrom, (head + size + FRAME_SECTOR - 1) / FRAME_SECTOR * FRAME_SECTOR);
+    return head;
+}
+
+// appends the record to the log within the flash budget, false if it could not be written
+bool appendFrameRecord(FrameRecord& record, const uint8_t* encoded)
+{
+    const esp_partition_t* partition = framePartition();
+    size_t size = sizeof(record.header) + record.header.length;
+    size_t eraseFrom, eraseTo, cost;
+    size_t offset = placeFrameRecord(size, eraseFrom, eraseTo, cost);
+    record.location = FRAME_NONE;
+    if (offset + size > partition->size)
+        return false;
+    if (cost > frameBudget)
+    {
+        Serial.println("Flash budget of " + String(frameBudget) + " bytes exceeded, the frame is not stored");
+        return false;
+    }
+    frameBudget -= cost;
+    if (eraseTo > eraseFrom)
+    {
+        frameLogHead = frameLogErased = eraseFrom; // nothing before eraseFrom is erased after a wrap
+        if (esp_partition_erase_range(partition, eraseFrom, eraseTo - eraseFrom) != ESP_OK)
+        {
+            Serial.println("Erasing frames partition at " + String(eraseFrom) + " failed");
+            return false;
+        }
+        frameLogErased = eraseTo;
+    }
+    frameLogHead = offset + size;
+    if (esp_partition_write(partition, offset, &record.header, sizeof(record.header)) != ESP_OK ||
+        esp_partition_write(partition, offset + sizeof(record.header), encoded, record.header.length) != ESP_OK)
+    {
+        Serial.println("Writing frame to flash at " + String(offset) + " failed");
+        return false;
+    }
+    record.location = FRAME_FLASH;
+    record.offset = offset;
+    return true;
+}
+
+// refills the flash budget for the time since the last store (epoch in seconds)
+void refillFrameBudget(unsigned long epoch)
+{
+    if (frameBudgetEpoch != 0 && epoch > frameBudgetEpoch)
+    {
+        uint64_t refill = (uint64_t)(epoch - frameBudgetEpoch) * FRAME_FLASH_PASSES_PER_DAY * framePartition()->size / 86400;
+        frameBudget = min((uint64_t)FRAME_FLASH_BURST, frameBudget + refill);
+    }
+    frameBudgetEpoch = epoch;
+}
+
+// Stores the frame, as its difference to the key frame or as a whole frame in RTC memory if that fits, otherwise as
+// a new key frame in flash. Returns false if it could not be stored (the next wake does a full refresh then).
+bool storeFrame(const uint8_t* frame, unsigned long epoch)
+{
+    unsigned long start = millis();
+    const esp_partition_t* partition = framePartition();
+    uint8_t* delta = (uint8_t*)ps_malloc(FRAME_SIZE);
+    uint8_t* whole = (uint8_t*)ps_malloc(FRAME_SIZE);
+    frameStored.location = FRAME_NONE;
+    if (!delta || !whole)
+    {
+        Serial.println("Memory alloc failed!");
+        free(delta);
+        free(whole);
+        return false;
+    }
+    FrameRecord record = {FRAME_NONE, true, 0, {FRAME_MAGIC, ++frameSequence, 0, 0}};
+    record.header.length = partition != NULL && loadFrameKey() ? encodeFrame(frame, FRAME_SIZE, delta, FRAME_SIZE, frameKeyPixels) : 0;
+    const uint8_t* encoded = delta;
+    if (record.header.length == 0 || record.header.length > FRAME_RTC_SIZE)
+    {
+        // the whole frame, in RTC memory if it fits, otherwise as the new key frame: a difference in flash would be
+        // written again on every wake the change stays on the panel
+        record.onKey = false;
+        record.header.length = encodeFrame(frame, FRAME_SIZE, whole, FRAME_SIZE);
+        encoded = whole;
+    }
+    record.header.checksum = fnv1a(FNV_OFFSET_BASIS, encoded, record.header.length);
+    refillFrameBudget(epoch);
+    if (record.header.length == 0)
+        Serial.println("Frame does not compress into " + String(FRAME_SIZE) + " bytes, not stored");
+    else if (record.header.length <= FRAME_RTC_SIZE)
+    {
+        memcpy(rtcFrame, encoded, record.header.length);
+        record.location = FRAME_RTC;
+        frameStored = record;
+    }
+    else if (partition == NULL)
+        Serial.println("No frames partition, the frame is not stored");
+    else
+    {
+        // the log may erase the old key frame on the way
+        frameKey.location = FRAME_NONE;
+        if (appendFrameRecord(record, encoded))
+        {
+            frameKey = record;
+            frameStored = {FRAME_KEY};
+            if (frameKeyPixels == NULL)
+                frameKeyPixels = (uint8_t*)ps_malloc(FRAME_SIZE);
+            if (frameKeyPixels)
+                memcpy(frameKeyPixels, frame, FRAME_SIZE);
+        }
+    }
+    free(delta);
+    free(whole);
+    String location = frameStored.location == FRAME_RTC ? "RTC memory" : frameStored.location == FRAME_KEY ? "flash at " + String(record.offset) : String("-");
+    Serial.println("Stored frame: " + String(record.header.length) + " bytes" + (record.onKey ? " of difference to the key frame" : "") +
+                   " in " + location + " in " + String(millis() - start) + "ms, flash budget " + String(frameBudget) + " bytes");
+    return frameStored.location != FRAME_NONE;
+}
+
+// Restores the frame stored before the last deep sleep. Only valid after a timer wake, after a power cycle the
+// RTC memory is gone and the panel might show anything.
+bool restoreFrame(uint8_t* frame)
+{
+    unsigned long start = millis();
+    bool ok = false;
+    if (frameStored.location == FRAME_KEY || (frameStored.location == FRAME_RTC && frameStored.onKey))
+    {
+        ok = loadFrameKey();
+        if (ok)
+            memcpy(frame, frameKeyPixels, FRAME_SIZE);
+    }
+    if (frameStored.location == FRAME_RTC)
+        ok = (ok || !frameStored.onKey) && decodeFrameRecord(frameStored, frame);
+    Serial.println(String(ok ? "Restored" : "No") + " previous frame in " + String(millis() - start) + "ms");
+    return ok;
+}
@@ -0,0 +1,254 @@
+#define ARRAY_SIZE(a) (sizeof(a) / sizeof((a)[0]))
+
+// attributes that are kept in the entity cache, everything else is dropped while parsing
+const char* haCachedAttributes[] = {"current_temperature"};
+const char* haHigrowSuffixes[]   = {"_soil", "_temperature", "_battery", "_updated"};
+
+#define HA_CACHED_ATTRIBUTES ARRAY_SIZE(haCachedAttributes)
+#define HA_CACHE_SIZE (ARRAY_SIZE(haEntities) * ARRAY_SIZE(haHigrowSuffixes) + ARRAY_SIZE(haSensors) + ARRAY_SIZE(haFloatSensors))
+
+static_assert(HA_CACHED_ATTRIBUTES <= HA_MAX_ATTRIBUTES, "too many cached attributes");
+
+struct HAEntityCacheEntry{
+    String        entityID;
+    HAStateObject value;
+    bool          loaded; // downloaded during this refresh (successful or not)
+    bool          found;  // entity exists and the response could be parsed
+};
+
+// Refresh-scoped entity cache, keyed by entity id. Every entity is downloaded at most once per refresh,
+// either by the prefetch of the data source or on the first getter call that asks for it.
+HAEntityCacheEntry haCache[HA_CACHE_SIZE];
+int haCacheCount    = 0;
+int haCacheHits     = 0;
+int haCacheMisses   = 0;
+int haCacheRequests = 0;
+
+HAEntityCacheEntry* findCachedEntity(const char* entity)
+{
+    for (int i = 0; i < haCacheCount; i++)
+    {
+        if (haCache[i].entityID == entity)
+            return &haCache[i];
+    }
+    return NULL;
+}
+
+HAEntityCacheEntry* findCachedEntity(const String& entity)
+{
+    return findCachedEntity(entity.c_str());
+}
+
+HAEntityCacheEntry* addCachedEntity(const String& entity)
+{
+    HAEntityCacheEntry* entry = findCachedEntity(entity);
+    if (entry != NULL)
+        return entry;
+    if (entity == "" || haCacheCount >= HA_CACHE_SIZE)
+        return NULL;
+    // the count is increased last, so the entry is complete before other tasks can find it
+    entry = &haCache[haCacheCount];
+    entry->entityID = entity;
+    entry->loaded = false;
+    entry->found = false;
+    haCacheCount++;
+    return entry;
+}
+
+void resetEntityCache()
+{
+    haCacheCount = 0;
+    haCacheHits = 0;
+    haCacheMisses = 0;
+    haCacheRequests = 0;
+}
+
+void printEntityCacheStats()
+{
+    Serial.println("Entity cache: " + String(haCacheCount) + " entities, " + String(haCacheHits) + " hits, " +
+                   String(haCacheMisses) + " misses, " + String(haCacheRequests) + " HTTP requests");
+}
+
+// collect every entity id that is displayed, including the HIGROW sub sensors. The bottom bar sensors
+// are left out when they were already rendered server side.
+void collectCachedEntities(bool withFloatSensors)
+{
+    for (int i = 0; i < ARRAY_SIZE(haEntities); i++)
+    {
+        if (haEntities[i].entityName == "")
+            continue;
+        if (haEntities[i].entityType == entity_type::HIGROW)
+        {
+            for (int s = 0; s < ARRAY_SIZE(haHigrowSuffixes); s++)
+                addCachedEntity(haEntities[i].entityID + haHigrowSuffixes[s]);
+        }
+        else
+            addCachedEntity(haEntities[i].entityID);
+    }
+    for (int i = 0; i < ARRAY_SIZE(haSensors); i++)
+        addCachedEntity(haSensors[i].entityID);
+    if (!withFloatSensors)
+        return;
+    for (int i = 0; i < ARRAY_SIZE(haFloatSensors); i++)
+        addCachedEntity(haFloatSensors[i].entityID);
+}
+
+// Streams a /api/states array into the cache entries that are not loaded yet. When the whole array was parsed
+// every entry counts as loaded, entities that are not part of it do not exist in HA.
+bool cacheStatesArray(Stream& stream, int& entities, int& matched)
+{
+    HAStateParser parser(stream, haCachedAttributes, HA_CACHED_ATTRIBUTES);
+    HAStateObject object;
+    if (parser.beginArray())
+    {
+        do
+        {
+            if (!parser.parseObject(object))
+                break;
+            entities++;
+            HAEntityCacheEntry* entry = findCachedEntity(object.entityID);
+            if (entry != NULL && !entry->loaded)
+            {
+                entry->value = object;
+                entry->found = true;
+                matched++;
+                if (parser.truncated() > 0)
+                    Serial.println("Truncated " + String(parser.truncated()) + " values of " + entry->entityID);
+            }
+        } while (parser.nextArrayElement());
+    }
+    if (parser.failed())
+    {
+        Serial.println("Parsing /api/states failed after " + String(entities) + " entities");
+        return false;
+    }
+    for (int i = 0; i < haCacheCount; i++)
+        haCache[i].loaded = true;
+    return true;
+}
+
+// Values of the bottom bar, rendered server side by fetchAggregates()
+struct HAAggregates{
+    bool  valid;
+    float totalEnergy;
+    float totalPower;
+    float temperatures[ARRAY_SIZE(haFloatSensors)]; // by haFloatSensors index, TEMP sensors only
+};
+
+HAAggregates haAggregates;
+
+// stores strings as they are and anything else (numbers, booleans) as its JSON text
+void copyJsonValue(char* buffer, size_t size, JsonVariant value)
+{
+    memset(buffer, 0, size);
+    if (value.is<const char*>())
+    {
+        strncpy(buffer, value.as<const char*>(), size - 1);
+    }
+    else
+        serializeJson(value, buffer, size);
+}
+
+// Source of entity states. prefetch() fills as many cache entries as it can in one go at the start of a refresh
+// and calls progress (if not NULL) whenever more entries were loaded. fetch() loads a single entry that the getters
+// ask for and that is not loaded yet.
+class HADataSource
+{
+public:
+    virtual const char* name() = 0;
+    virtual bool prefetch(void (*progress)()) = 0;
+    virtual void fetch(HAEntityCacheEntry* entry) = 0;
+};
+
+// selected in setup(), REST (homeassistantapi.h) or MQTT (mqttdatasource.h)
+HADataSource* haDataSource = NULL;
+
+// returns the cached entity, downloading it on the first access during this refresh
+HAEntityCacheEntry* getEntity(const String& entity)
+{
+    HAEntityCacheEntry* entry = addCachedEntity(entity);
+    if (entry == NULL)
+    {
+        // cache is full, use a scratch entry that is overwritten on the next overflow
+        static HAEntityCacheEntry scratch;
+        scratch.entityID = entity;
+        scratch.loaded = false;
+        entry = &scratch;
+    }
+    if (entry->loaded)
+    {
+        haCacheHits++;
+        return entry;
+    }
+    haCacheMisses++;
+    haDataSource->fetch(entry);
+    return entry;
+}
+
+int checkOnOffState(String entity)
+{
+    HAEntityCacheEntry* entry = getEntity(entity);
+    if (!entry->found)
+    {
+        Serial.println("  - " + entity + " state: ERROR");
+        return entity_state::ERROR;
+    }
+    const char* state = entry->value.state;
+    Serial.println("  - " + entity + " state: " + state);
+    if (strcmp(state, "on") == 0){
+        return entity_state::ON;
+    }
+    if (strcmp(state, "unavailable") == 0){
+        return entity_state::UNAVAILABLE;
+    }
+    return entity_state::OFF;
+}
+
+String getSensorValue(String entity)
+{
+    HAEntityCacheEntry* entry = getEntity(entity);
+    if (!entry->found)
+        return "";
+    Serial.println("  - " + entity + " state: " + entry->value.state);
+    return entry->value.state;
+}
+
+// only attributes listed in haCachedAttributes, last_changed and last_updated are available
+String getSensorAttributeValue(String entity, String attribute)
+{
+    HAEntityCacheEntry* entry = getEntity(entity);
+    if (!entry->found)
+        return "";
+    String attr = "";
+    bool cached = false;
+    if (attribute == "last_changed")
+    {
+        attr = entry->value.lastChanged;
+        cached = true;
+    }
+    if (attribute == "last_updated")
+    {
+        attr = entry->value.lastUpdated;
+        cached = true;
+    }
+    for (int a = 0; a < HA_CACHED_ATTRIBUTES; a++)
+    {
+        if (attribute == haCachedAttributes[a])
+        {
+            attr = entry->value.attributes[a];
+            cached = true;
+        }
+    }
+    if (!cached)
+        Serial.println("Attribute '" + attribute + "' is not cached, add it to haCachedAttributes");
+    Serial.println("  - " + entity + ".Attributes[" + attribute + "]: " + attr);
+    if (attr != "" && attr != "null")
+        return attr;
+    return "";
+}
+
+float getSensorFloatValue(String entity)
+{
+    String state = getSensorValue(entity);
+    return  state.toFloat();
+}
@@ -0,0 +1,377 @@
+// Streaming parser for Home Assistant state objects as returned by /api/states and /api/states/<entity_id>.
+// Only entity_id, state, last_changed, last_updated and a given list of attribute keys are extracted, directly from the
+// byte stream into fixed size buffers; everything else (e.g. large attribute blobs of climate or media entities)
+// is skipped without being stored. No heap is allocated. Values that do not fit their buffer are truncated at a UTF-8
+// character boundary and counted in truncated(); a truncated key matches none of the extracted keys and a truncated
+// entity_id is left empty, so that neither can be mistaken for a shorter one.
+
+#define HA_ENTITY_ID_LENGTH 64
+#define HA_STATE_LENGTH     32
+#define HA_TIMESTAMP_LENGTH 36
+#define HA_ATTRIBUTE_LENGTH 24
+#define HA_MAX_ATTRIBUTES   4
+#define HA_KEY_LENGTH       32
+
+struct HAStateObject{
+    char entityID[HA_ENTITY_ID_LENGTH];
+    char state[HA_STATE_LENGTH];
+    char lastChanged[HA_TIMESTAMP_LENGTH];
+    char lastUpdated[HA_TIMESTAMP_LENGTH];
+    char attributes[HA_MAX_ATTRIBUTES][HA_ATTRIBUTE_LENGTH];
+};
+
+class HAStateParser
+{
+public:
+    // attributeKeys[i] is stored in HAStateObject::attributes[i], at most HA_MAX_ATTRIBUTES keys are used
+    HAStateParser(Stream& stream, const char* const* attributeKeys, int attributeCount)
+        : stream(stream), attributeKeys(attributeKeys), attributeCount(min(attributeCount, HA_MAX_ATTRIBUTES)) {}
+
+    // parses a single state object
+    bool parseObject(HAStateObject& object)
+    {
+        memset(&object, 0, sizeof(object));
+        truncatedValues = 0;
+        if (!expect('{'))
+            return false;
+        if (skipWhitespace() == '}')
+            return next() == '}';
+        while (true)
+        {
+            char key[HA_KEY_LENGTH];
+            if (!parseKey(key) || !expect(':'))
+                return false;
+            bool ok;
+            if (strcmp(key, "entity_id") == 0)
+            {
+                int before = truncatedValues;
+                ok = parseValue(object.entityID, sizeof(object.entityID));
+                if (truncatedValues > before)
+                    object.entityID[0] = '\0';
+            }
+            else if (strcmp(key, "state") == 0)
+                ok = parseValue(object.state, sizeof(object.state));
+            else if (strcmp(key, "last_changed") == 0)
+                ok = parseValue(object.lastChanged, sizeof(object.lastChanged));
+            else if (strcmp(key, "last_updated") == 0)
+                ok = parseValue(object.lastUpdated, sizeof(object.lastUpdated));
+            else if (strcmp(key, "attributes") == 0 && skipWhitespace() == '{')
+                ok = parseAttributes(object);
+            else
+                ok = skipValue();
+            if (!ok)
+                return false;
+            int c = skipWhitespace();
+            next();
+            if (c == '}')
+                return true;
+            if (c != ',')
+                return fail();
+        }
+    }
+
+    // consumes the opening bracket of an array of state objects, false if the array is empty (or on error)
+    bool beginArray()
+    {
+        if (!expect('['))
+            return false;
+        if (skipWhitespace() != ']')
+            return true;
+        next();
+        return false;
+    }
+
+    // consumes the separator after an array element, false at the end of the array (or on error)
+    bool nextArrayElement()
+    {
+        int c = skipWhitespace();
+        next();
+        if (c != ',' && c != ']')
+            fail();
+        return c == ',';
+    }
+
+    bool failed()
+    {
+        return error;
+    }
+
+    // keys and values of the last parsed object that did not fit their buffer
+    int truncated()
+    {
+        return truncatedValues;
+    }
+
+private:
+    // a key that does not fit is replaced with an empty one, which is not extracted
+    bool parseKey(char* key)
+    {
+        int before = truncatedValues;
+        if (!parseString(key, HA_KEY_LENGTH))
+            return false;
+        if (truncatedValues > before)
+            key[0] = '\0';
+        return true;
+    }
+
+    bool parseAttributes(HAStateObject& object)
+    {
+        if (!expect('{'))
+            return false;
+        if (skipWhitespace() == '}')
+            return next() == '}';
+        while (true)
+        {
+            char key[HA_KEY_LENGTH];
+            if (!parseKey(key) || !expect(':'))
+                return false;
+            int index = -1;
+            for (int a = 0; a < attributeCount && key[0] != '\0'; a++)
+            {
+                if (strcmp(key, attributeKeys[a]) == 0)
+                    index = a;
+            }
+            if (!(index >= 0 ? parseValue(object.attributes[index], HA_ATTRIBUTE_LENGTH) : skipValue()))
+                return false;
+            int c = skipWhitespace();
+            next();
+            if (c == '}')
+                return true;
+            if (c != ',')
+                return fail();
+        }
+    }
+
+    // stores strings unescaped and numbers/literals as their text, objects and arrays are skipped
+    bool parseValue(char* buffer, size_t size)
+    {
+        int c = skipWhitespace();
+        if (c == '"')
+            return parseString(buffer, size);
+        if (c == '{' || c == '[')
+        {
+            buffer[0] = '\0';
+            return skipValue();
+        }
+        size_t length = 0;
+        bool truncated = false;
+        while (c >= 0 && c != ',' && c != '}' && c != ']' && !isspace(c))
+        {
+            append(buffer, size, length, truncated, c);
+            next();
+            c = peek();
+        }
+        buffer[length] = '\0';
+        return length > 0 || fail();
+    }
+
+    bool parseString(char* buffer, size_t size)
+    {
+        size_t length = 0;
+        bool truncated = false;
+        if (!expect('"'))
+            return false;
+        while (true)
+        {
+            int c = next();
+            if (c < 0)
+                return fail();
+            if (c == '"')
+                break;
+            if (c == '\\')
+            {
+                c = next();
+                switch (c)
+                {
+                    case 'b': c = '\b'; break;
+                    case 'f': c = '\f'; break;
+                    case 'n': c = '\n'; break;
+                    case 'r': c = '\r'; break;
+                    case 't': c = '\t'; break;
+                    case 'u':
+                    {
+                        uint32_t codePoint = 0;
+                        for (int i = 0; i < 4; i++)
+                        {
+                            int h = next();
+                            if (!isxdigit(h))
+                                return fail();
+                            codePoint = (codePoint << 4) | (isdigit(h) ? h - '0' : (tolower(h) - 'a' + 10));
+                        }
+                        if (codePoint >= 0xD800 && codePoint <= 0xDFFF)
+                            codePoint = '?'; // surrogate pairs are outside of the font ranges anyway
+                        appendUtf8(buffer, size, length, truncated, codePoint);
+                        continue;
+                    }
+                    default:
+                        if (c < 0)
+                            return fail();
+                        break; // \" \\ \/
+                }
+            }
+            append(buffer, size, length, truncated, c);
+        }
+        buffer[length] = '\0';
+        return true;
+    }
+
+    // appends a byte of a value; the first byte that does not fit counts the value as truncated and, if it continues a
+    // UTF-8 sequence, removes the start of that sequence, the bytes after it are dropped
+    void append(char* buffer, size_t size, size_t& length, bool& truncated, int c)
+    {
+        if (truncated)
+            return;
+        if (length + 1 < size)
+        {
+            buffer[length++] = c;
+            return;
+        }
+        truncated = true;
+        truncatedValues++;
+        if ((c & 0xC0) != 0x80)
+            return;
+        while (length > 0 && (buffer[length - 1] & 0xC0) == 0x80)
+            length--;
+        if (length > 0 && (buffer[length - 1] & 0xC0) == 0xC0)
+            length--;
+    }
+
+    void appendUtf8(char* buffer, size_t size, size_t& length, bool& truncated, uint32_t codePoint)
+    {
+        char encoded[3];
+        size_t n;
+        if (codePoint < 0x80)
+        {
+            encoded[0] = codePoint;
+            n = 1;
+        }
+        else if (codePoint < 0x800)
+        {
+            encoded[0] = 0xC0 | (codePoint >> 6);
+            encoded[1] = 0x80 | (codePoint & 0x3F);
+            n = 2;
+        }
+        else
+        {
+            encoded[0] = 0xE0 | (codePoint >> 12);
+            encoded[1] = 0x80 | ((codePoint >> 6) & 0x3F);
+            encoded[2] = 0x80 | (codePoint & 0x3F);
+            n = 3;
+        }
+        if (!truncated && length + n < size)
+        {
+            memcpy(buffer + length, encoded, n);
+            length += n;
+        }
+        else if (!truncated)
+        {
+            truncated = true;
+            truncatedValues++;
+        }
+    }
+
+    // skips any JSON value, nested objects and arrays are tracked by depth only
+    bool skipValue()
+    {
+        int c = skipWhitespace();
+        if (c == '"')
+            return skipString();
+        if (c != '{' && c != '[')
+        {
+            // a skipped number is not a truncated value
+            char literal[8];
+            int truncated = truncatedValues;
+            bool ok = parseValue(literal, sizeof(literal));
+            truncatedValues = truncated;
+            return ok;
+        }
+        int depth = 0;
+        do
+        {
+            c = peek();
+            if (c < 0)
+                return fail();
+            if (c == '"')
+            {
+                if (!skipString())
+                    return false;
+                continue;
+            }
+            if (c == '{' || c == '[')
+                depth++;
+            else if (c == '}' || c == ']')
+                depth--;
+            next();
+        } while (depth > 0);
+        return true;
+    }
+
+    bool skipString()
+    {
+        if (!expect('"'))
+            return false;
+        while (true)
+        {
+            int c = next();
+            if (c < 0)
+                return fail();
+            if (c == '"')
+                return true;
+            if (c == '\\' && next() < 0)
+                return fail();
+        }
+    }
+
+    bool expect(char expected)
+    {
+        if (skipWhitespace() != expected)
+            return fail();
+        next();
+        return true;
+    }
+
+    int skipWhitespace()
+    {
+        int c = peek();
+        while (c >= 0 && isspace(c))
+        {
+            next();
+            c = peek();
+        }
+        return c;
+    }
+
+    // one byte look-ahead on top of the stream, reads block until the stream timeout
+    int peek()
+    {
+        if (lookahead == NONE)
+        {
+            char c;
+            lookahead = stream.readBytes(&c, 1) == 1 ? (uint8_t)c : END;
+        }
+        return lookahead;
+    }
+
+    int next()
+    {
+        int c = peek();
+        if (c != END)
+            lookahead = NONE;
+        return c;
+    }
+
+    bool fail()
+    {
+        error = true;
+        return false;
+    }
+
+    enum { NONE = -2, END = -1 };
+
+    Stream& stream;
+    const char* const* attributeKeys;
+    int  attributeCount;
+    int  lookahead = NONE;
+    bool error = false;
+    int  truncatedValues = 0;
+};
@@ -1,37 +1,492 @@
-HTTPClient http;
-WiFiClientSecure client;
+#define HA_RESPONSE_TIMEOUT_MS 5000 // for the status line and headers of a pipelined response, like HTTPClient
 
-int checkOnOffState(String entity)
+// Client for the HA REST API that keeps one keep-alive connection to ha_server open for all requests of a wake.
+// The Authorization header is built once, the connection is (re-)established only when the server closed it.
+// An https server is connected with TLS, its certificate is checked against rootCA unless that is empty.
+class HAClient
 {
-    String api_url = ha_server + "/api/states/" + entity;
-    http.begin(api_url);
-    http.addHeader("Authorization", "Bearer " + ha_token);
-    int code = http.GET();
+public:
+    HAClient(const String& server, const String& token, const char* rootCA = "")
+        : tcp(server.startsWith("https://") ? (WiFiClient&)tls : plain)
+    {
+        String hostPort = server;
+        int scheme = hostPort.indexOf("://");
+        secure = server.startsWith("https://");
+        if (scheme >= 0)
+            hostPort = hostPort.substring(scheme + 3);
+        int slash = hostPort.indexOf('/');
+        if (slash >= 0)
+            hostPort = hostPort.substring(0, slash);
+        int colon = hostPort.indexOf(':');
+        host = colon >= 0 ? hostPort.substring(0, colon) : hostPort;
+        port = colon >= 0 ? hostPort.substring(colon + 1).toInt() : (secure ? 443 : 80);
+        authorization = "Bearer " + token;
+        http.setReuse(true);
+        if (secure && rootCA[0] != '\0')
+            tls.setCACert(rootCA);
+        else if (secure)
+            tls.setInsecure(); // encrypted, but the server is not authenticated
+    }
+
+    // sends a GET request, the response body can be read from getStream() until end() is called
+    int GET(const String& path)
+    {
+        return send(path, NULL);
+    }
+
+    // sends a POST request with a JSON body, the response body can be read from getStream() until end() is called
+    int POST(const String& path, const String& body)
+    {
+        return send(path, &body);
+    }
+
+    WiFiClient& getStream()
+    {
+        return tcp;
+    }
+
+    // finishes the current request, the connection is kept open if the server allows it
+    void end()
+    {
+        http.end();
+    }
+
+    void stop()
+    {
+        tcp.stop();
+    }
+
+    // HTTP/1.1 pipelining: requests are written with sendGET() back to back and their responses are read
+    // afterwards in the same order with readResponseHeaders(), followed by exactly contentLength body bytes.
+    // A request that could not be written completely closes the connection, the requests sent on it are lost.
+    bool sendGET(const String& path)
+    {
+        if (!tcp.connected() && !connect())
+            return false;
+        String request = "GET " + path + " HTTP/1.1\r\nHost: " + host + "\r\nAuthorization: " + authorization +
+                         "\r\nConnection: keep-alive\r\n\r\n";
+        if (tcp.print(request) != request.length())
+        {
+            Serial.println("Short write of the request for " + path + ", closing the HA connection");
+            tcp.stop();
+            return false;
+        }
+        requests++;
+        return true;
+    }
+
+    // reads the status line and headers of the next response, returns the HTTP code or a negative error
+    int readResponseHeaders(long& contentLength)
+    {
+        unsigned long start = millis();
+        contentLength = -1;
+        String status;
+        int error = readLine(status);
+        if (error < 0)
+            return error;
+        if (!status.startsWith("HTTP/1."))
+            return HTTPC_ERROR_NO_HTTP_SERVER;
+        int code = status.substring(9, 12).toInt();
+        while (true)
+        {
+            String line;
+            error = readLine(line);
+            if (error < 0)
+                return error;
+            line.trim();
+            if (line.length() == 0)
+                break;
+            int colon = line.indexOf(':');
+            if (colon < 0)
+                continue;
+            String name = line.substring(0, colon);
+            String value = line.substring(colon + 1);
+            name.toLowerCase();
+            value.trim();
+            if (name == "content-length")
+                contentLength = value.toInt();
+            else if (name == "transfer-encoding" && value.indexOf("chunked") >= 0)
+                code = HTTPC_ERROR_ENCODING;
+        }
+        requestMs += millis() - start;
+        return code;
+    }
+
+    bool isSecure()
+    {
+        return secure;
+    }
+
+    // HTTP code or error of the first GET/POST of this wake, 0 before it
+    int getFirstResult()
+    {
+        return firstResult;
+    }
+
+    const String& getHost()
+    {
+        return host;
+    }
+
+    uint16_t getPort()
+    {
+        return port;
+    }
+
+    void printStats()
+    {
+        Serial.println("HA client: " + String(connects) + " connects in " + String(connectMs) + "ms, " +
+                       String(requests) + " requests in " + String(requestMs) + "ms");
+    }
+
+private:
+    // reads a line without its line end, waits up to HA_RESPONSE_TIMEOUT_MS for every byte instead of the 1s
+    // stream timeout, so a response that takes longer than that to start is not taken for a lost connection
+    int readLine(String& line)
+    {
+        unsigned long lastData = millis();
+        while (true)
+        {
+            int c = tcp.read();
+            if (c < 0)
+            {
+                if (!tcp.connected())
+                    return HTTPC_ERROR_CONNECTION_LOST;
+                if (millis() - lastData > HA_RESPONSE_TIMEOUT_MS)
+                    return HTTPC_ERROR_READ_TIMEOUT;
+                delay(1);
+                continue;
+            }
+            lastData = millis();
+            if (c == '\n')
+                return 0;
+            line += (char)c;
+        }
+    }
+
+    bool connect()
+    {
+        unsigned long start = millis();
+        bool ok = tcp.connect(host.c_str(), port);
+        connectMs += millis() - start;
+        connects++;
+        if (!ok)
+            Serial.println("Error connecting to HA at " + host + ":" + String(port));
+        return ok;
+    }
+
+    int send(const String& path, const String* body)
+    {
+        bool reused = tcp.connected();
+        int code = reused || connect() ? request(path, body) : HTTPC_ERROR_CONNECTION_REFUSED;
+        if (code < 0 && reused)
+        {
+            // the server closed the idle connection, retry once on a fresh one
+            Serial.println("HA connection lost (" + HTTPClient::errorToString(code) + "), reconnecting");
+            tcp.stop();
+            code = connect() ? request(path, body) : HTTPC_ERROR_CONNECTION_REFUSED;
+        }
+        // after a failed (e.g. partly written) request the connection is out of sync, the next one starts afresh
+        if (code < 0)
+            tcp.stop();
+        if (firstResult == 0)
+            firstResult = code;
+        return code;
+    }
+
+    int request(const String& path, const String* body)
+    {
+        unsigned long start = millis();
+        http.begin(tcp, host, port, path);
+        http.addHeader("Authorization", authorization);
+        int code;
+        if (body != NULL)
+        {
+            http.addHeader("Content-Type", "application/json");
+            code = http.POST(*body);
+        }
+        else
+            code = http.GET();
+        requestMs += millis() - start;
+        requests++;
+        return code;
+    }
+
+    WiFiClient plain;
+    WiFiClientSecure tls;
+    WiFiClient& tcp;
+    HTTPClient http;
+    bool secure;
+    String host;
+    uint16_t port;
+    String authorization;
+    int connects = 0;
+    int requests = 0;
+    int firstResult = 0;
+    unsigned long connectMs = 0;
+    unsigned long requestMs = 0;
+};
+
+HAClient haClient(ha_server, ha_token, ha_root_ca);
+
+// Stream that ends after a fixed number of bytes, used to parse one response body of a pipelined connection
+class BoundedStream : public Stream
+{
+public:
+    BoundedStream(Stream& stream, long length) : stream(stream), remaining(length) {}
+
+    int available() override
+    {
+        return remaining > 0 ? min((long)stream.available(), remaining) : 0;
+    }
+
+    int read() override
+    {
+        char c;
+        if (remaining <= 0 || stream.readBytes(&c, 1) != 1)
+            return -1;
+        remaining--;
+        return (uint8_t)c;
+    }
+
+    int peek() override
+    {
+        return remaining > 0 ? stream.peek() : -1;
+    }
+
+    size_t write(uint8_t) override
+    {
+        return 0;
+    }
+
+    // skip what is left of the body so the next response can be read
+    bool drain()
+    {
+        while (remaining > 0 && read() >= 0);
+        return remaining == 0;
+    }
+
+private:
+    Stream& stream;
+    long remaining;
+};
+
+#define HA_MAX_PIPELINE_DEPTH 16
+
+// parses one state object from the stream into the cache entry
+bool parseCachedEntity(HAEntityCacheEntry* entry, Stream& stream)
+{
+    HAStateParser parser(stream, haCachedAttributes, HA_CACHED_ATTRIBUTES);
+    entry->found = parser.parseObject(entry->value);
+    if (!entry->found)
+        Serial.println("Parsing state of " + entry->entityID + " failed");
+    else if (parser.truncated() > 0)
+        Serial.println("Truncated " + String(parser.truncated()) + " values of " + entry->entityID);
+    return entry->found;
+}
+
+// Fetch the state of all configured entities with a single GET /api/states.
+// The response is an array of all entities in HA, which can be far too large to hold in memory,
+// so it is parsed while streaming and only the cached fields of configured entities are kept.
+bool fetchAllStates(void (*progress)() = NULL)
+{
+    unsigned long start = millis();
+    collectCachedEntities(!haAggregates.valid);
+
+    String api_path = "/api/states";
+    haCacheRequests++;
+    int code = haClient.GET(api_path);
     if (code != HTTP_CODE_OK)
     {
-        Serial.println("Error '" + String(code) + "' connecting to HA API: " + api_url);
-        return entity_state::ERROR;
+        haClient.end();
+        Serial.println("Error '" + String(code) + "' connecting to HA API: " + api_path);
+        return false;
     }
-    DynamicJsonDocument doc(4096);
-    DeserializationError error = deserializeJson(doc, http.getStream());
-    http.end();
+
+    int entities = 0;
+    int matched = 0;
+    bool ok = cacheStatesArray(haClient.getStream(), entities, matched);
+    haClient.end();
+    if (ok && progress != NULL)
+        progress();
+    Serial.println("Fetched " + String(matched) + "/" + String(haCacheCount) + " entities out of " + String(entities) +
+                   " in " + String(millis() - start) + "ms, free heap: " + String(ESP.getFreeHeap()) + ", min free heap: " + String(ESP.getMinFreeHeap()));
+    return ok;
+}
+
+// download a single entity into its cache entry
+void fetchEntity(HAEntityCacheEntry* entry)
+{
+    entry->found = false;
+
+    String api_path = "/api/states/" + entry->entityID;
+    haCacheRequests++;
+    int code = haClient.GET(api_path);
+    if (code == HTTP_CODE_OK)
+        parseCachedEntity(entry, haClient.getStream());
+    else
+        Serial.println("Error '" + String(code) + "' connecting to HA API for: " + api_path);
+    haClient.end();
+    // last, a loaded entry is complete for the render task
+    entry->loaded = true;
+}
+
+// Fetch all configured entities that are not cached yet with pipelined single-entity requests.
+// Up to ha_pipeline_depth GET requests are written back to back on the keep-alive connection before the
+// responses are parsed in order, which saves a round trip per entity compared to request/response ping-pong.
+// Entities whose response could not be read stay unloaded and are fetched one by one on first access.
+void fetchEntitiesPipelined(void (*progress)() = NULL)
+{
+    unsigned long start = millis();
+    collectCachedEntities(!haAggregates.valid);
+
+    int depth = constrain(ha_pipeline_depth, 1, HA_MAX_PIPELINE_DEPTH);
+    HAEntityCacheEntry* batch[HA_MAX_PIPELINE_DEPTH];
+    int next = 0;
+    int fetched = 0;
+    bool ok = true;
+    bool resent = false;
+    while (ok && next < haCacheCount)
+    {
+        int first = next;
+        int n = 0;
+        bool sent = true;
+        while (sent && next < haCacheCount && n < depth)
+        {
+            if (!haCache[next].loaded)
+            {
+                sent = haClient.sendGET("/api/states/" + haCache[next].entityID);
+                if (!sent)
+                    break;
+                batch[n++] = &haCache[next];
+                haCacheRequests++;
+            }
+            next++;
+        }
+        if (!sent)
+        {
+            // the requests of the batch were lost with the connection, send them again once on a fresh one
+            ok = !resent;
+            resent = true;
+            next = first;
+            continue;
+        }
+        if (n == 0)
+            break;
+
+        for (int i = 0; i < n; i++)
+        {
+            long length;
+            int code = haClient.readResponseHeaders(length);
+            if (code < 0 || length < 0)
+            {
+                Serial.println("Error '" + String(code) + "' reading pipelined response for: " + batch[i]->entityID);
+                ok = false;
+                break;
+            }
+            batch[i]->found = false;
+            BoundedStream body(haClient.getStream(), length);
+            if (code == HTTP_CODE_OK)
+            {
+                if (parseCachedEntity(batch[i], body))
+                    fetched++;
+            }
+            else
+                Serial.println("Error '" + String(code) + "' connecting to HA API for: /api/states/" + batch[i]->entityID);
+            batch[i]->loaded = true;
+            if (!body.drain())
+            {
+                ok = false;
+                break;
+            }
+        }
+        if (progress != NULL)
+            progress();
+    }
+    if (!ok)
+    {
+        // the connection is out of sync, the remaining entities are requested one by one
+        haClient.stop();
+    }
+    Serial.println("Fetched " + String(fetched) + "/" + String(haCacheCount) + " entities pipelined in " + String(millis() - start) + "ms");
+}
+
+String jsonEscape(const String& text)
+{
+    String escaped;
+    escaped.reserve(text.length() + 16);
+    for (int i = 0; i < text.length(); i++)
+    {
+        char c = text[i];
+        if (c == '"' || c == '\\')
+            escaped += '\\';
+        escaped += c;
+    }
+    return escaped;
+}
+
+// Jinja template that renders all bottom bar values as one compact JSON line
+String buildAggregateTemplate()
+{
+    String energy;
+    String power;
+    String temperatures;
+    for (int i = 0; i < ARRAY_SIZE(haFloatSensors); i++)
+    {
+        String state = "states('" + haFloatSensors[i].entityID + "')";
+        if (haFloatSensors[i].entityType == sensor_type::ENERGYMETER)
+            energy += (energy == "" ? "" : ",") + state;
+        else if (haFloatSensors[i].entityType == sensor_type::ENERGYMETERPWR)
+            power += (power == "" ? "" : ",") + state;
+        else if (haFloatSensors[i].entityType == sensor_type::TEMP)
+            temperatures += String(temperatures == "" ? "" : ",") + "(state_attr('" + haFloatSensors[i].entityID + "','current_temperature') or " + state + ")|float(0)";
+    }
+    return "{\"energy\":{{[" + energy + "]|map('float',0)|sum}},"
+           "\"power\":{{[" + power + "]|map('float',0)|sum}},"
+           "\"temp\":[{{[" + temperatures + "]|join(',')}}]}";
+}
+
+// Render the energy sums and temperatures with a single POST /api/template instead of
+// one request per sensor. The per-entity path is used for anything that could not be aggregated.
+bool fetchAggregates()
+{
+    unsigned long start = millis();
+    haAggregates.valid = false;
+
+    String api_path = "/api/template";
+    int code = haClient.POST(api_path, "{\"template\":\"" + jsonEscape(buildAggregateTemplate()) + "\"}");
+    if (code != HTTP_CODE_OK)
+    {
+        haClient.end();
+        Serial.println("Error '" + String(code) + "' connecting to HA API: " + api_path);
+        return false;
+    }
+    StaticJsonDocument<512> doc;
+    DeserializationError error = deserializeJson(doc, haClient.getStream());
+    haClient.end();
     if (error)
     {
         Serial.print(F("deserializeJson() failed: "));
         Serial.println(error.f_str());
-        return entity_state::ERROR;
-    }
-    String state = doc["state"];
-    Serial.println("  - " + entity + " state: " + state);
-    if (state == "on"){
-        return entity_state::ON;
+        return false;
     }
-    if (state == "unavailable"){
-        return entity_state::UNAVAILABLE;
+    haAggregates.totalEnergy = doc["energy"];
+    haAggregates.totalPower = doc["power"];
+    int t = 0;
+    for (int i = 0; i < ARRAY_SIZE(haFloatSensors); i++)
+    {
+        haAggregates.temperatures[i] = 0;
+        if (haFloatSensors[i].entityType == sensor_type::TEMP)
+            haAggregates.temperatures[i] = doc["temp"][t++];
     }
-    return entity_state::OFF;
+    haAggregates.valid = true;
+    Serial.println("Aggregates: energy " + String(haAggregates.totalEnergy) + ", power " + String(haAggregates.totalPower) +
+                   " in " + String(millis() - start) + "ms");
+    return true;
 }
 
+// The run state, time zone and version always come from /api/config: templates can render none of them reliably
+// (the version of the update entity is "None" on Core and Container installs).
 HAConfigurations getHaStatus()
 {
     HAConfigurations haConfigs;
@@ -39,14 +494,12 @@ HAConfigurations getHaStatus()
     haConfigs.timeZone = "ERROR";
     haConfigs.version  = "ERROR"; 
 
-    String api_url = ha_server + "/api/config";
-    http.begin(api_url);
-    http.addHeader("Authorization", "Bearer " + ha_token);
-    int code = http.GET();
+    String api_path = "/api/config";
+    int code = haClient.GET(api_path);
     if (code != HTTP_CODE_OK)
     {
-        http.end();
-        Serial.println("Error '" + String(code) + "' connecting to HA API: " + api_url);
+        haClient.end();
+        Serial.println("Error '" + String(code) + "' connecting to HA API: " + api_path);
         return haConfigs;
     }
     DynamicJsonDocument doc(4096);
@@ -55,8 +508,8 @@ HAConfigurations getHaStatus()
     filter["time_zone"] = true;
     filter["version"] = true;
     filter["state"] = true;
-    DeserializationError error = deserializeJson(doc, http.getStream(), DeserializationOption::Filter(filter));
-    http.end();
+    DeserializationError error = deserializeJson(doc, haClient.getStream(), DeserializationOption::Filter(filter));
+    haClient.end();
     if (error)
     {
         Serial.print(F("deserializeJson() failed: "));
@@ -73,73 +526,38 @@ HAConfigurations getHaStatus()
     return haConfigs;
 }
 
-String getSensorValue(String entity)
+// The REST API as data source: everything with a single GET /api/states, then pipelined single-entity requests for
+// whatever is left (without bulk fetch or if it failed)
+class HARestDataSource : public HADataSource
 {
-    String api_url = ha_server + "/api/states/" + entity;
-    http.begin(api_url);
-    http.addHeader("Authorization", "Bearer " + ha_token);
-    int code = http.GET();
-    if (code != HTTP_CODE_OK)
-    {
-        Serial.println("Error '" + String(code) + "' connecting to HA API for: " + api_url);
-        return "";
-    }
-    DynamicJsonDocument doc(4096);
-    DeserializationError error = deserializeJson(doc, http.getStream());
-    http.end();
-    if (error)
+public:
+    const char* name() override
     {
-        Serial.print(F("deserializeJson() failed: "));
-        Serial.println(error.f_str());
-        return "";
+        return "HA REST API";
     }
-    String state = doc["state"];
-    Serial.println("  - " + entity + " state: " + state);
-    return state;
-}
 
-String getSensorAttributeValue(String entity, String attribute)
-{
-    String api_url = ha_server + "/api/states/" + entity;
-    http.begin(api_url);
-    http.addHeader("Authorization", "Bearer " + ha_token);
-    int code = http.GET();
-    if (code != HTTP_CODE_OK)
+    bool prefetch(void (*progress)()) override
     {
-        Serial.println("Error '" + String(code) + "' connecting to HA API for: " + api_url);
-        return "";
+        bool ok = false;
+        if (ha_bulk_fetch)
+        {
+            Serial.println("Fetching all states...");
+            ok = fetchAllStates(progress);
+        }
+        if (ha_pipeline_depth > 1)
+        {
+            // no-op for entities that were already fetched in bulk
+            Serial.println("Fetching remaining states pipelined...");
+            fetchEntitiesPipelined(progress);
+            ok = true;
+        }
+        return ok;
     }
-    DynamicJsonDocument doc(4096);
-    DeserializationError error = deserializeJson(doc, http.getStream());
-    http.end();
 
-    if (error)
+    void fetch(HAEntityCacheEntry* entry) override
     {
-        Serial.print(F("deserializeJson() failed: "));
-        Serial.println(error.f_str());
-        return "";
-    }
-    // read attribute
-    String attr = doc["attributes"][attribute];
-    if (attr != NULL && attr != "" && attr != "null")
-    {
-        Serial.println("  - " + entity + ".Attributes[" + attribute + "]: " + attr);
-        return attr;
-    }
-    // try entity properties
-    String coreAttr = doc[attribute];
-    if (coreAttr != NULL && coreAttr != "" && coreAttr != "null")
-    {
-        Serial.println("  - " + entity + "[" + attribute + "]: " + coreAttr);
-        return coreAttr;
+        fetchEntity(entry);
     }
+};
 
-    Serial.println("  - " + entity + ".Attributes[" + attribute + "]: " + attr);
-    return "";
-}
-
-float getSensorFloatValue(String entity)
-{
-    String state = getSensorValue(entity);
-    return  state.toFloat();
-}
+HARestDataSource haRestDataSource;
@@ -0,0 +1,180 @@
+// Push mode: client for the HA WebSocket API that authenticates, subscribes to all configured entities with
+// subscribe_entities and applies the compressed state diffs it receives to the entity cache.
+// Every entity whose cached value changed is reported through haEntityChangedCallback.
+
+WebSocketsClient haWebSocket;
+void (*haEntityChangedCallback)(const char* entity) = NULL;
+unsigned long haWsLastEventMs = 0; // millis() of the last state event, to measure update to pixel latency
+int haWsEvents = 0;
+
+// The WebSocket sends timestamps as epoch seconds, they are stored like the REST API returns them
+// (2024-06-01T11:58:01.123456+00:00), so the cache looks the same whichever API filled it
+void copyTimestamp(char* buffer, size_t size, JsonVariant value)
+{
+    if (!value.is<double>())
+    {
+        copyJsonValue(buffer, size, value);
+        return;
+    }
+    long long us = llround(value.as<double>() * 1000000.0);
+    time_t seconds = us / 1000000;
+    struct tm utc;
+    gmtime_r(&seconds, &utc);
+    size_t length = strftime(buffer, size, "%Y-%m-%dT%H:%M:%S", &utc);
+    if (us % 1000000 != 0)
+        length += snprintf(buffer + length, size - length, ".%06d", (int)(us % 1000000));
+    snprintf(buffer + length, size - length, "+00:00");
+}
+
+// applies a compressed state ("s" state, "a" attributes, "lc" last changed, "lu" last updated) to the entry
+void applyCompressedState(HAEntityCacheEntry* entry, JsonObject state)
+{
+    if (state.containsKey("s"))
+        copyJsonValue(entry->value.state, sizeof(entry->value.state), state["s"]);
+    if (state.containsKey("lc"))
+        copyTimestamp(entry->value.lastChanged, sizeof(entry->value.lastChanged), state["lc"]);
+    // "lu" is left out when it equals "lc"
+    if (state.containsKey("lu"))
+        copyTimestamp(entry->value.lastUpdated, sizeof(entry->value.lastUpdated), state["lu"]);
+    else if (state.containsKey("lc"))
+        copyTimestamp(entry->value.lastUpdated, sizeof(entry->value.lastUpdated), state["lc"]);
+    JsonObject attributes = state["a"];
+    for (int a = 0; !attributes.isNull() && a < HA_CACHED_ATTRIBUTES; a++)
+    {
+        if (attributes.containsKey(haCachedAttributes[a]))
+            copyJsonValue(entry->value.attributes[a], HA_ATTRIBUTE_LENGTH, attributes[haCachedAttributes[a]]);
+    }
+}
+
+// Reports the entry if what its tiles show changed: whether it exists, its state or a cached attribute. The timestamps
+// are not shown, an update of "lu" alone (e.g. a sensor that reported the same value again) redraws nothing.
+void changedEntity(HAEntityCacheEntry* entry, const HAStateObject& before, bool foundBefore)
+{
+    bool changed = foundBefore != entry->found || strcmp(before.state, entry->value.state) != 0;
+    for (int a = 0; a < HA_CACHED_ATTRIBUTES; a++)
+        changed |= strcmp(before.attributes[a], entry->value.attributes[a]) != 0;
+    if (!changed)
+        return;
+    Serial.println("  - " + entry->entityID + " state: " + entry->value.state);
+    if (haEntityChangedCallback != NULL)
+        haEntityChangedCallback(entry->entityID.c_str());
+}
+
+void sendSubscribeEntities()
+{
+    collectCachedEntities(!haAggregates.valid);
+    String message = "{\"id\":1,\"type\":\"subscribe_entities\",\"entity_ids\":[";
+    for (int i = 0; i < haCacheCount; i++)
+        message += String(i > 0 ? "," : "") + "\"" + haCache[i].entityID + "\"";
+    message += "]}";
+    haWebSocket.sendTXT(message);
+}
+
+void handleHaWebSocketEvent(JsonObject event)
+{
+    haWsLastEventMs = millis();
+    haWsEvents++;
+    // "a": entities added with their full state (the first event after subscribing)
+    for (JsonPair added : event["a"].as<JsonObject>())
+    {
+        HAEntityCacheEntry* entry = findCachedEntity(added.key().c_str());
+        if (entry == NULL)
+            continue;
+        HAStateObject before = entry->value;
+        bool foundBefore = entry->found;
+        memset(entry->value.attributes, 0, sizeof(entry->value.attributes));
+        applyCompressedState(entry, added.value());
+        entry->loaded = true;
+        entry->found = true;
+        changedEntity(entry, before, foundBefore);
+    }
+    // "c": changes, "+" holds changed values, "-" removed attributes
+    for (JsonPair changed : event["c"].as<JsonObject>())
+    {
+        HAEntityCacheEntry* entry = findCachedEntity(changed.key().c_str());
+        if (entry == NULL)
+            continue;
+        HAStateObject before = entry->value;
+        applyCompressedState(entry, changed.value()["+"]);
+        for (JsonVariant removed : changed.value()["-"]["a"].as<JsonArray>())
+        {
+            for (int a = 0; a < HA_CACHED_ATTRIBUTES; a++)
+            {
+                if (removed == haCachedAttributes[a])
+                    entry->value.attributes[a][0] = '\0';
+            }
+        }
+        changedEntity(entry, before, entry->found);
+    }
+    // "r": removed entities
+    for (JsonVariant removed : event["r"].as<JsonArray>())
+    {
+        HAEntityCacheEntry* entry = findCachedEntity(removed.as<const char*>());
+        if (entry == NULL)
+            continue;
+        HAStateObject before = entry->value;
+        entry->found = false;
+        changedEntity(entry, before, true);
+    }
+}
+
+void handleHaWebSocketMessage(char* payload, size_t length)
+{
+    // deserialized in place, so the document only holds the tree, not copies of the strings
+    DynamicJsonDocument doc(length + 1024);
+    DeserializationError error = deserializeJson(doc, payload, length);
+    if (error)
+    {
+        Serial.print(F("deserializeJson() failed: "));
+        Serial.println(error.f_str());
+        return;
+    }
+    const char* type = doc["type"] | "";
+    if (strcmp(type, "auth_required") == 0)
+    {
+        String auth = "{\"type\":\"auth\",\"access_token\":\"" + ha_token + "\"}";
+        haWebSocket.sendTXT(auth);
+    }
+    else if (strcmp(type, "auth_ok") == 0)
+    {
+        Serial.println("HA WebSocket authenticated, subscribing entities");
+        sendSubscribeEntities();
+    }
+    else if (strcmp(type, "auth_invalid") == 0)
+        Serial.println("HA WebSocket authentication failed: " + doc["message"].as<String>());
+    else if (strcmp(type, "result") == 0 && !doc["success"].as<bool>())
+        Serial.println("HA WebSocket subscription failed: " + doc["error"]["message"].as<String>());
+    else if (strcmp(type, "event") == 0)
+        handleHaWebSocketEvent(doc["event"]);
+}
+
+void onHaWebSocketEvent(WStype_t type, uint8_t* payload, size_t length)
+{
+    switch (type)
+    {
+        case WStype_CONNECTED:
+            Serial.println("HA WebSocket connected");
+            break;
+        case WStype_DISCONNECTED:
+            Serial.println("HA WebSocket disconnected");
+            break;
+        case WStype_TEXT:
+            handleHaWebSocketMessage((char*)payload, length);
+            break;
+        default:
+            break;
+    }
+}
+
+// on the host and port of ha_server, with TLS if it is https
+void beginHaWebSocket()
+{
+    if (!haClient.isSecure())
+        haWebSocket.begin(haClient.getHost(), haClient.getPort(), "/api/websocket");
+    else if (ha_root_ca[0] != '\0')
+        haWebSocket.beginSslWithCA(haClient.getHost().c_str(), haClient.getPort(), "/api/websocket", ha_root_ca);
+    else
+        haWebSocket.beginSSL(haClient.getHost(), haClient.getPort(), "/api/websocket");
+    haWebSocket.onEvent(onHaWebSocketEvent);
+    haWebSocket.setReconnectInterval(5000);
+}
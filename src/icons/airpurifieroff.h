@@ -1,104 +1,48 @@
+#pragma once
 const uint32_t airpurifieroff_width = 100;
 const uint32_t airpurifieroff_height = 100;
-const uint8_t airpurifieroff_data[(100*100)/2] = {
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4A, 0x32, 0xF8, 0xFF, 0xFF, 0x3D, 0xD3, 0xFF, 0xFF, 0x8F, 0x23, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x30, 0xFE, 0xFF, 0x07, 0x70, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x06, 0x60, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x40, 0x7C, 0x00, 0xC0, 0xFF, 0x06, 0x60, 0xFF, 0x0C, 0x00, 0xC7, 0x04, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0xD0, 0xFF, 0x02, 0xB0, 0xFF, 0x06, 0x60, 0xFF, 0x0B, 0x20, 0xFF, 0x0D, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0xB0, 0xFF, 0x02, 0xB0, 0xFF, 0x06, 0x60, 0xFF, 0x0B, 0x20, 0xFF, 0x0B, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x80, 0xFF, 0x02, 0xB0, 0xFF, 0x07, 0x70, 0xFF, 0x0B, 0x20, 0xFF, 0x08, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0xE3, 0xFF, 0x02, 0xB0, 0xFF, 0x3D, 0xD3, 0xFF, 0x0B, 0x20, 0xFF, 0x3E, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xB0, 0xFF, 0x9F, 0xF9, 0xFF, 0x0B, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xB0, 0xFF, 0x09, 0x90, 0xFF, 0x0B, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xB0, 0xFF, 0x06, 0x60, 0xFF, 0x0B, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xB0, 0xFF, 0x06, 0x60, 0xFF, 0x0B, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xE2, 0xFF, 0x0B, 0xB0, 0xFF, 0x2E, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFE, 0xFF, 0xDF, 0xFD, 0xFF, 0xEF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x59, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x95, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x60, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x06, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0xB9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0x00, 0x00, 0x92, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x41, 0x14, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x20, 0xFC, 0xCF, 0x02, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0xB0, 0xFF, 0xFF, 0x0B, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0xF1, 0xFF, 0xFF, 0x1F, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0xF1, 0xFF, 0xFF, 0x1F, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0x80, 0xFF, 0xFF, 0x08, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xD7, 0x7D, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x00, 0x00, 0x00, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x02, 0x00, 0x00, 0x20, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8E, 0x03, 0x20, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xCF, 0x26, 0x10, 0x73, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x37, 0x11, 0x73, 0xFC, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x07, 0x00, 0x93, 0xDD, 0x29, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x92, 0xDD, 0x39, 0x00, 0x70, 0xFF, 0xFF, 
-	0xFF, 0xDF, 0x00, 0x50, 0xFF, 0xFF, 0xEF, 0x04, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x40, 0xFE, 0xFF, 0xFF, 0x05, 0x00, 0xFD, 0xFF, 
-	0xFF, 0x7F, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x3E, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xE2, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xF8, 0xFF, 
-	0xFF, 0x3F, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xEF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0x3A, 0xFA, 0xFF, 0x4C, 0xF8, 0xFF, 0x5E, 0xE6, 0xFF, 0x8F, 0xC4, 0xFF, 0xAF, 0xA3, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xFE, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0xF4, 0xFF, 
-	0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0x00, 0xF0, 0xFF, 0x03, 0xB0, 0xFF, 0x07, 0x70, 0xFF, 0x0B, 0x30, 0xFF, 0x0F, 0x00, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 
-	0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0x03, 0xF3, 0xFF, 0x06, 0xD1, 0xFF, 0x0A, 0xA0, 0xFF, 0x1D, 0x60, 0xFF, 0x3F, 0x30, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xF2, 0xFF, 
-	0xFF, 0x5F, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xAE, 0xFE, 0xFF, 0xAF, 0xFC, 0xFF, 0xBF, 0xFB, 0xFF, 0xCF, 0xFA, 0xFF, 0xEF, 0xEA, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xF5, 0xFF, 
-	0xFF, 0x9F, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0xFA, 0xFF, 
-	0xFF, 0xFF, 0x02, 0x20, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02, 0x20, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x0B, 0x00, 0x40, 0x77, 0x87, 0x77, 0x77, 0x77, 0x77, 0x88, 0x97, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0x8D, 0xFD, 0xFF, 0x8E, 0xFB, 0xFF, 0x9F, 0xF9, 0xFF, 0xBF, 0xE8, 0xFF, 0xDF, 0xD8, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0x79, 0x88, 0x77, 0x77, 0x77, 0x77, 0x78, 0x78, 0x04, 0x00, 0xB0, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xBF, 0x00, 0xF2, 0xFF, 0x02, 0xF2, 0xFF, 0x05, 0xC0, 0xFF, 0x09, 0x90, 0xFF, 0x0C, 0x50, 0xFF, 0x2F, 0x20, 0xFF, 0x2F, 0x00, 0xFB, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xBF, 0x00, 0xF2, 0xFF, 0x01, 0xF1, 0xFF, 0x04, 0xC0, 0xFF, 0x08, 0x80, 0xFF, 0x0C, 0x40, 0xFF, 0x1F, 0x10, 0xFF, 0x2F, 0x00, 0xFB, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0x56, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x75, 0xFE, 0xBF, 0x00, 0xF2, 0xFF, 0x5C, 0xFC, 0xFF, 0x6D, 0xF9, 0xFF, 0x7F, 0xF7, 0xFF, 0x9F, 0xD6, 0xFF, 0xCF, 0xC5, 0xFF, 0x2F, 0x00, 0xFB, 0xEF, 0x57, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0xB8, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xCF, 0xCC, 0xCC, 0xCC, 0xCC, 0xFE, 0xFF, 0xCF, 0xCC, 0xDC, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFE, 0xFF, 0xDF, 0xFD, 0xFF, 0xEF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xCD, 0xCC, 0xFC, 0xFF, 0xEF, 0xCC, 0xCC, 0xCC, 0xCC, 0xFC, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xFF, 0x09, 0x00, 0x00, 0xFA, 0xBF, 0x00, 0xF2, 0xFF, 0x04, 0xF4, 0xFF, 0x08, 0xD2, 0xFF, 0x0B, 0xB0, 0xFF, 0x2D, 0x80, 0xFF, 0x4F, 0x40, 0xFF, 0x2F, 0x00, 0xFB, 0xAF, 0x00, 0x00, 0x90, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0x04, 0x00, 0x00, 0xF7, 0xBF, 0x00, 0xF2, 0xEF, 0x00, 0xE0, 0xFF, 0x03, 0xB0, 0xFF, 0x07, 0x70, 0xFF, 0x0B, 0x30, 0xFF, 0x0E, 0x00, 0xFE, 0x2F, 0x00, 0xFB, 0x7F, 0x00, 0x00, 0x50, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x3B, 0x21, 0x11, 0x11, 0x12, 0xF7, 0xFF, 0x3C, 0x21, 0x41, 0xFD, 0xBF, 0x00, 0xF2, 0xFF, 0x29, 0xF9, 0xFF, 0x2B, 0xF6, 0xFF, 0x4D, 0xD4, 0xFF, 0x6F, 0xB2, 0xFF, 0x9F, 0x92, 0xFF, 0x2F, 0x00, 0xFB, 0xDF, 0x14, 0x12, 0xC3, 0xFF, 0x7F, 0x21, 0x11, 0x11, 0x12, 0xC3, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xCF, 0x36, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFC, 0xBF, 0x00, 0xF2, 0xFF, 0x07, 0xF7, 0xFF, 0x1A, 0xE5, 0xFF, 0x2D, 0xD2, 0xFF, 0x4E, 0xA1, 0xFF, 0x7F, 0x70, 0xFF, 0x2F, 0x00, 0xFB, 0xCF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x62, 0xFC, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xBF, 0x00, 0xF2, 0xEF, 0x00, 0xE0, 0xFF, 0x02, 0xB0, 0xFF, 0x07, 0x70, 0xFF, 0x0B, 0x20, 0xFF, 0x0E, 0x00, 0xFE, 0x2F, 0x00, 0xFB, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFB, 0xBF, 0x00, 0xF2, 0xFF, 0x06, 0xF6, 0xFF, 0x09, 0xE3, 0xFF, 0x1C, 0xC1, 0xFF, 0x3E, 0x90, 0xFF, 0x6F, 0x60, 0xFF, 0x2F, 0x00, 0xFB, 0xBF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x07, 0x00, 0x93, 0xED, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xED, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xEF, 0xFF, 0xFF, 0xEF, 0xFF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xDE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xDE, 0x39, 0x00, 0x70, 0xFF, 0xFF, 
-	0xFF, 0xDF, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0xFD, 0xFF, 
-	0xFF, 0x7F, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xF7, 0xFF, 
-	0xFF, 0x4F, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0x3A, 0xFA, 0xFF, 0x4C, 0xF8, 0xFF, 0x5E, 0xE6, 0xFF, 0x8F, 0xC4, 0xFF, 0xAF, 0xA3, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0xF4, 0xFF, 
-	0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0x00, 0xF0, 0xFF, 0x03, 0xB0, 0xFF, 0x07, 0x70, 0xFF, 0x0B, 0x30, 0xFF, 0x0F, 0x00, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 
-	0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0x03, 0xF3, 0xFF, 0x06, 0xD1, 0xFF, 0x0A, 0xA0, 0xFF, 0x1D, 0x60, 0xFF, 0x3F, 0x30, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xF2, 0xFF, 
-	0xFF, 0x5F, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xAF, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xAE, 0xFE, 0xFF, 0xAF, 0xFC, 0xFF, 0xBF, 0xFB, 0xFF, 0xCF, 0xFA, 0xFF, 0xEF, 0xEA, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0xFA, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xF5, 0xFF, 
-	0xFF, 0xAF, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x0B, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xB0, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0xFA, 0xFF, 
-	0xFF, 0xFF, 0x02, 0x20, 0xFB, 0xFF, 0xAF, 0x01, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x10, 0xFA, 0xFF, 0xBF, 0x02, 0x20, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x0B, 0x00, 0x40, 0x77, 0x04, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x70, 0x78, 0x78, 0x78, 0x77, 0x77, 0x87, 0x87, 0x87, 0x77, 0x77, 0x77, 0x77, 0x77, 0x87, 0x87, 0x87, 0x07, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x40, 0x77, 0x04, 0x00, 0xB0, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x3C, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x8B, 0x66, 0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x63, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x36, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x66, 0xB7, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xD7, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0xCC, 0x7D, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x13, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x21, 0x31, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+const uint8_t airpurifieroff_data[2070] = { // run length encoded
+0xFF, 0xFF, 0xA4, 0xFF, 0x0B, 0x4A, 0x32, 0xF8, 0xFF, 0xFF, 0x3D, 0xD3, 0xFF, 0xFF, 0x8F, 0x23, 0xA4, 0xA2, 0xFF, 0x0D, 0x6F, 0x00, 0x00, 0x30, 0xFE, 0xFF, 0x07, 0x70, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0xF6, 0xA1, 0xFF, 0x00, 0x09, 0x80, 0x00, 0x05, 0xF5, 0xFF, 0x06, 0x60, 0xFF, 0x5F, 0x80, 0x00, 0x00, 
+	0x90, 0xA1, 0xFF, 0x0D, 0x03, 0x40, 0x7C, 0x00, 0xC0, 0xFF, 0x06, 0x60, 0xFF, 0x0C, 0x00, 0xC7, 0x04, 0x30, 0xA0, 0xFF, 0x0F, 0xEF, 0x00, 0xD0, 0xFF, 0x02, 0xB0, 0xFF, 0x06, 0x60, 0xFF, 0x0B, 0x20, 0xFF, 0x0D, 0x00, 0xFE, 0x9F, 0xFF, 0x0F, 0xEF, 0x00, 0xB0, 0xFF, 0x02, 0xB0, 0xFF, 0x06, 0x60, 0xFF, 
+	0x0B, 0x20, 0xFF, 0x0B, 0x10, 0xFE, 0xA0, 0xFF, 0x0D, 0x05, 0x80, 0xFF, 0x02, 0xB0, 0xFF, 0x07, 0x70, 0xFF, 0x0B, 0x20, 0xFF, 0x08, 0x50, 0xA1, 0xFF, 0x0D, 0x2D, 0xE3, 0xFF, 0x02, 0xB0, 0xFF, 0x3D, 0xD3, 0xFF, 0x0B, 0x20, 0xFF, 0x3E, 0xD2, 0xA4, 0xFF, 0x01, 0x02, 0xB0, 0x81, 0xFF, 0x01, 0x0B, 0x20, 
+	0xA7, 0xFF, 0x07, 0x02, 0xB0, 0xFF, 0x9F, 0xF9, 0xFF, 0x0B, 0x20, 0xA7, 0xFF, 0x07, 0x02, 0xB0, 0xFF, 0x09, 0x90, 0xFF, 0x0B, 0x20, 0xA7, 0xFF, 0x07, 0x02, 0xB0, 0xFF, 0x06, 0x60, 0xFF, 0x0B, 0x20, 0xA7, 0xFF, 0x07, 0x02, 0xB0, 0xFF, 0x06, 0x60, 0xFF, 0x0B, 0x20, 0xA7, 0xFF, 0x07, 0x08, 0xE2, 0xFF, 
+	0x0B, 0xB0, 0xFF, 0x2E, 0x80, 0xA7, 0xFF, 0x07, 0xDF, 0xFE, 0xFF, 0xDF, 0xFD, 0xFF, 0xEF, 0xFD, 0xFF, 0xFF, 0x84, 0xFF, 0x00, 0x59, 0x8D, 0x44, 0x00, 0x95, 0x9C, 0xFF, 0x00, 0x3D, 0x8F, 0x00, 0x00, 0xE3, 0x9B, 0xFF, 0x00, 0x05, 0x8F, 0x00, 0x00, 0x50, 0x9A, 0xFF, 0x02, 0xCF, 0x00, 0x60, 0x8D, 0x99, 
+	0x02, 0x06, 0x00, 0xFC, 0x99, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x8D, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x99, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x8D, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x99, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x84, 0xFF, 0x01, 0x9B, 0xB9, 0x84, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x99, 0xFF, 0x02, 0xBF, 0x00, 
+	0xF2, 0x83, 0xFF, 0x03, 0x29, 0x00, 0x00, 0x92, 0x83, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x99, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x82, 0xFF, 0x00, 0x7F, 0x81, 0x00, 0x00, 0xF8, 0x82, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x99, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x82, 0xFF, 0x05, 0x0A, 0x00, 0x41, 0x14, 0x00, 0xA0, 0x82, 
+	0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x99, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x82, 0xFF, 0x05, 0x04, 0x20, 0xFC, 0xCF, 0x02, 0x40, 0x82, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x99, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x81, 0xFF, 0x07, 0xDF, 0x00, 0xB0, 0xFF, 0xFF, 0x0B, 0x00, 0xFD, 0x81, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x99, 
+	0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x81, 0xFF, 0x07, 0xCF, 0x00, 0xF1, 0xFF, 0xFF, 0x1F, 0x00, 0xFC, 0x81, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x99, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x81, 0xFF, 0x07, 0xCF, 0x00, 0xF1, 0xFF, 0xFF, 0x1F, 0x00, 0xFC, 0x81, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x99, 0xFF, 0x02, 0xBF, 0x00, 
+	0xF2, 0x81, 0xFF, 0x07, 0xDF, 0x01, 0x80, 0xFF, 0xFF, 0x08, 0x10, 0xFD, 0x81, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x99, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x82, 0xFF, 0x05, 0x06, 0x00, 0xD7, 0x7D, 0x00, 0x60, 0x82, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x99, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x82, 0xFF, 0x00, 0x2D, 0x81, 
+	0x00, 0x00, 0xD2, 0x82, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x99, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x82, 0xFF, 0x05, 0xCF, 0x02, 0x00, 0x00, 0x20, 0xFC, 0x82, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x99, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x83, 0xFF, 0x03, 0x8E, 0x03, 0x20, 0xE8, 0x83, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x99, 
+	0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x84, 0xFF, 0x01, 0xEF, 0xFE, 0x84, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x99, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x8D, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x99, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x8D, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x99, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x8D, 0xFF, 0x02, 0x2F, 
+	0x00, 0xFB, 0x99, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x8D, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x99, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x8D, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x99, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x8D, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x99, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x8D, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 
+	0x99, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x8D, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x99, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x8D, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x99, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x8D, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x8E, 0xFF, 0x04, 0xCF, 0x26, 0x10, 0x73, 0xFD, 0x83, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 
+	0x8D, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x83, 0xFF, 0x04, 0xDF, 0x37, 0x11, 0x73, 0xFC, 0x83, 0xFF, 0x00, 0x06, 0x80, 0x00, 0x00, 0x80, 0x83, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x8D, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x83, 0xFF, 0x00, 0x08, 0x80, 0x00, 0x00, 0x70, 0x82, 0xFF, 0x00, 0x4F, 0x82, 0x00, 0x00, 0xF6, 
+	0x82, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x8D, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x82, 0xFF, 0x00, 0x6F, 0x82, 0x00, 0x00, 0xF5, 0x81, 0xFF, 0x06, 0x07, 0x00, 0x93, 0xDD, 0x29, 0x00, 0x90, 0x82, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x8D, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x82, 0xFF, 0x06, 0x09, 0x00, 0x92, 0xDD, 0x39, 
+	0x00, 0x70, 0x80, 0xFF, 0x07, 0xDF, 0x00, 0x50, 0xFF, 0xFF, 0xEF, 0x04, 0x20, 0x82, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x8D, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x82, 0xFF, 0x0C, 0x01, 0x40, 0xFE, 0xFF, 0xFF, 0x05, 0x00, 0xFD, 0xFF, 0xFF, 0x7F, 0x00, 0xF2, 0x80, 0xFF, 0x01, 0x3E, 0x60, 0x82, 0xFF, 0x02, 0xBF, 
+	0x00, 0xF2, 0x8D, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x82, 0xFF, 0x01, 0x06, 0xE2, 0x80, 0xFF, 0x07, 0x2F, 0x00, 0xF8, 0xFF, 0xFF, 0x3F, 0x00, 0xF8, 0x80, 0xFF, 0x01, 0xEF, 0xFC, 0x82, 0xFF, 0x15, 0xBF, 0x00, 0xF2, 0xFF, 0x3A, 0xFA, 0xFF, 0x4C, 0xF8, 0xFF, 0x5E, 0xE6, 0xFF, 0x8F, 0xC4, 0xFF, 0xAF, 0xA3, 
+	0xFF, 0x2F, 0x00, 0xFB, 0x82, 0xFF, 0x01, 0xCF, 0xFE, 0x80, 0xFF, 0x07, 0x8F, 0x00, 0xF4, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0x87, 0xFF, 0x15, 0xBF, 0x00, 0xF2, 0xFF, 0x00, 0xF0, 0xFF, 0x03, 0xB0, 0xFF, 0x07, 0x70, 0xFF, 0x0B, 0x30, 0xFF, 0x0F, 0x00, 0xFF, 0x2F, 0x00, 0xFB, 0x87, 0xFF, 0x07, 0xBF, 0x00, 
+	0xF2, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0x87, 0xFF, 0x15, 0xBF, 0x00, 0xF2, 0xFF, 0x03, 0xF3, 0xFF, 0x06, 0xD1, 0xFF, 0x0A, 0xA0, 0xFF, 0x1D, 0x60, 0xFF, 0x3F, 0x30, 0xFF, 0x2F, 0x00, 0xFB, 0x87, 0xFF, 0x07, 0xAF, 0x00, 0xF2, 0xFF, 0xFF, 0x5F, 0x00, 0xF6, 0x87, 0xFF, 0x15, 0xBF, 0x00, 0xF2, 0xFF, 0xAE, 
+	0xFE, 0xFF, 0xAF, 0xFC, 0xFF, 0xBF, 0xFB, 0xFF, 0xCF, 0xFA, 0xFF, 0xEF, 0xEA, 0xFF, 0x2F, 0x00, 0xFB, 0x87, 0xFF, 0x07, 0x6F, 0x00, 0xF5, 0xFF, 0xFF, 0x9F, 0x00, 0xC0, 0x87, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x8D, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x87, 0xFF, 0x02, 0x0C, 0x00, 0xFA, 0x80, 0xFF, 0x02, 0x02, 
+	0x20, 0xFB, 0x86, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x8D, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x86, 0xFF, 0x02, 0xBF, 0x02, 0x20, 0x81, 0xFF, 0x04, 0x0B, 0x00, 0x40, 0x77, 0x87, 0x81, 0x77, 0x1B, 0x88, 0x97, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0x8D, 0xFD, 0xFF, 0x8E, 0xFB, 0xFF, 0x9F, 0xF9, 0xFF, 0xBF, 0xE8, 0xFF, 
+	0xDF, 0xD8, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0x79, 0x88, 0x81, 0x77, 0x04, 0x78, 0x78, 0x04, 0x00, 0xB0, 0x81, 0xFF, 0x00, 0x9F, 0x87, 0x00, 0x17, 0xF9, 0xBF, 0x00, 0xF2, 0xFF, 0x02, 0xF2, 0xFF, 0x05, 0xC0, 0xFF, 0x09, 0x90, 0xFF, 0x0C, 0x50, 0xFF, 0x2F, 0x20, 0xFF, 0x2F, 0x00, 0xFB, 0x8F, 0x87, 0x00, 
+	0x00, 0xF9, 0x82, 0xFF, 0x00, 0x3B, 0x86, 0x00, 0x17, 0xF8, 0xBF, 0x00, 0xF2, 0xFF, 0x01, 0xF1, 0xFF, 0x04, 0xC0, 0xFF, 0x08, 0x80, 0xFF, 0x0C, 0x40, 0xFF, 0x1F, 0x10, 0xFF, 0x2F, 0x00, 0xFB, 0x8F, 0x86, 0x00, 0x00, 0xC3, 0x84, 0xFF, 0x01, 0x7B, 0x56, 0x83, 0x55, 0x19, 0x75, 0xFE, 0xBF, 0x00, 0xF2, 
+	0xFF, 0x5C, 0xFC, 0xFF, 0x6D, 0xF9, 0xFF, 0x7F, 0xF7, 0xFF, 0x9F, 0xD6, 0xFF, 0xCF, 0xC5, 0xFF, 0x2F, 0x00, 0xFB, 0xEF, 0x57, 0x83, 0x55, 0x01, 0x65, 0xB8, 0x8F, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x8D, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x99, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x8D, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 
+	0x8E, 0xFF, 0x00, 0xCF, 0x81, 0xCC, 0x21, 0xFE, 0xFF, 0xCF, 0xCC, 0xDC, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xCF, 0xFF, 0xFF, 0xCF, 0xFE, 0xFF, 0xDF, 0xFD, 0xFF, 0xEF, 0xFC, 0xFF, 0xFF, 0xFC, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xCD, 0xCC, 0xFC, 0xFF, 0xEF, 0x81, 0xCC, 0x00, 0xFC, 0x83, 0xFF, 0x00, 0x08, 0x81, 
+	0x00, 0x21, 0xE3, 0xFF, 0x09, 0x00, 0x00, 0xFA, 0xBF, 0x00, 0xF2, 0xFF, 0x04, 0xF4, 0xFF, 0x08, 0xD2, 0xFF, 0x0B, 0xB0, 0xFF, 0x2D, 0x80, 0xFF, 0x4F, 0x40, 0xFF, 0x2F, 0x00, 0xFB, 0xAF, 0x00, 0x00, 0x90, 0xFF, 0x3E, 0x81, 0x00, 0x00, 0x80, 0x83, 0xFF, 0x00, 0x03, 0x81, 0x00, 0x21, 0xD0, 0xFF, 0x04, 
+	0x00, 0x00, 0xF7, 0xBF, 0x00, 0xF2, 0xEF, 0x00, 0xE0, 0xFF, 0x03, 0xB0, 0xFF, 0x07, 0x70, 0xFF, 0x0B, 0x30, 0xFF, 0x0E, 0x00, 0xFE, 0x2F, 0x00, 0xFB, 0x7F, 0x00, 0x00, 0x50, 0xFF, 0x0D, 0x81, 0x00, 0x00, 0x40, 0x83, 0xFF, 0x2B, 0x3B, 0x21, 0x11, 0x11, 0x12, 0xF7, 0xFF, 0x3C, 0x21, 0x41, 0xFD, 0xBF, 
+	0x00, 0xF2, 0xFF, 0x29, 0xF9, 0xFF, 0x2B, 0xF6, 0xFF, 0x4D, 0xD4, 0xFF, 0x6F, 0xB2, 0xFF, 0x9F, 0x92, 0xFF, 0x2F, 0x00, 0xFB, 0xDF, 0x14, 0x12, 0xC3, 0xFF, 0x7F, 0x21, 0x11, 0x11, 0x12, 0xC3, 0x8E, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x8D, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x99, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 
+	0x8D, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x99, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x8D, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x8E, 0xFF, 0x02, 0xCF, 0x36, 0x01, 0x83, 0x00, 0x19, 0x20, 0xFC, 0xBF, 0x00, 0xF2, 0xFF, 0x07, 0xF7, 0xFF, 0x1A, 0xE5, 0xFF, 0x2D, 0xD2, 0xFF, 0x4E, 0xA1, 0xFF, 0x7F, 0x70, 0xFF, 0x2F, 0x00, 
+	0xFB, 0xCF, 0x02, 0x84, 0x00, 0x01, 0x62, 0xFC, 0x83, 0xFF, 0x00, 0x07, 0x86, 0x00, 0x17, 0xF6, 0xBF, 0x00, 0xF2, 0xEF, 0x00, 0xE0, 0xFF, 0x02, 0xB0, 0xFF, 0x07, 0x70, 0xFF, 0x0B, 0x20, 0xFF, 0x0E, 0x00, 0xFE, 0x2F, 0x00, 0xFB, 0x6F, 0x86, 0x00, 0x00, 0x70, 0x82, 0xFF, 0x00, 0x5F, 0x86, 0x00, 0x19, 
+	0x10, 0xFB, 0xBF, 0x00, 0xF2, 0xFF, 0x06, 0xF6, 0xFF, 0x09, 0xE3, 0xFF, 0x1C, 0xC1, 0xFF, 0x3E, 0x90, 0xFF, 0x6F, 0x60, 0xFF, 0x2F, 0x00, 0xFB, 0xBF, 0x01, 0x86, 0x00, 0x00, 0xF5, 0x81, 0xFF, 0x03, 0x07, 0x00, 0x93, 0xED, 0x83, 0xEE, 0x19, 0xED, 0xFF, 0xBF, 0x00, 0xF2, 0xFF, 0xEF, 0xFF, 0xFF, 0xEF, 
+	0xFF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFE, 0xFF, 0x2F, 0x00, 0xFB, 0xFF, 0xDE, 0x83, 0xEE, 0x03, 0xDE, 0x39, 0x00, 0x70, 0x80, 0xFF, 0x02, 0xDF, 0x00, 0x50, 0x87, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x8D, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x87, 0xFF, 0x07, 0x05, 0x00, 0xFD, 0xFF, 0xFF, 0x7F, 
+	0x00, 0xF2, 0x87, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x8D, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x87, 0xFF, 0x07, 0x2F, 0x00, 0xF7, 0xFF, 0xFF, 0x4F, 0x00, 0xF8, 0x87, 0xFF, 0x15, 0xBF, 0x00, 0xF2, 0xFF, 0x3A, 0xFA, 0xFF, 0x4C, 0xF8, 0xFF, 0x5E, 0xE6, 0xFF, 0x8F, 0xC4, 0xFF, 0xAF, 0xA3, 0xFF, 0x2F, 0x00, 0xFB, 
+	0x87, 0xFF, 0x07, 0x8F, 0x00, 0xF4, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0x87, 0xFF, 0x15, 0xBF, 0x00, 0xF2, 0xFF, 0x00, 0xF0, 0xFF, 0x03, 0xB0, 0xFF, 0x07, 0x70, 0xFF, 0x0B, 0x30, 0xFF, 0x0F, 0x00, 0xFF, 0x2F, 0x00, 0xFB, 0x87, 0xFF, 0x07, 0xBF, 0x00, 0xF2, 0xFF, 0xFF, 0x2F, 0x00, 0xFB, 0x87, 0xFF, 0x15, 
+	0xBF, 0x00, 0xF2, 0xFF, 0x03, 0xF3, 0xFF, 0x06, 0xD1, 0xFF, 0x0A, 0xA0, 0xFF, 0x1D, 0x60, 0xFF, 0x3F, 0x30, 0xFF, 0x2F, 0x00, 0xFB, 0x87, 0xFF, 0x07, 0xAF, 0x00, 0xF2, 0xFF, 0xFF, 0x5F, 0x00, 0xF6, 0x80, 0xFF, 0x01, 0xAF, 0xD5, 0x82, 0xFF, 0x15, 0xBF, 0x00, 0xF2, 0xFF, 0xAE, 0xFE, 0xFF, 0xAF, 0xFC, 
+	0xFF, 0xBF, 0xFB, 0xFF, 0xCF, 0xFA, 0xFF, 0xEF, 0xEA, 0xFF, 0x2F, 0x00, 0xFB, 0x82, 0xFF, 0x01, 0x5D, 0xFA, 0x80, 0xFF, 0x07, 0x6F, 0x00, 0xF5, 0xFF, 0xFF, 0xAF, 0x00, 0xC0, 0x80, 0xFF, 0x01, 0x0B, 0x30, 0x82, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x8D, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x82, 0xFF, 0x01, 0x03, 
+	0xB0, 0x80, 0xFF, 0x02, 0x0C, 0x00, 0xFA, 0x80, 0xFF, 0x06, 0x02, 0x20, 0xFB, 0xFF, 0xAF, 0x01, 0x30, 0x82, 0xFF, 0x02, 0xBF, 0x00, 0xF2, 0x8D, 0xFF, 0x02, 0x2F, 0x00, 0xFB, 0x82, 0xFF, 0x06, 0x03, 0x10, 0xFA, 0xFF, 0xBF, 0x02, 0x20, 0x81, 0xFF, 0x06, 0x0B, 0x00, 0x40, 0x77, 0x04, 0x00, 0xC0, 0x82, 
+	0xFF, 0x02, 0xCF, 0x00, 0x70, 0x80, 0x78, 0x01, 0x77, 0x77, 0x80, 0x87, 0x82, 0x77, 0x80, 0x87, 0x02, 0x07, 0x00, 0xFC, 0x82, 0xFF, 0x06, 0x0C, 0x00, 0x40, 0x77, 0x04, 0x00, 0xB0, 0x81, 0xFF, 0x00, 0x9F, 0x82, 0x00, 0x00, 0xFB, 0x83, 0xFF, 0x00, 0x03, 0x8F, 0x00, 0x00, 0x30, 0x83, 0xFF, 0x00, 0xAF, 
+	0x82, 0x00, 0x00, 0xF9, 0x82, 0xFF, 0x00, 0x3C, 0x80, 0x00, 0x00, 0xD4, 0x84, 0xFF, 0x00, 0x1C, 0x8F, 0x00, 0x00, 0xC1, 0x84, 0xFF, 0x00, 0x4C, 0x80, 0x00, 0x00, 0xB3, 0x84, 0xFF, 0x02, 0x8B, 0x66, 0xC8, 0x85, 0xFF, 0x02, 0x3F, 0x00, 0x63, 0x8B, 0x55, 0x02, 0x36, 0x00, 0xF3, 0x85, 0xFF, 0x02, 0x8C, 
+	0x66, 0xB7, 0x90, 0xFF, 0x02, 0x3F, 0x00, 0xFB, 0x8B, 0xFF, 0x02, 0xBF, 0x00, 0xF3, 0x9B, 0xFF, 0x02, 0x3F, 0x00, 0xFA, 0x8B, 0xFF, 0x02, 0xAF, 0x00, 0xF3, 0x9B, 0xFF, 0x02, 0x3F, 0x00, 0xD7, 0x8B, 0xCC, 0x02, 0x7D, 0x00, 0xF3, 0x9B, 0xFF, 0x00, 0x3F, 0x8F, 0x00, 0x00, 0xF3, 0x9B, 0xFF, 0x00, 0x4F, 
+	0x8F, 0x00, 0x00, 0xF4, 0x9B, 0xFF, 0x02, 0xCF, 0x13, 0x12, 0x8B, 0x11, 0x02, 0x21, 0x31, 0xFC, 0xFF, 0xFF, 0xA0, 0xFF, 
 	};
+const Icon airpurifieroff_icon = {airpurifieroff_width, airpurifieroff_height, sizeof(airpurifieroff_data), airpurifieroff_data, NULL};
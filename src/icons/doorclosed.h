@@ -1,68 +1,22 @@
+#pragma once
 const uint32_t doorclosed_width = 64;
 const uint32_t doorclosed_height = 64;
-const uint8_t doorclosed_data[(64*64)/2] = {
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x20, 0x54, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x04, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0x06, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0x6B, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0x00, 0x00, 0xB2, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x95, 0x59, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0xB0, 0xFF, 0xFF, 0x0B, 0x10, 0xFE, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0xF7, 0xFF, 0xFF, 0x7F, 0x00, 0xF9, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xFE, 0xFF, 0xFF, 0xEF, 0x00, 0xF6, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6A, 0x15, 0x00, 0x11, 0x11, 0x11, 0x11, 0x00, 0x51, 0xA6, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x10, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x65, 0xFD, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x20, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x02, 0x50, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFD, 
+const uint8_t doorclosed_data[789] = { // run length encoded
+0x82, 0xFF, 0x01, 0xDF, 0x16, 0x8C, 0x00, 0x01, 0x30, 0xE8, 0x8A, 0xFF, 0x00, 0x07, 0x8E, 0x00, 0x01, 0x10, 0xFC, 0x88, 0xFF, 0x03, 0x7F, 0x00, 0x20, 0x54, 0x8B, 0x55, 0x02, 0x04, 0x00, 0xC0, 0x88, 0xFF, 0x02, 0x0D, 0x00, 0xF9, 0x8D, 0xFF, 0x01, 0x06, 0x20, 0x88, 0xFF, 0x01, 0x06, 0x90, 0x8E, 0xFF, 
+	0x02, 0x4F, 0x00, 0xFB, 0x87, 0xFF, 0x01, 0x01, 0xF2, 0x8E, 0xFF, 0x02, 0xCF, 0x00, 0xF7, 0x87, 0xFF, 0x01, 0x00, 0xF4, 0x8F, 0xFF, 0x01, 0x00, 0xF5, 0x87, 0xFF, 0x01, 0x00, 0xF5, 0x8F, 0xFF, 0x01, 0x00, 0xF5, 0x87, 0xFF, 0x01, 0x00, 0xF5, 0x8F, 0xFF, 0x01, 0x00, 0xF5, 0x87, 0xFF, 0x01, 0x00, 0xF5, 
+	0x8F, 0xFF, 0x01, 0x00, 0xF5, 0x87, 0xFF, 0x01, 0x00, 0xF5, 0x8F, 0xFF, 0x01, 0x00, 0xF5, 0x87, 0xFF, 0x01, 0x00, 0xF5, 0x8F, 0xFF, 0x01, 0x00, 0xF5, 0x87, 0xFF, 0x01, 0x00, 0xF5, 0x8F, 0xFF, 0x01, 0x00, 0xF5, 0x87, 0xFF, 0x01, 0x00, 0xF5, 0x8F, 0xFF, 0x01, 0x00, 0xF5, 0x87, 0xFF, 0x01, 0x00, 0xF5, 
+	0x8F, 0xFF, 0x01, 0x00, 0xF5, 0x87, 0xFF, 0x01, 0x00, 0xF5, 0x8F, 0xFF, 0x01, 0x00, 0xF5, 0x87, 0xFF, 0x01, 0x00, 0xF5, 0x8F, 0xFF, 0x01, 0x00, 0xF5, 0x87, 0xFF, 0x01, 0x00, 0xF5, 0x8F, 0xFF, 0x01, 0x00, 0xF5, 0x87, 0xFF, 0x01, 0x00, 0xF5, 0x8F, 0xFF, 0x01, 0x00, 0xF5, 0x87, 0xFF, 0x01, 0x00, 0xF5, 
+	0x8F, 0xFF, 0x01, 0x00, 0xF5, 0x87, 0xFF, 0x01, 0x00, 0xF5, 0x8F, 0xFF, 0x01, 0x00, 0xF5, 0x87, 0xFF, 0x01, 0x00, 0xF5, 0x8F, 0xFF, 0x01, 0x00, 0xF5, 0x87, 0xFF, 0x01, 0x00, 0xF5, 0x8F, 0xFF, 0x01, 0x00, 0xF5, 0x87, 0xFF, 0x01, 0x00, 0xF5, 0x8F, 0xFF, 0x01, 0x00, 0xF5, 0x87, 0xFF, 0x05, 0x00, 0xF5, 
+	0xFF, 0xFF, 0x06, 0xFB, 0x8B, 0xFF, 0x01, 0x00, 0xF5, 0x87, 0xFF, 0x05, 0x00, 0xF5, 0xFF, 0xFF, 0x00, 0xF5, 0x8B, 0xFF, 0x01, 0x00, 0xF5, 0x87, 0xFF, 0x05, 0x00, 0xF5, 0xFF, 0xFF, 0x00, 0xF5, 0x8B, 0xFF, 0x01, 0x00, 0xF5, 0x87, 0xFF, 0x05, 0x00, 0xF5, 0xFF, 0xFF, 0x00, 0xF5, 0x8B, 0xFF, 0x01, 0x00, 
+	0xF5, 0x87, 0xFF, 0x05, 0x00, 0xF5, 0xFF, 0xFF, 0x00, 0xF5, 0x8B, 0xFF, 0x01, 0x02, 0xF7, 0x87, 0xFF, 0x05, 0x00, 0xF5, 0xFF, 0xFF, 0x00, 0xF5, 0x8B, 0xFF, 0x00, 0xBE, 0x88, 0xFF, 0x05, 0x00, 0xF5, 0xFF, 0xFF, 0x00, 0xF5, 0x97, 0xFF, 0x05, 0x00, 0xF5, 0xFF, 0xFF, 0x00, 0xF5, 0x97, 0xFF, 0x05, 0x00, 
+	0xF5, 0xFF, 0xFF, 0x00, 0xF5, 0x97, 0xFF, 0x05, 0x00, 0xF5, 0xFF, 0xFF, 0x00, 0xF6, 0x97, 0xFF, 0x05, 0x00, 0xF5, 0xFF, 0xFF, 0x6B, 0xFD, 0x8C, 0xFF, 0x01, 0xBD, 0xDB, 0x86, 0xFF, 0x01, 0x00, 0xF5, 0x8F, 0xFF, 0x03, 0x2A, 0x00, 0x00, 0xB2, 0x85, 0xFF, 0x01, 0x00, 0xF5, 0x8E, 0xFF, 0x00, 0x7F, 0x81, 
+	0x00, 0x00, 0xF7, 0x84, 0xFF, 0x01, 0x00, 0xF5, 0x8E, 0xFF, 0x05, 0x09, 0x00, 0x95, 0x59, 0x00, 0x90, 0x84, 0xFF, 0x01, 0x00, 0xF5, 0x8D, 0xFF, 0x07, 0xEF, 0x00, 0xB0, 0xFF, 0xFF, 0x0B, 0x10, 0xFE, 0x83, 0xFF, 0x01, 0x00, 0xF5, 0x8D, 0xFF, 0x07, 0x9F, 0x00, 0xF7, 0xFF, 0xFF, 0x7F, 0x00, 0xF9, 0x83, 
+	0xFF, 0x01, 0x00, 0xF5, 0x8D, 0xFF, 0x07, 0x6F, 0x00, 0xFE, 0xFF, 0xFF, 0xEF, 0x00, 0xF6, 0x83, 0xFF, 0x01, 0x00, 0xF5, 0x8D, 0xFF, 0x01, 0x5F, 0x00, 0x81, 0xFF, 0x01, 0x00, 0xF5, 0x83, 0xFF, 0x01, 0x00, 0xF5, 0x8D, 0xFF, 0x01, 0x5F, 0x00, 0x81, 0xFF, 0x01, 0x00, 0xF5, 0x83, 0xFF, 0x01, 0x00, 0xF5, 
+	0x8D, 0xFF, 0x01, 0x5F, 0x00, 0x81, 0xFF, 0x01, 0x00, 0xF5, 0x83, 0xFF, 0x01, 0x00, 0xF5, 0x8D, 0xFF, 0x01, 0x5F, 0x00, 0x81, 0xFF, 0x01, 0x00, 0xF5, 0x83, 0xFF, 0x01, 0x00, 0xF5, 0x8C, 0xFF, 0x02, 0x6A, 0x15, 0x00, 0x81, 0x11, 0x02, 0x00, 0x51, 0xA6, 0x82, 0xFF, 0x01, 0x00, 0xF5, 0x8B, 0xFF, 0x00, 
+	0x4F, 0x87, 0x00, 0x00, 0xF4, 0x81, 0xFF, 0x01, 0x00, 0xF5, 0x8B, 0xFF, 0x00, 0x08, 0x87, 0x00, 0x00, 0x80, 0x81, 0xFF, 0x01, 0x00, 0xF5, 0x8B, 0xFF, 0x01, 0x01, 0xD1, 0x85, 0xFF, 0x01, 0x1D, 0x10, 0x81, 0xFF, 0x01, 0x00, 0xF5, 0x8B, 0xFF, 0x01, 0x00, 0xF5, 0x85, 0xFF, 0x01, 0x5F, 0x00, 0x81, 0xFF, 
+	0x01, 0x00, 0xF5, 0x8B, 0xFF, 0x01, 0x00, 0xF5, 0x85, 0xFF, 0x01, 0x5F, 0x00, 0x81, 0xFF, 0x01, 0x00, 0xF5, 0x8B, 0xFF, 0x01, 0x00, 0xF5, 0x85, 0xFF, 0x01, 0x5F, 0x00, 0x81, 0xFF, 0x01, 0x00, 0xF4, 0x8B, 0xFF, 0x01, 0x00, 0xF5, 0x85, 0xFF, 0x01, 0x5F, 0x00, 0x81, 0xFF, 0x01, 0x03, 0xF0, 0x8B, 0xFF, 
+	0x01, 0x00, 0xF5, 0x85, 0xFF, 0x01, 0x5F, 0x00, 0x81, 0xFF, 0x01, 0x08, 0x60, 0x8B, 0xFF, 0x01, 0x00, 0xF5, 0x85, 0xFF, 0x01, 0x5F, 0x00, 0x81, 0xFF, 0x02, 0x1E, 0x00, 0xC4, 0x8A, 0xFF, 0x01, 0x00, 0xF5, 0x85, 0xFF, 0x01, 0x5F, 0x00, 0x81, 0xFF, 0x00, 0xCF, 0x89, 0x00, 0x04, 0xFB, 0xFF, 0xFF, 0x00, 
+	0xF5, 0x85, 0xFF, 0x01, 0x5F, 0x00, 0x82, 0xFF, 0x00, 0x2C, 0x88, 0x00, 0x04, 0xF6, 0xFF, 0xFF, 0x00, 0xF5, 0x85, 0xFF, 0x01, 0x5F, 0x00, 0x83, 0xFF, 0x00, 0x7B, 0x86, 0x55, 0x05, 0x65, 0xFD, 0xFF, 0xFF, 0x00, 0xF5, 0x85, 0xFF, 0x01, 0x5F, 0x00, 0x91, 0xFF, 0x01, 0x00, 0xF5, 0x85, 0xFF, 0x01, 0x5F, 
+	0x00, 0x91, 0xFF, 0x01, 0x00, 0xF2, 0x85, 0xFF, 0x01, 0x2F, 0x00, 0x91, 0xFF, 0x01, 0x05, 0x20, 0x85, 0x55, 0x01, 0x02, 0x50, 0x91, 0xFF, 0x00, 0x1D, 0x87, 0x00, 0x00, 0xD1, 0x91, 0xFF, 0x01, 0xEF, 0x05, 0x85, 0x00, 0x01, 0x50, 0xFD, 
 	};
+const Icon doorclosed_icon = {doorclosed_width, doorclosed_height, sizeof(doorclosed_data), doorclosed_data, NULL};
@@ -1,68 +1,30 @@
+#pragma once
+#include "doorclosed.h"
 const uint32_t dooropen_width = 64;
 const uint32_t dooropen_height = 64;
-const uint8_t dooropen_data[(64*64)/2] = {
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x19, 0x53, 0x97, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x10, 0x53, 0x97, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x53, 0x97, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x53, 0x97, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xAF, 0x77, 0x77, 0x77, 0x77, 0x77, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x53, 0x97, 0xFC, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xEF, 0xAC, 0x68, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xAC, 0x68, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x9B, 0x57, 0x13, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x10, 0x33, 0x33, 0x33, 0x02, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x9B, 0x03, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xCF, 0xCC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0x0F, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0x0F, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0x0F, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0x0F, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0x0F, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0x0F, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0x0F, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0x0F, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xCF, 0xCC, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xDF, 0x33, 0x13, 0x00, 0x10, 0x33, 0x33, 0x33, 0x02, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x9B, 0x03, 0x00, 0x31, 0x33, 0xFD, 0xFF, 
-	0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x9B, 0x57, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 
-	0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xAC, 0x68, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 
-	0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xEF, 0xAC, 0x68, 0x24, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 
-	0xFF, 0xEF, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x04, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x53, 0x77, 0x77, 0x77, 0xFE, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x53, 0x97, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x53, 0x97, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x10, 0x53, 0x97, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x19, 0x53, 0x97, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+const uint8_t dooropen_data[1101] = { // delta to doorclosed, run length encoded
+0xC4, 0x81, 0xFF, 0x03, 0x19, 0x53, 0x97, 0xDB, 0x99, 0xFF, 0x00, 0x09, 0xC2, 0x03, 0x10, 0x53, 0x97, 0xDB, 0x95, 0xFF, 0x00, 0x09, 0x84, 0x00, 0x03, 0x10, 0x53, 0x97, 0xDB, 0x91, 0xFF, 0x00, 0x09, 0x88, 0x00, 0x03, 0x10, 0x53, 0x97, 0xDB, 0xC9, 0x00, 0xAF, 0x82, 0x77, 0x02, 0x04, 0x00, 0x20, 0x8A, 
+	0x00, 0x03, 0x10, 0x53, 0x97, 0xFC, 0xC5, 0x00, 0x5F, 0x84, 0x00, 0x04, 0xF2, 0xEF, 0xAC, 0x68, 0x24, 0x89, 0x00, 0x00, 0xF5, 0xC5, 0x00, 0x5F, 0x84, 0x00, 0x00, 0xF2, 0xC3, 0x03, 0xEF, 0xAC, 0x68, 0x24, 0x85, 0x00, 0x00, 0xF5, 0xC5, 0x00, 0x5F, 0x84, 0x00, 0x00, 0xF2, 0xC7, 0x03, 0xDF, 0x9B, 0x57, 
+	0x13, 0x81, 0x00, 0x00, 0xF5, 0xC5, 0x02, 0x5F, 0x00, 0x10, 0x80, 0x33, 0x02, 0x02, 0x00, 0xF2, 0xCB, 0x04, 0xDF, 0x9B, 0x03, 0x00, 0xF5, 0xC5, 0x02, 0x5F, 0x00, 0x60, 0xC2, 0x02, 0x09, 0x00, 0xF2, 0xCB, 0x04, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xC5, 0x02, 0x5F, 0x00, 0x60, 0xC2, 0x02, 0x09, 0x00, 0xF2, 
+	0xCB, 0x04, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xC5, 0x02, 0x5F, 0x00, 0x60, 0xC2, 0x02, 0x09, 0x00, 0xF2, 0xCB, 0x04, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xC5, 0x02, 0x5F, 0x00, 0x60, 0xC2, 0x02, 0x09, 0x00, 0xF2, 0xCB, 0x04, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xC5, 0x02, 0x5F, 0x00, 0x60, 0xC2, 0x02, 0x09, 0x00, 
+	0xF2, 0xCB, 0x04, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xC5, 0x02, 0x5F, 0x00, 0x60, 0xC2, 0x02, 0x09, 0x00, 0xF2, 0xCB, 0x04, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xC5, 0x02, 0x5F, 0x00, 0x60, 0xC2, 0x02, 0x09, 0x00, 0xF2, 0xCB, 0x04, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xC5, 0x02, 0x5F, 0x00, 0x60, 0xC2, 0x02, 0x09, 
+	0x00, 0xF2, 0xCB, 0x04, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xC5, 0x02, 0x5F, 0x00, 0x60, 0xC2, 0x02, 0x09, 0x00, 0xF2, 0xCB, 0x04, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xC5, 0x02, 0x5F, 0x00, 0x60, 0xC2, 0x02, 0x09, 0x00, 0xF2, 0xCB, 0x04, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xC5, 0x02, 0x5F, 0x00, 0x60, 0xC2, 0x02, 
+	0x09, 0x00, 0xF2, 0xCB, 0x04, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xC5, 0x02, 0x5F, 0x00, 0x60, 0xC2, 0x02, 0x09, 0x00, 0xF2, 0xCB, 0x04, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xC5, 0x02, 0x5F, 0x00, 0x60, 0xC2, 0x02, 0x09, 0x00, 0xF2, 0xCB, 0x04, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xC5, 0x02, 0x5F, 0x00, 0x60, 0xC2, 
+	0x02, 0x09, 0x00, 0xF2, 0xCB, 0x04, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xC5, 0x02, 0x5F, 0x00, 0x60, 0xC2, 0x02, 0x09, 0x00, 0xF2, 0xCB, 0x04, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xC5, 0x02, 0x5F, 0x00, 0x60, 0xC1, 0x03, 0xFF, 0x09, 0x00, 0xF2, 0xCB, 0x04, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xC5, 0x02, 0x5F, 0x00, 
+	0x60, 0xC1, 0x03, 0xFF, 0x09, 0x00, 0xF2, 0xCB, 0x04, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xC5, 0x02, 0x5F, 0x00, 0x60, 0xC1, 0x03, 0xFF, 0x09, 0x00, 0xF2, 0xCB, 0x04, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xC5, 0x02, 0x5F, 0x00, 0x60, 0xC1, 0x07, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0xCF, 0xCC, 0xFC, 0xC7, 0x04, 0xFF, 
+	0xFF, 0x06, 0x00, 0xF5, 0xC5, 0x02, 0x5F, 0x00, 0x60, 0xC1, 0x07, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0x0F, 0x00, 0xB0, 0xC7, 0x04, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xC5, 0x02, 0x5F, 0x00, 0x60, 0xC1, 0x07, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0x0F, 0x00, 0xB0, 0xC7, 0x04, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xC5, 0x02, 
+	0x5F, 0x00, 0x60, 0xC1, 0x07, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0x0F, 0x00, 0xB0, 0xC9, 0x02, 0x06, 0x00, 0xF5, 0xC5, 0x02, 0x5F, 0x00, 0x60, 0xC1, 0x07, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0x0F, 0x00, 0xB0, 0xC9, 0x02, 0x06, 0x00, 0xF5, 0xC5, 0x02, 0x5F, 0x00, 0x60, 0xC1, 0x07, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 
+	0x0F, 0x00, 0xB0, 0xC9, 0x02, 0x06, 0x00, 0xF5, 0xC5, 0x02, 0x5F, 0x00, 0x60, 0xC1, 0x07, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0x0F, 0x00, 0xB0, 0xC9, 0x02, 0x06, 0x00, 0xF5, 0xC5, 0x02, 0x5F, 0x00, 0x60, 0xC1, 0x07, 0xFF, 0x09, 0x00, 0xF2, 0xFF, 0x0F, 0x00, 0xB0, 0xC8, 0x03, 0xFF, 0x06, 0x00, 0xF5, 0xC5, 
+	0x02, 0x5F, 0x00, 0x60, 0xC2, 0x06, 0x09, 0x00, 0xF2, 0xFF, 0x0F, 0x00, 0xB0, 0xC7, 0x04, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0xC5, 0x02, 0x5F, 0x00, 0x60, 0xC2, 0x06, 0x09, 0x00, 0xF2, 0xFF, 0xCF, 0xCC, 0xFC, 0xC6, 0x80, 0xFF, 0x02, 0x06, 0x00, 0xF5, 0xC5, 0x02, 0x5F, 0x00, 0x60, 0xC2, 0x02, 0x09, 0x00, 
+	0xF2, 0xCA, 0x80, 0xFF, 0x02, 0x06, 0x00, 0xF5, 0xC5, 0x02, 0x5F, 0x00, 0x60, 0xC2, 0x02, 0x09, 0x00, 0xF2, 0xC9, 0x81, 0xFF, 0x02, 0x06, 0x00, 0xF5, 0x83, 0xFF, 0x02, 0x5F, 0x00, 0x60, 0xC2, 0x02, 0x09, 0x00, 0xF2, 0xC9, 0x81, 0xFF, 0x02, 0x06, 0x00, 0xF5, 0x83, 0xFF, 0x02, 0x5F, 0x00, 0x60, 0xC2, 
+	0x02, 0x09, 0x00, 0xF2, 0xC9, 0x81, 0xFF, 0x02, 0x06, 0x00, 0xF5, 0x83, 0xFF, 0x02, 0x5F, 0x00, 0x60, 0xC2, 0x02, 0x09, 0x00, 0xF2, 0xC9, 0x81, 0xFF, 0x02, 0x06, 0x00, 0xF5, 0x83, 0xFF, 0x02, 0x5F, 0x00, 0x60, 0xC2, 0x02, 0x09, 0x00, 0xF2, 0xC9, 0x81, 0xFF, 0x02, 0x06, 0x00, 0xF5, 0x83, 0xFF, 0x02, 
+	0x5F, 0x00, 0x60, 0xC2, 0x02, 0x09, 0x00, 0xF2, 0xC9, 0x81, 0xFF, 0x02, 0x06, 0x00, 0xF5, 0x83, 0xFF, 0x02, 0x5F, 0x00, 0x60, 0xC2, 0x02, 0x09, 0x00, 0xF2, 0xC9, 0x81, 0xFF, 0x02, 0x06, 0x00, 0xF5, 0x83, 0xFF, 0x02, 0x5F, 0x00, 0x60, 0xC2, 0x02, 0x09, 0x00, 0xF2, 0xC8, 0x82, 0xFF, 0x02, 0x06, 0x00, 
+	0xF5, 0x83, 0xFF, 0x02, 0x5F, 0x00, 0x60, 0xC2, 0x02, 0x09, 0x00, 0xF2, 0xC7, 0x83, 0xFF, 0x02, 0x06, 0x00, 0xF5, 0x83, 0xFF, 0x02, 0x5F, 0x00, 0x60, 0xC2, 0x02, 0x09, 0x00, 0xF2, 0xC7, 0x83, 0xFF, 0x02, 0x06, 0x00, 0xF5, 0x83, 0xFF, 0x02, 0x5F, 0x00, 0x60, 0xC2, 0x02, 0x09, 0x00, 0xF2, 0xC7, 0x83, 
+	0xFF, 0x02, 0x06, 0x00, 0xF5, 0x83, 0xFF, 0x02, 0x5F, 0x00, 0x60, 0xC2, 0x02, 0x09, 0x00, 0xF2, 0xC7, 0x83, 0xFF, 0x02, 0x06, 0x00, 0xF5, 0x83, 0xFF, 0x02, 0x5F, 0x00, 0x60, 0xC2, 0x02, 0x09, 0x00, 0xF2, 0xC7, 0x83, 0xFF, 0x02, 0x06, 0x00, 0xF5, 0x83, 0xFF, 0x02, 0x5F, 0x00, 0x60, 0xC2, 0x02, 0x09, 
+	0x00, 0xF2, 0xC7, 0x83, 0xFF, 0x02, 0x06, 0x00, 0xF5, 0x83, 0xFF, 0x02, 0x5F, 0x00, 0x60, 0xC2, 0x02, 0x09, 0x00, 0xF2, 0xC7, 0x83, 0xFF, 0x02, 0x06, 0x00, 0xF5, 0x83, 0xFF, 0x02, 0x5F, 0x00, 0x60, 0xC2, 0x02, 0x09, 0x00, 0xF2, 0xC7, 0x83, 0xFF, 0x02, 0x06, 0x00, 0xF5, 0x83, 0xFF, 0x01, 0x5F, 0x00, 
+	0xC3, 0x02, 0x09, 0x00, 0xF2, 0xC7, 0x83, 0xFF, 0x02, 0x06, 0x00, 0xF5, 0x81, 0xFF, 0x04, 0xDF, 0x33, 0x13, 0x00, 0x10, 0x80, 0x33, 0x02, 0x02, 0x00, 0xF2, 0xC7, 0x81, 0xFF, 0x09, 0xDF, 0x9B, 0x03, 0x00, 0x31, 0x33, 0xFD, 0xFF, 0xFF, 0xCF, 0x86, 0x00, 0x00, 0xF2, 0x85, 0xFF, 0x03, 0xDF, 0x9B, 0x57, 
+	0x13, 0x83, 0x00, 0x03, 0xFC, 0xFF, 0xFF, 0xCF, 0x86, 0x00, 0x00, 0xF2, 0x81, 0xFF, 0x03, 0xEF, 0xAC, 0x68, 0x24, 0x87, 0x00, 0x03, 0xFC, 0xFF, 0xFF, 0xCF, 0x86, 0x00, 0x04, 0xF2, 0xEF, 0xAC, 0x68, 0x24, 0x8B, 0x00, 0x03, 0xFC, 0xFF, 0xFF, 0xEF, 0x84, 0x77, 0x02, 0x04, 0x00, 0x20, 0x8A, 0x00, 0x01, 
+	0x10, 0x53, 0x80, 0x77, 0x00, 0xFE, 0x87, 0xFF, 0x00, 0x09, 0x88, 0x00, 0x03, 0x10, 0x53, 0x97, 0xDB, 0xC4, 0x88, 0xFF, 0x00, 0x09, 0x84, 0x00, 0x03, 0x10, 0x53, 0x97, 0xDB, 0x91, 0xFF, 0x00, 0x09, 0x80, 0x00, 0x03, 0x10, 0x53, 0x97, 0xDB, 0xC2, 0x92, 0xFF, 0x03, 0x19, 0x53, 0x97, 0xDB, 0xC6, 0x89, 
+	0xFF, 
 	};
+const Icon dooropen_icon = {dooropen_width, dooropen_height, sizeof(dooropen_data), dooropen_data, &doorclosed_icon};
@@ -1,104 +1,86 @@
+#pragma once
 const uint32_t exhaustfanon_width = 100;
 const uint32_t exhaustfanon_height = 100;
-const uint8_t exhaustfanon_data[(100*100)/2] = {
-0xFF, 0x7E, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xE7, 0xFF, 
-	0xCF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFC, 
-	0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 
-	0x07, 0x10, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x33, 0x33, 0x33, 0x23, 0x00, 0x70, 
-	0x03, 0x40, 0x45, 0x44, 0x55, 0x44, 0x55, 0x45, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x54, 0x45, 0x33, 0x33, 0x33, 0x33, 0x02, 0x30, 
-	0x00, 0x40, 0x44, 0x54, 0x34, 0x12, 0x32, 0x54, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x23, 0x11, 0x32, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x01, 0x00, 0x00, 0x41, 0x45, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x54, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x54, 0x14, 0x00, 0x00, 0x10, 0x32, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x04, 0x00, 0x00, 0x00, 0x10, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x55, 0x44, 0x44, 0x34, 0x22, 0x22, 0x22, 0x22, 0x43, 0x44, 0x44, 0x55, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x01, 0x00, 0x00, 0x00, 0x30, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x54, 0x02, 0x20, 0x87, 0x27, 0x00, 0x43, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x34, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x43, 0x54, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x34, 0x00, 0x72, 0x78, 0x02, 0x10, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x01, 0x80, 0xBB, 0x8B, 0x00, 0x41, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x54, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x14, 0x00, 0xB8, 0xBB, 0x08, 0x10, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x45, 0x01, 0xA3, 0xBB, 0xBB, 0x03, 0x40, 0x45, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x34, 0x01, 0x00, 0x00, 0x00, 0x20, 0x74, 0x98, 0xAA, 0xAA, 0x89, 0x47, 0x02, 0x00, 0x00, 0x00, 0x10, 0x43, 0x54, 0x44, 0x44, 0x44, 0x44, 0x44, 0x54, 0x04, 0x30, 0xBB, 0xBB, 0x3A, 0x10, 0x32, 0x03, 0x00, 
-	0x00, 0x40, 0x45, 0x01, 0xA0, 0xBB, 0xAB, 0x02, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x54, 0x34, 0x01, 0x00, 0x00, 0x42, 0xB7, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x7B, 0x24, 0x00, 0x00, 0x10, 0x43, 0x45, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0x20, 0xBA, 0xBB, 0x0A, 0x10, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x54, 0x02, 0x60, 0xBA, 0x5A, 0x00, 0x42, 0x44, 0x44, 0x44, 0x44, 0x54, 0x34, 0x01, 0x00, 0x10, 0x95, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x59, 0x01, 0x00, 0x10, 0x43, 0x45, 0x44, 0x44, 0x44, 0x44, 0x24, 0x00, 0xA5, 0xAB, 0x06, 0x10, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x54, 0x03, 0x00, 0x64, 0x04, 0x00, 0x53, 0x44, 0x44, 0x44, 0x44, 0x35, 0x01, 0x00, 0x10, 0xD8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0x66, 0x76, 0x87, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0x8D, 0x01, 0x00, 0x10, 0x53, 0x44, 0x44, 0x44, 0x44, 0x35, 0x00, 0x40, 0x46, 0x00, 0x20, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x24, 0x00, 0x00, 0x00, 0x30, 0x44, 0x44, 0x44, 0x44, 0x45, 0x02, 0x00, 0x10, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x10, 0x11, 0x11, 0x11, 0x11, 0x31, 0xB6, 0xFF, 0xFF, 0xFF, 0x7E, 0x01, 0x00, 0x20, 0x54, 0x44, 0x44, 0x44, 0x44, 0x03, 0x00, 0x00, 0x01, 0x31, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x13, 0x00, 0x10, 0x43, 0x44, 0x44, 0x44, 0x54, 0x14, 0x00, 0x00, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE4, 0xFF, 0xFF, 0xFF, 0x6D, 0x00, 0x00, 0x41, 0x45, 0x44, 0x44, 0x44, 0x34, 0x01, 0x00, 0x20, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x45, 0x34, 0x44, 0x45, 0x44, 0x44, 0x44, 0x34, 0x00, 0x00, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x60, 0x88, 0x88, 0x68, 0x35, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x5C, 0x00, 0x00, 0x43, 0x44, 0x44, 0x44, 0x54, 0x44, 0x23, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x44, 0x55, 0x45, 0x44, 0x44, 0x44, 0x44, 0x02, 0x00, 0x90, 0xFF, 0xFF, 0xDF, 0xFE, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0xA4, 0xBB, 0xBB, 0x9A, 0x99, 0x99, 0x06, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x20, 0x44, 0x44, 0x44, 0x44, 0x54, 0x34, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x54, 0x24, 0x00, 0x20, 0xFC, 0xFF, 0x7E, 0x02, 0x30, 0xFC, 0xFF, 0xFF, 0x8F, 0x00, 0xB6, 0xAA, 0xAA, 0x9A, 0xA9, 0xAA, 0x6A, 0x10, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x02, 0x00, 0x42, 0x45, 0x44, 0x44, 0x44, 0x34, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x01, 0x00, 0xD3, 0xFF, 0xBF, 0x02, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x7F, 0x00, 0xB7, 0xBA, 0xAB, 0x99, 0x99, 0x99, 0x6A, 0x10, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3D, 0x00, 0x10, 0x54, 0x44, 0x44, 0x44, 0x34, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x14, 0x00, 0x50, 0xFF, 0xFF, 0x06, 0x00, 0x20, 0x00, 0x20, 0xFE, 0xFF, 0x6F, 0x00, 0xB8, 0xBA, 0xAB, 0x99, 0x99, 0xA9, 0x39, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x41, 0x44, 0x44, 0x44, 0x34, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x02, 0x00, 0xF7, 0xFF, 0x3C, 0x10, 0x20, 0x97, 0x38, 0x00, 0xFB, 0xFF, 0x5F, 0x00, 0xB9, 0xBA, 0xAB, 0x99, 0x99, 0xA9, 0x06, 0x21, 0xFF, 0xFF, 0xFF, 0xDF, 0x89, 0xEB, 0xFF, 0x7F, 0x00, 0x20, 0x44, 0x44, 0x44, 0x34, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x00, 0x70, 0xFF, 0xCF, 0x01, 0x00, 0x95, 0x9A, 0x5A, 0x00, 0xF7, 0xFF, 0x4F, 0x00, 0xB9, 0xBA, 0xAA, 0x99, 0x99, 0x9A, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x20, 0xFB, 0xFF, 0x07, 0x00, 0x42, 0x44, 0x44, 0x34, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x54, 0x03, 0x00, 0xF5, 0xFF, 0x1B, 0x00, 0x70, 0xA9, 0x99, 0x89, 0x00, 0xF2, 0xFF, 0x3F, 0x00, 0xBA, 0xBA, 0xAA, 0x99, 0x99, 0x5A, 0x00, 0xF3, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0x5F, 0x00, 0x30, 0x45, 0x44, 0x34, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x00, 0x30, 0xFF, 0xBF, 0x10, 0x10, 0xA9, 0x99, 0x99, 0x99, 0x01, 0xD0, 0xFF, 0x2F, 0x00, 0xBA, 0xBA, 0x9A, 0x99, 0xA9, 0x08, 0x00, 0xFB, 0xFF, 0xDF, 0x03, 0x00, 0x64, 0x01, 0x01, 0xFB, 0xFF, 0x03, 0x00, 0x54, 0x44, 0x34, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x14, 0x00, 0xD2, 0xFF, 0x0B, 0x01, 0x91, 0xAB, 0x99, 0x99, 0x99, 0x05, 0x90, 0xFF, 0x1F, 0x00, 0xBA, 0xBA, 0x9A, 0x99, 0x99, 0x04, 0x50, 0xFF, 0xFF, 0x2C, 0x00, 0x70, 0xBA, 0x29, 0x10, 0xC1, 0xFF, 0x2D, 0x00, 0x41, 0x44, 0x34, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x54, 0x02, 0x00, 0xFC, 0xEF, 0x02, 0x20, 0xB9, 0xBA, 0x9A, 0x99, 0xA9, 0x07, 0x41, 0xFF, 0x0F, 0x10, 0xBA, 0xBA, 0x9A, 0x99, 0x7A, 0x00, 0xD1, 0xFF, 0xBF, 0x01, 0x00, 0xB8, 0xAB, 0x9B, 0x01, 0x10, 0xFC, 0xCF, 0x00, 0x20, 0x44, 0x34, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x35, 0x00, 0x90, 0xFF, 0xBF, 0x00, 0x91, 0xAB, 0xBB, 0xAA, 0x99, 0xA9, 0x08, 0x20, 0xFF, 0x0F, 0x10, 0xBA, 0xBA, 0x9A, 0x99, 0x49, 0x00, 0xF7, 0xFF, 0x09, 0x01, 0x80, 0xAB, 0xBB, 0xBA, 0x19, 0x00, 0xF3, 0xFF, 0x09, 0x00, 0x53, 0x34, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x14, 0x00, 0xF5, 0xFF, 0x8F, 0x00, 0xB6, 0xBA, 0xBB, 0xAB, 0x99, 0x99, 0x49, 0x10, 0xFB, 0x0F, 0x00, 0xBA, 0xBB, 0x9A, 0xA9, 0x08, 0x11, 0xFD, 0x8F, 0x10, 0x30, 0xB9, 0xBA, 0xBB, 0xAB, 0x9B, 0x00, 0x60, 0xFF, 0x5F, 0x00, 0x41, 0x34, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x44, 0x54, 0x03, 0x00, 0xFC, 0xFF, 0xAF, 0x00, 0xA4, 0xBB, 0xBB, 0xBB, 0x9A, 0x99, 0x6A, 0x10, 0xF5, 0x1F, 0x00, 0xBA, 0xBB, 0x9A, 0x99, 0x06, 0x40, 0xFF, 0x09, 0x01, 0x94, 0xAB, 0xBB, 0xBB, 0xBB, 0xAA, 0x07, 0x00, 0xFB, 0xCF, 0x00, 0x30, 0x34, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x44, 0x45, 0x01, 0x60, 0xFF, 0xFF, 0xDF, 0x00, 0x70, 0xAB, 0xBB, 0xBB, 0x9A, 0x99, 0x7A, 0x00, 0xC0, 0x1F, 0x00, 0xBA, 0xBB, 0x9A, 0x9A, 0x01, 0x90, 0x9F, 0x10, 0x50, 0xBA, 0xBA, 0xBB, 0xBB, 0xAA, 0x99, 0x59, 0x00, 0xE2, 0xFF, 0x06, 0x10, 0x33, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x44, 0x34, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xB8, 0xBA, 0xBB, 0xAB, 0x99, 0x99, 0x04, 0x60, 0x2F, 0x00, 0xBA, 0xAA, 0x9A, 0x89, 0x00, 0xF0, 0x0B, 0x01, 0xA5, 0xAB, 0xBB, 0xBB, 0xAB, 0x99, 0x99, 0x9A, 0x02, 0x70, 0xFF, 0x1D, 0x00, 0x32, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x44, 0x14, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x80, 0xAB, 0xBB, 0xBB, 0x9A, 0xA9, 0x07, 0x00, 0x3C, 0x00, 0xBA, 0xBB, 0xAA, 0x5A, 0x00, 0xB6, 0x10, 0x40, 0xBA, 0xBA, 0xBB, 0xAB, 0x9A, 0x99, 0x99, 0xA9, 0x07, 0x20, 0xFF, 0x7F, 0x00, 0x30, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x44, 0x03, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0xB9, 0xBA, 0xBB, 0x9A, 0x99, 0x39, 0x00, 0x35, 0x00, 0xAA, 0x99, 0x88, 0x49, 0x00, 0x16, 0x00, 0xA3, 0xAB, 0xBB, 0xAB, 0x9A, 0x99, 0x99, 0x99, 0x99, 0x29, 0x00, 0xFE, 0xEF, 0x01, 0x20, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x54, 0x01, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x93, 0xAB, 0xBB, 0xAB, 0x99, 0x7A, 0x00, 0x10, 0x00, 0x56, 0x23, 0x21, 0x14, 0x00, 0x00, 0x20, 0xB9, 0xBA, 0xBB, 0xAA, 0x99, 0x99, 0x99, 0x99, 0xA9, 0x09, 0x00, 0xFE, 0xFF, 0x08, 0x10, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x44, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x11, 0x40, 0xBA, 0xBA, 0xBB, 0x9A, 0x99, 0x05, 0x00, 0x10, 0x00, 0x00, 0x00, 0x20, 0x01, 0x00, 0x93, 0xAB, 0xBB, 0xAB, 0x99, 0x99, 0x99, 0xAA, 0x99, 0x58, 0x03, 0x40, 0xFF, 0xFF, 0x1D, 0x00, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x35, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x01, 0xA5, 0xAB, 0xBB, 0xAA, 0xA9, 0x08, 0x11, 0x01, 0x00, 0x42, 0x24, 0x00, 0x10, 0x01, 0xA6, 0xAB, 0xAB, 0x9A, 0x99, 0xA9, 0x9A, 0x78, 0x15, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x5F, 0x00, 0x32, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x24, 0x00, 0xF9, 0xFF, 0xAF, 0x67, 0xE9, 0xFF, 0xFF, 0x9F, 0x10, 0x50, 0xBA, 0xBA, 0xAB, 0x8A, 0x04, 0x01, 0x60, 0xBA, 0xCC, 0xCC, 0xAB, 0x06, 0x10, 0x40, 0xB9, 0x9A, 0x99, 0xA9, 0x79, 0x46, 0x00, 0x00, 0x00, 0x30, 0xFB, 0xFF, 0xFF, 0x9F, 0x00, 0x31, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x54, 0x04, 0x20, 0xFD, 0xDF, 0x03, 0x11, 0x20, 0xF9, 0xFF, 0xFF, 0x08, 0x01, 0xA4, 0xAB, 0xBA, 0x28, 0x10, 0x60, 0xDC, 0xEF, 0xEE, 0xEE, 0xEE, 0xBD, 0x04, 0x00, 0x82, 0x9A, 0xA9, 0x79, 0x04, 0x00, 0x10, 0x00, 0x72, 0xFB, 0xFF, 0xFF, 0xFF, 0xDF, 0x02, 0x20, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x54, 0x03, 0x40, 0xFF, 0x3F, 0x00, 0x00, 0x10, 0x30, 0xFB, 0xFF, 0x9F, 0x10, 0x30, 0xB9, 0x9B, 0x02, 0x00, 0xE9, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x8E, 0x01, 0x20, 0xA8, 0x79, 0x03, 0x00, 0x11, 0x42, 0xD9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x20, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x03, 0x70, 0xFF, 0x0A, 0x00, 0x66, 0x03, 0x00, 0x50, 0xFD, 0xFF, 0x09, 0x01, 0x92, 0x4A, 0x00, 0xA0, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x0B, 0x00, 0x84, 0x05, 0x00, 0x00, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x20, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x01, 0xB0, 0xFF, 0x06, 0x60, 0xAA, 0x69, 0x00, 0x00, 0x71, 0xFD, 0xBF, 0x00, 0x30, 0x06, 0x10, 0xEB, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xAE, 0x10, 0x00, 0x00, 0x00, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x10, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x00, 0xE0, 0xFF, 0x03, 0x80, 0x99, 0xAA, 0x59, 0x00, 0x00, 0x41, 0xF9, 0x1B, 0x00, 0x10, 0x80, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x09, 0x11, 0x00, 0xC5, 0xFF, 0xEF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x45, 0x00, 0xF2, 0xFF, 0x01, 0x90, 0x9A, 0x99, 0xAA, 0x48, 0x00, 0x01, 0x00, 0x66, 0x00, 0x01, 0xE4, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x6E, 0x10, 0x10, 0x33, 0x12, 0x01, 0x00, 0x21, 0x43, 0x65, 0x87, 0xDA, 0xFF, 0xFF, 0x2F, 0x00, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x00, 0xF4, 0xDF, 0x01, 0x92, 0x9A, 0x99, 0x99, 0x9A, 0x47, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEB, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xCE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x4F, 0x00, 0x32, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x34, 0x00, 0xF7, 0xAF, 0x00, 0x95, 0x99, 0x99, 0x99, 0x99, 0x9A, 0x68, 0x01, 0x00, 0x10, 0x60, 0xED, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xDE, 0x06, 0x01, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x7F, 0x00, 0x32, 0x33, 0x03, 0x00, 
-	0x03, 0x41, 0x44, 0x24, 0x00, 0xF8, 0x8F, 0x01, 0xA7, 0x9A, 0x99, 0x99, 0x99, 0x99, 0x9A, 0x89, 0x45, 0x21, 0xA0, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x0A, 0x60, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9A, 0x88, 0x67, 0x04, 0x00, 0xFB, 0x8F, 0x00, 0x32, 0x33, 0x13, 0x30, 
-	0x5D, 0x54, 0x44, 0x24, 0x00, 0xF9, 0x7F, 0x01, 0xB8, 0xAA, 0xAA, 0x9A, 0x99, 0x99, 0x99, 0x9A, 0x9A, 0x04, 0xB0, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x0B, 0x50, 0xBA, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0x6A, 0x10, 0xF7, 0x9F, 0x00, 0x31, 0x33, 0x33, 0xD4, 
-	0xAF, 0x55, 0x44, 0x24, 0x00, 0xFA, 0x7F, 0x01, 0xB8, 0xBA, 0xBB, 0xAA, 0xAA, 0xAA, 0x99, 0x99, 0x8A, 0x02, 0xC2, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x2C, 0x30, 0xB9, 0xBA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x8B, 0x10, 0xF6, 0xAF, 0x00, 0x31, 0x33, 0x33, 0xF9, 
-	0xAF, 0x55, 0x44, 0x24, 0x00, 0xFA, 0x6F, 0x01, 0xB8, 0xBA, 0xBB, 0xBB, 0xBB, 0xAA, 0xAA, 0xAA, 0x8A, 0x01, 0xC4, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x4C, 0x20, 0xB9, 0xBA, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xAB, 0x8B, 0x10, 0xF6, 0xAF, 0x00, 0x31, 0x33, 0x33, 0xF8, 
-	0xAF, 0x55, 0x44, 0x24, 0x00, 0xFA, 0x6F, 0x01, 0xB8, 0xBA, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xAB, 0x9B, 0x02, 0xC4, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x4C, 0x10, 0xA8, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xBB, 0xAB, 0x8B, 0x10, 0xF6, 0xAF, 0x00, 0x31, 0x33, 0x33, 0xF8, 
-	0xAF, 0x55, 0x44, 0x24, 0x00, 0xFA, 0x6F, 0x01, 0xB8, 0xAA, 0xAA, 0xBA, 0xBB, 0xAA, 0xAA, 0xAA, 0x9B, 0x03, 0xC2, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x2C, 0x20, 0xA8, 0x99, 0x99, 0x99, 0x99, 0xAA, 0xAA, 0xAA, 0x8B, 0x10, 0xF7, 0xAF, 0x00, 0x31, 0x33, 0x33, 0xF9, 
-	0x5D, 0x54, 0x44, 0x24, 0x00, 0xF9, 0x7F, 0x01, 0xA6, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xAB, 0x05, 0xB0, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x0B, 0x40, 0xA9, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x99, 0xA9, 0x8A, 0x10, 0xF7, 0x9F, 0x00, 0x31, 0x33, 0x33, 0xD4, 
-	0x03, 0x41, 0x44, 0x24, 0x00, 0xF8, 0xBF, 0x00, 0x40, 0x76, 0x88, 0xA9, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x06, 0xA0, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x0A, 0x12, 0x54, 0x98, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x99, 0x79, 0x10, 0xF8, 0x8F, 0x00, 0x32, 0x33, 0x13, 0x30, 
-	0x00, 0x40, 0x44, 0x34, 0x00, 0xF7, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0x10, 0x60, 0xED, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xDE, 0x06, 0x01, 0x00, 0x10, 0x86, 0xA9, 0x99, 0x99, 0x99, 0x99, 0x59, 0x00, 0xFA, 0x7F, 0x00, 0x32, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x00, 0xF4, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xEC, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xBE, 0x10, 0x00, 0x00, 0x00, 0x00, 0x74, 0xA9, 0x99, 0x99, 0xA9, 0x29, 0x10, 0xFD, 0x4F, 0x00, 0x32, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x45, 0x00, 0xF2, 0xFF, 0xFF, 0xAD, 0x78, 0x56, 0x34, 0x12, 0x00, 0x10, 0x21, 0x33, 0x01, 0x01, 0xE6, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x4E, 0x10, 0x00, 0x66, 0x00, 0x10, 0x00, 0x84, 0xAA, 0x99, 0xA9, 0x09, 0x10, 0xFF, 0x2F, 0x00, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0x5C, 0x00, 0x11, 0x90, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x08, 0x01, 0x00, 0xB1, 0x9F, 0x14, 0x00, 0x00, 0x95, 0xAA, 0x99, 0x08, 0x30, 0xFF, 0x0E, 0x00, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x01, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6C, 0x00, 0x00, 0x00, 0x01, 0xEA, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xBE, 0x01, 0x60, 0x03, 0x00, 0xFB, 0xDF, 0x17, 0x00, 0x00, 0x96, 0xAA, 0x06, 0x60, 0xFF, 0x0B, 0x10, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x03, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5B, 0x00, 0x00, 0x50, 0x48, 0x00, 0xB0, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x0A, 0x00, 0xA4, 0x29, 0x10, 0x90, 0xFF, 0xDF, 0x05, 0x00, 0x30, 0x66, 0x00, 0xA0, 0xFF, 0x07, 0x20, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x54, 0x03, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9D, 0x24, 0x11, 0x00, 0x30, 0x97, 0x8A, 0x02, 0x10, 0xE8, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x9E, 0x00, 0x20, 0xB9, 0x9B, 0x03, 0x01, 0xF9, 0xFF, 0xBF, 0x03, 0x01, 0x00, 0x00, 0xF3, 0xFF, 0x04, 0x20, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x54, 0x04, 0x20, 0xFD, 0xFF, 0xFF, 0xFF, 0xBF, 0x27, 0x00, 0x01, 0x00, 0x40, 0x97, 0x9A, 0xA9, 0x28, 0x00, 0x40, 0xDB, 0xEE, 0xEE, 0xEE, 0xFE, 0xCD, 0x06, 0x01, 0x82, 0xAB, 0xBA, 0x4A, 0x10, 0x80, 0xFF, 0xFF, 0x9F, 0x02, 0x11, 0x30, 0xFD, 0xDF, 0x02, 0x20, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x24, 0x00, 0xF9, 0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x00, 0x00, 0x64, 0x97, 0x9A, 0x99, 0xA9, 0x9B, 0x04, 0x01, 0x60, 0xBA, 0xCC, 0xCC, 0xAB, 0x06, 0x10, 0x40, 0xA8, 0xBA, 0xAB, 0xAB, 0x05, 0x01, 0xF9, 0xFF, 0xFF, 0x9E, 0x76, 0xFA, 0xFF, 0x9F, 0x00, 0x31, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x35, 0x00, 0xF5, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x51, 0x87, 0xA9, 0x9A, 0x99, 0xA9, 0xBA, 0xBA, 0x6A, 0x10, 0x01, 0x00, 0x42, 0x24, 0x00, 0x10, 0x11, 0x80, 0x9A, 0xA9, 0xBB, 0xBA, 0x5A, 0x10, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x32, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x44, 0x00, 0xD1, 0xFF, 0xFF, 0x04, 0x30, 0x85, 0x99, 0xAA, 0x99, 0x99, 0x99, 0xAA, 0xBB, 0xBA, 0x39, 0x00, 0x10, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x50, 0x99, 0x99, 0xBA, 0xAB, 0xAB, 0x04, 0x11, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x54, 0x01, 0x80, 0xFF, 0xEF, 0x00, 0x90, 0x9A, 0x99, 0x99, 0x99, 0x99, 0xA9, 0xBA, 0xAB, 0x9B, 0x02, 0x00, 0x00, 0x41, 0x12, 0x32, 0x65, 0x00, 0x01, 0x00, 0xA7, 0x99, 0xAA, 0xBB, 0xBA, 0x39, 0x00, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x10, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x44, 0x03, 0x10, 0xFE, 0xDF, 0x00, 0x92, 0x99, 0x99, 0x99, 0x99, 0x99, 0xBA, 0xBB, 0xBA, 0x3A, 0x00, 0x61, 0x00, 0x94, 0x88, 0x99, 0xAA, 0x00, 0x53, 0x00, 0x93, 0x99, 0xA9, 0xBB, 0xAB, 0x9B, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0x20, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x44, 0x14, 0x00, 0xF7, 0xFF, 0x02, 0x70, 0x9A, 0x99, 0x99, 0x99, 0xAA, 0xBB, 0xAB, 0xAB, 0x04, 0x01, 0x6B, 0x00, 0xA5, 0xAA, 0xBB, 0xAB, 0x00, 0xC3, 0x00, 0x70, 0x9A, 0x99, 0xBA, 0xBB, 0xBA, 0x08, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x30, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x44, 0x34, 0x00, 0xD1, 0xFF, 0x07, 0x20, 0xA9, 0x99, 0x99, 0xA9, 0xBA, 0xBB, 0xBA, 0x5A, 0x10, 0xB0, 0x0F, 0x00, 0x98, 0xA9, 0xAA, 0xAB, 0x00, 0xF2, 0x06, 0x40, 0x99, 0x99, 0xA9, 0xBB, 0xAB, 0x8B, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x32, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x44, 0x45, 0x01, 0x60, 0xFF, 0x2E, 0x00, 0x95, 0x99, 0xA9, 0xBA, 0xBB, 0xAB, 0xAB, 0x05, 0x01, 0xF9, 0x09, 0x10, 0xA9, 0xA9, 0xAB, 0xAB, 0x00, 0xF1, 0x0C, 0x00, 0xA7, 0x99, 0xA9, 0xBA, 0xBB, 0xBA, 0x07, 0x00, 0xFD, 0xFF, 0xFF, 0x06, 0x10, 0x33, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x44, 0x54, 0x03, 0x00, 0xFC, 0xAF, 0x00, 0x70, 0x9A, 0xAA, 0xBB, 0xBB, 0xBA, 0x49, 0x10, 0x90, 0xFF, 0x04, 0x60, 0x99, 0xA9, 0xAB, 0xAB, 0x00, 0xF1, 0x5F, 0x01, 0xA6, 0x99, 0x99, 0xBA, 0xBB, 0xBB, 0x4A, 0x00, 0xFA, 0xFF, 0xCF, 0x00, 0x30, 0x34, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x14, 0x00, 0xF5, 0xFF, 0x06, 0x00, 0xB8, 0xBA, 0xBB, 0xAB, 0x9B, 0x03, 0x01, 0xF8, 0xDF, 0x11, 0x80, 0x9A, 0xA9, 0xAB, 0xAB, 0x00, 0xF0, 0xBF, 0x01, 0x94, 0x99, 0x99, 0xA9, 0xBB, 0xAB, 0x6B, 0x00, 0xF8, 0xFF, 0x5F, 0x00, 0x41, 0x34, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x35, 0x00, 0x90, 0xFF, 0x2F, 0x00, 0x91, 0xAB, 0xBB, 0xBA, 0x08, 0x10, 0x90, 0xFF, 0x7F, 0x00, 0x94, 0x99, 0xA9, 0xAB, 0xAB, 0x01, 0xF0, 0xFF, 0x02, 0x80, 0x9A, 0x99, 0xA9, 0xBA, 0xBA, 0x19, 0x00, 0xFB, 0xFF, 0x09, 0x00, 0x53, 0x34, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x54, 0x02, 0x00, 0xFC, 0xCF, 0x01, 0x10, 0xB9, 0xBA, 0x8B, 0x00, 0x10, 0xFB, 0xFF, 0x1D, 0x00, 0xA7, 0x99, 0xAA, 0xAB, 0xAB, 0x01, 0xF0, 0xFF, 0x14, 0x70, 0x9A, 0x99, 0x99, 0xAA, 0x9B, 0x02, 0x20, 0xFE, 0xCF, 0x00, 0x20, 0x44, 0x34, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x14, 0x00, 0xD2, 0xFF, 0x1C, 0x01, 0x92, 0xAB, 0x07, 0x00, 0xC2, 0xFF, 0xFF, 0x05, 0x40, 0x99, 0x99, 0xBA, 0xBB, 0xAB, 0x00, 0xF1, 0xFF, 0x09, 0x50, 0x99, 0x99, 0x99, 0xB9, 0x19, 0x10, 0xB0, 0xFF, 0x2D, 0x00, 0x41, 0x44, 0x34, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x00, 0x30, 0xFF, 0xBF, 0x10, 0x10, 0x46, 0x00, 0x30, 0xFD, 0xFF, 0xBF, 0x00, 0x80, 0x9A, 0x99, 0xBA, 0xBB, 0xAB, 0x00, 0xF2, 0xFF, 0x0D, 0x10, 0x99, 0x99, 0x99, 0x8A, 0x01, 0x01, 0xFB, 0xFF, 0x03, 0x00, 0x54, 0x44, 0x34, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x54, 0x03, 0x00, 0xF5, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0xE5, 0xFF, 0xFF, 0x3F, 0x00, 0xA5, 0x99, 0x99, 0xBA, 0xBB, 0xAB, 0x00, 0xF3, 0xFF, 0x2F, 0x00, 0x98, 0x99, 0x9A, 0x07, 0x00, 0xB1, 0xFF, 0x5F, 0x00, 0x30, 0x45, 0x44, 0x34, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x00, 0x70, 0xFF, 0xBF, 0x02, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xA9, 0x99, 0xA9, 0xBA, 0xAB, 0x9B, 0x00, 0xF4, 0xFF, 0x7F, 0x00, 0xA5, 0xA9, 0x59, 0x00, 0x10, 0xFC, 0xFF, 0x07, 0x00, 0x42, 0x44, 0x44, 0x34, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x02, 0x00, 0xF7, 0xFF, 0xBE, 0x98, 0xFD, 0xFF, 0xFF, 0xFF, 0x12, 0x60, 0x9A, 0x99, 0xA9, 0xBB, 0xAB, 0x9B, 0x00, 0xF5, 0xFF, 0xBF, 0x00, 0x83, 0x79, 0x02, 0x00, 0xC3, 0xFF, 0x7F, 0x00, 0x20, 0x44, 0x44, 0x44, 0x34, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x14, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x93, 0x9A, 0x99, 0xA9, 0xBB, 0xAB, 0x8B, 0x00, 0xF6, 0xFF, 0xEF, 0x02, 0x00, 0x02, 0x00, 0x60, 0xFF, 0xFF, 0x05, 0x00, 0x41, 0x44, 0x44, 0x44, 0x34, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x01, 0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x01, 0xA6, 0x99, 0x99, 0xA9, 0xBB, 0xAB, 0x7B, 0x00, 0xF7, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x20, 0xFB, 0xFF, 0x3D, 0x00, 0x10, 0x54, 0x44, 0x44, 0x44, 0x34, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x54, 0x44, 0x54, 0x44, 0x44, 0x54, 0x24, 0x00, 0x20, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x01, 0xA6, 0xAA, 0x9A, 0xA9, 0xAA, 0xAA, 0x6B, 0x00, 0xF8, 0xFF, 0xFF, 0xCF, 0x03, 0x20, 0xE7, 0xFF, 0xCF, 0x02, 0x00, 0x42, 0x45, 0x44, 0x44, 0x54, 0x34, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x44, 0x23, 0x43, 0x44, 0x44, 0x44, 0x44, 0x02, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x60, 0x98, 0x99, 0xBA, 0xBB, 0xBB, 0x4A, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xEF, 0xFD, 0xFF, 0xFF, 0x09, 0x00, 0x20, 0x44, 0x44, 0x44, 0x44, 0x34, 0x22, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x02, 0x00, 0x00, 0x42, 0x45, 0x44, 0x44, 0x34, 0x00, 0x00, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x52, 0x87, 0x88, 0x88, 0x06, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5C, 0x00, 0x00, 0x43, 0x44, 0x44, 0x54, 0x24, 0x00, 0x00, 0x10, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x24, 0x00, 0x00, 0x00, 0x20, 0x44, 0x44, 0x44, 0x54, 0x14, 0x00, 0x00, 0xD6, 0xFF, 0xFF, 0xFF, 0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6D, 0x00, 0x00, 0x41, 0x45, 0x44, 0x44, 0x44, 0x02, 0x00, 0x00, 0x00, 0x31, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x54, 0x03, 0x00, 0x75, 0x05, 0x00, 0x43, 0x44, 0x44, 0x44, 0x45, 0x02, 0x00, 0x10, 0xE7, 0xFF, 0xFF, 0xFF, 0x5B, 0x13, 0x00, 0x11, 0x11, 0x11, 0x01, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0x01, 0x00, 0x20, 0x54, 0x44, 0x44, 0x44, 0x34, 0x00, 0x50, 0x57, 0x00, 0x20, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x01, 0x70, 0xBB, 0x7B, 0x00, 0x41, 0x44, 0x44, 0x44, 0x44, 0x35, 0x01, 0x00, 0x10, 0xD8, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0x78, 0x56, 0x55, 0xB7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8D, 0x01, 0x00, 0x10, 0x53, 0x44, 0x44, 0x44, 0x44, 0x14, 0x00, 0xB7, 0xBB, 0x07, 0x11, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x45, 0x01, 0xA2, 0xBB, 0xAB, 0x02, 0x40, 0x44, 0x44, 0x44, 0x44, 0x54, 0x34, 0x01, 0x00, 0x10, 0x95, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x59, 0x01, 0x00, 0x10, 0x43, 0x45, 0x44, 0x44, 0x44, 0x44, 0x04, 0x20, 0xBA, 0xBB, 0x2A, 0x10, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x45, 0x01, 0xA2, 0xBB, 0xBB, 0x02, 0x40, 0x44, 0x44, 0x44, 0x44, 0x44, 0x54, 0x34, 0x01, 0x00, 0x00, 0x42, 0xB7, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x7B, 0x24, 0x00, 0x00, 0x10, 0x43, 0x45, 0x44, 0x44, 0x44, 0x44, 0x44, 0x04, 0x20, 0xBB, 0xBB, 0x2A, 0x10, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x01, 0x80, 0xBB, 0x7B, 0x00, 0x41, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x34, 0x01, 0x00, 0x00, 0x00, 0x20, 0x74, 0x98, 0xAA, 0xAA, 0x89, 0x47, 0x02, 0x00, 0x00, 0x00, 0x10, 0x43, 0x54, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x14, 0x00, 0xB7, 0xBB, 0x08, 0x11, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x54, 0x03, 0x00, 0x96, 0x06, 0x00, 0x43, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x54, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x34, 0x00, 0x60, 0x69, 0x00, 0x20, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x14, 0x00, 0x00, 0x00, 0x20, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x34, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x43, 0x54, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x02, 0x00, 0x00, 0x00, 0x31, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x02, 0x10, 0x00, 0x42, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x55, 0x44, 0x44, 0x34, 0x22, 0x22, 0x22, 0x22, 0x43, 0x44, 0x44, 0x55, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x24, 0x00, 0x01, 0x10, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x44, 0x23, 0x43, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x54, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x45, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x34, 0x22, 0x32, 0x33, 0x33, 0x03, 0x00, 
-	0x00, 0x40, 0x44, 0x44, 0x44, 0x55, 0x45, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x54, 0x34, 0x33, 0x33, 0x33, 0x03, 0x00, 
-	0x03, 0x40, 0x45, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x33, 0x33, 0x33, 0x33, 0x02, 0x30, 
-	0x07, 0x10, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x33, 0x33, 0x33, 0x23, 0x00, 0x70, 
-	0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 
-	0xCF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFC, 
-	0xFF, 0x7E, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xE7, 0xFF, 
+const uint8_t exhaustfanon_data[3958] = { // run length encoded
+0x02, 0xFF, 0x7E, 0x03, 0xA9, 0x00, 0x04, 0x30, 0xE7, 0xFF, 0xCF, 0x02, 0xAB, 0x00, 0x02, 0x20, 0xFC, 0x2E, 0xAD, 0x00, 0x02, 0xE2, 0x07, 0x10, 0xA7, 0x44, 0x80, 0x33, 0x0A, 0x23, 0x00, 0x70, 0x03, 0x40, 0x45, 0x44, 0x55, 0x44, 0x55, 0x45, 0x9F, 0x44, 0x01, 0x54, 0x45, 0x81, 0x33, 0x09, 0x02, 0x30, 
+	0x00, 0x40, 0x44, 0x54, 0x34, 0x12, 0x32, 0x54, 0x9F, 0x44, 0x10, 0x45, 0x23, 0x11, 0x32, 0x33, 0x33, 0x03, 0x00, 0x00, 0x40, 0x44, 0x44, 0x01, 0x00, 0x00, 0x41, 0x45, 0x89, 0x44, 0x00, 0x54, 0x83, 0x44, 0x00, 0x45, 0x89, 0x44, 0x0C, 0x54, 0x14, 0x00, 0x00, 0x10, 0x32, 0x33, 0x03, 0x00, 0x00, 0x40, 
+	0x44, 0x04, 0x80, 0x00, 0x00, 0x10, 0x88, 0x44, 0x03, 0x55, 0x44, 0x44, 0x34, 0x81, 0x22, 0x03, 0x43, 0x44, 0x44, 0x55, 0x88, 0x44, 0x00, 0x01, 0x80, 0x00, 0x0C, 0x30, 0x33, 0x03, 0x00, 0x00, 0x40, 0x54, 0x02, 0x20, 0x87, 0x27, 0x00, 0x43, 0x86, 0x44, 0x02, 0x45, 0x34, 0x13, 0x85, 0x00, 0x02, 0x31, 
+	0x43, 0x54, 0x86, 0x44, 0x11, 0x34, 0x00, 0x72, 0x78, 0x02, 0x10, 0x33, 0x03, 0x00, 0x00, 0x40, 0x44, 0x01, 0x80, 0xBB, 0x8B, 0x00, 0x41, 0x85, 0x44, 0x01, 0x45, 0x23, 0x89, 0x00, 0x01, 0x32, 0x54, 0x85, 0x44, 0x12, 0x14, 0x00, 0xB8, 0xBB, 0x08, 0x10, 0x33, 0x03, 0x00, 0x00, 0x40, 0x45, 0x01, 0xA3, 
+	0xBB, 0xBB, 0x03, 0x40, 0x45, 0x82, 0x44, 0x02, 0x45, 0x34, 0x01, 0x80, 0x00, 0x07, 0x20, 0x74, 0x98, 0xAA, 0xAA, 0x89, 0x47, 0x02, 0x80, 0x00, 0x02, 0x10, 0x43, 0x54, 0x82, 0x44, 0x12, 0x54, 0x04, 0x30, 0xBB, 0xBB, 0x3A, 0x10, 0x32, 0x03, 0x00, 0x00, 0x40, 0x45, 0x01, 0xA0, 0xBB, 0xAB, 0x02, 0x40, 
+	0x82, 0x44, 0x07, 0x54, 0x34, 0x01, 0x00, 0x00, 0x42, 0xB7, 0xFE, 0x83, 0xFF, 0x07, 0xEF, 0x7B, 0x24, 0x00, 0x00, 0x10, 0x43, 0x45, 0x82, 0x44, 0x11, 0x04, 0x20, 0xBA, 0xBB, 0x0A, 0x10, 0x33, 0x03, 0x00, 0x00, 0x40, 0x54, 0x02, 0x60, 0xBA, 0x5A, 0x00, 0x42, 0x81, 0x44, 0x06, 0x54, 0x34, 0x01, 0x00, 
+	0x10, 0x95, 0xFD, 0x87, 0xFF, 0x06, 0xDF, 0x59, 0x01, 0x00, 0x10, 0x43, 0x45, 0x81, 0x44, 0x11, 0x24, 0x00, 0xA5, 0xAB, 0x06, 0x10, 0x33, 0x03, 0x00, 0x00, 0x40, 0x54, 0x03, 0x00, 0x64, 0x04, 0x00, 0x53, 0x81, 0x44, 0x04, 0x35, 0x01, 0x00, 0x10, 0xD8, 0x82, 0xFF, 0x04, 0x7B, 0x66, 0x76, 0x87, 0xDA, 
+	0x81, 0xFF, 0x04, 0x8D, 0x01, 0x00, 0x10, 0x53, 0x81, 0x44, 0x0C, 0x35, 0x00, 0x40, 0x46, 0x00, 0x20, 0x33, 0x03, 0x00, 0x00, 0x40, 0x44, 0x24, 0x80, 0x00, 0x00, 0x30, 0x81, 0x44, 0x04, 0x45, 0x02, 0x00, 0x10, 0xE7, 0x82, 0xFF, 0x01, 0x5F, 0x10, 0x81, 0x11, 0x01, 0x31, 0xB6, 0x80, 0xFF, 0x04, 0x7E, 
+	0x01, 0x00, 0x20, 0x54, 0x81, 0x44, 0x0F, 0x03, 0x00, 0x00, 0x01, 0x31, 0x33, 0x03, 0x00, 0x00, 0x40, 0x44, 0x44, 0x13, 0x00, 0x10, 0x43, 0x80, 0x44, 0x04, 0x54, 0x14, 0x00, 0x00, 0xD6, 0x83, 0xFF, 0x00, 0x06, 0x84, 0x00, 0x00, 0xE4, 0x80, 0xFF, 0x04, 0x6D, 0x00, 0x00, 0x41, 0x45, 0x80, 0x44, 0x0F, 
+	0x34, 0x01, 0x00, 0x20, 0x33, 0x33, 0x03, 0x00, 0x00, 0x40, 0x44, 0x44, 0x45, 0x34, 0x44, 0x45, 0x80, 0x44, 0x03, 0x34, 0x00, 0x00, 0xC5, 0x83, 0xFF, 0x09, 0xDF, 0x00, 0x60, 0x88, 0x88, 0x68, 0x35, 0x00, 0x00, 0x40, 0x81, 0xFF, 0x03, 0x5C, 0x00, 0x00, 0x43, 0x80, 0x44, 0x02, 0x54, 0x44, 0x23, 0x80, 
+	0x33, 0x03, 0x03, 0x00, 0x00, 0x40, 0x80, 0x44, 0x01, 0x55, 0x45, 0x81, 0x44, 0x06, 0x02, 0x00, 0x90, 0xFF, 0xFF, 0xDF, 0xFE, 0x80, 0xFF, 0x0A, 0x9F, 0x00, 0xA4, 0xBB, 0xBB, 0x9A, 0x99, 0x99, 0x06, 0x00, 0xFA, 0x81, 0xFF, 0x02, 0x09, 0x00, 0x20, 0x81, 0x44, 0x01, 0x54, 0x34, 0x80, 0x33, 0x03, 0x03, 
+	0x00, 0x00, 0x40, 0x84, 0x44, 0x16, 0x54, 0x24, 0x00, 0x20, 0xFC, 0xFF, 0x7E, 0x02, 0x30, 0xFC, 0xFF, 0xFF, 0x8F, 0x00, 0xB6, 0xAA, 0xAA, 0x9A, 0xA9, 0xAA, 0x6A, 0x10, 0xF8, 0x81, 0xFF, 0x04, 0xCF, 0x02, 0x00, 0x42, 0x45, 0x80, 0x44, 0x00, 0x34, 0x80, 0x33, 0x03, 0x03, 0x00, 0x00, 0x40, 0x84, 0x44, 
+	0x10, 0x45, 0x01, 0x00, 0xD3, 0xFF, 0xBF, 0x02, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x7F, 0x00, 0xB7, 0xBA, 0xAB, 0x80, 0x99, 0x02, 0x6A, 0x10, 0xF7, 0x82, 0xFF, 0x03, 0x3D, 0x00, 0x10, 0x54, 0x80, 0x44, 0x00, 0x34, 0x80, 0x33, 0x03, 0x03, 0x00, 0x00, 0x40, 0x84, 0x44, 0x16, 0x14, 0x00, 0x50, 0xFF, 0xFF, 
+	0x06, 0x00, 0x20, 0x00, 0x20, 0xFE, 0xFF, 0x6F, 0x00, 0xB8, 0xBA, 0xAB, 0x99, 0x99, 0xA9, 0x39, 0x00, 0xFA, 0x83, 0xFF, 0x02, 0x05, 0x00, 0x41, 0x80, 0x44, 0x00, 0x34, 0x80, 0x33, 0x03, 0x03, 0x00, 0x00, 0x40, 0x84, 0x44, 0x15, 0x02, 0x00, 0xF7, 0xFF, 0x3C, 0x10, 0x20, 0x97, 0x38, 0x00, 0xFB, 0xFF, 
+	0x5F, 0x00, 0xB9, 0xBA, 0xAB, 0x99, 0x99, 0xA9, 0x06, 0x21, 0x80, 0xFF, 0x06, 0xDF, 0x89, 0xEB, 0xFF, 0x7F, 0x00, 0x20, 0x80, 0x44, 0x00, 0x34, 0x80, 0x33, 0x03, 0x03, 0x00, 0x00, 0x40, 0x83, 0x44, 0x16, 0x24, 0x00, 0x70, 0xFF, 0xCF, 0x01, 0x00, 0x95, 0x9A, 0x5A, 0x00, 0xF7, 0xFF, 0x4F, 0x00, 0xB9, 
+	0xBA, 0xAA, 0x99, 0x99, 0x9A, 0x00, 0x90, 0x80, 0xFF, 0x0A, 0x07, 0x00, 0x20, 0xFB, 0xFF, 0x07, 0x00, 0x42, 0x44, 0x44, 0x34, 0x80, 0x33, 0x03, 0x03, 0x00, 0x00, 0x40, 0x82, 0x44, 0x1A, 0x54, 0x03, 0x00, 0xF5, 0xFF, 0x1B, 0x00, 0x70, 0xA9, 0x99, 0x89, 0x00, 0xF2, 0xFF, 0x3F, 0x00, 0xBA, 0xBA, 0xAA, 
+	0x99, 0x99, 0x5A, 0x00, 0xF3, 0xFF, 0xFF, 0x5E, 0x80, 0x00, 0x07, 0xB0, 0xFF, 0x5F, 0x00, 0x30, 0x45, 0x44, 0x34, 0x80, 0x33, 0x03, 0x03, 0x00, 0x00, 0x40, 0x82, 0x44, 0x07, 0x45, 0x00, 0x30, 0xFF, 0xBF, 0x10, 0x10, 0xA9, 0x80, 0x99, 0x1A, 0x01, 0xD0, 0xFF, 0x2F, 0x00, 0xBA, 0xBA, 0x9A, 0x99, 0xA9, 
+	0x08, 0x00, 0xFB, 0xFF, 0xDF, 0x03, 0x00, 0x64, 0x01, 0x01, 0xFB, 0xFF, 0x03, 0x00, 0x54, 0x44, 0x34, 0x80, 0x33, 0x03, 0x03, 0x00, 0x00, 0x40, 0x82, 0x44, 0x07, 0x14, 0x00, 0xD2, 0xFF, 0x0B, 0x01, 0x91, 0xAB, 0x80, 0x99, 0x1A, 0x05, 0x90, 0xFF, 0x1F, 0x00, 0xBA, 0xBA, 0x9A, 0x99, 0x99, 0x04, 0x50, 
+	0xFF, 0xFF, 0x2C, 0x00, 0x70, 0xBA, 0x29, 0x10, 0xC1, 0xFF, 0x2D, 0x00, 0x41, 0x44, 0x34, 0x80, 0x33, 0x03, 0x03, 0x00, 0x00, 0x40, 0x81, 0x44, 0x26, 0x54, 0x02, 0x00, 0xFC, 0xEF, 0x02, 0x20, 0xB9, 0xBA, 0x9A, 0x99, 0xA9, 0x07, 0x41, 0xFF, 0x0F, 0x10, 0xBA, 0xBA, 0x9A, 0x99, 0x7A, 0x00, 0xD1, 0xFF, 
+	0xBF, 0x01, 0x00, 0xB8, 0xAB, 0x9B, 0x01, 0x10, 0xFC, 0xCF, 0x00, 0x20, 0x44, 0x34, 0x80, 0x33, 0x03, 0x03, 0x00, 0x00, 0x40, 0x81, 0x44, 0x26, 0x35, 0x00, 0x90, 0xFF, 0xBF, 0x00, 0x91, 0xAB, 0xBB, 0xAA, 0x99, 0xA9, 0x08, 0x20, 0xFF, 0x0F, 0x10, 0xBA, 0xBA, 0x9A, 0x99, 0x49, 0x00, 0xF7, 0xFF, 0x09, 
+	0x01, 0x80, 0xAB, 0xBB, 0xBA, 0x19, 0x00, 0xF3, 0xFF, 0x09, 0x00, 0x53, 0x34, 0x80, 0x33, 0x03, 0x03, 0x00, 0x00, 0x40, 0x81, 0x44, 0x26, 0x14, 0x00, 0xF5, 0xFF, 0x8F, 0x00, 0xB6, 0xBA, 0xBB, 0xAB, 0x99, 0x99, 0x49, 0x10, 0xFB, 0x0F, 0x00, 0xBA, 0xBB, 0x9A, 0xA9, 0x08, 0x11, 0xFD, 0x8F, 0x10, 0x30, 
+	0xB9, 0xBA, 0xBB, 0xAB, 0x9B, 0x00, 0x60, 0xFF, 0x5F, 0x00, 0x41, 0x34, 0x80, 0x33, 0x03, 0x03, 0x00, 0x00, 0x40, 0x80, 0x44, 0x07, 0x54, 0x03, 0x00, 0xFC, 0xFF, 0xAF, 0x00, 0xA4, 0x80, 0xBB, 0x11, 0x9A, 0x99, 0x6A, 0x10, 0xF5, 0x1F, 0x00, 0xBA, 0xBB, 0x9A, 0x99, 0x06, 0x40, 0xFF, 0x09, 0x01, 0x94, 
+	0xAB, 0x80, 0xBB, 0x07, 0xAA, 0x07, 0x00, 0xFB, 0xCF, 0x00, 0x30, 0x34, 0x80, 0x33, 0x03, 0x03, 0x00, 0x00, 0x40, 0x80, 0x44, 0x26, 0x45, 0x01, 0x60, 0xFF, 0xFF, 0xDF, 0x00, 0x70, 0xAB, 0xBB, 0xBB, 0x9A, 0x99, 0x7A, 0x00, 0xC0, 0x1F, 0x00, 0xBA, 0xBB, 0x9A, 0x9A, 0x01, 0x90, 0x9F, 0x10, 0x50, 0xBA, 
+	0xBA, 0xBB, 0xBB, 0xAA, 0x99, 0x59, 0x00, 0xE2, 0xFF, 0x06, 0x10, 0x81, 0x33, 0x03, 0x03, 0x00, 0x00, 0x40, 0x80, 0x44, 0x02, 0x34, 0x00, 0xD1, 0x80, 0xFF, 0x21, 0x07, 0x00, 0xB8, 0xBA, 0xBB, 0xAB, 0x99, 0x99, 0x04, 0x60, 0x2F, 0x00, 0xBA, 0xAA, 0x9A, 0x89, 0x00, 0xF0, 0x0B, 0x01, 0xA5, 0xAB, 0xBB, 
+	0xBB, 0xAB, 0x99, 0x99, 0x9A, 0x02, 0x70, 0xFF, 0x1D, 0x00, 0x32, 0x80, 0x33, 0x03, 0x03, 0x00, 0x00, 0x40, 0x80, 0x44, 0x02, 0x14, 0x00, 0xF7, 0x80, 0xFF, 0x21, 0x5F, 0x00, 0x80, 0xAB, 0xBB, 0xBB, 0x9A, 0xA9, 0x07, 0x00, 0x3C, 0x00, 0xBA, 0xBB, 0xAA, 0x5A, 0x00, 0xB6, 0x10, 0x40, 0xBA, 0xBA, 0xBB, 
+	0xAB, 0x9A, 0x99, 0x99, 0xA9, 0x07, 0x20, 0xFF, 0x7F, 0x00, 0x30, 0x80, 0x33, 0x03, 0x03, 0x00, 0x00, 0x40, 0x80, 0x44, 0x02, 0x03, 0x10, 0xFE, 0x80, 0xFF, 0x17, 0xEF, 0x03, 0x00, 0xB9, 0xBA, 0xBB, 0x9A, 0x99, 0x39, 0x00, 0x35, 0x00, 0xAA, 0x99, 0x88, 0x49, 0x00, 0x16, 0x00, 0xA3, 0xAB, 0xBB, 0xAB, 
+	0x9A, 0x81, 0x99, 0x05, 0x29, 0x00, 0xFE, 0xEF, 0x01, 0x20, 0x80, 0x33, 0x08, 0x03, 0x00, 0x00, 0x40, 0x44, 0x44, 0x54, 0x01, 0x80, 0x82, 0xFF, 0x15, 0x2D, 0x00, 0x93, 0xAB, 0xBB, 0xAB, 0x99, 0x7A, 0x00, 0x10, 0x00, 0x56, 0x23, 0x21, 0x14, 0x00, 0x00, 0x20, 0xB9, 0xBA, 0xBB, 0xAA, 0x81, 0x99, 0x06, 
+	0xA9, 0x09, 0x00, 0xFE, 0xFF, 0x08, 0x10, 0x80, 0x33, 0x03, 0x03, 0x00, 0x00, 0x40, 0x80, 0x44, 0x01, 0x00, 0xD1, 0x82, 0xFF, 0x0A, 0xCF, 0x11, 0x40, 0xBA, 0xBA, 0xBB, 0x9A, 0x99, 0x05, 0x00, 0x10, 0x80, 0x00, 0x06, 0x20, 0x01, 0x00, 0x93, 0xAB, 0xBB, 0xAB, 0x80, 0x99, 0x08, 0xAA, 0x99, 0x58, 0x03, 
+	0x40, 0xFF, 0xFF, 0x1D, 0x00, 0x80, 0x33, 0x08, 0x03, 0x00, 0x00, 0x40, 0x44, 0x44, 0x35, 0x00, 0xF5, 0x83, 0xFF, 0x48, 0x0B, 0x01, 0xA5, 0xAB, 0xBB, 0xAA, 0xA9, 0x08, 0x11, 0x01, 0x00, 0x42, 0x24, 0x00, 0x10, 0x01, 0xA6, 0xAB, 0xAB, 0x9A, 0x99, 0xA9, 0x9A, 0x78, 0x15, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 
+	0x5F, 0x00, 0x32, 0x33, 0x33, 0x03, 0x00, 0x00, 0x40, 0x44, 0x44, 0x24, 0x00, 0xF9, 0xFF, 0xAF, 0x67, 0xE9, 0xFF, 0xFF, 0x9F, 0x10, 0x50, 0xBA, 0xBA, 0xAB, 0x8A, 0x04, 0x01, 0x60, 0xBA, 0xCC, 0xCC, 0xAB, 0x06, 0x10, 0x40, 0xB9, 0x9A, 0x99, 0xA9, 0x79, 0x46, 0x80, 0x00, 0x22, 0x30, 0xFB, 0xFF, 0xFF, 
+	0x9F, 0x00, 0x31, 0x33, 0x33, 0x03, 0x00, 0x00, 0x40, 0x44, 0x54, 0x04, 0x20, 0xFD, 0xDF, 0x03, 0x11, 0x20, 0xF9, 0xFF, 0xFF, 0x08, 0x01, 0xA4, 0xAB, 0xBA, 0x28, 0x10, 0x60, 0xDC, 0xEF, 0x80, 0xEE, 0x0C, 0xBD, 0x04, 0x00, 0x82, 0x9A, 0xA9, 0x79, 0x04, 0x00, 0x10, 0x00, 0x72, 0xFB, 0x80, 0xFF, 0x1C, 
+	0xDF, 0x02, 0x20, 0x33, 0x33, 0x03, 0x00, 0x00, 0x40, 0x44, 0x54, 0x03, 0x40, 0xFF, 0x3F, 0x00, 0x00, 0x10, 0x30, 0xFB, 0xFF, 0x9F, 0x10, 0x30, 0xB9, 0x9B, 0x02, 0x00, 0xE9, 0x83, 0xEE, 0x09, 0x8E, 0x01, 0x20, 0xA8, 0x79, 0x03, 0x00, 0x11, 0x42, 0xD9, 0x83, 0xFF, 0x1A, 0x04, 0x20, 0x33, 0x33, 0x03, 
+	0x00, 0x00, 0x40, 0x44, 0x44, 0x03, 0x70, 0xFF, 0x0A, 0x00, 0x66, 0x03, 0x00, 0x50, 0xFD, 0xFF, 0x09, 0x01, 0x92, 0x4A, 0x00, 0xA0, 0x85, 0xEE, 0x06, 0x0B, 0x00, 0x84, 0x05, 0x00, 0x00, 0xB5, 0x85, 0xFF, 0x1A, 0x07, 0x20, 0x33, 0x33, 0x03, 0x00, 0x00, 0x40, 0x44, 0x44, 0x01, 0xB0, 0xFF, 0x06, 0x60, 
+	0xAA, 0x69, 0x00, 0x00, 0x71, 0xFD, 0xBF, 0x00, 0x30, 0x06, 0x10, 0xEB, 0x85, 0xEE, 0x01, 0xAE, 0x10, 0x80, 0x00, 0x00, 0xC6, 0x86, 0xFF, 0x19, 0x0B, 0x10, 0x33, 0x33, 0x03, 0x00, 0x00, 0x40, 0x44, 0x44, 0x00, 0xE0, 0xFF, 0x03, 0x80, 0x99, 0xAA, 0x59, 0x00, 0x00, 0x41, 0xF9, 0x1B, 0x00, 0x10, 0x80, 
+	0x87, 0xEE, 0x05, 0x09, 0x11, 0x00, 0xC5, 0xFF, 0xEF, 0x85, 0xFF, 0x19, 0x0E, 0x00, 0x33, 0x33, 0x03, 0x00, 0x00, 0x40, 0x44, 0x45, 0x00, 0xF2, 0xFF, 0x01, 0x90, 0x9A, 0x99, 0xAA, 0x48, 0x00, 0x01, 0x00, 0x66, 0x00, 0x01, 0xE4, 0x87, 0xEE, 0x21, 0x6E, 0x10, 0x10, 0x33, 0x12, 0x01, 0x00, 0x21, 0x43, 
+	0x65, 0x87, 0xDA, 0xFF, 0xFF, 0x2F, 0x00, 0x33, 0x33, 0x03, 0x00, 0x00, 0x40, 0x44, 0x44, 0x00, 0xF4, 0xDF, 0x01, 0x92, 0x9A, 0x99, 0x99, 0x9A, 0x47, 0x81, 0x00, 0x01, 0x01, 0xEB, 0x87, 0xEE, 0x01, 0xCE, 0x10, 0x87, 0x00, 0x10, 0xF6, 0xFF, 0x4F, 0x00, 0x32, 0x33, 0x03, 0x00, 0x00, 0x40, 0x44, 0x34, 
+	0x00, 0xF7, 0xAF, 0x00, 0x95, 0x81, 0x99, 0x06, 0x9A, 0x68, 0x01, 0x00, 0x10, 0x60, 0xED, 0x87, 0xEE, 0x02, 0xDE, 0x06, 0x01, 0x80, 0x00, 0x00, 0x11, 0x82, 0x00, 0x11, 0x50, 0xFF, 0x7F, 0x00, 0x32, 0x33, 0x03, 0x00, 0x03, 0x41, 0x44, 0x24, 0x00, 0xF8, 0x8F, 0x01, 0xA7, 0x9A, 0x81, 0x99, 0x04, 0x9A, 
+	0x89, 0x45, 0x21, 0xA0, 0x89, 0xEE, 0x01, 0x0A, 0x60, 0x82, 0xAA, 0x17, 0x9A, 0x88, 0x67, 0x04, 0x00, 0xFB, 0x8F, 0x00, 0x32, 0x33, 0x13, 0x30, 0x5D, 0x54, 0x44, 0x24, 0x00, 0xF9, 0x7F, 0x01, 0xB8, 0xAA, 0xAA, 0x9A, 0x80, 0x99, 0x03, 0x9A, 0x9A, 0x04, 0xB0, 0x89, 0xEE, 0x02, 0x0B, 0x50, 0xBA, 0x84, 
+	0xBB, 0x13, 0x6A, 0x10, 0xF7, 0x9F, 0x00, 0x31, 0x33, 0x33, 0xD4, 0xAF, 0x55, 0x44, 0x24, 0x00, 0xFA, 0x7F, 0x01, 0xB8, 0xBA, 0xBB, 0x80, 0xAA, 0x04, 0x99, 0x99, 0x8A, 0x02, 0xC2, 0x89, 0xEE, 0x03, 0x2C, 0x30, 0xB9, 0xBA, 0x83, 0xAA, 0x12, 0x8B, 0x10, 0xF6, 0xAF, 0x00, 0x31, 0x33, 0x33, 0xF9, 0xAF, 
+	0x55, 0x44, 0x24, 0x00, 0xFA, 0x6F, 0x01, 0xB8, 0xBA, 0x80, 0xBB, 0x80, 0xAA, 0x02, 0x8A, 0x01, 0xC4, 0x89, 0xEE, 0x03, 0x4C, 0x20, 0xB9, 0xBA, 0x82, 0xBB, 0x13, 0xAB, 0x8B, 0x10, 0xF6, 0xAF, 0x00, 0x31, 0x33, 0x33, 0xF8, 0xAF, 0x55, 0x44, 0x24, 0x00, 0xFA, 0x6F, 0x01, 0xB8, 0xBA, 0x82, 0xBB, 0x03, 
+	0xAB, 0x9B, 0x02, 0xC4, 0x89, 0xEE, 0x02, 0x4C, 0x10, 0xA8, 0x82, 0xAA, 0x17, 0xBB, 0xAB, 0x8B, 0x10, 0xF6, 0xAF, 0x00, 0x31, 0x33, 0x33, 0xF8, 0xAF, 0x55, 0x44, 0x24, 0x00, 0xFA, 0x6F, 0x01, 0xB8, 0xAA, 0xAA, 0xBA, 0xBB, 0x80, 0xAA, 0x02, 0x9B, 0x03, 0xC2, 0x89, 0xEE, 0x02, 0x2C, 0x20, 0xA8, 0x81, 
+	0x99, 0x80, 0xAA, 0x11, 0x8B, 0x10, 0xF7, 0xAF, 0x00, 0x31, 0x33, 0x33, 0xF9, 0x5D, 0x54, 0x44, 0x24, 0x00, 0xF9, 0x7F, 0x01, 0xA6, 0x84, 0xBB, 0x02, 0xAB, 0x05, 0xB0, 0x89, 0xEE, 0x03, 0x0B, 0x40, 0xA9, 0xA9, 0x82, 0x99, 0x15, 0xA9, 0x8A, 0x10, 0xF7, 0x9F, 0x00, 0x31, 0x33, 0x33, 0xD4, 0x03, 0x41, 
+	0x44, 0x24, 0x00, 0xF8, 0xBF, 0x00, 0x40, 0x76, 0x88, 0xA9, 0x82, 0xAA, 0x01, 0x06, 0xA0, 0x89, 0xEE, 0x04, 0x0A, 0x12, 0x54, 0x98, 0xA9, 0x82, 0x99, 0x10, 0x79, 0x10, 0xF8, 0x8F, 0x00, 0x32, 0x33, 0x13, 0x30, 0x00, 0x40, 0x44, 0x34, 0x00, 0xF7, 0xFF, 0x05, 0x82, 0x00, 0x00, 0x11, 0x80, 0x00, 0x02, 
+	0x10, 0x60, 0xED, 0x87, 0xEE, 0x06, 0xDE, 0x06, 0x01, 0x00, 0x10, 0x86, 0xA9, 0x81, 0x99, 0x10, 0x59, 0x00, 0xFA, 0x7F, 0x00, 0x32, 0x33, 0x03, 0x00, 0x00, 0x40, 0x44, 0x44, 0x00, 0xF4, 0xFF, 0x6F, 0x87, 0x00, 0x01, 0x01, 0xEC, 0x87, 0xEE, 0x01, 0xBE, 0x10, 0x81, 0x00, 0x21, 0x74, 0xA9, 0x99, 0x99, 
+	0xA9, 0x29, 0x10, 0xFD, 0x4F, 0x00, 0x32, 0x33, 0x03, 0x00, 0x00, 0x40, 0x44, 0x45, 0x00, 0xF2, 0xFF, 0xFF, 0xAD, 0x78, 0x56, 0x34, 0x12, 0x00, 0x10, 0x21, 0x33, 0x01, 0x01, 0xE6, 0x87, 0xEE, 0x19, 0x4E, 0x10, 0x00, 0x66, 0x00, 0x10, 0x00, 0x84, 0xAA, 0x99, 0xA9, 0x09, 0x10, 0xFF, 0x2F, 0x00, 0x33, 
+	0x33, 0x03, 0x00, 0x00, 0x40, 0x44, 0x44, 0x00, 0xE0, 0x85, 0xFF, 0x05, 0xFE, 0xFF, 0x5C, 0x00, 0x11, 0x90, 0x87, 0xEE, 0x19, 0x08, 0x01, 0x00, 0xB1, 0x9F, 0x14, 0x00, 0x00, 0x95, 0xAA, 0x99, 0x08, 0x30, 0xFF, 0x0E, 0x00, 0x33, 0x33, 0x03, 0x00, 0x00, 0x40, 0x44, 0x44, 0x01, 0xB0, 0x86, 0xFF, 0x00, 
+	0x6C, 0x80, 0x00, 0x01, 0x01, 0xEA, 0x85, 0xEE, 0x1A, 0xBE, 0x01, 0x60, 0x03, 0x00, 0xFB, 0xDF, 0x17, 0x00, 0x00, 0x96, 0xAA, 0x06, 0x60, 0xFF, 0x0B, 0x10, 0x33, 0x33, 0x03, 0x00, 0x00, 0x40, 0x44, 0x44, 0x03, 0x70, 0x85, 0xFF, 0x06, 0x5B, 0x00, 0x00, 0x50, 0x48, 0x00, 0xB0, 0x85, 0xEE, 0x1A, 0x0A, 
+	0x00, 0xA4, 0x29, 0x10, 0x90, 0xFF, 0xDF, 0x05, 0x00, 0x30, 0x66, 0x00, 0xA0, 0xFF, 0x07, 0x20, 0x33, 0x33, 0x03, 0x00, 0x00, 0x40, 0x44, 0x54, 0x03, 0x40, 0x83, 0xFF, 0x09, 0x9D, 0x24, 0x11, 0x00, 0x30, 0x97, 0x8A, 0x02, 0x10, 0xE8, 0x83, 0xEE, 0x1C, 0x9E, 0x00, 0x20, 0xB9, 0x9B, 0x03, 0x01, 0xF9, 
+	0xFF, 0xBF, 0x03, 0x01, 0x00, 0x00, 0xF3, 0xFF, 0x04, 0x20, 0x33, 0x33, 0x03, 0x00, 0x00, 0x40, 0x44, 0x54, 0x04, 0x20, 0xFD, 0x80, 0xFF, 0x0C, 0xBF, 0x27, 0x00, 0x01, 0x00, 0x40, 0x97, 0x9A, 0xA9, 0x28, 0x00, 0x40, 0xDB, 0x80, 0xEE, 0x22, 0xFE, 0xCD, 0x06, 0x01, 0x82, 0xAB, 0xBA, 0x4A, 0x10, 0x80, 
+	0xFF, 0xFF, 0x9F, 0x02, 0x11, 0x30, 0xFD, 0xDF, 0x02, 0x20, 0x33, 0x33, 0x03, 0x00, 0x00, 0x40, 0x44, 0x44, 0x24, 0x00, 0xF9, 0xFF, 0xFF, 0xBF, 0x03, 0x80, 0x00, 0x48, 0x64, 0x97, 0x9A, 0x99, 0xA9, 0x9B, 0x04, 0x01, 0x60, 0xBA, 0xCC, 0xCC, 0xAB, 0x06, 0x10, 0x40, 0xA8, 0xBA, 0xAB, 0xAB, 0x05, 0x01, 
+	0xF9, 0xFF, 0xFF, 0x9E, 0x76, 0xFA, 0xFF, 0x9F, 0x00, 0x31, 0x33, 0x33, 0x03, 0x00, 0x00, 0x40, 0x44, 0x44, 0x35, 0x00, 0xF5, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x51, 0x87, 0xA9, 0x9A, 0x99, 0xA9, 0xBA, 0xBA, 0x6A, 0x10, 0x01, 0x00, 0x42, 0x24, 0x00, 0x10, 0x11, 0x80, 0x9A, 0xA9, 0xBB, 0xBA, 0x5A, 0x10, 
+	0xB0, 0x83, 0xFF, 0x08, 0x5F, 0x00, 0x32, 0x33, 0x33, 0x03, 0x00, 0x00, 0x40, 0x80, 0x44, 0x08, 0x00, 0xD1, 0xFF, 0xFF, 0x04, 0x30, 0x85, 0x99, 0xAA, 0x80, 0x99, 0x06, 0xAA, 0xBB, 0xBA, 0x39, 0x00, 0x10, 0x02, 0x80, 0x00, 0x0A, 0x01, 0x00, 0x50, 0x99, 0x99, 0xBA, 0xAB, 0xAB, 0x04, 0x11, 0xFC, 0x82, 
+	0xFF, 0x01, 0x1D, 0x00, 0x80, 0x33, 0x0D, 0x03, 0x00, 0x00, 0x40, 0x44, 0x44, 0x54, 0x01, 0x80, 0xFF, 0xEF, 0x00, 0x90, 0x9A, 0x81, 0x99, 0x15, 0xA9, 0xBA, 0xAB, 0x9B, 0x02, 0x00, 0x00, 0x41, 0x12, 0x32, 0x65, 0x00, 0x01, 0x00, 0xA7, 0x99, 0xAA, 0xBB, 0xBA, 0x39, 0x00, 0xD2, 0x82, 0xFF, 0x01, 0x08, 
+	0x10, 0x80, 0x33, 0x03, 0x03, 0x00, 0x00, 0x40, 0x80, 0x44, 0x05, 0x03, 0x10, 0xFE, 0xDF, 0x00, 0x92, 0x82, 0x99, 0x16, 0xBA, 0xBB, 0xBA, 0x3A, 0x00, 0x61, 0x00, 0x94, 0x88, 0x99, 0xAA, 0x00, 0x53, 0x00, 0x93, 0x99, 0xA9, 0xBB, 0xAB, 0x9B, 0x00, 0x30, 0xFE, 0x80, 0xFF, 0x02, 0xEF, 0x01, 0x20, 0x80, 
+	0x33, 0x03, 0x03, 0x00, 0x00, 0x40, 0x80, 0x44, 0x06, 0x14, 0x00, 0xF7, 0xFF, 0x02, 0x70, 0x9A, 0x80, 0x99, 0x17, 0xAA, 0xBB, 0xAB, 0xAB, 0x04, 0x01, 0x6B, 0x00, 0xA5, 0xAA, 0xBB, 0xAB, 0x00, 0xC3, 0x00, 0x70, 0x9A, 0x99, 0xBA, 0xBB, 0xBA, 0x08, 0x00, 0xF5, 0x80, 0xFF, 0x02, 0x7F, 0x00, 0x30, 0x80, 
+	0x33, 0x03, 0x03, 0x00, 0x00, 0x40, 0x80, 0x44, 0x21, 0x34, 0x00, 0xD1, 0xFF, 0x07, 0x20, 0xA9, 0x99, 0x99, 0xA9, 0xBA, 0xBB, 0xBA, 0x5A, 0x10, 0xB0, 0x0F, 0x00, 0x98, 0xA9, 0xAA, 0xAB, 0x00, 0xF2, 0x06, 0x40, 0x99, 0x99, 0xA9, 0xBB, 0xAB, 0x8B, 0x00, 0x70, 0x80, 0xFF, 0x02, 0x1D, 0x00, 0x32, 0x80, 
+	0x33, 0x03, 0x03, 0x00, 0x00, 0x40, 0x80, 0x44, 0x26, 0x45, 0x01, 0x60, 0xFF, 0x2E, 0x00, 0x95, 0x99, 0xA9, 0xBA, 0xBB, 0xAB, 0xAB, 0x05, 0x01, 0xF9, 0x09, 0x10, 0xA9, 0xA9, 0xAB, 0xAB, 0x00, 0xF1, 0x0C, 0x00, 0xA7, 0x99, 0xA9, 0xBA, 0xBB, 0xBA, 0x07, 0x00, 0xFD, 0xFF, 0xFF, 0x06, 0x10, 0x81, 0x33, 
+	0x03, 0x03, 0x00, 0x00, 0x40, 0x80, 0x44, 0x27, 0x54, 0x03, 0x00, 0xFC, 0xAF, 0x00, 0x70, 0x9A, 0xAA, 0xBB, 0xBB, 0xBA, 0x49, 0x10, 0x90, 0xFF, 0x04, 0x60, 0x99, 0xA9, 0xAB, 0xAB, 0x00, 0xF1, 0x5F, 0x01, 0xA6, 0x99, 0x99, 0xBA, 0xBB, 0xBB, 0x4A, 0x00, 0xFA, 0xFF, 0xCF, 0x00, 0x30, 0x34, 0x80, 0x33, 
+	0x03, 0x03, 0x00, 0x00, 0x40, 0x81, 0x44, 0x26, 0x14, 0x00, 0xF5, 0xFF, 0x06, 0x00, 0xB8, 0xBA, 0xBB, 0xAB, 0x9B, 0x03, 0x01, 0xF8, 0xDF, 0x11, 0x80, 0x9A, 0xA9, 0xAB, 0xAB, 0x00, 0xF0, 0xBF, 0x01, 0x94, 0x99, 0x99, 0xA9, 0xBB, 0xAB, 0x6B, 0x00, 0xF8, 0xFF, 0x5F, 0x00, 0x41, 0x34, 0x80, 0x33, 0x03, 
+	0x03, 0x00, 0x00, 0x40, 0x81, 0x44, 0x26, 0x35, 0x00, 0x90, 0xFF, 0x2F, 0x00, 0x91, 0xAB, 0xBB, 0xBA, 0x08, 0x10, 0x90, 0xFF, 0x7F, 0x00, 0x94, 0x99, 0xA9, 0xAB, 0xAB, 0x01, 0xF0, 0xFF, 0x02, 0x80, 0x9A, 0x99, 0xA9, 0xBA, 0xBA, 0x19, 0x00, 0xFB, 0xFF, 0x09, 0x00, 0x53, 0x34, 0x80, 0x33, 0x03, 0x03, 
+	0x00, 0x00, 0x40, 0x81, 0x44, 0x26, 0x54, 0x02, 0x00, 0xFC, 0xCF, 0x01, 0x10, 0xB9, 0xBA, 0x8B, 0x00, 0x10, 0xFB, 0xFF, 0x1D, 0x00, 0xA7, 0x99, 0xAA, 0xAB, 0xAB, 0x01, 0xF0, 0xFF, 0x14, 0x70, 0x9A, 0x99, 0x99, 0xAA, 0x9B, 0x02, 0x20, 0xFE, 0xCF, 0x00, 0x20, 0x44, 0x34, 0x80, 0x33, 0x03, 0x03, 0x00, 
+	0x00, 0x40, 0x82, 0x44, 0x18, 0x14, 0x00, 0xD2, 0xFF, 0x1C, 0x01, 0x92, 0xAB, 0x07, 0x00, 0xC2, 0xFF, 0xFF, 0x05, 0x40, 0x99, 0x99, 0xBA, 0xBB, 0xAB, 0x00, 0xF1, 0xFF, 0x09, 0x50, 0x80, 0x99, 0x09, 0xB9, 0x19, 0x10, 0xB0, 0xFF, 0x2D, 0x00, 0x41, 0x44, 0x34, 0x80, 0x33, 0x03, 0x03, 0x00, 0x00, 0x40, 
+	0x82, 0x44, 0x18, 0x45, 0x00, 0x30, 0xFF, 0xBF, 0x10, 0x10, 0x46, 0x00, 0x30, 0xFD, 0xFF, 0xBF, 0x00, 0x80, 0x9A, 0x99, 0xBA, 0xBB, 0xAB, 0x00, 0xF2, 0xFF, 0x0D, 0x10, 0x80, 0x99, 0x09, 0x8A, 0x01, 0x01, 0xFB, 0xFF, 0x03, 0x00, 0x54, 0x44, 0x34, 0x80, 0x33, 0x03, 0x03, 0x00, 0x00, 0x40, 0x82, 0x44, 
+	0x05, 0x54, 0x03, 0x00, 0xF5, 0xFF, 0x0B, 0x80, 0x00, 0x1C, 0xE5, 0xFF, 0xFF, 0x3F, 0x00, 0xA5, 0x99, 0x99, 0xBA, 0xBB, 0xAB, 0x00, 0xF3, 0xFF, 0x2F, 0x00, 0x98, 0x99, 0x9A, 0x07, 0x00, 0xB1, 0xFF, 0x5F, 0x00, 0x30, 0x45, 0x44, 0x34, 0x80, 0x33, 0x03, 0x03, 0x00, 0x00, 0x40, 0x83, 0x44, 0x07, 0x24, 
+	0x00, 0x70, 0xFF, 0xBF, 0x02, 0x00, 0x70, 0x80, 0xFF, 0x19, 0x09, 0x00, 0xA9, 0x99, 0xA9, 0xBA, 0xAB, 0x9B, 0x00, 0xF4, 0xFF, 0x7F, 0x00, 0xA5, 0xA9, 0x59, 0x00, 0x10, 0xFC, 0xFF, 0x07, 0x00, 0x42, 0x44, 0x44, 0x34, 0x80, 0x33, 0x03, 0x03, 0x00, 0x00, 0x40, 0x84, 0x44, 0x06, 0x02, 0x00, 0xF7, 0xFF, 
+	0xBE, 0x98, 0xFD, 0x80, 0xFF, 0x15, 0x12, 0x60, 0x9A, 0x99, 0xA9, 0xBB, 0xAB, 0x9B, 0x00, 0xF5, 0xFF, 0xBF, 0x00, 0x83, 0x79, 0x02, 0x00, 0xC3, 0xFF, 0x7F, 0x00, 0x20, 0x80, 0x44, 0x00, 0x34, 0x80, 0x33, 0x03, 0x03, 0x00, 0x00, 0x40, 0x84, 0x44, 0x02, 0x14, 0x00, 0x50, 0x83, 0xFF, 0x16, 0xAF, 0x00, 
+	0x93, 0x9A, 0x99, 0xA9, 0xBB, 0xAB, 0x8B, 0x00, 0xF6, 0xFF, 0xEF, 0x02, 0x00, 0x02, 0x00, 0x60, 0xFF, 0xFF, 0x05, 0x00, 0x41, 0x80, 0x44, 0x00, 0x34, 0x80, 0x33, 0x03, 0x03, 0x00, 0x00, 0x40, 0x84, 0x44, 0x03, 0x45, 0x01, 0x00, 0xD3, 0x82, 0xFF, 0x16, 0x7F, 0x01, 0xA6, 0x99, 0x99, 0xA9, 0xBB, 0xAB, 
+	0x7B, 0x00, 0xF7, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x20, 0xFB, 0xFF, 0x3D, 0x00, 0x10, 0x54, 0x80, 0x44, 0x00, 0x34, 0x80, 0x33, 0x0F, 0x03, 0x00, 0x00, 0x40, 0x44, 0x44, 0x54, 0x44, 0x54, 0x44, 0x44, 0x54, 0x24, 0x00, 0x20, 0xFC, 0x81, 0xFF, 0x1A, 0x8F, 0x01, 0xA6, 0xAA, 0x9A, 0xA9, 0xAA, 0xAA, 0x6B, 
+	0x00, 0xF8, 0xFF, 0xFF, 0xCF, 0x03, 0x20, 0xE7, 0xFF, 0xCF, 0x02, 0x00, 0x42, 0x45, 0x44, 0x44, 0x54, 0x34, 0x80, 0x33, 0x03, 0x03, 0x00, 0x00, 0x40, 0x80, 0x44, 0x01, 0x23, 0x43, 0x81, 0x44, 0x02, 0x02, 0x00, 0x90, 0x81, 0xFF, 0x0A, 0xAF, 0x00, 0x60, 0x98, 0x99, 0xBA, 0xBB, 0xBB, 0x4A, 0x00, 0xF9, 
+	0x80, 0xFF, 0x06, 0xEF, 0xFD, 0xFF, 0xFF, 0x09, 0x00, 0x20, 0x81, 0x44, 0x01, 0x34, 0x22, 0x80, 0x33, 0x10, 0x03, 0x00, 0x00, 0x40, 0x44, 0x44, 0x02, 0x00, 0x00, 0x42, 0x45, 0x44, 0x44, 0x34, 0x00, 0x00, 0xC5, 0x81, 0xFF, 0x09, 0x04, 0x00, 0x00, 0x52, 0x87, 0x88, 0x88, 0x06, 0x00, 0xFD, 0x83, 0xFF, 
+	0x12, 0x5C, 0x00, 0x00, 0x43, 0x44, 0x44, 0x54, 0x24, 0x00, 0x00, 0x10, 0x33, 0x33, 0x03, 0x00, 0x00, 0x40, 0x44, 0x24, 0x80, 0x00, 0x00, 0x20, 0x80, 0x44, 0x04, 0x54, 0x14, 0x00, 0x00, 0xD6, 0x80, 0xFF, 0x00, 0x4E, 0x84, 0x00, 0x00, 0x60, 0x83, 0xFF, 0x04, 0x6D, 0x00, 0x00, 0x41, 0x45, 0x80, 0x44, 
+	0x00, 0x02, 0x80, 0x00, 0x0C, 0x31, 0x33, 0x03, 0x00, 0x00, 0x40, 0x54, 0x03, 0x00, 0x75, 0x05, 0x00, 0x43, 0x80, 0x44, 0x04, 0x45, 0x02, 0x00, 0x10, 0xE7, 0x80, 0xFF, 0x02, 0x5B, 0x13, 0x00, 0x80, 0x11, 0x01, 0x01, 0xF5, 0x82, 0xFF, 0x04, 0x7E, 0x01, 0x00, 0x20, 0x54, 0x80, 0x44, 0x11, 0x34, 0x00, 
+	0x50, 0x57, 0x00, 0x20, 0x33, 0x03, 0x00, 0x00, 0x40, 0x44, 0x01, 0x70, 0xBB, 0x7B, 0x00, 0x41, 0x81, 0x44, 0x04, 0x35, 0x01, 0x00, 0x10, 0xD8, 0x81, 0xFF, 0x04, 0x9C, 0x78, 0x56, 0x55, 0xB7, 0x82, 0xFF, 0x04, 0x8D, 0x01, 0x00, 0x10, 0x53, 0x81, 0x44, 0x11, 0x14, 0x00, 0xB7, 0xBB, 0x07, 0x11, 0x33, 
+	0x03, 0x00, 0x00, 0x40, 0x45, 0x01, 0xA2, 0xBB, 0xAB, 0x02, 0x40, 0x81, 0x44, 0x06, 0x54, 0x34, 0x01, 0x00, 0x10, 0x95, 0xFD, 0x87, 0xFF, 0x06, 0xDF, 0x59, 0x01, 0x00, 0x10, 0x43, 0x45, 0x81, 0x44, 0x11, 0x04, 0x20, 0xBA, 0xBB, 0x2A, 0x10, 0x33, 0x03, 0x00, 0x00, 0x40, 0x45, 0x01, 0xA2, 0xBB, 0xBB, 
+	0x02, 0x40, 0x82, 0x44, 0x07, 0x54, 0x34, 0x01, 0x00, 0x00, 0x42, 0xB7, 0xFE, 0x83, 0xFF, 0x07, 0xEF, 0x7B, 0x24, 0x00, 0x00, 0x10, 0x43, 0x45, 0x82, 0x44, 0x11, 0x04, 0x20, 0xBB, 0xBB, 0x2A, 0x10, 0x33, 0x03, 0x00, 0x00, 0x40, 0x44, 0x01, 0x80, 0xBB, 0x7B, 0x00, 0x41, 0x83, 0x44, 0x02, 0x45, 0x34, 
+	0x01, 0x80, 0x00, 0x07, 0x20, 0x74, 0x98, 0xAA, 0xAA, 0x89, 0x47, 0x02, 0x80, 0x00, 0x02, 0x10, 0x43, 0x54, 0x83, 0x44, 0x11, 0x14, 0x00, 0xB7, 0xBB, 0x08, 0x11, 0x33, 0x03, 0x00, 0x00, 0x40, 0x54, 0x03, 0x00, 0x96, 0x06, 0x00, 0x43, 0x85, 0x44, 0x01, 0x45, 0x23, 0x89, 0x00, 0x01, 0x32, 0x54, 0x85, 
+	0x44, 0x0C, 0x34, 0x00, 0x60, 0x69, 0x00, 0x20, 0x33, 0x03, 0x00, 0x00, 0x40, 0x44, 0x14, 0x80, 0x00, 0x00, 0x20, 0x87, 0x44, 0x02, 0x45, 0x34, 0x13, 0x85, 0x00, 0x02, 0x31, 0x43, 0x54, 0x87, 0x44, 0x00, 0x02, 0x80, 0x00, 0x0B, 0x31, 0x33, 0x03, 0x00, 0x00, 0x40, 0x44, 0x44, 0x02, 0x10, 0x00, 0x42, 
+	0x88, 0x44, 0x03, 0x55, 0x44, 0x44, 0x34, 0x81, 0x22, 0x03, 0x43, 0x44, 0x44, 0x55, 0x88, 0x44, 0x09, 0x24, 0x00, 0x01, 0x10, 0x33, 0x33, 0x03, 0x00, 0x00, 0x40, 0x80, 0x44, 0x01, 0x23, 0x43, 0x8B, 0x44, 0x00, 0x54, 0x83, 0x44, 0x00, 0x45, 0x8B, 0x44, 0x08, 0x34, 0x22, 0x32, 0x33, 0x33, 0x03, 0x00, 
+	0x00, 0x40, 0x80, 0x44, 0x01, 0x55, 0x45, 0xA1, 0x44, 0x01, 0x54, 0x34, 0x80, 0x33, 0x04, 0x03, 0x00, 0x03, 0x40, 0x45, 0xA6, 0x44, 0x81, 0x33, 0x03, 0x02, 0x30, 0x07, 0x10, 0xA7, 0x44, 0x80, 0x33, 0x03, 0x23, 0x00, 0x70, 0x2E, 0xAD, 0x00, 0x02, 0xE2, 0xCF, 0x02, 0xAB, 0x00, 0x04, 0x20, 0xFC, 0xFF, 
+	0x7E, 0x03, 0xA9, 0x00, 0x02, 0x30, 0xE7, 0xFF, 
 	};
+const Icon exhaustfanon_icon = {exhaustfanon_width, exhaustfanon_height, sizeof(exhaustfanon_data), exhaustfanon_data, NULL};
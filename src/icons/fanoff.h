@@ -1,104 +1,70 @@
+#pragma once
 const uint32_t fanoff_width = 100;
 const uint32_t fanoff_height = 100;
-const uint8_t fanoff_data[(100*100)/2] = {
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xCD, 0x7A, 0x35, 0x23, 0x01, 0x10, 0x32, 0x53, 0xA7, 0xDC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0xCA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x37, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x73, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0x03, 0x00, 0x00, 0x00, 0x00, 0x21, 0x75, 0x87, 0xA9, 0x9A, 0x78, 0x57, 0x12, 0x00, 0x00, 0x00, 0x00, 0x30, 0xE9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0x00, 0x00, 0x00, 0x10, 0x63, 0xCA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAC, 0x36, 0x01, 0x00, 0x00, 0x10, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6C, 0x01, 0x00, 0x00, 0x61, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAD, 0x16, 0x00, 0x00, 0x10, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0xA4, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x4A, 0x00, 0x00, 0x10, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x02, 0x00, 0x00, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5C, 0x00, 0x00, 0x20, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x04, 0x00, 0x10, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x77, 0xB9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6C, 0x01, 0x00, 0x50, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0x00, 0x00, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xA4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5C, 0x00, 0x00, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x00, 0x00, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x04, 0x00, 0x60, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x01, 0x00, 0x20, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x06, 0x00, 0x40, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x10, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0xA8, 0x02, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x01, 0x00, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x01, 0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0xFA, 0x5D, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3D, 0x00, 0x20, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1B, 0x00, 0x50, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0xFA, 0xFF, 0x06, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x05, 0x00, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x01, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0xFA, 0xFF, 0x6F, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0xFA, 0xFF, 0xFF, 0x03, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x02, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9B, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0xFA, 0xFF, 0xFF, 0x0C, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5C, 0x10, 0xFD, 0xFF, 0xFF, 0x2D, 0x00, 0xFA, 0xFF, 0xFF, 0x6F, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5B, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x2D, 0x00, 0xFA, 0xFF, 0xFF, 0xDF, 0x01, 0x80, 0xFF, 0xFF, 0xFF, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x10, 0xFA, 0xFF, 0xFF, 0x2D, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x06, 0x20, 0xFE, 0xFF, 0xFF, 0x2E, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02, 0x00, 0x10, 0xE8, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0xFB, 0xFF, 0xFF, 0x06, 0x20, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x20, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xF6, 0xFF, 0xEF, 0x03, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xF3, 0xFF, 0xFF, 0x5D, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x02, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x1A, 0x00, 0x40, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x20, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xDF, 0x02, 0x00, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xCF, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0xE4, 0xFF, 0xFF, 0xFF, 0xDD, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xEF, 0x02, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x10, 0xFD, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x6F, 0x00, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0xAF, 0x41, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0x00, 0xF6, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x1D, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xE3, 0xFF, 0xFF, 0xEF, 0x05, 0x00, 0xF9, 0xFF, 0xFF, 0x2D, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xD1, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x07, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0x3D, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x2D, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x02, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x70, 0xFF, 0xFF, 
-	0xFF, 0xEF, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xD1, 0xFF, 0xFF, 0xBF, 0x01, 0x00, 0x91, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x50, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0x1C, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x10, 0xFE, 0xFF, 
-	0xFF, 0x9F, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xF9, 0xFF, 0xFF, 0x0C, 0x00, 0x40, 0xFE, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x70, 0xFF, 0xFF, 0x08, 0xD2, 0xFF, 0xFF, 0xAF, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0xF9, 0xFF, 
-	0xFF, 0x3F, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x40, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xEF, 0x02, 0x90, 0xFF, 0xCF, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0x05, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xF3, 0xFF, 
-	0xFF, 0x0C, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xD1, 0xFF, 0xFF, 0x2E, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0xB0, 0xFF, 0xFF, 0x06, 0x00, 0xF4, 0xFF, 0xFF, 0x1D, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xD0, 0xFF, 
-	0xFF, 0x07, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xF8, 0xFF, 0xFF, 0x06, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0xC0, 0xFF, 0xFF, 0x4F, 0x00, 0x50, 0xFF, 0xFF, 0x8F, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0x70, 0xFF, 
-	0xFF, 0x03, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x20, 0xFF, 0xFF, 0xAF, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0xFB, 0xFF, 0xFF, 0x02, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x30, 0xFF, 
-	0xCF, 0x01, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x80, 0xFF, 0xFF, 0x2E, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0xF3, 0xFF, 0xFF, 0x09, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x10, 0xFC, 
-	0x9F, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xE1, 0xFF, 0xFF, 0x08, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x90, 0xFF, 0xFF, 0x1E, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0xFA, 
-	0x6F, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xF7, 0xFF, 0xEF, 0x01, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0x64, 0x75, 0xD9, 0xFF, 0x0A, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x10, 0xFE, 0xFF, 0x7F, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xF6, 
-	0x3E, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xFC, 0xFF, 0x8F, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0x00, 0x00, 0x00, 0x00, 0xC3, 0x05, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xF8, 0xFF, 0xCF, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xE3, 
-	0x0D, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x40, 0xFF, 0xFF, 0x2F, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xF3, 0xFF, 0xEF, 0x03, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xD0, 
-	0x0C, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x60, 0xFF, 0xFF, 0x0C, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0x54, 0x35, 0x00, 0x00, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xD0, 0xFF, 0xFF, 0x07, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0xC0, 
-	0x0A, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0x90, 0xFF, 0xFF, 0x06, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x00, 0xD7, 0xFF, 0xEF, 0x8D, 0x01, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x80, 0xFF, 0xFF, 0x0A, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xA0, 
-	0x07, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xC1, 0xFF, 0xFF, 0x03, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x30, 0xFF, 0xFF, 0x1C, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x70, 
-	0x05, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0xF3, 0xFF, 0xDF, 0x01, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x30, 0xFF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0x02, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x10, 0xFD, 0xFF, 0x2F, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x50, 
-	0x03, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xF4, 0xFF, 0xBF, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xD1, 0xFF, 0xBF, 0x34, 0x43, 0xFB, 0xFF, 0x0C, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0xFB, 0xFF, 0x4F, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x30, 
-	0x03, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xF6, 0xFF, 0x8F, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0xDE, 0x8A, 0x05, 0x00, 0xF8, 0xFF, 0x08, 0x00, 0x00, 0x80, 0xFF, 0x7F, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0xFA, 0xFF, 0x6F, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x30, 
-	0x02, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0xF6, 0xFF, 0x7F, 0x00, 0xF4, 0xFF, 0xCF, 0x47, 0x01, 0x00, 0x00, 0x00, 0xFD, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xCF, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0xF9, 0xFF, 0x7F, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x20, 
-	0x01, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0xF7, 0xFF, 0x6F, 0x00, 0xF4, 0xAF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFE, 0x4F, 0x00, 0x70, 0x07, 0x00, 0xF4, 0xEF, 0x01, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xF7, 0xFF, 0x8F, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x10, 
-	0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0xF8, 0xFF, 0x6F, 0x00, 0xA4, 0x03, 0x00, 0x00, 0x00, 0x40, 0x01, 0x50, 0xFF, 0x3E, 0x00, 0xF7, 0x7F, 0x00, 0xE3, 0xFF, 0x04, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xF6, 0xFF, 0x9F, 0x00, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 
-	0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xF9, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x51, 0xC8, 0xFE, 0x05, 0x40, 0xFF, 0x3E, 0x00, 0xF7, 0x7F, 0x00, 0xE3, 0xFF, 0x05, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 
-	0x01, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xF9, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x83, 0xFE, 0xFF, 0xFF, 0x06, 0x10, 0xFE, 0x4F, 0x00, 0x70, 0x07, 0x00, 0xF4, 0xFF, 0x03, 0x00, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x10, 
-	0x02, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xF7, 0xFF, 0x3E, 0x00, 0x00, 0xA3, 0xFE, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xFC, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xDF, 0x00, 0x00, 0x10, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x20, 
-	0x03, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xF5, 0xEF, 0x03, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0xF8, 0xFF, 0x08, 0x00, 0x00, 0x80, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x30, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x30, 
-	0x03, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xF3, 0x3E, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xC0, 0xFF, 0xBF, 0x34, 0x43, 0xFB, 0xFF, 0x1D, 0x00, 0x53, 0x00, 0x00, 0x50, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x30, 
-	0x05, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0xD3, 0x03, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x20, 0xFE, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0x03, 0x00, 0xFC, 0x3A, 0x00, 0x00, 0x70, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x50, 
-	0x07, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x21, 0x00, 0x60, 0x03, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x60, 0xFF, 0xFF, 0x18, 0x00, 0x00, 0x92, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x15, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x70, 
-	0x0A, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x02, 0x00, 0x00, 0xF5, 0x08, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x06, 0x00, 0x00, 0xD8, 0xFF, 0xEF, 0x8D, 0x01, 0x00, 0xE3, 0xFF, 0xFF, 0xEF, 0x06, 0x00, 0x00, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0xA0, 
-	0x0C, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x30, 0xFF, 0x0D, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0x19, 0x00, 0x00, 0x00, 0x00, 0x53, 0x35, 0x00, 0x00, 0x30, 0xFD, 0xFF, 0xFF, 0xFF, 0xCF, 0x04, 0x00, 0x00, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0xC0, 
-	0x0D, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xD1, 0xFF, 0x3F, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x3A, 0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x02, 0x00, 0x10, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xD0, 
-	0x3E, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xF9, 0xFF, 0x8F, 0x00, 0xA0, 0xFF, 0xFF, 0x4D, 0x00, 0x00, 0x50, 0xFD, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8E, 0x00, 0x00, 0x20, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xE3, 
-	0x6F, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x02, 0x00, 0xF7, 0xFF, 0xEF, 0x02, 0x30, 0xFF, 0x7E, 0x00, 0x00, 0x30, 0xFB, 0xFF, 0xFF, 0xAD, 0x68, 0x85, 0x04, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0x00, 0x00, 0x40, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xF6, 
-	0x9F, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0x09, 0x00, 0xA8, 0x01, 0x00, 0x10, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4B, 0x00, 0x00, 0x60, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0x00, 0xF9, 
-	0xCF, 0x01, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x02, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x19, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x10, 0xFC, 
-	0xFF, 0x03, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x07, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x30, 0xFF, 
-	0xFF, 0x07, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x08, 0x00, 0xF8, 0xEF, 0x18, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0xE5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x05, 0x00, 0x00, 0xE5, 0xFF, 0xFF, 0xDF, 0x01, 0x70, 0xFF, 
-	0xFF, 0x0C, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x08, 0x10, 0x5F, 0x00, 0xD1, 0x2A, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x20, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x50, 0xFF, 0xFF, 0x9F, 0x00, 0xC0, 0xFF, 
-	0xFF, 0x3F, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x06, 0x40, 0xBF, 0x00, 0x10, 0x00, 0x00, 0x50, 0x02, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x02, 0x00, 0x60, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x30, 0xFF, 0xFF, 0x4F, 0x00, 0xF3, 0xFF, 
-	0xFF, 0x9F, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x05, 0x40, 0xFF, 0x05, 0x00, 0x00, 0x40, 0xFC, 0x2C, 0x00, 0x40, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x60, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x06, 0x00, 0xA0, 0xFF, 0xFF, 0x0C, 0x00, 0xF9, 0xFF, 
-	0xFF, 0xEF, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0x07, 0x30, 0x8F, 0x01, 0x00, 0x20, 0xFA, 0xFF, 0xDF, 0x02, 0x00, 0x91, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x30, 0xB7, 0xFD, 0xFF, 0xFF, 0xFF, 0xBD, 0x18, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x05, 0x00, 0xFE, 0xFF, 
-	0xFF, 0xFF, 0x07, 0x00, 0xFC, 0xFF, 0xFF, 0x08, 0x10, 0x03, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0x3D, 0x00, 0x00, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x06, 0x00, 0x00, 0x00, 0x31, 0x54, 0x55, 0x35, 0x02, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xCF, 0x00, 0x70, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x1D, 0x00, 0xF6, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x02, 0x00, 0xD2, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0xB4, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFC, 0xFF, 0xFF, 0x6F, 0x00, 0xD1, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x6F, 0x00, 0xC1, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xB3, 0x6F, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0xAF, 0x02, 0x00, 0x00, 0x61, 0xCA, 0xFD, 0xFF, 0xFF, 0xDE, 0xAC, 0x55, 0xFF, 0xFF, 0xFF, 0xEF, 0x59, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x52, 0xFB, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0xF6, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xCF, 0x00, 0x50, 0xFF, 0xFF, 0x9F, 0x00, 0x92, 0xFF, 0xFF, 0x05, 0x00, 0xE3, 0xFF, 0xFF, 0xFF, 0x8E, 0x01, 0x00, 0x00, 0x00, 0x42, 0x54, 0x45, 0x23, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0x79, 0x56, 0x44, 0x75, 0xB9, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0xFC, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xFA, 0xFF, 0xFF, 0xAA, 0xFE, 0xFF, 0xFF, 0x4F, 0x00, 0x20, 0xFC, 0xFF, 0xFF, 0xFF, 0x8E, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x26, 0x01, 0x00, 0x00, 0x00, 0x00, 0x10, 0x73, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0x78, 0x66, 0x66, 0x97, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x10, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAE, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x02, 0x00, 0x10, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8E, 0x02, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x10, 0xC8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x7C, 0x01, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5B, 0x00, 0x00, 0x00, 0x63, 0xD9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9D, 0x36, 0x00, 0x00, 0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5B, 0x00, 0x00, 0x00, 0x10, 0x33, 0x65, 0x98, 0x89, 0x56, 0x34, 0x01, 0x00, 0x00, 0x00, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x02, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAE, 0x37, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x64, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x01, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAC, 0x78, 0x45, 0x12, 0x32, 0x54, 0x76, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1B, 0x00, 0x50, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x04, 0x00, 0xB1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x01, 0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x10, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x04, 0x00, 0x60, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x05, 0x00, 0x40, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0x00, 0x00, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4C, 0x00, 0x00, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x04, 0x00, 0x10, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6C, 0x00, 0x00, 0x40, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x02, 0x00, 0x00, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5C, 0x00, 0x00, 0x20, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0xA4, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x49, 0x00, 0x00, 0x00, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6C, 0x01, 0x00, 0x00, 0x61, 0xDA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0x16, 0x00, 0x00, 0x10, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0x00, 0x00, 0x00, 0x10, 0x63, 0xCA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xAC, 0x36, 0x01, 0x00, 0x00, 0x00, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0x03, 0x00, 0x00, 0x00, 0x00, 0x21, 0x75, 0x87, 0xA9, 0x9A, 0x78, 0x46, 0x12, 0x00, 0x00, 0x00, 0x00, 0x30, 0xE9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x37, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x73, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xCD, 0x7A, 0x35, 0x23, 0x01, 0x10, 0x32, 0x53, 0xA7, 0xDC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+const uint8_t fanoff_data[3174] = { // run length encoded
+0x90, 0xFF, 0x0B, 0xEF, 0xCD, 0x7A, 0x35, 0x23, 0x01, 0x10, 0x32, 0x53, 0xA7, 0xDC, 0xFE, 0xA2, 0xFF, 0x01, 0x9C, 0x36, 0x87, 0x00, 0x01, 0x63, 0xCA, 0x9F, 0xFF, 0x02, 0xCF, 0x37, 0x01, 0x89, 0x00, 0x02, 0x10, 0x73, 0xFD, 0x9C, 0xFF, 0x01, 0x9E, 0x03, 0x81, 0x00, 0x07, 0x21, 0x75, 0x87, 0xA9, 0x9A, 
+	0x78, 0x57, 0x12, 0x81, 0x00, 0x01, 0x30, 0xE9, 0x9A, 0xFF, 0x00, 0x7D, 0x80, 0x00, 0x02, 0x10, 0x63, 0xCA, 0x85, 0xFF, 0x06, 0xAC, 0x36, 0x01, 0x00, 0x00, 0x10, 0xD7, 0x98, 0xFF, 0x05, 0x6C, 0x01, 0x00, 0x00, 0x61, 0xDA, 0x89, 0xFF, 0x05, 0xAD, 0x16, 0x00, 0x00, 0x10, 0xD6, 0x96, 0xFF, 0x00, 0x6E, 
+	0x80, 0x00, 0x01, 0xA4, 0xFD, 0x8B, 0xFF, 0x05, 0xDF, 0x4A, 0x00, 0x00, 0x10, 0xF7, 0x94, 0xFF, 0x04, 0xAF, 0x02, 0x00, 0x00, 0xC5, 0x8F, 0xFF, 0x04, 0x5C, 0x00, 0x00, 0x20, 0xFA, 0x92, 0xFF, 0x04, 0xDF, 0x04, 0x00, 0x10, 0xC6, 0x84, 0xFF, 0x02, 0xCF, 0x77, 0xB9, 0x87, 0xFF, 0x04, 0x6C, 0x01, 0x00, 
+	0x50, 0xFD, 0x91, 0xFF, 0x03, 0x1A, 0x00, 0x00, 0xC5, 0x85, 0xFF, 0x03, 0x3F, 0x00, 0x00, 0xA4, 0x87, 0xFF, 0x03, 0x5C, 0x00, 0x00, 0xA1, 0x90, 0xFF, 0x03, 0x7F, 0x00, 0x00, 0xA2, 0x86, 0xFF, 0x00, 0x2D, 0x80, 0x00, 0x00, 0xE5, 0x87, 0xFF, 0x03, 0x2A, 0x00, 0x00, 0xF7, 0x8E, 0xFF, 0x04, 0xEF, 0x04, 
+	0x00, 0x60, 0xFE, 0x86, 0xFF, 0x05, 0x2D, 0x00, 0x01, 0x00, 0x20, 0xFD, 0x86, 0xFF, 0x04, 0xEF, 0x06, 0x00, 0x40, 0xFE, 0x8D, 0xFF, 0x03, 0x2D, 0x00, 0x10, 0xFA, 0x87, 0xFF, 0x05, 0x2D, 0x00, 0xA8, 0x02, 0x00, 0xD1, 0x87, 0xFF, 0x03, 0xAF, 0x01, 0x00, 0xD2, 0x8C, 0xFF, 0x03, 0xCF, 0x01, 0x00, 0xD3, 
+	0x88, 0xFF, 0x06, 0x2D, 0x00, 0xFA, 0x5D, 0x00, 0x20, 0xFE, 0x87, 0xFF, 0x03, 0x3D, 0x00, 0x20, 0xFC, 0x8B, 0xFF, 0x03, 0x1B, 0x00, 0x50, 0xFE, 0x88, 0xFF, 0x06, 0x2D, 0x00, 0xFA, 0xFF, 0x06, 0x00, 0xF4, 0x87, 0xFF, 0x03, 0xEF, 0x05, 0x00, 0xC1, 0x8A, 0xFF, 0x03, 0xCF, 0x01, 0x00, 0xF6, 0x89, 0xFF, 
+	0x06, 0x2D, 0x00, 0xFA, 0xFF, 0x6F, 0x00, 0x80, 0x88, 0xFF, 0x03, 0x6F, 0x00, 0x10, 0xFC, 0x89, 0xFF, 0x02, 0x1D, 0x00, 0x70, 0x8A, 0xFF, 0x07, 0x2D, 0x00, 0xFA, 0xFF, 0xFF, 0x03, 0x10, 0xFE, 0x88, 0xFF, 0x02, 0x07, 0x00, 0xD2, 0x88, 0xFF, 0x03, 0xEF, 0x02, 0x00, 0xF7, 0x86, 0xFF, 0x00, 0x9B, 0x80, 
+	0xFF, 0x07, 0x2D, 0x00, 0xFA, 0xFF, 0xFF, 0x0C, 0x00, 0xF6, 0x88, 0xFF, 0x03, 0x7F, 0x00, 0x20, 0xFE, 0x87, 0xFF, 0x02, 0x4F, 0x00, 0x60, 0x86, 0xFF, 0x0C, 0x5C, 0x10, 0xFD, 0xFF, 0xFF, 0x2D, 0x00, 0xFA, 0xFF, 0xFF, 0x6F, 0x00, 0xC0, 0x89, 0xFF, 0x02, 0x06, 0x00, 0xF4, 0x87, 0xFF, 0x02, 0x07, 0x00, 
+	0xF5, 0x85, 0xFF, 0x0D, 0x5B, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x2D, 0x00, 0xFA, 0xFF, 0xFF, 0xDF, 0x01, 0x80, 0x80, 0xFF, 0x00, 0xDF, 0x85, 0xFF, 0x02, 0x5F, 0x00, 0x70, 0x86, 0xFF, 0x03, 0xAF, 0x00, 0x30, 0xFE, 0x84, 0xFF, 0x09, 0x5E, 0x00, 0x00, 0x10, 0xFA, 0xFF, 0xFF, 0x2D, 0x00, 0xFA, 0x80, 0xFF, 
+	0x06, 0x06, 0x20, 0xFE, 0xFF, 0xFF, 0x2E, 0xE5, 0x84, 0xFF, 0x03, 0xEF, 0x03, 0x00, 0xFA, 0x85, 0xFF, 0x02, 0x1D, 0x00, 0xD1, 0x84, 0xFF, 0x04, 0xBF, 0x02, 0x00, 0x10, 0xE8, 0x80, 0xFF, 0x02, 0x2D, 0x00, 0xFA, 0x80, 0xFF, 0x07, 0x0C, 0x00, 0xFB, 0xFF, 0xFF, 0x06, 0x20, 0xFB, 0x84, 0xFF, 0x02, 0x1D, 
+	0x00, 0xD1, 0x85, 0xFF, 0x02, 0x04, 0x00, 0xFA, 0x84, 0xFF, 0x03, 0x08, 0x00, 0x20, 0xE8, 0x81, 0xFF, 0x02, 0x2D, 0x00, 0xFA, 0x80, 0xFF, 0x07, 0x2F, 0x00, 0xF6, 0xFF, 0xEF, 0x03, 0x00, 0x70, 0x84, 0xFF, 0x02, 0xAF, 0x00, 0x50, 0x84, 0xFF, 0x02, 0xAF, 0x00, 0x60, 0x84, 0xFF, 0x03, 0x5E, 0x00, 0x00, 
+	0xE5, 0x82, 0xFF, 0x02, 0x2D, 0x00, 0xFA, 0x80, 0xFF, 0x08, 0x7F, 0x00, 0xF3, 0xFF, 0xFF, 0x5D, 0x00, 0x00, 0xF4, 0x84, 0xFF, 0x02, 0x06, 0x00, 0xFA, 0x83, 0xFF, 0x02, 0x2E, 0x00, 0xE2, 0x83, 0xFF, 0x03, 0xEF, 0x02, 0x00, 0x90, 0x83, 0xFF, 0x02, 0x2D, 0x00, 0xFA, 0x80, 0xFF, 0x02, 0xBF, 0x00, 0xE0, 
+	0x80, 0xFF, 0x03, 0x1A, 0x00, 0x40, 0xFE, 0x83, 0xFF, 0x02, 0x2E, 0x00, 0xF2, 0x83, 0xFF, 0x02, 0x06, 0x00, 0xFA, 0x83, 0xFF, 0x03, 0x3E, 0x00, 0x20, 0xFC, 0x83, 0xFF, 0x02, 0x2D, 0x00, 0xFA, 0x80, 0xFF, 0x02, 0xDF, 0x00, 0xA0, 0x80, 0xFF, 0x03, 0xDF, 0x02, 0x00, 0xE3, 0x83, 0xFF, 0x02, 0xAF, 0x00, 
+	0x70, 0x82, 0xFF, 0x02, 0xCF, 0x00, 0x50, 0x84, 0xFF, 0x02, 0x04, 0x00, 0xE4, 0x80, 0xFF, 0x00, 0xDD, 0x80, 0xFF, 0x02, 0x2D, 0x00, 0xFA, 0x80, 0xFF, 0x02, 0xEF, 0x02, 0x80, 0x81, 0xFF, 0x03, 0x3E, 0x00, 0x30, 0xFE, 0x83, 0xFF, 0x02, 0x05, 0x10, 0xFD, 0x81, 0xFF, 0x02, 0x6F, 0x00, 0xC1, 0x83, 0xFF, 
+	0x07, 0x6F, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0xAF, 0x41, 0x80, 0xFF, 0x02, 0x2D, 0x00, 0xFA, 0x81, 0xFF, 0x01, 0x03, 0x70, 0x82, 0xFF, 0x02, 0x05, 0x00, 0xF5, 0x83, 0xFF, 0x02, 0x1C, 0x00, 0xF6, 0x81, 0xFF, 0x02, 0x1D, 0x00, 0xF6, 0x83, 0xFF, 0x0D, 0x07, 0x00, 0xE3, 0xFF, 0xFF, 0xEF, 0x05, 0x00, 0xF9, 
+	0xFF, 0xFF, 0x2D, 0x00, 0xFA, 0x81, 0xFF, 0x01, 0x04, 0x60, 0x82, 0xFF, 0x02, 0x3F, 0x00, 0x80, 0x83, 0xFF, 0x02, 0x6F, 0x00, 0xD1, 0x81, 0xFF, 0x02, 0x07, 0x00, 0xFC, 0x82, 0xFF, 0x0E, 0xAF, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0x3D, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x2D, 0x00, 0xFA, 0x81, 0xFF, 0x01, 0x05, 
+	0x50, 0x82, 0xFF, 0x03, 0xEF, 0x02, 0x00, 0xFB, 0x82, 0xFF, 0x02, 0xCF, 0x00, 0x70, 0x80, 0xFF, 0x02, 0xEF, 0x00, 0x50, 0x83, 0xFF, 0x08, 0x2F, 0x00, 0xD1, 0xFF, 0xFF, 0xBF, 0x01, 0x00, 0x91, 0x80, 0xFF, 0x02, 0x2D, 0x00, 0xFA, 0x81, 0xFF, 0x0A, 0x05, 0x50, 0xFF, 0xFF, 0x8F, 0xFC, 0xFF, 0xFF, 0x1C, 
+	0x00, 0xD1, 0x83, 0xFF, 0x07, 0x05, 0x10, 0xFE, 0xFF, 0xFF, 0x9F, 0x00, 0xC0, 0x83, 0xFF, 0x08, 0x07, 0x00, 0xF9, 0xFF, 0xFF, 0x0C, 0x00, 0x40, 0xFE, 0x80, 0xFF, 0x02, 0x2D, 0x00, 0xFA, 0x81, 0xFF, 0x0A, 0x03, 0x70, 0xFF, 0xFF, 0x08, 0xD2, 0xFF, 0xFF, 0xAF, 0x00, 0x50, 0x83, 0xFF, 0x07, 0x0C, 0x00, 
+	0xF9, 0xFF, 0xFF, 0x3F, 0x00, 0xF4, 0x82, 0xFF, 0x08, 0xCF, 0x00, 0x40, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0xF6, 0x81, 0xFF, 0x02, 0x2D, 0x00, 0xFA, 0x80, 0xFF, 0x0C, 0xEF, 0x02, 0x90, 0xFF, 0xCF, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0x05, 0x00, 0xFB, 0x82, 0xFF, 0x07, 0x4F, 0x00, 0xF3, 0xFF, 0xFF, 0x0C, 0x00, 
+	0xFA, 0x82, 0xFF, 0x07, 0x4F, 0x00, 0xD1, 0xFF, 0xFF, 0x2E, 0x00, 0x70, 0x82, 0xFF, 0x02, 0x2D, 0x00, 0xFA, 0x80, 0xFF, 0x0C, 0xDF, 0x01, 0xB0, 0xFF, 0xFF, 0x06, 0x00, 0xF4, 0xFF, 0xFF, 0x1D, 0x00, 0xF5, 0x82, 0xFF, 0x07, 0xAF, 0x00, 0xD0, 0xFF, 0xFF, 0x07, 0x10, 0xFD, 0x82, 0xFF, 0x07, 0x0A, 0x00, 
+	0xF8, 0xFF, 0xFF, 0x06, 0x00, 0xF6, 0x82, 0xFF, 0x02, 0x2D, 0x00, 0xFA, 0x80, 0xFF, 0x0C, 0xDF, 0x00, 0xC0, 0xFF, 0xFF, 0x4F, 0x00, 0x50, 0xFF, 0xFF, 0x8F, 0x00, 0xB0, 0x82, 0xFF, 0x06, 0xDF, 0x01, 0x70, 0xFF, 0xFF, 0x03, 0x60, 0x83, 0xFF, 0x06, 0x03, 0x20, 0xFF, 0xFF, 0xAF, 0x00, 0x40, 0x83, 0xFF, 
+	0x02, 0x2D, 0x00, 0xFA, 0x80, 0xFF, 0x02, 0xBF, 0x00, 0xE0, 0x80, 0xFF, 0x06, 0x03, 0x00, 0xFB, 0xFF, 0xFF, 0x02, 0x30, 0x83, 0xFF, 0x05, 0x06, 0x30, 0xFF, 0xCF, 0x01, 0xA0, 0x82, 0xFF, 0x07, 0xDF, 0x00, 0x80, 0xFF, 0xFF, 0x2E, 0x00, 0xD1, 0x83, 0xFF, 0x02, 0x2D, 0x00, 0xF9, 0x80, 0xFF, 0x02, 0x5F, 
+	0x00, 0xF2, 0x80, 0xFF, 0x07, 0x1D, 0x00, 0xF3, 0xFF, 0xFF, 0x09, 0x00, 0xFC, 0x82, 0xFF, 0x05, 0x0A, 0x10, 0xFC, 0x9F, 0x00, 0xD1, 0x82, 0xFF, 0x07, 0x7F, 0x00, 0xE1, 0xFF, 0xFF, 0x08, 0x00, 0xFA, 0x83, 0xFF, 0x02, 0x2D, 0x00, 0xFA, 0x80, 0xFF, 0x02, 0x1F, 0x00, 0xF7, 0x80, 0xFF, 0x07, 0x8F, 0x00, 
+	0x90, 0xFF, 0xFF, 0x1E, 0x00, 0xF6, 0x82, 0xFF, 0x05, 0x1D, 0x00, 0xFA, 0x6F, 0x00, 0xF3, 0x82, 0xFF, 0x06, 0x2F, 0x00, 0xF7, 0xFF, 0xEF, 0x01, 0x40, 0x84, 0xFF, 0x08, 0x2E, 0x00, 0x64, 0x75, 0xD9, 0xFF, 0x0A, 0x00, 0xFD, 0x81, 0xFF, 0x06, 0x03, 0x10, 0xFE, 0xFF, 0x7F, 0x00, 0xF2, 0x82, 0xFF, 0x05, 
+	0x3F, 0x00, 0xF6, 0x3E, 0x00, 0xF6, 0x82, 0xFF, 0x06, 0x0A, 0x00, 0xFC, 0xFF, 0x8F, 0x00, 0xB0, 0x84, 0xFF, 0x00, 0x1A, 0x81, 0x00, 0x02, 0xC3, 0x05, 0x40, 0x82, 0xFF, 0x06, 0x0A, 0x00, 0xF8, 0xFF, 0xCF, 0x00, 0xA0, 0x82, 0xFF, 0x05, 0x6F, 0x00, 0xE3, 0x0D, 0x00, 0xFA, 0x82, 0xFF, 0x06, 0x05, 0x40, 
+	0xFF, 0xFF, 0x2F, 0x00, 0xF4, 0x83, 0xFF, 0x00, 0x6E, 0x84, 0x00, 0x00, 0x90, 0x82, 0xFF, 0x06, 0x4F, 0x00, 0xF3, 0xFF, 0xEF, 0x03, 0x50, 0x82, 0xFF, 0x05, 0xAF, 0x00, 0xD0, 0x0C, 0x00, 0xFC, 0x81, 0xFF, 0x07, 0xEF, 0x03, 0x60, 0xFF, 0xFF, 0x0C, 0x00, 0xFB, 0x82, 0xFF, 0x05, 0xEF, 0x03, 0x00, 0x00, 
+	0x54, 0x35, 0x80, 0x00, 0x00, 0xD1, 0x82, 0xFF, 0x07, 0xAF, 0x00, 0xD0, 0xFF, 0xFF, 0x07, 0x30, 0xFE, 0x81, 0xFF, 0x04, 0xCF, 0x00, 0xC0, 0x0A, 0x10, 0x82, 0xFF, 0x07, 0xDF, 0x01, 0x90, 0xFF, 0xFF, 0x06, 0x10, 0xFE, 0x82, 0xFF, 0x09, 0x3E, 0x00, 0x00, 0xD7, 0xFF, 0xEF, 0x8D, 0x01, 0x00, 0xE2, 0x82, 
+	0xFF, 0x07, 0xEF, 0x00, 0x80, 0xFF, 0xFF, 0x0A, 0x10, 0xFC, 0x82, 0xFF, 0x03, 0x01, 0xA0, 0x07, 0x20, 0x82, 0xFF, 0x06, 0xBF, 0x00, 0xC1, 0xFF, 0xFF, 0x03, 0x60, 0x83, 0xFF, 0x02, 0x06, 0x00, 0xD3, 0x81, 0xFF, 0x02, 0x3E, 0x00, 0x80, 0x83, 0xFF, 0x06, 0x05, 0x30, 0xFF, 0xFF, 0x1C, 0x00, 0xFB, 0x82, 
+	0xFF, 0x03, 0x02, 0x70, 0x05, 0x50, 0x82, 0xFF, 0x06, 0x9F, 0x00, 0xF3, 0xFF, 0xDF, 0x01, 0xA0, 0x82, 0xFF, 0x0B, 0xCF, 0x00, 0x30, 0xFF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0x02, 0x10, 0xFD, 0x82, 0xFF, 0x06, 0x0A, 0x10, 0xFD, 0xFF, 0x2F, 0x00, 0xF8, 0x82, 0xFF, 0x03, 0x05, 0x50, 0x03, 0x70, 0x82, 0xFF, 
+	0x06, 0x7F, 0x00, 0xF4, 0xFF, 0xBF, 0x00, 0xC0, 0x82, 0xFF, 0x0B, 0x4F, 0x00, 0xD1, 0xFF, 0xBF, 0x34, 0x43, 0xFB, 0xFF, 0x0C, 0x00, 0xF5, 0x82, 0xFF, 0x06, 0x0C, 0x00, 0xFB, 0xFF, 0x4F, 0x00, 0xF6, 0x82, 0xFF, 0x03, 0x07, 0x30, 0x03, 0x70, 0x82, 0xFF, 0x06, 0x4F, 0x00, 0xF6, 0xFF, 0x8F, 0x00, 0xE2, 
+	0x80, 0xFF, 0x0D, 0xDE, 0x8A, 0x05, 0x00, 0xF8, 0xFF, 0x08, 0x00, 0x00, 0x80, 0xFF, 0x7F, 0x00, 0xE0, 0x82, 0xFF, 0x06, 0x1D, 0x00, 0xFA, 0xFF, 0x6F, 0x00, 0xF4, 0x82, 0xFF, 0x03, 0x07, 0x30, 0x02, 0x80, 0x82, 0xFF, 0x0A, 0x3E, 0x00, 0xF6, 0xFF, 0x7F, 0x00, 0xF4, 0xFF, 0xCF, 0x47, 0x01, 0x80, 0x00, 
+	0x01, 0xFD, 0xBF, 0x81, 0x00, 0x03, 0xFB, 0xCF, 0x00, 0xB0, 0x82, 0xFF, 0x06, 0x2E, 0x00, 0xF9, 0xFF, 0x7F, 0x00, 0xF4, 0x82, 0xFF, 0x03, 0x08, 0x20, 0x01, 0x90, 0x82, 0xFF, 0x08, 0x3E, 0x00, 0xF7, 0xFF, 0x6F, 0x00, 0xF4, 0xAF, 0x05, 0x81, 0x00, 0x0A, 0x30, 0xFE, 0x4F, 0x00, 0x70, 0x07, 0x00, 0xF4, 
+	0xEF, 0x01, 0x90, 0x82, 0xFF, 0x06, 0x3F, 0x00, 0xF7, 0xFF, 0x8F, 0x00, 0xF3, 0x82, 0xFF, 0x03, 0x09, 0x10, 0x00, 0xA0, 0x82, 0xFF, 0x07, 0x3E, 0x00, 0xF8, 0xFF, 0x6F, 0x00, 0xA4, 0x03, 0x80, 0x00, 0x0C, 0x40, 0x01, 0x50, 0xFF, 0x3E, 0x00, 0xF7, 0x7F, 0x00, 0xE3, 0xFF, 0x04, 0x60, 0x82, 0xFF, 0x06, 
+	0x5F, 0x00, 0xF6, 0xFF, 0x9F, 0x00, 0xE3, 0x82, 0xFF, 0x03, 0x0A, 0x00, 0x00, 0xA0, 0x82, 0xFF, 0x04, 0x3F, 0x00, 0xF9, 0xFF, 0x5F, 0x81, 0x00, 0x0E, 0x51, 0xC8, 0xFE, 0x05, 0x40, 0xFF, 0x3E, 0x00, 0xF7, 0x7F, 0x00, 0xE3, 0xFF, 0x05, 0x40, 0x86, 0xFF, 0x02, 0x9F, 0x00, 0xE2, 0x82, 0xFF, 0x03, 0x0A, 
+	0x00, 0x01, 0x90, 0x82, 0xFF, 0x04, 0x3F, 0x00, 0xF9, 0xFF, 0x7F, 0x80, 0x00, 0x10, 0x83, 0xFE, 0xFF, 0xFF, 0x06, 0x10, 0xFE, 0x4F, 0x00, 0x70, 0x07, 0x00, 0xF4, 0xFF, 0x03, 0x00, 0xE7, 0x85, 0xFF, 0x02, 0x7F, 0x00, 0xE2, 0x82, 0xFF, 0x03, 0x09, 0x10, 0x02, 0x80, 0x82, 0xFF, 0x08, 0x3F, 0x00, 0xF7, 
+	0xFF, 0x3E, 0x00, 0x00, 0xA3, 0xFE, 0x80, 0xFF, 0x03, 0x09, 0x00, 0xFC, 0xBF, 0x81, 0x00, 0x05, 0xFB, 0xDF, 0x00, 0x00, 0x10, 0xF8, 0x84, 0xFF, 0x02, 0x6F, 0x00, 0xF3, 0x82, 0xFF, 0x03, 0x08, 0x20, 0x03, 0x70, 0x82, 0xFF, 0x06, 0x4F, 0x00, 0xF5, 0xEF, 0x03, 0x00, 0x80, 0x82, 0xFF, 0x09, 0x0D, 0x00, 
+	0xF8, 0xFF, 0x08, 0x00, 0x00, 0x80, 0xFF, 0x8F, 0x80, 0x00, 0x01, 0x30, 0xFB, 0x83, 0xFF, 0x02, 0x4F, 0x00, 0xF5, 0x82, 0xFF, 0x03, 0x07, 0x30, 0x03, 0x70, 0x82, 0xFF, 0x06, 0x6F, 0x00, 0xF3, 0x3E, 0x00, 0x00, 0xC0, 0x82, 0xFF, 0x0F, 0x4F, 0x00, 0xC0, 0xFF, 0xBF, 0x34, 0x43, 0xFB, 0xFF, 0x1D, 0x00, 
+	0x53, 0x00, 0x00, 0x50, 0xFD, 0x82, 0xFF, 0x02, 0x3F, 0x00, 0xF6, 0x82, 0xFF, 0x03, 0x06, 0x30, 0x05, 0x50, 0x82, 0xFF, 0x06, 0x9F, 0x00, 0xD3, 0x03, 0x00, 0x00, 0x80, 0x82, 0xFF, 0x10, 0xBF, 0x00, 0x20, 0xFE, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0x03, 0x00, 0xFC, 0x3A, 0x00, 0x00, 0x70, 0xFE, 0x81, 0xFF, 
+	0x02, 0x2F, 0x00, 0xF8, 0x82, 0xFF, 0x03, 0x04, 0x50, 0x07, 0x20, 0x82, 0xFF, 0x06, 0xBF, 0x00, 0x21, 0x00, 0x60, 0x03, 0x40, 0x83, 0xFF, 0x02, 0x06, 0x00, 0xD3, 0x81, 0xFF, 0x08, 0x3E, 0x00, 0x60, 0xFF, 0xFF, 0x18, 0x00, 0x00, 0x92, 0x81, 0xFF, 0x02, 0x9F, 0x15, 0xFA, 0x82, 0xFF, 0x03, 0x02, 0x70, 
+	0x0A, 0x10, 0x82, 0xFF, 0x07, 0xDF, 0x02, 0x00, 0x00, 0xF5, 0x08, 0x00, 0xFE, 0x81, 0xFF, 0x11, 0xEF, 0x06, 0x00, 0x00, 0xD8, 0xFF, 0xEF, 0x8D, 0x01, 0x00, 0xE3, 0xFF, 0xFF, 0xEF, 0x06, 0x00, 0x00, 0xC3, 0x87, 0xFF, 0x05, 0xEF, 0x01, 0xA0, 0x0C, 0x00, 0xFC, 0x82, 0xFF, 0x06, 0x04, 0x00, 0x30, 0xFF, 
+	0x0D, 0x00, 0xFB, 0x81, 0xFF, 0x00, 0x19, 0x81, 0x00, 0x05, 0x53, 0x35, 0x00, 0x00, 0x30, 0xFD, 0x80, 0xFF, 0x04, 0xCF, 0x04, 0x00, 0x00, 0xD6, 0x86, 0xFF, 0x05, 0xCF, 0x00, 0xC0, 0x0D, 0x00, 0xFA, 0x82, 0xFF, 0x06, 0x06, 0x00, 0xD1, 0xFF, 0x3F, 0x00, 0xF3, 0x80, 0xFF, 0x03, 0x3A, 0x00, 0x00, 0x50, 
+	0x83, 0x00, 0x00, 0xE6, 0x82, 0xFF, 0x04, 0xAF, 0x02, 0x00, 0x10, 0xF8, 0x85, 0xFF, 0x05, 0xAF, 0x00, 0xD0, 0x3E, 0x00, 0xF6, 0x82, 0xFF, 0x0E, 0x07, 0x00, 0xF9, 0xFF, 0x8F, 0x00, 0xA0, 0xFF, 0xFF, 0x4D, 0x00, 0x00, 0x50, 0xFD, 0x6D, 0x81, 0x00, 0x00, 0x30, 0x84, 0xFF, 0x04, 0x8E, 0x00, 0x00, 0x20, 
+	0xFA, 0x84, 0xFF, 0x05, 0x6F, 0x00, 0xE3, 0x6F, 0x00, 0xF3, 0x81, 0xFF, 0x15, 0xDF, 0x02, 0x00, 0xF7, 0xFF, 0xEF, 0x02, 0x30, 0xFF, 0x7E, 0x00, 0x00, 0x30, 0xFB, 0xFF, 0xFF, 0xAD, 0x68, 0x85, 0x04, 0x00, 0xF6, 0x84, 0xFF, 0x04, 0x5D, 0x00, 0x00, 0x40, 0xFC, 0x83, 0xFF, 0x05, 0x3F, 0x00, 0xF6, 0x9F, 
+	0x00, 0xD1, 0x81, 0xFF, 0x0C, 0xAF, 0x00, 0x00, 0xE1, 0xFF, 0xFF, 0x09, 0x00, 0xA8, 0x01, 0x00, 0x10, 0xF8, 0x83, 0xFF, 0x02, 0x3F, 0x00, 0x80, 0x85, 0xFF, 0x04, 0x4B, 0x00, 0x00, 0x60, 0xFD, 0x82, 0xFF, 0x05, 0x1C, 0x00, 0xF9, 0xCF, 0x01, 0xA0, 0x81, 0xFF, 0x06, 0x5F, 0x00, 0x00, 0x90, 0xFF, 0xFF, 
+	0x3F, 0x81, 0x00, 0x00, 0xE7, 0x84, 0xFF, 0x03, 0xDF, 0x02, 0x00, 0xF9, 0x85, 0xFF, 0x03, 0x19, 0x00, 0x00, 0x81, 0x82, 0xFF, 0x05, 0x09, 0x10, 0xFC, 0xFF, 0x03, 0x60, 0x81, 0xFF, 0x06, 0x0D, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x8F, 0x80, 0x00, 0x00, 0xC4, 0x86, 0xFF, 0x02, 0x0C, 0x00, 0x80, 0x85, 0xFF, 
+	0x04, 0xEF, 0x07, 0x00, 0x00, 0xB3, 0x81, 0xFF, 0x06, 0x06, 0x30, 0xFF, 0xFF, 0x07, 0x10, 0xFD, 0x80, 0xFF, 0x09, 0x0B, 0x00, 0x08, 0x00, 0xF8, 0xEF, 0x18, 0x00, 0x00, 0xA0, 0x87, 0xFF, 0x03, 0xAF, 0x00, 0x00, 0xE5, 0x85, 0xFF, 0x0E, 0xDF, 0x05, 0x00, 0x00, 0xE5, 0xFF, 0xFF, 0xDF, 0x01, 0x70, 0xFF, 
+	0xFF, 0x0C, 0x00, 0xFA, 0x80, 0xFF, 0x05, 0x08, 0x10, 0x5F, 0x00, 0xD1, 0x2A, 0x80, 0x00, 0x00, 0x70, 0x88, 0xFF, 0x03, 0x09, 0x00, 0x20, 0xFB, 0x85, 0xFF, 0x0D, 0xBF, 0x03, 0x00, 0x50, 0xFF, 0xFF, 0x9F, 0x00, 0xC0, 0xFF, 0xFF, 0x3F, 0x00, 0xF4, 0x80, 0xFF, 0x0A, 0x06, 0x40, 0xBF, 0x00, 0x10, 0x00, 
+	0x00, 0x50, 0x02, 0x00, 0xF5, 0x87, 0xFF, 0x04, 0xCF, 0x02, 0x00, 0x60, 0xFD, 0x85, 0xFF, 0x0C, 0x6F, 0x00, 0x30, 0xFF, 0xFF, 0x4F, 0x00, 0xF3, 0xFF, 0xFF, 0x9F, 0x00, 0xC0, 0x80, 0xFF, 0x0B, 0x05, 0x40, 0xFF, 0x05, 0x00, 0x00, 0x40, 0xFC, 0x2C, 0x00, 0x40, 0xFD, 0x87, 0xFF, 0x04, 0x6E, 0x00, 0x00, 
+	0x60, 0xEC, 0x83, 0xFF, 0x0D, 0xDF, 0x06, 0x00, 0xA0, 0xFF, 0xFF, 0x0C, 0x00, 0xF9, 0xFF, 0xFF, 0xEF, 0x00, 0x50, 0x80, 0xFF, 0x0B, 0x07, 0x30, 0x8F, 0x01, 0x00, 0x20, 0xFA, 0xFF, 0xDF, 0x02, 0x00, 0x91, 0x88, 0xFF, 0x05, 0x09, 0x00, 0x00, 0x30, 0xB7, 0xFD, 0x80, 0xFF, 0x09, 0xBD, 0x18, 0x00, 0x00, 
+	0xF8, 0xFF, 0xFF, 0x05, 0x00, 0xFE, 0x80, 0xFF, 0x11, 0x07, 0x00, 0xFC, 0xFF, 0xFF, 0x08, 0x10, 0x03, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0x3D, 0x00, 0x00, 0xB4, 0x87, 0xFF, 0x01, 0xDF, 0x06, 0x80, 0x00, 0x0C, 0x31, 0x54, 0x55, 0x35, 0x02, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xCF, 0x00, 0x70, 0x81, 0xFF, 
+	0x05, 0x1D, 0x00, 0xF6, 0xFF, 0xFF, 0x0B, 0x80, 0x00, 0x02, 0x02, 0x00, 0xD2, 0x80, 0xFF, 0x04, 0x06, 0x00, 0x00, 0xB4, 0xFE, 0x86, 0xFF, 0x01, 0xDF, 0x16, 0x85, 0x00, 0x06, 0x30, 0xFC, 0xFF, 0xFF, 0x6F, 0x00, 0xD1, 0x81, 0xFF, 0x1A, 0x6F, 0x00, 0xC1, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0xB3, 0x6F, 0x00, 
+	0x30, 0xFE, 0xFF, 0xFF, 0xAF, 0x02, 0x00, 0x00, 0x61, 0xCA, 0xFD, 0xFF, 0xFF, 0xDE, 0xAC, 0x55, 0x80, 0xFF, 0x02, 0xEF, 0x59, 0x12, 0x82, 0x00, 0x01, 0x52, 0xFB, 0x80, 0xFF, 0x02, 0x0C, 0x00, 0xF6, 0x81, 0xFF, 0x0C, 0xCF, 0x00, 0x50, 0xFF, 0xFF, 0x9F, 0x00, 0x92, 0xFF, 0xFF, 0x05, 0x00, 0xE3, 0x80, 
+	0xFF, 0x01, 0x8E, 0x01, 0x80, 0x00, 0x06, 0x42, 0x54, 0x45, 0x23, 0x00, 0x00, 0xFC, 0x81, 0xFF, 0x06, 0xCE, 0x79, 0x56, 0x44, 0x75, 0xB9, 0xFD, 0x81, 0xFF, 0x02, 0x04, 0x00, 0xFC, 0x82, 0xFF, 0x0C, 0x06, 0x00, 0xFA, 0xFF, 0xFF, 0xAA, 0xFE, 0xFF, 0xFF, 0x4F, 0x00, 0x20, 0xFC, 0x80, 0xFF, 0x01, 0x8E, 
+	0x02, 0x85, 0x00, 0x00, 0xF7, 0x8B, 0xFF, 0x02, 0xAF, 0x00, 0x60, 0x83, 0xFF, 0x02, 0x2E, 0x00, 0xE2, 0x84, 0xFF, 0x02, 0x04, 0x00, 0x80, 0x81, 0xFF, 0x02, 0xCF, 0x26, 0x01, 0x81, 0x00, 0x02, 0x10, 0x73, 0xFC, 0x8B, 0xFF, 0x02, 0x1E, 0x00, 0xE2, 0x83, 0xFF, 0x02, 0xAF, 0x00, 0x60, 0x84, 0xFF, 0x03, 
+	0x5E, 0x00, 0x00, 0xD4, 0x82, 0xFF, 0x05, 0xBD, 0x78, 0x66, 0x66, 0x97, 0xDA, 0x8D, 0xFF, 0x02, 0x05, 0x00, 0xFA, 0x84, 0xFF, 0x02, 0x04, 0x00, 0xFA, 0x84, 0xFF, 0x03, 0x08, 0x00, 0x10, 0xE8, 0x8B, 0xFF, 0x01, 0xAE, 0xFE, 0x86, 0xFF, 0x02, 0x9F, 0x00, 0x40, 0x85, 0xFF, 0x02, 0x1D, 0x00, 0xD1, 0x84, 
+	0xFF, 0x04, 0xCF, 0x02, 0x00, 0x10, 0xE8, 0x89, 0xFF, 0x02, 0x8E, 0x02, 0xF9, 0x86, 0xFF, 0x02, 0x0C, 0x00, 0xD1, 0x85, 0xFF, 0x03, 0xAF, 0x00, 0x30, 0xFE, 0x84, 0xFF, 0x05, 0x6E, 0x00, 0x00, 0x10, 0xC8, 0xFE, 0x85, 0xFF, 0x04, 0xEF, 0x7C, 0x01, 0x00, 0xD0, 0x85, 0xFF, 0x03, 0xEF, 0x03, 0x00, 0xFA, 
+	0x86, 0xFF, 0x02, 0x07, 0x00, 0xF5, 0x85, 0xFF, 0x00, 0x5B, 0x80, 0x00, 0x01, 0x63, 0xD9, 0x83, 0xFF, 0x01, 0x9D, 0x36, 0x80, 0x00, 0x00, 0xD3, 0x85, 0xFF, 0x02, 0x4F, 0x00, 0x70, 0x87, 0xFF, 0x02, 0x4F, 0x00, 0x60, 0x86, 0xFF, 0x00, 0x5B, 0x80, 0x00, 0x07, 0x10, 0x33, 0x65, 0x98, 0x89, 0x56, 0x34, 
+	0x01, 0x80, 0x00, 0x00, 0xB5, 0x86, 0xFF, 0x02, 0x05, 0x00, 0xF4, 0x87, 0xFF, 0x03, 0xEF, 0x02, 0x00, 0xF7, 0x86, 0xFF, 0x01, 0x5C, 0x01, 0x87, 0x00, 0x01, 0x10, 0xC5, 0x86, 0xFF, 0x03, 0x7F, 0x00, 0x20, 0xFE, 0x88, 0xFF, 0x02, 0x1D, 0x00, 0x70, 0x87, 0xFF, 0x02, 0xAE, 0x37, 0x01, 0x83, 0x00, 0x02, 
+	0x10, 0x64, 0xDA, 0x87, 0xFF, 0x02, 0x07, 0x00, 0xD1, 0x89, 0xFF, 0x03, 0xCF, 0x01, 0x00, 0xF6, 0x88, 0xFF, 0x07, 0xAC, 0x78, 0x45, 0x12, 0x32, 0x54, 0x76, 0xDA, 0x88, 0xFF, 0x03, 0x5F, 0x00, 0x10, 0xFC, 0x8A, 0xFF, 0x03, 0x1B, 0x00, 0x50, 0xFE, 0x8A, 0xFF, 0x01, 0xEE, 0xEE, 0x8A, 0xFF, 0x03, 0xEF, 
+	0x04, 0x00, 0xB1, 0x8B, 0xFF, 0x03, 0xCF, 0x01, 0x00, 0xD3, 0x99, 0xFF, 0x03, 0x3C, 0x00, 0x10, 0xFC, 0x8C, 0xFF, 0x03, 0x2D, 0x00, 0x10, 0xFA, 0x97, 0xFF, 0x03, 0x9F, 0x00, 0x00, 0xD2, 0x8D, 0xFF, 0x04, 0xEF, 0x04, 0x00, 0x60, 0xFE, 0x95, 0xFF, 0x04, 0xEF, 0x05, 0x00, 0x40, 0xFE, 0x8E, 0xFF, 0x03, 
+	0x7F, 0x00, 0x00, 0xA2, 0x95, 0xFF, 0x03, 0x1A, 0x00, 0x00, 0xF7, 0x90, 0xFF, 0x03, 0x1A, 0x00, 0x00, 0xC5, 0x93, 0xFF, 0x03, 0x4C, 0x00, 0x00, 0xA1, 0x91, 0xFF, 0x04, 0xDF, 0x04, 0x00, 0x10, 0xC6, 0x91, 0xFF, 0x04, 0x6C, 0x00, 0x00, 0x40, 0xFD, 0x92, 0xFF, 0x04, 0xAF, 0x02, 0x00, 0x00, 0xC5, 0x8F, 
+	0xFF, 0x04, 0x5C, 0x00, 0x00, 0x20, 0xFA, 0x94, 0xFF, 0x00, 0x6E, 0x80, 0x00, 0x01, 0xA4, 0xFD, 0x8B, 0xFF, 0x01, 0xDF, 0x49, 0x80, 0x00, 0x00, 0xE6, 0x96, 0xFF, 0x05, 0x6C, 0x01, 0x00, 0x00, 0x61, 0xDA, 0x89, 0xFF, 0x05, 0x9C, 0x16, 0x00, 0x00, 0x10, 0xC6, 0x98, 0xFF, 0x00, 0x7D, 0x80, 0x00, 0x02, 
+	0x10, 0x63, 0xCA, 0x84, 0xFF, 0x03, 0xEF, 0xAC, 0x36, 0x01, 0x80, 0x00, 0x00, 0xD7, 0x9A, 0xFF, 0x01, 0x9E, 0x03, 0x81, 0x00, 0x07, 0x21, 0x75, 0x87, 0xA9, 0x9A, 0x78, 0x46, 0x12, 0x81, 0x00, 0x01, 0x30, 0xE9, 0x9C, 0xFF, 0x02, 0xCF, 0x37, 0x01, 0x89, 0x00, 0x02, 0x10, 0x73, 0xFC, 0x9F, 0xFF, 0x01, 
+	0x9C, 0x36, 0x87, 0x00, 0x01, 0x63, 0xC9, 0xA2, 0xFF, 0x0B, 0xEF, 0xCD, 0x7A, 0x35, 0x23, 0x01, 0x10, 0x32, 0x53, 0xA7, 0xDC, 0xFE, 0x90, 0xFF, 
 	};
+const Icon fanoff_icon = {fanoff_width, fanoff_height, sizeof(fanoff_data), fanoff_data, NULL};
@@ -1,104 +1,57 @@
+#pragma once
+#include "fanoff.h"
 const uint32_t fanon_width = 100;
 const uint32_t fanon_height = 100;
-const uint8_t fanon_data[(100*100)/2] = {
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xCD, 0x7A, 0x35, 0x23, 0x01, 0x10, 0x32, 0x53, 0xA7, 0xDC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0xCA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x37, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x73, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xE9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x79, 0x35, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0xFF, 0xEF, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xCF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xA8, 0xFF, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x03, 0xE5, 0xFF, 0xEF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x04, 0x10, 0xFC, 0xFF, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x04, 0x00, 0xC1, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x04, 0x00, 0x20, 0xFD, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x04, 0x00, 0x00, 0xF4, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0x1A, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x04, 0x00, 0x00, 0x90, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xFD, 0x5F, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x04, 0x00, 0x00, 0x20, 0xFE, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xFE, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFE, 0xFF, 0xFF, 0x7E, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xEC, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x7D, 0x01, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x04, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0x1F, 0x00, 0x00, 0x60, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB2, 0xFF, 0xFF, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x6F, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFE, 0xFF, 0x9F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x10, 0xFE, 0x9F, 0x00, 0x00, 0x10, 0xFA, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xCF, 0x00, 0x00, 0x00, 0x60, 0xFE, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xEF, 0x02, 0x00, 0x00, 0x00, 0xB2, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x91, 0x0A, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x50, 0xFD, 0x4F, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x2E, 0x00, 0x00, 0x10, 0xFC, 0xFF, 0xAF, 0x01, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x07, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x00, 0xE3, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 
-	0xFF, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0x06, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x06, 0x00, 0x80, 0xFF, 0x0A, 0x00, 0x00, 0x50, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 
-	0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x06, 0x00, 0xF2, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 
-	0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0xFF, 0x2E, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x04, 0x00, 0x50, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xE1, 0xFF, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 
-	0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0x06, 0x00, 0x00, 0xF4, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xEF, 0x02, 0x00, 0x00, 0xF6, 0xFF, 0x4F, 0x00, 0x00, 0x70, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 
-	0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xCF, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xCF, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xCF, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 
-	0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x7F, 0x00, 0x00, 0x90, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x06, 0x00, 0x00, 0xF6, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 
-	0xCF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x1E, 0x00, 0x00, 0xF2, 0xFF, 0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x60, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0xE2, 0xFF, 0x1E, 0x00, 0x00, 0xD0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFC, 
-	0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x09, 0x00, 0x00, 0xFA, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x79, 0x67, 0x14, 0x00, 0xC0, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x9F, 0x00, 0x00, 0x90, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 
-	0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0x02, 0x00, 0x30, 0xFE, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xDF, 0x3A, 0xF2, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xEF, 0x03, 0x00, 0x30, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 
-	0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xCF, 0x00, 0x00, 0x80, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFD, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x07, 0x00, 0x00, 0xFD, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 
-	0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x8F, 0x00, 0x00, 0xC1, 0xFF, 0x1C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFD, 0xFF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xFF, 0x0B, 0x00, 0x00, 0xF7, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 
-	0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x4F, 0x00, 0x00, 0xF4, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xFF, 0xFF, 0x6C, 0x34, 0x43, 0xC7, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0x3F, 0x00, 0x00, 0xF3, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 
-	0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0x2F, 0x00, 0x00, 0xF8, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0xE5, 0xFF, 0xCF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x6F, 0x00, 0x00, 0xE1, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 
-	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x0B, 0x00, 0x00, 0xFB, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xDF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFD, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xBF, 0x00, 0x00, 0xB0, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xFF, 0x08, 0x00, 0x10, 0xFE, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0x2E, 0x00, 0x00, 0x52, 0x24, 0x00, 0x00, 0xF4, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xEF, 0x01, 0x00, 0x90, 0xFF, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 
-	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xFF, 0x06, 0x00, 0x20, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x05, 0x00, 0xA1, 0xFE, 0xEF, 0x1A, 0x00, 0x70, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0x01, 0x00, 0x60, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 
-	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x05, 0x00, 0x50, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x41, 0xB8, 0xED, 0xFF, 0xCF, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0xFC, 0xDF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x03, 0x00, 0x50, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 
-	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x05, 0x00, 0x60, 0xFF, 0x3F, 0x00, 0x30, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xF8, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x04, 0x00, 0x40, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x04, 0x00, 0x70, 0xFF, 0x1F, 0x50, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xE2, 0xFF, 0x6D, 0xD6, 0xFF, 0x2E, 0x00, 0xF6, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x06, 0x00, 0x40, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0x04, 0x00, 0x80, 0xFF, 0x5F, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0x3E, 0x00, 0xF5, 0xFF, 0x06, 0x60, 0xFF, 0x5F, 0x00, 0xF3, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0x07, 0x00, 0x30, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xEF, 0x03, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x6A, 0x13, 0x70, 0xFF, 0x3E, 0x00, 0xF5, 0xFF, 0x06, 0x60, 0xFF, 0x5F, 0x00, 0xE3, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x03, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xCF, 0x17, 0x00, 0x00, 0x60, 0xFF, 0x4F, 0x00, 0xE2, 0xFF, 0x6D, 0xD6, 0xFF, 0x2E, 0x00, 0xF4, 0xFF, 0x6D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFE, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 
-	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x05, 0x00, 0xA0, 0xFF, 0xFF, 0xBF, 0x05, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x7F, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xF7, 0xFF, 0xFF, 0x4C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 
-	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0x06, 0x00, 0xF9, 0xFF, 0xDF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xCF, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x2A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 
-	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0x07, 0x90, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0x05, 0x00, 0xA1, 0xFE, 0xEF, 0x1A, 0x00, 0x50, 0xFF, 0xDF, 0xFE, 0xFF, 0xFF, 0x17, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 
-	0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xFF, 0x09, 0xF9, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0x2E, 0x00, 0x00, 0x52, 0x24, 0x00, 0x00, 0xE2, 0xFF, 0x3F, 0xB3, 0xFF, 0xFF, 0xDF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 
-	0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x9B, 0xFF, 0xFF, 0xFD, 0xEF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xCF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFD, 0xFF, 0x0A, 0x00, 0xD5, 0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 
-	0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0x4F, 0xF6, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0x00, 0xE5, 0xFF, 0xDF, 0x01, 0x00, 0x00, 0xE7, 0xFF, 0xFF, 0x9F, 0x02, 0x00, 0x00, 0x00, 0x00, 0x51, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 
-	0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x06, 0xF3, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC5, 0xFF, 0xFF, 0xFF, 0x7C, 0x34, 0x43, 0xC7, 0xFF, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0x20, 0xF9, 0xFF, 0xFF, 0x7E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 
-	0x0D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0x8F, 0x00, 0xB0, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xDF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFB, 0xFF, 0xFF, 0x5C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 
-	0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0xFF, 0x0C, 0x00, 0x80, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x91, 0xFF, 0xFF, 0xFF, 0x88, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x19, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFD, 0xFF, 0xFF, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 
-	0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0x04, 0x00, 0x20, 0xFE, 0xEF, 0x01, 0x00, 0x60, 0xFE, 0xFF, 0xFF, 0x2A, 0x00, 0x81, 0xED, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFE, 0xFF, 0xFF, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 
-	0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0xF9, 0xFF, 0x08, 0x50, 0xFC, 0xFF, 0xFF, 0x4C, 0x00, 0x00, 0x00, 0x31, 0x75, 0x57, 0xF8, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA2, 0xFF, 0xFF, 0xEF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 
-	0xCF, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0xE1, 0xFF, 0x4E, 0xFA, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xEF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC4, 0xFF, 0xFF, 0xCF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFC, 
-	0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE6, 0xFF, 0xFF, 0xAF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 
-	0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xAF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0xFF, 0xDF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xF8, 0xFF, 0xFF, 0x8F, 0x01, 0x00, 0x00, 0x00, 0x70, 0xFF, 
-	0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xCF, 0xFA, 0xFF, 0x07, 0x00, 0xB4, 0xFF, 0xFF, 0xDF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFE, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFA, 0xFF, 0xFF, 0x6D, 0x00, 0x00, 0x00, 0xC0, 0xFF, 
-	0xFF, 0x3F, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xAF, 0xE0, 0xFF, 0x1E, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xFF, 0xFF, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFD, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xF3, 0xFF, 
-	0xFF, 0x9F, 0x00, 0x00, 0x00, 0x30, 0xFF, 0x8F, 0x80, 0xFF, 0xCF, 0xFE, 0xFF, 0xFF, 0xFD, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFC, 0xFF, 0xDF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xF9, 0xFF, 
-	0xFF, 0xEF, 0x00, 0x00, 0x00, 0x30, 0xFF, 0x7F, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x3B, 0xA0, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 0xFF, 0xFF, 0xCF, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA3, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0xFE, 0xFF, 
-	0xFF, 0xFF, 0x07, 0x00, 0x00, 0x30, 0xFF, 0x7F, 0x30, 0xFD, 0xFF, 0xFF, 0x5D, 0x00, 0x00, 0xFA, 0xFF, 0xBF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE6, 0xFF, 0xFF, 0xDF, 0x49, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x70, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x20, 0xFE, 0xAF, 0xF8, 0xFF, 0xFF, 0xEF, 0x02, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFA, 0xFF, 0xFF, 0xFF, 0xBE, 0x68, 0x23, 0x22, 0x52, 0xC9, 0xFE, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0xD1, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0x6D, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5E, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xBF, 0xE6, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x40, 0xFD, 0xFF, 0xFF, 0x8C, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x02, 0x00, 0x00, 0x30, 0xC8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8E, 0x02, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0xF4, 0xFF, 0xEF, 0x06, 0x40, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x81, 0xFF, 0xFF, 0xFF, 0xDF, 0x8A, 0x25, 0x12, 0x11, 0x53, 0xA6, 0xFD, 0x08, 0x00, 0x00, 0x00, 0x10, 0x83, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x5B, 0x01, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0x00, 0x90, 0xEF, 0x18, 0x00, 0x00, 0xF4, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x92, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x65, 0x77, 0x47, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x24, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x83, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x40, 0xB8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFE, 0xFF, 0xAF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x65, 0x77, 0x88, 0x46, 0x12, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB2, 0xFF, 0xFF, 0x6E, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0x7D, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xD7, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFD, 0xFF, 0xFF, 0x8E, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xE9, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xFE, 0xFF, 0xFF, 0xDF, 0x48, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x84, 0xFC, 0xFF, 0xFF, 0xEF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x81, 0xFD, 0xFF, 0xFF, 0xFF, 0xAE, 0x78, 0x55, 0x34, 0x43, 0x55, 0x86, 0xEB, 0xFF, 0xFF, 0xFF, 0xDF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x71, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0xD8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9D, 0x15, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x72, 0xCB, 0xED, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xAD, 0x26, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x31, 0x54, 0x76, 0x67, 0x45, 0x23, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9E, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xE9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x37, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x73, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x63, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xCD, 0x7A, 0x35, 0x23, 0x01, 0x10, 0x32, 0x53, 0xA7, 0xDC, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+const uint8_t fanon_data[2488] = { // delta to fanoff, run length encoded
+0xFF, 0xFF, 0xEA, 0x89, 0x00, 0xE2, 0x8D, 0x00, 0xE0, 0x82, 0x00, 0x02, 0x40, 0x79, 0x35, 0x87, 0x00, 0xDE, 0x83, 0x00, 0x03, 0xE2, 0xFF, 0xEF, 0x3B, 0x87, 0x00, 0xDC, 0x84, 0x00, 0x00, 0xF6, 0xC2, 0x00, 0x1A, 0x87, 0x00, 0xD9, 0x86, 0x00, 0x00, 0xF6, 0x80, 0xFF, 0x01, 0xCF, 0x02, 0x87, 0x00, 0xD8, 
+	0x86, 0x00, 0x05, 0xF6, 0xFF, 0xA8, 0xFF, 0xFF, 0x3E, 0x88, 0x00, 0xD6, 0x87, 0x00, 0x06, 0xF6, 0xFF, 0x03, 0xE5, 0xFF, 0xEF, 0x02, 0x88, 0x00, 0xD4, 0x88, 0x00, 0x06, 0xF6, 0xFF, 0x04, 0x10, 0xFC, 0xFF, 0x1C, 0x88, 0x00, 0xD3, 0x89, 0x00, 0x06, 0xF6, 0xFF, 0x04, 0x00, 0xC1, 0xFF, 0xAF, 0x89, 0x00, 
+	0xD2, 0x89, 0x00, 0x07, 0xF6, 0xFF, 0x04, 0x00, 0x20, 0xFD, 0xFF, 0x04, 0x88, 0x00, 0xD1, 0x8A, 0x00, 0x07, 0xF6, 0xFF, 0x04, 0x00, 0x00, 0xF4, 0xFF, 0x0C, 0x89, 0x00, 0xD0, 0x85, 0x00, 0x01, 0x81, 0x1A, 0x80, 0x00, 0x07, 0xF6, 0xFF, 0x04, 0x00, 0x00, 0x90, 0xFF, 0x6F, 0x89, 0x00, 0xCF, 0x85, 0x00, 
+	0x02, 0x71, 0xFD, 0x5F, 0x80, 0x00, 0x07, 0xF6, 0xFF, 0x04, 0x00, 0x00, 0x20, 0xFE, 0xDF, 0x8A, 0x00, 0xCE, 0x84, 0x00, 0x03, 0x71, 0xFE, 0xFF, 0xAF, 0x80, 0x00, 0x02, 0xF6, 0xFF, 0x04, 0x80, 0x00, 0x02, 0xF9, 0xFF, 0x04, 0x80, 0x00, 0x00, 0x22, 0x85, 0x00, 0xCD, 0x84, 0x00, 0x04, 0x50, 0xFE, 0xFF, 
+	0xFF, 0x7E, 0x80, 0x00, 0x02, 0xF6, 0xFF, 0x04, 0x80, 0x00, 0x02, 0xF2, 0xFF, 0x0A, 0x80, 0x00, 0x01, 0xEC, 0x04, 0x85, 0x00, 0xCC, 0x84, 0x00, 0x04, 0xF8, 0xFF, 0xFF, 0x7D, 0x01, 0x80, 0x00, 0x02, 0xF6, 0xFF, 0x04, 0x80, 0x00, 0x07, 0xB0, 0xFF, 0x1F, 0x00, 0x00, 0x60, 0xFF, 0x8F, 0x85, 0x00, 0xCB, 
+	0x84, 0x00, 0x04, 0xB2, 0xFF, 0xFF, 0x6D, 0x01, 0x81, 0x00, 0x02, 0xF6, 0xFF, 0x04, 0x80, 0x00, 0x08, 0x50, 0xFF, 0x6F, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0x3C, 0x85, 0x00, 0xCA, 0x83, 0x00, 0x04, 0x40, 0xFE, 0xFF, 0x9F, 0x01, 0x82, 0x00, 0x02, 0xF6, 0xFF, 0x04, 0x80, 0x00, 0x09, 0x10, 0xFE, 0x9F, 0x00, 
+	0x00, 0x10, 0xFA, 0xFF, 0xFF, 0x05, 0x84, 0x00, 0xCA, 0x83, 0x00, 0x03, 0xF6, 0xFF, 0xFF, 0x06, 0x83, 0x00, 0x02, 0xF6, 0xFF, 0x04, 0x81, 0x00, 0x01, 0xFB, 0xCF, 0x80, 0x00, 0x03, 0x60, 0xFE, 0xFF, 0x5F, 0x84, 0x00, 0xC9, 0x83, 0x00, 0x03, 0x60, 0xFF, 0xFF, 0x3C, 0x84, 0x00, 0x02, 0xF6, 0xFF, 0x04, 
+	0x81, 0x00, 0x02, 0xF8, 0xEF, 0x02, 0x80, 0x00, 0x03, 0xB2, 0xFF, 0xFF, 0x06, 0x84, 0x00, 0xC8, 0x83, 0x00, 0x02, 0xF5, 0xFF, 0x9F, 0x85, 0x00, 0x02, 0xF6, 0xFF, 0x04, 0x81, 0x00, 0x02, 0xF6, 0xFF, 0x04, 0x81, 0x00, 0x02, 0xFA, 0xFF, 0x6F, 0x84, 0x00, 0xC8, 0x82, 0x00, 0x03, 0x40, 0xFF, 0xFF, 0x09, 
+	0x80, 0x00, 0x01, 0x91, 0x0A, 0x80, 0x00, 0x02, 0xF6, 0xFF, 0x04, 0x81, 0x00, 0x02, 0xF4, 0xFF, 0x05, 0x81, 0x00, 0x03, 0xA0, 0xFF, 0xFF, 0x05, 0x83, 0x00, 0xC7, 0x83, 0x00, 0x02, 0xE3, 0xFF, 0xAF, 0x80, 0x00, 0x02, 0x50, 0xFD, 0x4F, 0x80, 0x00, 0x02, 0xF6, 0xFF, 0x04, 0x81, 0x00, 0x02, 0xF4, 0xFF, 
+	0x06, 0x82, 0x00, 0x02, 0xF9, 0xFF, 0x2E, 0x83, 0x00, 0xC7, 0x82, 0x00, 0x03, 0x10, 0xFD, 0xFF, 0x0A, 0x80, 0x00, 0x02, 0xF8, 0xFF, 0xCF, 0x80, 0x00, 0x02, 0xF6, 0xFF, 0x04, 0x81, 0x00, 0x02, 0xE3, 0xFF, 0x07, 0x82, 0x00, 0x02, 0x90, 0xFF, 0xCF, 0x84, 0x00, 0xC6, 0x82, 0x00, 0x02, 0x90, 0xFF, 0xBF, 
+	0x80, 0x00, 0x03, 0xA0, 0xFF, 0xFF, 0x6E, 0x80, 0x00, 0x02, 0xF6, 0xFF, 0x04, 0x81, 0x00, 0x02, 0xE3, 0xFF, 0x07, 0x83, 0x00, 0x02, 0xFC, 0xFF, 0x09, 0x83, 0x00, 0xC6, 0x82, 0x00, 0x09, 0xF4, 0xFF, 0x2E, 0x00, 0x00, 0x10, 0xFC, 0xFF, 0xAF, 0x01, 0x80, 0x00, 0x02, 0xF6, 0xFF, 0x04, 0x81, 0x00, 0x05, 
+	0xF3, 0xFF, 0x07, 0x00, 0x00, 0xBA, 0x80, 0x00, 0x02, 0xE3, 0xFF, 0x5F, 0x83, 0x00, 0xC5, 0x83, 0x00, 0x08, 0xFC, 0xFF, 0x06, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x07, 0x81, 0x00, 0x02, 0xF6, 0xFF, 0x04, 0x81, 0x00, 0x0C, 0xF4, 0xFF, 0x06, 0x00, 0x80, 0xFF, 0x0A, 0x00, 0x00, 0x50, 0xFF, 0xEF, 0x01, 0x82, 
+	0x00, 0xC5, 0x82, 0x00, 0x02, 0x70, 0xFF, 0xAF, 0x80, 0x00, 0x02, 0xFA, 0xFF, 0x5E, 0x82, 0x00, 0x02, 0xF6, 0xFF, 0x04, 0x81, 0x00, 0x06, 0xF6, 0xFF, 0x06, 0x00, 0xF2, 0xFF, 0x9F, 0x80, 0x00, 0x02, 0xF9, 0xFF, 0x08, 0x83, 0x00, 0xC4, 0x82, 0x00, 0x08, 0xE2, 0xFF, 0x2E, 0x00, 0x00, 0x90, 0xFF, 0xFF, 
+	0x04, 0x82, 0x00, 0x02, 0xF6, 0xFF, 0x04, 0x81, 0x00, 0x0C, 0xF7, 0xFF, 0x04, 0x00, 0x50, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0xE1, 0xFF, 0x2E, 0x83, 0x00, 0xC4, 0x82, 0x00, 0x07, 0xF9, 0xFF, 0x06, 0x00, 0x00, 0xF4, 0xFF, 0x5F, 0x83, 0x00, 0x02, 0xF6, 0xFF, 0x04, 0x81, 0x00, 0x0C, 0xF8, 0xEF, 0x02, 0x00, 
+	0x00, 0xF6, 0xFF, 0x4F, 0x00, 0x00, 0x70, 0xFF, 0x9F, 0x83, 0x00, 0xC3, 0x82, 0x00, 0x08, 0x20, 0xFE, 0xCF, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0x06, 0x83, 0x00, 0x02, 0xF6, 0xFF, 0x04, 0x81, 0x00, 0x01, 0xFB, 0xCF, 0x80, 0x00, 0x08, 0x80, 0xFF, 0xCF, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0x03, 0x82, 0x00, 0xC3, 
+	0x82, 0x00, 0x07, 0x60, 0xFF, 0x7F, 0x00, 0x00, 0x90, 0xFF, 0xAF, 0x84, 0x00, 0x02, 0xF6, 0xFF, 0x04, 0x80, 0x00, 0x02, 0x20, 0xFF, 0xAF, 0x81, 0x00, 0x07, 0xFA, 0xFF, 0x06, 0x00, 0x00, 0xF6, 0xFF, 0x07, 0x82, 0x00, 0xC3, 0x82, 0x00, 0x07, 0xC0, 0xFF, 0x1E, 0x00, 0x00, 0xF2, 0xFF, 0x1E, 0x84, 0x00, 
+	0x02, 0xF6, 0xFF, 0x03, 0x80, 0x00, 0x02, 0x60, 0xFF, 0x6F, 0x81, 0x00, 0x07, 0xE2, 0xFF, 0x1E, 0x00, 0x00, 0xD0, 0xFF, 0x0C, 0x82, 0x00, 0xC3, 0x82, 0x00, 0x07, 0xF3, 0xFF, 0x09, 0x00, 0x00, 0xFA, 0xFF, 0x05, 0x84, 0x00, 0x08, 0xF5, 0xFF, 0x79, 0x67, 0x14, 0x00, 0xC0, 0xFF, 0x1F, 0x81, 0x00, 0x07, 
+	0x70, 0xFF, 0x9F, 0x00, 0x00, 0x90, 0xFF, 0x3F, 0x83, 0x00, 0xC2, 0x82, 0x00, 0x06, 0xF8, 0xFF, 0x02, 0x00, 0x30, 0xFE, 0xCF, 0x85, 0x00, 0x00, 0xF6, 0x80, 0xFF, 0x04, 0xDF, 0x3A, 0xF2, 0xFF, 0x0C, 0x81, 0x00, 0x07, 0x10, 0xFD, 0xEF, 0x03, 0x00, 0x30, 0xFF, 0x9F, 0x83, 0x00, 0xC2, 0x82, 0x00, 0x06, 
+	0xFE, 0xCF, 0x00, 0x00, 0x80, 0xFF, 0x5F, 0x84, 0x00, 0x00, 0x81, 0x83, 0xFF, 0x02, 0xFD, 0xFF, 0x05, 0x82, 0x00, 0x06, 0xF5, 0xFF, 0x07, 0x00, 0x00, 0xFD, 0xEF, 0x83, 0x00, 0xC2, 0x81, 0x00, 0x07, 0x40, 0xFF, 0x8F, 0x00, 0x00, 0xC1, 0xFF, 0x1C, 0x83, 0x00, 0x05, 0x20, 0xFD, 0xFF, 0xFF, 0xEF, 0xFE, 
+	0x80, 0xFF, 0x01, 0xEF, 0x01, 0x82, 0x00, 0x07, 0xD1, 0xFF, 0x0B, 0x00, 0x00, 0xF7, 0xFF, 0x04, 0x82, 0x00, 0xC2, 0x81, 0x00, 0x07, 0x70, 0xFF, 0x4F, 0x00, 0x00, 0xF4, 0xFF, 0x08, 0x83, 0x00, 0x09, 0xE3, 0xFF, 0xFF, 0x6C, 0x34, 0x43, 0xC7, 0xFF, 0xFF, 0x8F, 0x83, 0x00, 0x07, 0x90, 0xFF, 0x3F, 0x00, 
+	0x00, 0xF3, 0xFF, 0x07, 0x82, 0x00, 0xC1, 0x82, 0x00, 0x07, 0x90, 0xFF, 0x2F, 0x00, 0x00, 0xF8, 0xFF, 0x04, 0x82, 0x00, 0x03, 0x10, 0xFD, 0xFF, 0x5E, 0x81, 0x00, 0x03, 0xE5, 0xFF, 0xCF, 0x01, 0x82, 0x00, 0x07, 0x50, 0xFF, 0x6F, 0x00, 0x00, 0xE1, 0xFF, 0x0A, 0x82, 0x00, 0xC1, 0x82, 0x00, 0x06, 0xC0, 
+	0xFF, 0x0B, 0x00, 0x00, 0xFB, 0xDF, 0x83, 0x00, 0x03, 0x90, 0xFF, 0xDF, 0x02, 0x81, 0x00, 0x03, 0x20, 0xFD, 0xFF, 0x09, 0x82, 0x00, 0x07, 0x10, 0xFD, 0xBF, 0x00, 0x00, 0xB0, 0xFF, 0x0C, 0x82, 0x00, 0xC1, 0x82, 0x00, 0x06, 0xD1, 0xFF, 0x08, 0x00, 0x10, 0xFE, 0xAF, 0x83, 0x00, 0x0B, 0xF2, 0xFF, 0x2E, 
+	0x00, 0x00, 0x52, 0x24, 0x00, 0x00, 0xF4, 0xFF, 0x3F, 0x83, 0x00, 0x06, 0xFA, 0xEF, 0x01, 0x00, 0x90, 0xFF, 0x2D, 0x82, 0x00, 0xC1, 0x82, 0x00, 0x06, 0xE3, 0xFF, 0x06, 0x00, 0x20, 0xFF, 0x7F, 0x83, 0x00, 0x0B, 0xFA, 0xFF, 0x05, 0x00, 0xA1, 0xFE, 0xEF, 0x1A, 0x00, 0x70, 0xFF, 0xAF, 0x83, 0x00, 0x06, 
+	0xF7, 0xFF, 0x01, 0x00, 0x60, 0xFF, 0x4F, 0x82, 0x00, 0xC1, 0x82, 0x00, 0x06, 0xF5, 0xFF, 0x05, 0x00, 0x50, 0xFF, 0x4F, 0x80, 0x00, 0x0F, 0x41, 0xB8, 0xED, 0xFF, 0xCF, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0xFC, 0xDF, 0x01, 0x82, 0x00, 0x06, 0xF6, 0xFF, 0x03, 0x00, 0x50, 0xFF, 0x5F, 0x82, 
+	0x00, 0xC1, 0x82, 0x00, 0x09, 0xF6, 0xFF, 0x05, 0x00, 0x60, 0xFF, 0x3F, 0x00, 0x30, 0xC7, 0x81, 0xFF, 0x02, 0x7F, 0x00, 0xA0, 0x81, 0xFF, 0x04, 0x0A, 0x00, 0xF8, 0xFF, 0x04, 0x82, 0x00, 0x06, 0xF4, 0xFF, 0x04, 0x00, 0x40, 0xFF, 0x5F, 0x82, 0x00, 0xC1, 0x82, 0x00, 0x08, 0xF6, 0xFF, 0x04, 0x00, 0x70, 
+	0xFF, 0x1F, 0x50, 0xFB, 0x82, 0xFF, 0x0B, 0x4F, 0x00, 0xE2, 0xFF, 0x6D, 0xD6, 0xFF, 0x2E, 0x00, 0xF6, 0xFF, 0x06, 0x82, 0x00, 0x06, 0xF3, 0xFF, 0x06, 0x00, 0x40, 0xFF, 0x6F, 0x82, 0x00, 0xC1, 0x82, 0x00, 0x07, 0xF6, 0xFF, 0x04, 0x00, 0x80, 0xFF, 0x5F, 0xFB, 0x81, 0xFF, 0x0D, 0xCB, 0xFF, 0x3E, 0x00, 
+	0xF5, 0xFF, 0x06, 0x60, 0xFF, 0x5F, 0x00, 0xF3, 0xFF, 0x07, 0x82, 0x00, 0x06, 0xF1, 0xFF, 0x07, 0x00, 0x30, 0xFF, 0x6F, 0x89, 0x00, 0x04, 0xF6, 0xEF, 0x03, 0x00, 0x80, 0x81, 0xFF, 0x10, 0xDF, 0x6A, 0x13, 0x70, 0xFF, 0x3E, 0x00, 0xF5, 0xFF, 0x06, 0x60, 0xFF, 0x5F, 0x00, 0xE3, 0xFF, 0x08, 0x86, 0x00, 
+	0x02, 0x30, 0xFE, 0x7F, 0x83, 0x00, 0xC0, 0x82, 0x00, 0x04, 0xF5, 0xFF, 0x03, 0x00, 0x70, 0x80, 0xFF, 0x11, 0xCF, 0x17, 0x00, 0x00, 0x60, 0xFF, 0x4F, 0x00, 0xE2, 0xFF, 0x6D, 0xD6, 0xFF, 0x2E, 0x00, 0xF4, 0xFF, 0x6D, 0x86, 0x00, 0x02, 0x30, 0xFE, 0x7F, 0x82, 0x00, 0xC1, 0x82, 0x00, 0x08, 0xF5, 0xFF, 
+	0x05, 0x00, 0xA0, 0xFF, 0xFF, 0xBF, 0x05, 0x80, 0x00, 0x04, 0x40, 0xFF, 0x7F, 0x00, 0xA0, 0x81, 0xFF, 0x05, 0x0A, 0x00, 0xF7, 0xFF, 0xFF, 0x4C, 0x85, 0x00, 0x02, 0x40, 0xFF, 0x6F, 0x82, 0x00, 0xC1, 0x82, 0x00, 0x07, 0xF5, 0xFF, 0x06, 0x00, 0xF9, 0xFF, 0xDF, 0x04, 0x81, 0x00, 0x0B, 0x10, 0xFD, 0xCF, 
+	0x00, 0x10, 0xFD, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0xFC, 0x80, 0xFF, 0x00, 0x2A, 0x84, 0x00, 0x02, 0x50, 0xFF, 0x4F, 0x82, 0x00, 0xC1, 0x82, 0x00, 0x06, 0xF4, 0xFF, 0x07, 0x90, 0xFF, 0xFF, 0x7F, 0x83, 0x00, 0x0F, 0xFA, 0xFF, 0x05, 0x00, 0xA1, 0xFE, 0xEF, 0x1A, 0x00, 0x50, 0xFF, 0xDF, 0xFE, 0xFF, 0xFF, 
+	0x17, 0x83, 0x00, 0x02, 0x70, 0xFF, 0x3E, 0x82, 0x00, 0xC1, 0x82, 0x00, 0x06, 0xD1, 0xFF, 0x09, 0xF9, 0xFF, 0xFF, 0xCF, 0x83, 0x00, 0x10, 0xF3, 0xFF, 0x2E, 0x00, 0x00, 0x52, 0x24, 0x00, 0x00, 0xE2, 0xFF, 0x3F, 0xB3, 0xFF, 0xFF, 0xDF, 0x06, 0x82, 0x00, 0x02, 0x90, 0xFF, 0x1D, 0x82, 0x00, 0xC1, 0x82, 
+	0x00, 0x07, 0xC0, 0xFF, 0x9B, 0xFF, 0xFF, 0xFD, 0xEF, 0x02, 0x82, 0x00, 0x03, 0x90, 0xFF, 0xCF, 0x02, 0x81, 0x00, 0x09, 0x20, 0xFD, 0xFF, 0x0A, 0x00, 0xD5, 0xFF, 0xFF, 0xBF, 0x03, 0x81, 0x00, 0x02, 0x90, 0xFF, 0x0D, 0x82, 0x00, 0xC1, 0x82, 0x00, 0x00, 0x90, 0x80, 0xFF, 0x03, 0x4F, 0xF6, 0xFF, 0x05, 
+	0x82, 0x00, 0x03, 0x20, 0xFF, 0xFF, 0x5E, 0x81, 0x00, 0x0A, 0xE5, 0xFF, 0xDF, 0x01, 0x00, 0x00, 0xE7, 0xFF, 0xFF, 0x9F, 0x02, 0x81, 0x00, 0x01, 0x51, 0x05, 0x82, 0x00, 0xC2, 0x81, 0x00, 0x00, 0x60, 0x80, 0xFF, 0x03, 0x06, 0xF3, 0xFF, 0x09, 0x82, 0x00, 0x00, 0xC5, 0x80, 0xFF, 0x06, 0x7C, 0x34, 0x43, 
+	0xC7, 0xFF, 0xFF, 0x3E, 0x80, 0x00, 0x04, 0x20, 0xF9, 0xFF, 0xFF, 0x7E, 0x88, 0x00, 0xC2, 0x81, 0x00, 0x07, 0x30, 0xFF, 0xFF, 0x8F, 0x00, 0xB0, 0xFF, 0x1D, 0x81, 0x00, 0x00, 0xB3, 0x83, 0xFF, 0x04, 0xFE, 0xFF, 0xFF, 0xDF, 0x03, 0x81, 0x00, 0x04, 0x40, 0xFB, 0xFF, 0xFF, 0x5C, 0x87, 0x00, 0xC2, 0x82, 
+	0x00, 0x06, 0xFE, 0xFF, 0x0C, 0x00, 0x80, 0xFF, 0x7F, 0x80, 0x00, 0x00, 0x91, 0x80, 0xFF, 0x01, 0x88, 0xFE, 0x82, 0xFF, 0x00, 0x19, 0x83, 0x00, 0x04, 0x50, 0xFD, 0xFF, 0xFF, 0x3B, 0x86, 0x00, 0xC2, 0x81, 0x00, 0x11, 0x10, 0xFE, 0xFF, 0x04, 0x00, 0x20, 0xFE, 0xEF, 0x01, 0x00, 0x60, 0xFE, 0xFF, 0xFF, 
+	0x2A, 0x00, 0x81, 0xED, 0x81, 0xFF, 0x00, 0x05, 0x84, 0x00, 0x04, 0x80, 0xFE, 0xFF, 0xFF, 0x18, 0x85, 0x00, 0xC2, 0x81, 0x00, 0x0D, 0x80, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0xF9, 0xFF, 0x08, 0x50, 0xFC, 0xFF, 0xFF, 0x4C, 0x80, 0x00, 0x05, 0x31, 0x75, 0x57, 0xF8, 0xFF, 0x4F, 0x85, 0x00, 0x04, 0xA2, 0xFF, 
+	0xFF, 0xEF, 0x06, 0x84, 0x00, 0xC2, 0x81, 0x00, 0x0C, 0xC0, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0xE1, 0xFF, 0x4E, 0xFA, 0xFF, 0xFF, 0x6E, 0x84, 0x00, 0x03, 0xA0, 0xFF, 0xEF, 0x03, 0x85, 0x00, 0x04, 0xC4, 0xFF, 0xFF, 0xCF, 0x04, 0x82, 0x00, 0xC3, 0x81, 0x00, 0x06, 0xF4, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x70, 
+	0x81, 0xFF, 0x01, 0x8F, 0x01, 0x84, 0x00, 0x03, 0x10, 0xFD, 0xFF, 0x2D, 0x86, 0x00, 0x04, 0xE6, 0xFF, 0xFF, 0xAF, 0x02, 0x81, 0x00, 0xC3, 0x81, 0x00, 0x0B, 0xF9, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x10, 0xFE, 0xFF, 0xFF, 0xAF, 0x03, 0x86, 0x00, 0x03, 0xE2, 0xFF, 0xDF, 0x03, 0x85, 0x00, 0x05, 0x10, 0xF8, 
+	0xFF, 0xFF, 0x8F, 0x01, 0x80, 0x00, 0xC4, 0x80, 0x00, 0x0A, 0xFB, 0xCF, 0xFA, 0xFF, 0x07, 0x00, 0xB4, 0xFF, 0xFF, 0xDF, 0x04, 0x87, 0x00, 0x03, 0x30, 0xFE, 0xFF, 0x7F, 0x86, 0x00, 0x04, 0x30, 0xFA, 0xFF, 0xFF, 0x6D, 0x80, 0x00, 0xC4, 0x08, 0x00, 0x00, 0x10, 0xFD, 0xAF, 0xE0, 0xFF, 0x1E, 0xA1, 0x81, 
+	0xFF, 0x00, 0x04, 0x88, 0x00, 0x03, 0xE3, 0xFF, 0xFF, 0x1A, 0x86, 0x00, 0x05, 0x40, 0xFD, 0xFF, 0xFF, 0x05, 0x00, 0xC5, 0x0D, 0x00, 0x00, 0x30, 0xFF, 0x8F, 0x80, 0xFF, 0xCF, 0xFE, 0xFF, 0xFF, 0xFD, 0xFF, 0x6F, 0x88, 0x00, 0x04, 0x20, 0xFC, 0xFF, 0xDF, 0x05, 0x86, 0x00, 0x04, 0x70, 0xFF, 0xFF, 0x09, 
+	0x00, 0xC5, 0x06, 0x00, 0x00, 0x30, 0xFF, 0x7F, 0x00, 0xFD, 0x80, 0xFF, 0x04, 0x3B, 0xA0, 0xFF, 0xFF, 0x07, 0x88, 0x00, 0x04, 0xA1, 0xFF, 0xFF, 0xCF, 0x16, 0x85, 0x00, 0x04, 0xA3, 0xFF, 0xFF, 0x03, 0x00, 0xC6, 0x0E, 0x00, 0x30, 0xFF, 0x7F, 0x30, 0xFD, 0xFF, 0xFF, 0x5D, 0x00, 0x00, 0xFA, 0xFF, 0xBF, 
+	0x02, 0x88, 0x00, 0x04, 0xE6, 0xFF, 0xFF, 0xDF, 0x49, 0x83, 0x00, 0x04, 0x81, 0xFF, 0xFF, 0x6F, 0x00, 0xC7, 0x0E, 0x00, 0x20, 0xFE, 0xAF, 0xF8, 0xFF, 0xFF, 0xEF, 0x02, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x6E, 0x88, 0x00, 0x01, 0x10, 0xFA, 0x80, 0xFF, 0x0A, 0xBE, 0x68, 0x23, 0x22, 0x52, 0xC9, 0xFE, 0xFF, 
+	0xFF, 0x08, 0x00, 0xC7, 0x02, 0x00, 0x10, 0xFD, 0x82, 0xFF, 0x00, 0x0A, 0x80, 0x00, 0x04, 0xF7, 0xFF, 0xFF, 0x6D, 0x01, 0x87, 0x00, 0x01, 0x30, 0xFA, 0x87, 0xFF, 0x00, 0x5E, 0x80, 0x00, 0xC6, 0x08, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xBF, 0xE6, 0xFF, 0xAF, 0x80, 0x00, 0x05, 0x40, 0xFD, 0xFF, 0xFF, 0x8C, 
+	0x04, 0x83, 0x00, 0x05, 0x40, 0x02, 0x00, 0x00, 0x30, 0xC8, 0x85, 0xFF, 0x01, 0x8E, 0x02, 0x80, 0x00, 0xC7, 0x08, 0x00, 0xF4, 0xFF, 0xEF, 0x06, 0x40, 0xFF, 0xFF, 0x0A, 0x80, 0x00, 0x00, 0x81, 0x80, 0xFF, 0x08, 0xDF, 0x8A, 0x25, 0x12, 0x11, 0x53, 0xA6, 0xFD, 0x08, 0x80, 0x00, 0x02, 0x10, 0x83, 0xEB, 
+	0xC3, 0x02, 0xEF, 0x5B, 0x01, 0x80, 0x00, 0xC8, 0x08, 0x00, 0x90, 0xEF, 0x18, 0x00, 0x00, 0xF4, 0xFF, 0xAF, 0x81, 0x00, 0x01, 0x92, 0xFE, 0x86, 0xFF, 0x00, 0x0C, 0x83, 0x00, 0x04, 0x42, 0x65, 0x77, 0x47, 0x02, 0x82, 0x00, 0xC8, 0x02, 0x00, 0x00, 0x24, 0x80, 0x00, 0x03, 0x50, 0xFF, 0xFF, 0x3C, 0x81, 
+	0x00, 0x01, 0x83, 0xFC, 0x85, 0xFF, 0x00, 0x3F, 0x8D, 0x00, 0xC9, 0x83, 0x00, 0x03, 0xF5, 0xFF, 0xFF, 0x06, 0x81, 0x00, 0x02, 0x40, 0xB8, 0xFE, 0xC4, 0x01, 0x7B, 0x14, 0x8C, 0x00, 0xCA, 0x83, 0x00, 0x04, 0x50, 0xFE, 0xFF, 0xAF, 0x01, 0x82, 0x00, 0x05, 0x21, 0x65, 0x77, 0x88, 0x46, 0x12, 0x8E, 0x00, 
+	0xCA, 0x84, 0x00, 0x04, 0xB2, 0xFF, 0xFF, 0x6E, 0x01, 0x8B, 0x00, 0x01, 0x10, 0x16, 0x88, 0x00, 0xCB, 0x84, 0x00, 0x04, 0xF8, 0xFF, 0xFF, 0x7D, 0x01, 0x89, 0x00, 0x02, 0x10, 0xD7, 0x9F, 0x87, 0x00, 0xCC, 0x84, 0x00, 0x05, 0x40, 0xFD, 0xFF, 0xFF, 0x8E, 0x02, 0x87, 0x00, 0x04, 0x20, 0xE9, 0xFF, 0xFF, 
+	0x04, 0x86, 0x00, 0xCD, 0x84, 0x00, 0x06, 0x81, 0xFE, 0xFF, 0xFF, 0xDF, 0x48, 0x01, 0xC5, 0x06, 0x10, 0x84, 0xFC, 0xFF, 0xFF, 0xEF, 0x07, 0x85, 0x00, 0xCE, 0x85, 0x00, 0x01, 0x81, 0xFD, 0x80, 0xFF, 0x07, 0xAE, 0x78, 0x55, 0x34, 0x43, 0x55, 0x86, 0xEB, 0x80, 0xFF, 0x01, 0xDF, 0x28, 0x86, 0x00, 0xCF, 
+	0x85, 0x00, 0x01, 0x71, 0xFD, 0xC1, 0x80, 0xFF, 0x01, 0xEF, 0xFE, 0x82, 0xFF, 0x01, 0xDF, 0x16, 0x86, 0x00, 0xD0, 0x86, 0x00, 0x01, 0x41, 0xD8, 0xC3, 0x83, 0xFF, 0x01, 0x9D, 0x15, 0x87, 0x00, 0xD1, 0x87, 0x00, 0x02, 0x72, 0xCB, 0xED, 0xC3, 0x02, 0xEE, 0xAD, 0x26, 0x88, 0x00, 0xD2, 0x89, 0x00, 0x05, 
+	0x31, 0x54, 0x76, 0x67, 0x45, 0x23, 0x8A, 0x00, 0xD3, 0x9A, 0x00, 0xD5, 0x99, 0x00, 0xD6, 0x97, 0x00, 0xD7, 0x96, 0x00, 0xDA, 0x93, 0x00, 0xDC, 0x92, 0x00, 0xDD, 0x8F, 0x00, 0xE0, 0x8E, 0x00, 0xE3, 0x89, 0x00, 0xFF, 0xFF, 0xE6, 
 	};
+const Icon fanon_icon = {fanon_width, fanon_height, sizeof(fanon_data), fanon_data, &fanoff_icon};
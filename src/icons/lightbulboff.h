@@ -1,104 +1,49 @@
+#pragma once
 const uint32_t lightbulboff_width = 100;
 const uint32_t lightbulboff_height = 100;
-const uint8_t lightbulboff_data[(100*100)/2] = {
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8E, 0x14, 0x41, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x03, 0x00, 0x00, 0x30, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x94, 0x49, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x70, 0xFF, 0xFF, 0x07, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0xF1, 0xFF, 0xFF, 0x1F, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xF4, 0xFF, 0xFF, 0x4F, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xF5, 0xFF, 0xFF, 0x5F, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xF5, 0xFF, 0xFF, 0x5F, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xF5, 0xFF, 0xFF, 0x5F, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xF5, 0xFF, 0xFF, 0x5F, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xF5, 0xFF, 0xFF, 0x5F, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0x02, 0x10, 0x93, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xF5, 0xFF, 0xFF, 0x5F, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x39, 0x01, 0x20, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02, 0x00, 0x00, 0x00, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xF5, 0xFF, 0xFF, 0x5F, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0x00, 0x00, 0x00, 0x20, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0x00, 0x01, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xF5, 0xFF, 0xFF, 0x5F, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0x10, 0x00, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xC5, 0xAD, 0x03, 0x00, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xF3, 0xFF, 0xFF, 0x3F, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x30, 0xDA, 0x5C, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x02, 0x50, 0xFF, 0xFF, 0x4E, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xD1, 0xFF, 0xFF, 0x1D, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0xE4, 0xFF, 0xFF, 0x05, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x30, 0xFD, 0xDF, 0x03, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x40, 0x04, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x6A, 0xA6, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0xF4, 0xFF, 0xFF, 0x4F, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x8B, 0x36, 0x11, 0x22, 0x43, 0xB8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xF4, 0xFF, 0xFF, 0x4F, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x40, 0xFD, 0xFF, 0x08, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x9D, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0xD8, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x80, 0xFF, 0xDF, 0x04, 0x00, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0x61, 0x47, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0x5C, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xD6, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0x74, 0x16, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0x7E, 0x00, 0x00, 0x00, 0x20, 0x75, 0xA8, 0x9A, 0x58, 0x02, 0x00, 0x00, 0x00, 0xE6, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x05, 0x00, 0x00, 0x20, 0xFB, 0xFF, 0xFF, 0xAF, 0x02, 0x00, 0x10, 0x95, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x49, 0x00, 0x00, 0x20, 0xFB, 0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x00, 0x60, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x46, 0x53, 0xE8, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0xC6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7C, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x9E, 0x46, 0x75, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4D, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x20, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x02, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3D, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x02, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x9C, 0x56, 0x55, 0x55, 0x55, 0x75, 0xDA, 0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xAD, 0x57, 0x55, 0x55, 0x55, 0x65, 0xC9, 0xFF, 0xFF, 
-	0xFF, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xAF, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0xFB, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 
-	0xCF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x7F, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xF8, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFC, 
-	0x3E, 0x00, 0x10, 0x54, 0x55, 0x55, 0x55, 0x35, 0x01, 0x00, 0xF7, 0xFF, 0x5F, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xF4, 0xFF, 0x7F, 0x00, 0x10, 0x53, 0x55, 0x55, 0x55, 0x45, 0x01, 0x00, 0xE3, 
-	0x09, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3D, 0x00, 0xD0, 0xFF, 0x4F, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xF3, 0xFF, 0x0D, 0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x80, 
-	0x04, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0xA0, 0xFF, 0x2F, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0xF3, 0xFF, 0x0A, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x40, 
-	0x01, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x60, 0xFF, 0x1F, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0xF3, 0xFF, 0x06, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x10, 
-	0x01, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x60, 0xFF, 0x1F, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0xF2, 0xFF, 0x06, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x10, 
-	0x04, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0xA0, 0xFF, 0x2F, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0xF2, 0xFF, 0x0A, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x40, 
-	0x09, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3D, 0x00, 0xD0, 0xFF, 0x4F, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xF2, 0xFF, 0x0D, 0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x80, 
-	0x3E, 0x00, 0x10, 0x54, 0x55, 0x55, 0x55, 0x35, 0x01, 0x00, 0xF7, 0xFF, 0x5F, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xF5, 0xFF, 0x7F, 0x00, 0x10, 0x53, 0x55, 0x55, 0x55, 0x45, 0x01, 0x00, 0xE3, 
-	0xCF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x7F, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0xF8, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFC, 
-	0xFF, 0x4D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xAF, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0xFC, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 
-	0xFF, 0xFF, 0x9C, 0x56, 0x55, 0x55, 0x55, 0x75, 0xDA, 0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0xAD, 0x57, 0x55, 0x55, 0x55, 0x65, 0xC9, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x58, 0x74, 0xF9, 0xFF, 0xFF, 0xCF, 0x01, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x10, 0xFD, 0xFF, 0xFF, 0x9F, 0x47, 0x85, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x30, 0xFB, 0xFF, 0xFF, 0x08, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x90, 0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x2F, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xF3, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0x62, 0x47, 0x00, 0x20, 0xFE, 0xFF, 0x9F, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0xFA, 0xFF, 0xEF, 0x02, 0x00, 0x74, 0x26, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x40, 0xFE, 0xFF, 0x08, 0x00, 0xF8, 0xFF, 0xEF, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0xFE, 0xFF, 0x8F, 0x00, 0x80, 0xFF, 0xEF, 0x04, 0x00, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0xF4, 0xFF, 0xFF, 0x4F, 0x00, 0xF6, 0xFF, 0xFF, 0x04, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x50, 0xFF, 0xFF, 0x6F, 0x00, 0xF4, 0xFF, 0xFF, 0x4F, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xF4, 0xFF, 0xFF, 0x07, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x80, 0xFF, 0xFF, 0x4F, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xF4, 0xFF, 0xFF, 0x09, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x90, 0xFF, 0xFF, 0x4F, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0xF7, 0xFF, 0xFF, 0x0A, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0xA0, 0xFF, 0xFF, 0x7F, 0x00, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0xFB, 0xFF, 0xFF, 0x0B, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xB0, 0xFF, 0xFF, 0xBF, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x0B, 0x10, 0xDC, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xDD, 0xCD, 0x01, 0xB0, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0xE3, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xE1, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE3, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x02, 0x50, 0xFF, 0xFF, 0x4F, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x30, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x03, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0xE4, 0xFF, 0xFF, 0x05, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xB5, 0xAD, 0x03, 0x00, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x30, 0xDA, 0x5B, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0x00, 0x01, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0x10, 0x00, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02, 0x00, 0x00, 0x00, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0x00, 0x00, 0x00, 0x10, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6E, 0x02, 0x00, 0x93, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x00, 0x10, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xDB, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xBC, 0xDC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0xE9, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x9E, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x00, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0x50, 0x9A, 0xAA, 0xAA, 0xA9, 0x05, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xD3, 0xFF, 0xFF, 0x3D, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x10, 0x96, 0x69, 0x01, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0x00, 0x00, 0x00, 0x00, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7C, 0x14, 0x41, 0xC7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+const uint8_t lightbulboff_data[2121] = { // run length encoded
+0x94, 0xFF, 0x03, 0x8E, 0x14, 0x41, 0xE8, 0xAA, 0xFF, 0x05, 0xCF, 0x03, 0x00, 0x00, 0x30, 0xFC, 0xA9, 0xFF, 0x00, 0x1D, 0x81, 0x00, 0x00, 0xD1, 0xA9, 0xFF, 0x05, 0x04, 0x00, 0x94, 0x49, 0x00, 0x40, 0xA8, 0xFF, 0x07, 0xCF, 0x00, 0x70, 0xFF, 0xFF, 0x07, 0x00, 0xFC, 0xA7, 0xFF, 0x07, 0x9F, 0x00, 0xF1, 
+	0xFF, 0xFF, 0x1F, 0x00, 0xF9, 0xA7, 0xFF, 0x07, 0x6F, 0x00, 0xF4, 0xFF, 0xFF, 0x4F, 0x00, 0xF6, 0xA7, 0xFF, 0x07, 0x5F, 0x00, 0xF5, 0xFF, 0xFF, 0x5F, 0x00, 0xF5, 0xA7, 0xFF, 0x07, 0x5F, 0x00, 0xF5, 0xFF, 0xFF, 0x5F, 0x00, 0xF5, 0xA7, 0xFF, 0x07, 0x5F, 0x00, 0xF5, 0xFF, 0xFF, 0x5F, 0x00, 0xF5, 0xA7, 
+	0xFF, 0x07, 0x5F, 0x00, 0xF5, 0xFF, 0xFF, 0x5F, 0x00, 0xF5, 0x9A, 0xFF, 0x01, 0xCE, 0xDC, 0x88, 0xFF, 0x07, 0x5F, 0x00, 0xF5, 0xFF, 0xFF, 0x5F, 0x00, 0xF5, 0x88, 0xFF, 0x01, 0xCD, 0xEC, 0x8C, 0xFF, 0x03, 0x7E, 0x02, 0x10, 0x93, 0x87, 0xFF, 0x07, 0x5F, 0x00, 0xF5, 0xFF, 0xFF, 0x5F, 0x00, 0xF5, 0x87, 
+	0xFF, 0x03, 0x39, 0x01, 0x20, 0xE7, 0x8A, 0xFF, 0x01, 0xBF, 0x02, 0x80, 0x00, 0x00, 0xE4, 0x86, 0xFF, 0x07, 0x5F, 0x00, 0xF5, 0xFF, 0xFF, 0x5F, 0x00, 0xF5, 0x86, 0xFF, 0x00, 0x4E, 0x80, 0x00, 0x01, 0x20, 0xFB, 0x89, 0xFF, 0x06, 0x2E, 0x00, 0x00, 0x01, 0x00, 0x30, 0xFE, 0x85, 0xFF, 0x07, 0x5F, 0x00, 
+	0xF5, 0xFF, 0xFF, 0x5F, 0x00, 0xF5, 0x85, 0xFF, 0x06, 0xEF, 0x03, 0x00, 0x10, 0x00, 0x00, 0xE2, 0x89, 0xFF, 0x06, 0x06, 0x00, 0xC5, 0xAD, 0x03, 0x00, 0xE3, 0x85, 0xFF, 0x07, 0x7F, 0x00, 0xF3, 0xFF, 0xFF, 0x3F, 0x00, 0xF7, 0x85, 0xFF, 0x06, 0x3E, 0x00, 0x30, 0xDA, 0x5C, 0x00, 0x60, 0x88, 0xFF, 0x08, 
+	0xEF, 0x02, 0x50, 0xFF, 0xFF, 0x4E, 0x00, 0x30, 0xFE, 0x84, 0xFF, 0x07, 0xAF, 0x00, 0xD1, 0xFF, 0xFF, 0x1D, 0x00, 0xFA, 0x84, 0xFF, 0x08, 0xEF, 0x03, 0x00, 0xE4, 0xFF, 0xFF, 0x05, 0x20, 0xFE, 0x87, 0xFF, 0x02, 0xCF, 0x00, 0xC0, 0x80, 0xFF, 0x02, 0x04, 0x00, 0xE3, 0x84, 0xFF, 0x07, 0xDF, 0x00, 0x30, 
+	0xFD, 0xDF, 0x03, 0x00, 0xFD, 0x84, 0xFF, 0x02, 0x3E, 0x00, 0x40, 0x80, 0xFF, 0x02, 0x0C, 0x00, 0xFC, 0x87, 0xFF, 0x02, 0xBF, 0x00, 0xD1, 0x80, 0xFF, 0x03, 0x4F, 0x00, 0x30, 0xFE, 0x84, 0xFF, 0x05, 0x07, 0x00, 0x40, 0x04, 0x00, 0x70, 0x84, 0xFF, 0x03, 0xEF, 0x03, 0x00, 0xF4, 0x80, 0xFF, 0x02, 0x1D, 
+	0x00, 0xFB, 0x87, 0xFF, 0x02, 0xDF, 0x00, 0xA0, 0x81, 0xFF, 0x02, 0x04, 0x00, 0xE3, 0x84, 0xFF, 0x00, 0x4F, 0x81, 0x00, 0x00, 0xF4, 0x84, 0xFF, 0x02, 0x3E, 0x00, 0x40, 0x81, 0xFF, 0x02, 0x0A, 0x00, 0xFD, 0x87, 0xFF, 0x03, 0xEF, 0x03, 0x30, 0xFE, 0x80, 0xFF, 0x02, 0x4F, 0x00, 0x50, 0x85, 0xFF, 0x03, 
+	0x07, 0x00, 0x00, 0x70, 0x85, 0xFF, 0x02, 0x06, 0x00, 0xF4, 0x80, 0xFF, 0x03, 0xEF, 0x03, 0x30, 0xFE, 0x88, 0xFF, 0x02, 0x09, 0x00, 0xF4, 0x81, 0xFF, 0x02, 0x04, 0x00, 0xFB, 0x84, 0xFF, 0x03, 0xDF, 0x6A, 0xA6, 0xFD, 0x84, 0xFF, 0x02, 0xBF, 0x00, 0x40, 0x81, 0xFF, 0x02, 0x4F, 0x00, 0x90, 0x89, 0xFF, 
+	0x02, 0x4F, 0x00, 0x40, 0x81, 0xFF, 0x02, 0x1E, 0x00, 0xF6, 0x8F, 0xFF, 0x02, 0x7F, 0x00, 0xE1, 0x81, 0xFF, 0x02, 0x04, 0x00, 0xF4, 0x89, 0xFF, 0x03, 0xEF, 0x03, 0x00, 0xF4, 0x80, 0xFF, 0x02, 0x6F, 0x00, 0xF4, 0x8F, 0xFF, 0x02, 0x5F, 0x00, 0xF6, 0x80, 0xFF, 0x03, 0x4F, 0x00, 0x30, 0xFE, 0x8A, 0xFF, 
+	0x02, 0x3E, 0x00, 0x40, 0x80, 0xFF, 0x02, 0x7F, 0x00, 0xE3, 0x8F, 0xFF, 0x02, 0x4F, 0x00, 0xF7, 0x80, 0xFF, 0x02, 0x04, 0x00, 0xE3, 0x8B, 0xFF, 0x08, 0xEF, 0x03, 0x00, 0xF4, 0xFF, 0xFF, 0x4F, 0x00, 0xF5, 0x82, 0xFF, 0x07, 0xDF, 0x8B, 0x36, 0x11, 0x22, 0x43, 0xB8, 0xFD, 0x82, 0xFF, 0x08, 0x6F, 0x00, 
+	0xF4, 0xFF, 0xFF, 0x4F, 0x00, 0x30, 0xFE, 0x8C, 0xFF, 0x07, 0x3E, 0x00, 0x40, 0xFD, 0xFF, 0x08, 0x00, 0xF8, 0x81, 0xFF, 0x01, 0x9D, 0x04, 0x83, 0x00, 0x01, 0x41, 0xD8, 0x81, 0xFF, 0x07, 0x9F, 0x00, 0x80, 0xFF, 0xDF, 0x04, 0x00, 0xE3, 0x8D, 0xFF, 0x07, 0xEF, 0x03, 0x00, 0x61, 0x47, 0x00, 0x20, 0xFE, 
+	0x80, 0xFF, 0x01, 0x5C, 0x01, 0x85, 0x00, 0x01, 0x10, 0xD6, 0x80, 0xFF, 0x07, 0xEF, 0x03, 0x00, 0x74, 0x16, 0x00, 0x30, 0xFE, 0x8E, 0xFF, 0x00, 0x3E, 0x81, 0x00, 0x00, 0xB0, 0x80, 0xFF, 0x00, 0x7E, 0x80, 0x00, 0x05, 0x20, 0x75, 0xA8, 0x9A, 0x58, 0x02, 0x80, 0x00, 0x00, 0xE6, 0x80, 0xFF, 0x00, 0x0B, 
+	0x81, 0x00, 0x00, 0xE3, 0x8F, 0xFF, 0x0D, 0xEF, 0x05, 0x00, 0x00, 0x20, 0xFB, 0xFF, 0xFF, 0xAF, 0x02, 0x00, 0x10, 0x95, 0xFD, 0x81, 0xFF, 0x0D, 0xDF, 0x49, 0x00, 0x00, 0x20, 0xFB, 0xFF, 0xFF, 0xBF, 0x03, 0x00, 0x00, 0x60, 0xFE, 0x90, 0xFF, 0x03, 0xBF, 0x46, 0x53, 0xE8, 0x80, 0xFF, 0x03, 0x08, 0x00, 
+	0x00, 0xC6, 0x85, 0xFF, 0x03, 0x7C, 0x00, 0x00, 0x70, 0x80, 0xFF, 0x03, 0x9E, 0x46, 0x75, 0xFB, 0x93, 0xFF, 0x00, 0xFE, 0x80, 0xFF, 0x03, 0x6F, 0x00, 0x00, 0xD5, 0x87, 0xFF, 0x03, 0x4D, 0x00, 0x00, 0xF5, 0x9D, 0xFF, 0x02, 0x04, 0x00, 0x90, 0x89, 0xFF, 0x02, 0x1A, 0x00, 0x50, 0x9C, 0xFF, 0x03, 0x5F, 
+	0x00, 0x20, 0xFC, 0x89, 0xFF, 0x03, 0xCF, 0x02, 0x00, 0xF5, 0x9B, 0xFF, 0x02, 0x08, 0x00, 0xE2, 0x8B, 0xFF, 0x02, 0x3D, 0x00, 0x70, 0x9A, 0xFF, 0x03, 0xBF, 0x00, 0x10, 0xFD, 0x8B, 0xFF, 0x03, 0xDF, 0x02, 0x00, 0xFB, 0x99, 0xFF, 0x02, 0x1E, 0x00, 0xC1, 0x8D, 0xFF, 0x02, 0x1C, 0x00, 0xE2, 0x99, 0xFF, 
+	0x02, 0x06, 0x00, 0xF9, 0x8D, 0xFF, 0x02, 0xAF, 0x00, 0x60, 0x98, 0xFF, 0x02, 0xDF, 0x01, 0x40, 0x8F, 0xFF, 0x02, 0x04, 0x00, 0xFC, 0x97, 0xFF, 0x02, 0x6F, 0x00, 0xC0, 0x8F, 0xFF, 0x02, 0x0D, 0x00, 0xF6, 0x97, 0xFF, 0x02, 0x1C, 0x00, 0xF7, 0x8F, 0xFF, 0x02, 0x7F, 0x00, 0xD2, 0x97, 0xFF, 0x02, 0x08, 
+	0x10, 0xFC, 0x8F, 0xFF, 0x02, 0xCF, 0x00, 0x80, 0x97, 0xFF, 0x01, 0x05, 0x40, 0x91, 0xFF, 0x01, 0x04, 0x40, 0x8C, 0xFF, 0x01, 0x9C, 0x56, 0x80, 0x55, 0x01, 0x75, 0xDA, 0x80, 0xFF, 0x02, 0xDF, 0x01, 0x80, 0x91, 0xFF, 0x02, 0x09, 0x00, 0xFD, 0x80, 0xFF, 0x01, 0xAD, 0x57, 0x80, 0x55, 0x01, 0x65, 0xC9, 
+	0x80, 0xFF, 0x00, 0x4D, 0x84, 0x00, 0x05, 0xF7, 0xFF, 0xFF, 0xAF, 0x00, 0xD0, 0x91, 0xFF, 0x05, 0x0D, 0x00, 0xFB, 0xFF, 0xFF, 0x7F, 0x84, 0x00, 0x03, 0xD4, 0xFF, 0xCF, 0x01, 0x84, 0x00, 0x05, 0x40, 0xFF, 0xFF, 0x7F, 0x00, 0xF2, 0x91, 0xFF, 0x05, 0x2F, 0x00, 0xF8, 0xFF, 0xFF, 0x04, 0x84, 0x00, 0x05, 
+	0x10, 0xFC, 0x3E, 0x00, 0x10, 0x54, 0x80, 0x55, 0x07, 0x35, 0x01, 0x00, 0xF7, 0xFF, 0x5F, 0x00, 0xF4, 0x91, 0xFF, 0x07, 0x5F, 0x00, 0xF4, 0xFF, 0x7F, 0x00, 0x10, 0x53, 0x80, 0x55, 0x06, 0x45, 0x01, 0x00, 0xE3, 0x09, 0x00, 0xF7, 0x82, 0xFF, 0x06, 0x3D, 0x00, 0xD0, 0xFF, 0x4F, 0x00, 0xF6, 0x91, 0xFF, 
+	0x06, 0x7F, 0x00, 0xF3, 0xFF, 0x0D, 0x00, 0xD3, 0x82, 0xFF, 0x04, 0x7F, 0x00, 0x80, 0x04, 0x40, 0x83, 0xFF, 0x06, 0xDF, 0x00, 0xA0, 0xFF, 0x2F, 0x00, 0xF8, 0x91, 0xFF, 0x06, 0x8F, 0x00, 0xF3, 0xFF, 0x0A, 0x00, 0xFD, 0x83, 0xFF, 0x03, 0x04, 0x40, 0x01, 0x90, 0x84, 0xFF, 0x05, 0x04, 0x60, 0xFF, 0x1F, 
+	0x00, 0xFA, 0x91, 0xFF, 0x05, 0x8F, 0x00, 0xF3, 0xFF, 0x06, 0x40, 0x84, 0xFF, 0x03, 0x09, 0x10, 0x01, 0x90, 0x84, 0xFF, 0x05, 0x04, 0x60, 0xFF, 0x1F, 0x00, 0xF9, 0x91, 0xFF, 0x05, 0x8F, 0x00, 0xF2, 0xFF, 0x06, 0x40, 0x84, 0xFF, 0x03, 0x09, 0x10, 0x04, 0x40, 0x83, 0xFF, 0x06, 0xDF, 0x00, 0xA0, 0xFF, 
+	0x2F, 0x00, 0xF7, 0x91, 0xFF, 0x06, 0x8F, 0x00, 0xF2, 0xFF, 0x0A, 0x00, 0xFD, 0x83, 0xFF, 0x04, 0x04, 0x40, 0x09, 0x00, 0xF7, 0x82, 0xFF, 0x06, 0x3D, 0x00, 0xD0, 0xFF, 0x4F, 0x00, 0xF6, 0x91, 0xFF, 0x06, 0x7F, 0x00, 0xF2, 0xFF, 0x0D, 0x00, 0xD3, 0x82, 0xFF, 0x06, 0x7F, 0x00, 0x80, 0x3E, 0x00, 0x10, 
+	0x54, 0x80, 0x55, 0x07, 0x35, 0x01, 0x00, 0xF7, 0xFF, 0x5F, 0x00, 0xF5, 0x91, 0xFF, 0x07, 0x4F, 0x00, 0xF5, 0xFF, 0x7F, 0x00, 0x10, 0x53, 0x80, 0x55, 0x05, 0x45, 0x01, 0x00, 0xE3, 0xCF, 0x01, 0x84, 0x00, 0x05, 0x40, 0xFF, 0xFF, 0x7F, 0x00, 0xF2, 0x91, 0xFF, 0x05, 0x1F, 0x00, 0xF8, 0xFF, 0xFF, 0x04, 
+	0x84, 0x00, 0x03, 0x10, 0xFC, 0xFF, 0x4D, 0x84, 0x00, 0x05, 0xF7, 0xFF, 0xFF, 0xAF, 0x00, 0xC0, 0x91, 0xFF, 0x05, 0x0C, 0x00, 0xFC, 0xFF, 0xFF, 0x7F, 0x84, 0x00, 0x00, 0xD4, 0x80, 0xFF, 0x01, 0x9C, 0x56, 0x80, 0x55, 0x01, 0x75, 0xDA, 0x80, 0xFF, 0x02, 0xDF, 0x01, 0x80, 0x91, 0xFF, 0x02, 0x09, 0x10, 
+	0xFE, 0x80, 0xFF, 0x01, 0xAD, 0x57, 0x80, 0x55, 0x01, 0x65, 0xC9, 0x8C, 0xFF, 0x01, 0x05, 0x40, 0x91, 0xFF, 0x01, 0x05, 0x40, 0x97, 0xFF, 0x02, 0x09, 0x10, 0xFC, 0x8F, 0xFF, 0x02, 0xBF, 0x00, 0x80, 0x97, 0xFF, 0x02, 0x1C, 0x00, 0xF6, 0x8F, 0xFF, 0x02, 0x5F, 0x00, 0xD1, 0x97, 0xFF, 0x02, 0x6F, 0x00, 
+	0xC0, 0x8F, 0xFF, 0x02, 0x0C, 0x00, 0xF7, 0x97, 0xFF, 0x02, 0xDF, 0x01, 0x50, 0x8F, 0xFF, 0x02, 0x05, 0x10, 0xFE, 0x98, 0xFF, 0x02, 0x07, 0x00, 0xF9, 0x8D, 0xFF, 0x02, 0x9F, 0x00, 0x70, 0x99, 0xFF, 0x02, 0x1E, 0x00, 0xB0, 0x8D, 0xFF, 0x02, 0x0B, 0x00, 0xE1, 0x99, 0xFF, 0x03, 0xAF, 0x00, 0x10, 0xFD, 
+	0x8B, 0xFF, 0x03, 0xDF, 0x01, 0x00, 0xFB, 0x9A, 0xFF, 0x02, 0x08, 0x00, 0xF3, 0x8B, 0xFF, 0x02, 0x3E, 0x00, 0x90, 0x9B, 0xFF, 0x02, 0x6F, 0x00, 0x50, 0x8B, 0xFF, 0x02, 0x05, 0x00, 0xF7, 0x9C, 0xFF, 0x02, 0x03, 0x00, 0xF7, 0x89, 0xFF, 0x02, 0x7F, 0x00, 0x40, 0x9D, 0xFF, 0x02, 0x2E, 0x00, 0xB0, 0x89, 
+	0xFF, 0x02, 0x0A, 0x00, 0xE2, 0x97, 0xFF, 0x08, 0xBF, 0x58, 0x74, 0xF9, 0xFF, 0xFF, 0xCF, 0x01, 0x40, 0x89, 0xFF, 0x08, 0x03, 0x10, 0xFD, 0xFF, 0xFF, 0x9F, 0x47, 0x85, 0xFB, 0x91, 0xFF, 0x09, 0x06, 0x00, 0x00, 0x30, 0xFB, 0xFF, 0xFF, 0x08, 0x00, 0xFA, 0x87, 0xFF, 0x09, 0x9F, 0x00, 0x90, 0xFF, 0xFF, 
+	0xBF, 0x03, 0x00, 0x00, 0x60, 0x90, 0xFF, 0x00, 0x3E, 0x81, 0x00, 0x05, 0xB0, 0xFF, 0xFF, 0x2F, 0x00, 0xF3, 0x87, 0xFF, 0x05, 0x3F, 0x00, 0xF3, 0xFF, 0xFF, 0x0B, 0x81, 0x00, 0x00, 0xE3, 0x8E, 0xFF, 0x0B, 0xEF, 0x03, 0x00, 0x62, 0x47, 0x00, 0x20, 0xFE, 0xFF, 0x9F, 0x00, 0xD0, 0x87, 0xFF, 0x0B, 0x0D, 
+	0x00, 0xFA, 0xFF, 0xEF, 0x02, 0x00, 0x74, 0x26, 0x00, 0x30, 0xFE, 0x8D, 0xFF, 0x0B, 0x3E, 0x00, 0x40, 0xFE, 0xFF, 0x08, 0x00, 0xF8, 0xFF, 0xEF, 0x00, 0x80, 0x87, 0xFF, 0x0B, 0x08, 0x00, 0xFE, 0xFF, 0x8F, 0x00, 0x80, 0xFF, 0xEF, 0x04, 0x00, 0xE3, 0x8C, 0xFF, 0x0C, 0xEF, 0x03, 0x00, 0xF4, 0xFF, 0xFF, 
+	0x4F, 0x00, 0xF6, 0xFF, 0xFF, 0x04, 0x50, 0x87, 0xFF, 0x0C, 0x05, 0x50, 0xFF, 0xFF, 0x6F, 0x00, 0xF4, 0xFF, 0xFF, 0x4F, 0x00, 0x30, 0xFE, 0x8B, 0xFF, 0x02, 0x3E, 0x00, 0x40, 0x80, 0xFF, 0x06, 0x7F, 0x00, 0xF4, 0xFF, 0xFF, 0x07, 0x30, 0x87, 0xFF, 0x06, 0x03, 0x80, 0xFF, 0xFF, 0x4F, 0x00, 0xF7, 0x80, 
+	0xFF, 0x02, 0x04, 0x00, 0xE3, 0x8A, 0xFF, 0x03, 0xEF, 0x03, 0x00, 0xF4, 0x80, 0xFF, 0x06, 0x6F, 0x00, 0xF4, 0xFF, 0xFF, 0x09, 0x20, 0x87, 0xFF, 0x06, 0x02, 0x90, 0xFF, 0xFF, 0x4F, 0x00, 0xF6, 0x80, 0xFF, 0x03, 0x4F, 0x00, 0x30, 0xFE, 0x89, 0xFF, 0x02, 0x4F, 0x00, 0x40, 0x81, 0xFF, 0x07, 0x1E, 0x00, 
+	0xF7, 0xFF, 0xFF, 0x0A, 0x10, 0xFE, 0x85, 0xFF, 0x07, 0xEF, 0x01, 0xA0, 0xFF, 0xFF, 0x7F, 0x00, 0xE1, 0x81, 0xFF, 0x02, 0x04, 0x00, 0xF4, 0x89, 0xFF, 0x02, 0x09, 0x00, 0xF4, 0x81, 0xFF, 0x06, 0x04, 0x00, 0xFB, 0xFF, 0xFF, 0x0B, 0x10, 0x87, 0xFF, 0x06, 0x01, 0xB0, 0xFF, 0xFF, 0xBF, 0x00, 0x40, 0x81, 
+	0xFF, 0x02, 0x4F, 0x00, 0x80, 0x88, 0xFF, 0x02, 0xEF, 0x03, 0x30, 0x81, 0xFF, 0x02, 0x4F, 0x00, 0x60, 0x80, 0xFF, 0x02, 0x0B, 0x10, 0xDC, 0x85, 0xDD, 0x02, 0xCD, 0x01, 0xB0, 0x80, 0xFF, 0x02, 0x06, 0x00, 0xF4, 0x81, 0xFF, 0x02, 0x03, 0x20, 0xFE, 0x87, 0xFF, 0x02, 0xDF, 0x00, 0xA0, 0x81, 0xFF, 0x02, 
+	0x04, 0x00, 0xE3, 0x80, 0xFF, 0x01, 0x0C, 0x00, 0x87, 0x22, 0x01, 0x00, 0xC0, 0x80, 0xFF, 0x02, 0x3E, 0x00, 0x40, 0x81, 0xFF, 0x02, 0x0A, 0x00, 0xFC, 0x87, 0xFF, 0x02, 0xBF, 0x00, 0xE1, 0x80, 0xFF, 0x03, 0x4F, 0x00, 0x30, 0xFE, 0x80, 0xFF, 0x00, 0x3E, 0x89, 0x00, 0x00, 0xE3, 0x80, 0xFF, 0x03, 0xEF, 
+	0x03, 0x00, 0xF4, 0x80, 0xFF, 0x02, 0x1E, 0x00, 0xFB, 0x87, 0xFF, 0x02, 0xCF, 0x00, 0xC0, 0x80, 0xFF, 0x02, 0x04, 0x00, 0xE3, 0x81, 0xFF, 0x01, 0xDF, 0x01, 0x87, 0x00, 0x01, 0x10, 0xFD, 0x81, 0xFF, 0x02, 0x3E, 0x00, 0x40, 0x80, 0xFF, 0x02, 0x0C, 0x00, 0xFC, 0x87, 0xFF, 0x08, 0xDF, 0x02, 0x50, 0xFF, 
+	0xFF, 0x4F, 0x00, 0x30, 0xFE, 0x82, 0xFF, 0x01, 0x05, 0x30, 0x85, 0x99, 0x01, 0x03, 0x50, 0x82, 0xFF, 0x08, 0xEF, 0x03, 0x00, 0xE4, 0xFF, 0xFF, 0x05, 0x10, 0xFD, 0x88, 0xFF, 0x06, 0x06, 0x00, 0xB5, 0xAD, 0x03, 0x00, 0xE3, 0x83, 0xFF, 0x01, 0x04, 0x60, 0x85, 0xFF, 0x01, 0x06, 0x40, 0x83, 0xFF, 0x06, 
+	0x3E, 0x00, 0x30, 0xDA, 0x5B, 0x00, 0x60, 0x89, 0xFF, 0x06, 0x2E, 0x00, 0x00, 0x01, 0x00, 0x30, 0xFE, 0x83, 0xFF, 0x01, 0x04, 0x50, 0x85, 0xFF, 0x01, 0x05, 0x40, 0x83, 0xFF, 0x06, 0xEF, 0x03, 0x00, 0x10, 0x00, 0x00, 0xD1, 0x89, 0xFF, 0x01, 0xBF, 0x02, 0x80, 0x00, 0x00, 0xE4, 0x84, 0xFF, 0x01, 0x04, 
+	0x50, 0x85, 0xFF, 0x01, 0x05, 0x40, 0x84, 0xFF, 0x00, 0x4E, 0x80, 0x00, 0x01, 0x10, 0xFB, 0x8A, 0xFF, 0x03, 0x6E, 0x02, 0x00, 0x93, 0x85, 0xFF, 0x01, 0x04, 0x60, 0x85, 0xFF, 0x01, 0x06, 0x40, 0x85, 0xFF, 0x03, 0x28, 0x00, 0x10, 0xD6, 0x8C, 0xFF, 0x02, 0xCD, 0xDB, 0xFE, 0x85, 0xFF, 0x01, 0x05, 0x40, 
+	0x85, 0xFF, 0x01, 0x04, 0x50, 0x85, 0xFF, 0x02, 0xEF, 0xBC, 0xDC, 0x98, 0xFF, 0x02, 0x08, 0x00, 0xE9, 0x83, 0xEE, 0x02, 0x9E, 0x00, 0x80, 0xA3, 0xFF, 0x02, 0x0D, 0x00, 0x00, 0x83, 0x11, 0x02, 0x00, 0x00, 0xD0, 0xA3, 0xFF, 0x00, 0x8F, 0x87, 0x00, 0x00, 0xF8, 0xA4, 0xFF, 0x00, 0x1A, 0x85, 0x00, 0x00, 
+	0xA1, 0xA5, 0xFF, 0x09, 0xDF, 0x01, 0x50, 0x9A, 0xAA, 0xAA, 0xA9, 0x05, 0x10, 0xFD, 0xA6, 0xFF, 0x01, 0x04, 0x20, 0x81, 0xFF, 0x01, 0x02, 0x40, 0xA7, 0xFF, 0x07, 0x0A, 0x00, 0xD3, 0xFF, 0xFF, 0x3D, 0x00, 0xA0, 0xA7, 0xFF, 0x07, 0x5F, 0x00, 0x10, 0x96, 0x69, 0x01, 0x00, 0xF5, 0xA8, 0xFF, 0x00, 0x04, 
+	0x81, 0x00, 0x00, 0x40, 0xA9, 0xFF, 0x00, 0x7E, 0x81, 0x00, 0x00, 0xE7, 0xAA, 0xFF, 0x03, 0x7C, 0x14, 0x41, 0xC7, 0x94, 0xFF, 
 	};
+const Icon lightbulboff_icon = {lightbulboff_width, lightbulboff_height, sizeof(lightbulboff_data), lightbulboff_data, NULL};
@@ -1,68 +1,22 @@
+#pragma once
 const uint32_t motionsensoroff_width = 64;
 const uint32_t motionsensoroff_height = 64;
-const uint8_t motionsensoroff_data[(64*64)/2] = {
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x75, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x57, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0x2E, 0xF2, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x0D, 0xD0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x71, 0x77, 0x77, 0xE8, 0xFF, 0xAF, 0xFA, 0xFF, 0x8E, 0x77, 0x77, 0x17, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x82, 0x88, 0x88, 0x88, 0xFE, 0xFF, 0xFF, 0xEF, 0x88, 0x88, 0x88, 0x28, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xF4, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0x4F, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xF4, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0x4F, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xF4, 0xFF, 0xFF, 0xFF, 0x8C, 0x77, 0x77, 0xC8, 0xFF, 0xFF, 0xFF, 0x4F, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xF4, 0xFF, 0xFF, 0xFF, 0xBF, 0x04, 0x40, 0xFB, 0xFF, 0xFF, 0xFF, 0x4F, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xF3, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0x3F, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xF2, 0xFF, 0xFF, 0xBF, 0x00, 0x61, 0x06, 0x00, 0xFB, 0xFF, 0xFF, 0x1F, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xF0, 0xFF, 0xFF, 0x4F, 0x10, 0xFD, 0xDF, 0x00, 0xF4, 0xFF, 0xFF, 0x0F, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0xB0, 0xFF, 0xFF, 0x0F, 0x60, 0xFF, 0xFF, 0x06, 0xF0, 0xFF, 0xFF, 0x0B, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x60, 0xFF, 0xFF, 0x0F, 0x60, 0xFF, 0xFF, 0x06, 0xF0, 0xFF, 0xFF, 0x06, 0xF0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xFD, 0xFF, 0x4F, 0x10, 0xFD, 0xDF, 0x00, 0xF4, 0xFF, 0xDF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0xF5, 0xFF, 0xBF, 0x00, 0x60, 0x06, 0x00, 0xFB, 0xFF, 0x4F, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x80, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x08, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0xF9, 0xFF, 0xBF, 0x04, 0x40, 0xFB, 0xFF, 0x9F, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x60, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x06, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0x00, 0x81, 0xFE, 0xFF, 0xFF, 0xEF, 0x18, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x04, 0x00, 0x20, 0x75, 0x57, 0x02, 0x00, 0x40, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x48, 0x02, 0x20, 0x84, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x81, 0xFF, 0xFF, 0x18, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x62, 0x26, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x02, 0x00, 0x00, 0x20, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCB, 0xFF, 0x8F, 0x03, 0x30, 0xF8, 0xFF, 0xBC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0x30, 0xFB, 0xFF, 0xFF, 0xBF, 0x03, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x10, 0x75, 0x57, 0x01, 0x00, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x29, 0xFA, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xAF, 0x92, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x70, 0xFF, 0xEF, 0x49, 0x02, 0x20, 0x94, 0xFE, 0xFF, 0x07, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x02, 0x00, 0xB5, 0xFF, 0xFF, 0xFF, 0xFF, 0x5A, 0x00, 0x20, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x30, 0x75, 0x57, 0x03, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x36, 0x01, 0x10, 0x63, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+const uint8_t motionsensoroff_data[761] = { // run length encoded
+0x84, 0xFF, 0x01, 0xEF, 0x02, 0x8B, 0x00, 0x00, 0x20, 0x8C, 0xFF, 0x00, 0xCF, 0x8D, 0x00, 0x00, 0xFC, 0x8B, 0xFF, 0x02, 0xBF, 0x00, 0x75, 0x89, 0x77, 0x02, 0x57, 0x00, 0xFB, 0x8B, 0xFF, 0x02, 0xCF, 0x00, 0xFB, 0x89, 0xFF, 0x02, 0xBF, 0x00, 0xFC, 0x8B, 0xFF, 0x02, 0xDF, 0x00, 0xF6, 0x89, 0xFF, 0x02, 
+	0x6F, 0x00, 0xFD, 0x8C, 0xFF, 0x00, 0x03, 0x81, 0x00, 0x05, 0xB0, 0xFF, 0x2E, 0xF2, 0xFF, 0x0A, 0x81, 0x00, 0x00, 0x30, 0x8D, 0xFF, 0x00, 0x2E, 0x81, 0x00, 0x05, 0x70, 0xFF, 0x0D, 0xD0, 0xFF, 0x07, 0x81, 0x00, 0x00, 0xE2, 0x8E, 0xFF, 0x0D, 0x03, 0x71, 0x77, 0x77, 0xE8, 0xFF, 0xAF, 0xFA, 0xFF, 0x8E, 
+	0x77, 0x77, 0x17, 0x30, 0x8F, 0xFF, 0x01, 0x04, 0xF4, 0x87, 0xFF, 0x01, 0x4F, 0x40, 0x8F, 0xFF, 0x01, 0x04, 0xF4, 0x87, 0xFF, 0x01, 0x4F, 0x40, 0x8F, 0xFF, 0x01, 0x04, 0xF4, 0x87, 0xFF, 0x01, 0x4F, 0x40, 0x8F, 0xFF, 0x01, 0x04, 0xF4, 0x87, 0xFF, 0x01, 0x4F, 0x40, 0x8F, 0xFF, 0x01, 0x04, 0xF4, 0x87, 
+	0xFF, 0x01, 0x4F, 0x40, 0x8F, 0xFF, 0x01, 0x04, 0xF4, 0x87, 0xFF, 0x01, 0x4F, 0x40, 0x8F, 0xFF, 0x01, 0x04, 0xF4, 0x87, 0xFF, 0x01, 0x4F, 0x40, 0x8F, 0xFF, 0x01, 0x04, 0xF4, 0x87, 0xFF, 0x01, 0x4F, 0x40, 0x8F, 0xFF, 0x01, 0x04, 0xF4, 0x87, 0xFF, 0x01, 0x4F, 0x40, 0x8F, 0xFF, 0x01, 0x04, 0xF4, 0x87, 
+	0xFF, 0x01, 0x4F, 0x40, 0x8F, 0xFF, 0x01, 0x04, 0xF4, 0x87, 0xFF, 0x01, 0x4F, 0x40, 0x8F, 0xFF, 0x01, 0x04, 0xF4, 0x87, 0xFF, 0x01, 0x4F, 0x40, 0x8F, 0xFF, 0x01, 0x04, 0xF4, 0x87, 0xFF, 0x01, 0x4F, 0x40, 0x8F, 0xFF, 0x01, 0x04, 0xF4, 0x87, 0xFF, 0x01, 0x4F, 0x40, 0x8F, 0xFF, 0x01, 0x04, 0x82, 0x80, 
+	0x88, 0x03, 0xFE, 0xFF, 0xFF, 0xEF, 0x80, 0x88, 0x01, 0x28, 0x40, 0x8F, 0xFF, 0x00, 0x04, 0x81, 0x00, 0x03, 0xF3, 0xFF, 0xFF, 0x3F, 0x81, 0x00, 0x00, 0x40, 0x8F, 0xFF, 0x00, 0x04, 0x81, 0x00, 0x03, 0xA0, 0xFF, 0xFF, 0x0A, 0x81, 0x00, 0x00, 0x40, 0x8F, 0xFF, 0x04, 0x04, 0xF4, 0xFF, 0xFF, 0x1F, 0x81, 
+	0x00, 0x04, 0xF1, 0xFF, 0xFF, 0x4F, 0x40, 0x8F, 0xFF, 0x04, 0x04, 0xF4, 0xFF, 0xFF, 0xAF, 0x81, 0x00, 0x04, 0xFA, 0xFF, 0xFF, 0x4F, 0x40, 0x8F, 0xFF, 0x01, 0x04, 0xF4, 0x80, 0xFF, 0x03, 0x8C, 0x77, 0x77, 0xC8, 0x80, 0xFF, 0x01, 0x4F, 0x40, 0x8F, 0xFF, 0x01, 0x04, 0xF4, 0x87, 0xFF, 0x01, 0x4F, 0x40, 
+	0x8F, 0xFF, 0x01, 0x04, 0xF4, 0x87, 0xFF, 0x01, 0x4F, 0x40, 0x8F, 0xFF, 0x01, 0x04, 0xF4, 0x80, 0xFF, 0x03, 0xBF, 0x04, 0x40, 0xFB, 0x80, 0xFF, 0x01, 0x4F, 0x40, 0x8F, 0xFF, 0x01, 0x04, 0xF3, 0x80, 0xFF, 0x03, 0x07, 0x00, 0x00, 0x70, 0x80, 0xFF, 0x01, 0x3F, 0x40, 0x8F, 0xFF, 0x0D, 0x06, 0xF2, 0xFF, 
+	0xFF, 0xBF, 0x00, 0x61, 0x06, 0x00, 0xFB, 0xFF, 0xFF, 0x1F, 0x60, 0x8F, 0xFF, 0x0D, 0x07, 0xF0, 0xFF, 0xFF, 0x4F, 0x10, 0xFD, 0xDF, 0x00, 0xF4, 0xFF, 0xFF, 0x0F, 0x70, 0x8F, 0xFF, 0x0D, 0x0A, 0xB0, 0xFF, 0xFF, 0x0F, 0x60, 0xFF, 0xFF, 0x06, 0xF0, 0xFF, 0xFF, 0x0B, 0xB0, 0x8F, 0xFF, 0x0D, 0x0F, 0x60, 
+	0xFF, 0xFF, 0x0F, 0x60, 0xFF, 0xFF, 0x06, 0xF0, 0xFF, 0xFF, 0x06, 0xF0, 0x8F, 0xFF, 0x0D, 0x5F, 0x00, 0xFD, 0xFF, 0x4F, 0x10, 0xFD, 0xDF, 0x00, 0xF4, 0xFF, 0xDF, 0x00, 0xF5, 0x8F, 0xFF, 0x0D, 0xCF, 0x00, 0xF5, 0xFF, 0xBF, 0x00, 0x60, 0x06, 0x00, 0xFB, 0xFF, 0x4F, 0x00, 0xFD, 0x90, 0xFF, 0x0B, 0x05, 
+	0x80, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0x08, 0x50, 0x91, 0xFF, 0x0B, 0x2E, 0x00, 0xF9, 0xFF, 0xBF, 0x04, 0x40, 0xFB, 0xFF, 0x9F, 0x00, 0xE2, 0x91, 0xFF, 0x03, 0xDF, 0x00, 0x60, 0xFE, 0x81, 0xFF, 0x03, 0xEF, 0x06, 0x00, 0xFD, 0x92, 0xFF, 0x09, 0x1C, 0x00, 0x81, 0xFE, 0xFF, 0xFF, 0xEF, 
+	0x18, 0x00, 0xD1, 0x93, 0xFF, 0x09, 0xEF, 0x04, 0x00, 0x20, 0x75, 0x57, 0x02, 0x00, 0x40, 0xFE, 0x94, 0xFF, 0x01, 0xBF, 0x02, 0x81, 0x00, 0x01, 0x20, 0xFB, 0x96, 0xFF, 0x05, 0xDF, 0x48, 0x02, 0x20, 0x84, 0xFD, 0xB9, 0xFF, 0x01, 0xAF, 0xFA, 0x9B, 0xFF, 0x01, 0x0D, 0xD0, 0x9B, 0xFF, 0x01, 0x2F, 0xF2, 
+	0xB9, 0xFF, 0x05, 0x9F, 0x81, 0xFF, 0xFF, 0x18, 0xF9, 0x97, 0xFF, 0x05, 0x4F, 0x00, 0x62, 0x26, 0x00, 0xF4, 0x97, 0xFF, 0x05, 0xDF, 0x02, 0x00, 0x00, 0x20, 0xFD, 0x96, 0xFF, 0x07, 0xCB, 0xFF, 0x8F, 0x03, 0x30, 0xF8, 0xFF, 0xBC, 0x94, 0xFF, 0x02, 0xCF, 0x00, 0xF8, 0x81, 0xFF, 0x02, 0x7F, 0x00, 0xFC, 
+	0x93, 0xFF, 0x09, 0xEF, 0x01, 0x30, 0xFB, 0xFF, 0xFF, 0xBF, 0x03, 0x10, 0xFE, 0x94, 0xFF, 0x07, 0x2D, 0x00, 0x10, 0x75, 0x57, 0x01, 0x00, 0xD2, 0x93, 0xFF, 0x03, 0x29, 0xFA, 0xFF, 0x07, 0x81, 0x00, 0x03, 0x70, 0xFF, 0xAF, 0x92, 0x91, 0xFF, 0x0B, 0x03, 0x70, 0xFF, 0xEF, 0x49, 0x02, 0x20, 0x94, 0xFE, 
+	0xFF, 0x07, 0x30, 0x91, 0xFF, 0x02, 0x0C, 0x00, 0xC4, 0x83, 0xFF, 0x02, 0x3C, 0x00, 0xC0, 0x91, 0xFF, 0x03, 0xCF, 0x02, 0x00, 0xB5, 0x81, 0xFF, 0x03, 0x5A, 0x00, 0x20, 0xFD, 0x92, 0xFF, 0x09, 0x6F, 0x00, 0x00, 0x30, 0x75, 0x57, 0x03, 0x00, 0x00, 0xF6, 0x94, 0xFF, 0x00, 0x5D, 0x83, 0x00, 0x00, 0xD5, 
+	0x96, 0xFF, 0x05, 0xAF, 0x36, 0x01, 0x10, 0x63, 0xFA, 0x8A, 0xFF, 
 	};
+const Icon motionsensoroff_icon = {motionsensoroff_width, motionsensoroff_height, sizeof(motionsensoroff_data), motionsensoroff_data, NULL};
@@ -1,68 +1,26 @@
+#pragma once
 const uint32_t motionsensoron_width = 64;
 const uint32_t motionsensoron_height = 64;
-const uint8_t motionsensoron_data[(64*64)/2] = {
-0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2B, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 
-	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 
-	0x01, 0x00, 0x22, 0x22, 0x22, 0x22, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0x22, 0x22, 0x22, 0x22, 0x00, 0x10, 
-	0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x10, 
-	0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x10, 
-	0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x10, 
-	0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x10, 
-	0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x10, 
-	0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x10, 
-	0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x10, 
-	0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6E, 0x12, 0x62, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x10, 
-	0x03, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x30, 
-	0x4D, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0xD4, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xCD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAD, 0xAA, 0xAA, 0xAA, 0x06, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDC, 0xFF, 0xFF, 
-	0xFF, 0x7F, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xF7, 0xFF, 
-	0xFF, 0x09, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x61, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0xA0, 0xFF, 
-	0xDF, 0x00, 0x00, 0xF5, 0xBF, 0xFD, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFB, 0x5F, 0x00, 0x00, 0xFE, 
-	0x5F, 0x00, 0x10, 0xEE, 0x02, 0xB0, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x20, 0xEF, 0x01, 0x00, 0xF5, 
-	0x0E, 0x00, 0xC0, 0x4F, 0x00, 0x60, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF5, 0x0C, 0x00, 0xE0, 
-	0x09, 0x00, 0xF5, 0x0B, 0x00, 0xA0, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x63, 0x66, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0xEB, 0xEE, 0xEE, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xC0, 0x5F, 0x00, 0x90, 
-	0x04, 0x00, 0xFB, 0x05, 0x00, 0xF5, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFC, 0xFF, 0x5F, 0x00, 0x50, 0xBF, 0x00, 0x40, 
-	0x02, 0x00, 0xFF, 0x01, 0x00, 0xFE, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1, 0xFF, 0xEF, 0x00, 0x10, 0xFF, 0x00, 0x20, 
-	0x00, 0x10, 0xFF, 0x00, 0x20, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0x02, 0x00, 0xFF, 0x01, 0x00, 
-	0x00, 0x10, 0xFF, 0x00, 0x20, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0xCF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0x02, 0x00, 0xFF, 0x01, 0x00, 
-	0x02, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0xFF, 0x7F, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x30, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF2, 0xFF, 0xEF, 0x00, 0x10, 0xFF, 0x00, 0x20, 
-	0x04, 0x00, 0xFB, 0x04, 0x00, 0xF7, 0xFF, 0xFF, 0x9C, 0xFC, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x70, 0xFF, 0xDF, 0x25, 0x22, 0x22, 0x22, 0x62, 0xFE, 0xFF, 0x7F, 0x00, 0x50, 0xBF, 0x00, 0x40, 
-	0x08, 0x00, 0xF6, 0x0A, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0xB0, 0x6F, 0x00, 0x80, 
-	0x0D, 0x00, 0xD0, 0x3F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF3, 0x0D, 0x00, 0xD0, 
-	0x4F, 0x00, 0x20, 0xEF, 0x01, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x10, 0xFE, 0x02, 0x00, 0xF4, 
-	0xDF, 0x00, 0x00, 0xF6, 0x9E, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xE9, 0x6F, 0x00, 0x00, 0xFD, 
-	0xFF, 0x08, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x80, 0xFF, 
-	0xFF, 0x5F, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xF5, 0xFF, 
-	0xFF, 0xFF, 0xAA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBA, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFD, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x10, 0xC6, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x82, 0x0B, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD5, 0x01, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0x1D, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0xDF, 0x01, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x03, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x17, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5B, 0x32, 0xFB, 0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0x3D, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0xD3, 
-	0x03, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x30, 
-	0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x10, 
-	0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x10, 
-	0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0x20, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x10, 
-	0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x10, 
-	0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x10, 
-	0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x10, 
-	0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x10, 
-	0x01, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0x10, 
-	0x01, 0x00, 0x22, 0x22, 0x22, 0x22, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3C, 0x22, 0x22, 0x22, 0x22, 0x00, 0x10, 
-	0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 
-	0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 
-	0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2C, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 
+const uint8_t motionsensoron_data[975] = { // run length encoded
+0x00, 0x2C, 0x82, 0x00, 0x00, 0xC2, 0x8F, 0xFF, 0x00, 0x2B, 0x82, 0x00, 0x01, 0xC2, 0x02, 0x82, 0x00, 0x00, 0x20, 0x8F, 0xFF, 0x00, 0x02, 0x82, 0x00, 0x01, 0x30, 0x01, 0x82, 0x00, 0x00, 0x30, 0x8F, 0xFF, 0x00, 0x03, 0x82, 0x00, 0x02, 0x10, 0x01, 0x00, 0x81, 0x22, 0x00, 0xC3, 0x8F, 0xFF, 0x00, 0x3C, 
+	0x81, 0x22, 0x03, 0x00, 0x10, 0x01, 0x00, 0x99, 0xFF, 0x03, 0x00, 0x10, 0x01, 0x00, 0x99, 0xFF, 0x03, 0x00, 0x10, 0x01, 0x00, 0x99, 0xFF, 0x03, 0x00, 0x10, 0x01, 0x00, 0x99, 0xFF, 0x03, 0x00, 0x10, 0x01, 0x00, 0x99, 0xFF, 0x03, 0x00, 0x10, 0x01, 0x00, 0x99, 0xFF, 0x03, 0x00, 0x10, 0x01, 0x00, 0x99, 
+	0xFF, 0x03, 0x00, 0x10, 0x01, 0x00, 0x8B, 0xFF, 0x03, 0x6E, 0x12, 0x62, 0xFD, 0x87, 0xFF, 0x03, 0x00, 0x10, 0x03, 0x20, 0x8A, 0xFF, 0x00, 0xAF, 0x80, 0x00, 0x00, 0x90, 0x87, 0xFF, 0x03, 0x02, 0x30, 0x4D, 0xC3, 0x8A, 0xFF, 0x00, 0x0B, 0x81, 0x00, 0x00, 0xFB, 0x86, 0xFF, 0x01, 0x3C, 0xD4, 0x8C, 0xFF, 
+	0x00, 0x02, 0x81, 0x00, 0x00, 0xF2, 0x96, 0xFF, 0x00, 0xCF, 0x82, 0x00, 0x00, 0xB0, 0x96, 0xFF, 0x00, 0x9F, 0x82, 0x00, 0x00, 0x90, 0x96, 0xFF, 0x00, 0x9F, 0x82, 0x00, 0x00, 0x90, 0x96, 0xFF, 0x00, 0xCF, 0x82, 0x00, 0x00, 0xB0, 0x97, 0xFF, 0x00, 0x02, 0x81, 0x00, 0x00, 0xF1, 0x8A, 0xFF, 0x00, 0xCD, 
+	0x85, 0xFF, 0x00, 0xAD, 0x80, 0xAA, 0x00, 0x06, 0x81, 0x00, 0x00, 0xFA, 0x85, 0xFF, 0x00, 0xDC, 0x80, 0xFF, 0x02, 0x7F, 0x00, 0xF7, 0x83, 0xFF, 0x00, 0x6F, 0x85, 0x00, 0x00, 0x90, 0x85, 0xFF, 0x07, 0x7F, 0x00, 0xF7, 0xFF, 0xFF, 0x09, 0x00, 0xF1, 0x83, 0xFF, 0x00, 0x05, 0x84, 0x00, 0x01, 0x61, 0xFD, 
+	0x85, 0xFF, 0x09, 0x1F, 0x00, 0xA0, 0xFF, 0xDF, 0x00, 0x00, 0xF5, 0xBF, 0xFD, 0x80, 0xFF, 0x00, 0x5F, 0x85, 0x00, 0x00, 0xB0, 0x84, 0xFF, 0x0B, 0xDF, 0xFB, 0x5F, 0x00, 0x00, 0xFE, 0x5F, 0x00, 0x10, 0xEE, 0x02, 0xB0, 0x80, 0xFF, 0x00, 0x05, 0x86, 0x00, 0x00, 0xFB, 0x83, 0xFF, 0x0E, 0x0B, 0x20, 0xEF, 
+	0x01, 0x00, 0xF5, 0x0E, 0x00, 0xC0, 0x4F, 0x00, 0x60, 0xFF, 0xFF, 0x5F, 0x87, 0x00, 0x00, 0xB0, 0x83, 0xFF, 0x0E, 0x06, 0x00, 0xF5, 0x0C, 0x00, 0xE0, 0x09, 0x00, 0xF5, 0x0B, 0x00, 0xA0, 0xFF, 0xFF, 0x05, 0x80, 0x00, 0x02, 0x63, 0x66, 0x05, 0x82, 0x00, 0x02, 0xEB, 0xEE, 0xEE, 0x80, 0xFF, 0x0D, 0x0A, 
+	0x00, 0xC0, 0x5F, 0x00, 0x90, 0x04, 0x00, 0xFB, 0x05, 0x00, 0xF5, 0xFF, 0x5F, 0x80, 0x00, 0x03, 0x40, 0xFF, 0xFF, 0x0A, 0x85, 0x00, 0x10, 0x30, 0xFC, 0xFF, 0x5F, 0x00, 0x50, 0xBF, 0x00, 0x40, 0x02, 0x00, 0xFF, 0x01, 0x00, 0xFE, 0xFF, 0x0C, 0x80, 0x00, 0x03, 0xF4, 0xFF, 0xFF, 0x06, 0x86, 0x00, 0x12, 
+	0xE1, 0xFF, 0xEF, 0x00, 0x10, 0xFF, 0x00, 0x20, 0x00, 0x10, 0xFF, 0x00, 0x20, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x40, 0x80, 0xFF, 0x03, 0x02, 0x00, 0x00, 0x08, 0x83, 0x00, 0x15, 0xA0, 0xFF, 0xFF, 0x02, 0x00, 0xFF, 0x01, 0x00, 0x00, 0x10, 0xFF, 0x00, 0x20, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 
+	0xEF, 0x80, 0x00, 0x00, 0xCF, 0x83, 0x00, 0x11, 0xB0, 0xFF, 0xFF, 0x02, 0x00, 0xFF, 0x01, 0x00, 0x02, 0x00, 0xFF, 0x00, 0x00, 0xFE, 0xFF, 0x7F, 0x00, 0x50, 0x80, 0xFF, 0x05, 0xAF, 0x00, 0x00, 0x30, 0xFF, 0x0C, 0x82, 0x00, 0x11, 0xF2, 0xFF, 0xEF, 0x00, 0x10, 0xFF, 0x00, 0x20, 0x04, 0x00, 0xFB, 0x04, 
+	0x00, 0xF7, 0xFF, 0xFF, 0x9C, 0xFC, 0x80, 0xFF, 0x06, 0x6F, 0x00, 0x00, 0x70, 0xFF, 0xDF, 0x25, 0x80, 0x22, 0x0E, 0x62, 0xFE, 0xFF, 0x7F, 0x00, 0x50, 0xBF, 0x00, 0x40, 0x08, 0x00, 0xF6, 0x0A, 0x00, 0xB0, 0x84, 0xFF, 0x03, 0x2F, 0x00, 0x00, 0xB0, 0x86, 0xFF, 0x0B, 0x0B, 0x00, 0xB0, 0x6F, 0x00, 0x80, 
+	0x0D, 0x00, 0xD0, 0x3F, 0x00, 0x60, 0x84, 0xFF, 0x03, 0x0E, 0x00, 0x00, 0xE0, 0x86, 0xFF, 0x0B, 0x06, 0x00, 0xF3, 0x0D, 0x00, 0xD0, 0x4F, 0x00, 0x20, 0xEF, 0x01, 0xA0, 0x84, 0xFF, 0x03, 0x09, 0x00, 0x00, 0xF2, 0x86, 0xFF, 0x0B, 0x0A, 0x10, 0xFE, 0x02, 0x00, 0xF4, 0xDF, 0x00, 0x00, 0xF6, 0x9E, 0xFB, 
+	0x84, 0xFF, 0x03, 0x05, 0x00, 0x00, 0xA0, 0x86, 0xFF, 0x09, 0xBF, 0xE9, 0x6F, 0x00, 0x00, 0xFD, 0xFF, 0x08, 0x00, 0xF1, 0x86, 0xFF, 0x00, 0x01, 0x80, 0x00, 0x00, 0xFA, 0x87, 0xFF, 0x07, 0x1F, 0x00, 0x80, 0xFF, 0xFF, 0x5F, 0x00, 0xF6, 0x85, 0xFF, 0x00, 0xDF, 0x81, 0x00, 0x00, 0xA0, 0x87, 0xFF, 0x02, 
+	0x6F, 0x00, 0xF5, 0x80, 0xFF, 0x00, 0xAA, 0x86, 0xFF, 0x00, 0x9F, 0x82, 0x00, 0x00, 0xFA, 0x87, 0xFF, 0x00, 0xBA, 0x87, 0xFF, 0x04, 0xEF, 0xFD, 0xFF, 0xFF, 0x5F, 0x82, 0x00, 0x00, 0xA0, 0x92, 0xFF, 0x04, 0x05, 0x10, 0xC6, 0xFF, 0x1F, 0x83, 0x00, 0x00, 0xFA, 0x90, 0xFF, 0x00, 0x8F, 0x80, 0x00, 0x04, 
+	0x82, 0x0B, 0x00, 0x00, 0x11, 0x80, 0x00, 0x00, 0xA0, 0x90, 0xFF, 0x00, 0x4F, 0x84, 0x00, 0x01, 0xD5, 0x01, 0x80, 0x00, 0x00, 0xFA, 0x8F, 0xFF, 0x00, 0x5F, 0x84, 0x00, 0x01, 0xF9, 0x1D, 0x80, 0x00, 0x00, 0xA0, 0x8F, 0xFF, 0x00, 0xDF, 0x84, 0x00, 0x02, 0xFC, 0xDF, 0x01, 0x80, 0x00, 0x00, 0xFA, 0x8F, 
+	0xFF, 0x00, 0x5D, 0x82, 0x00, 0x03, 0x10, 0xFF, 0xFF, 0x1D, 0x80, 0x00, 0x00, 0xA0, 0x90, 0xFF, 0x01, 0x9F, 0x03, 0x80, 0x00, 0x04, 0x50, 0xFF, 0xFF, 0xDF, 0x01, 0x80, 0x00, 0x00, 0xFA, 0x90, 0xFF, 0x04, 0xDF, 0x17, 0x00, 0x00, 0xC0, 0x80, 0xFF, 0x00, 0x1D, 0x80, 0x00, 0x00, 0xA0, 0x92, 0xFF, 0x02, 
+	0x5B, 0x32, 0xFB, 0x80, 0xFF, 0x01, 0xDF, 0x01, 0x80, 0x00, 0x00, 0xFA, 0x85, 0xFF, 0x01, 0x3D, 0xC3, 0x8E, 0xFF, 0x00, 0x1D, 0x80, 0x00, 0x00, 0xC0, 0x83, 0xFF, 0x03, 0x3C, 0xD3, 0x03, 0x20, 0x8E, 0xFF, 0x04, 0xDF, 0x01, 0x00, 0x00, 0x70, 0x83, 0xFF, 0x03, 0x02, 0x30, 0x01, 0x00, 0x8F, 0xFF, 0x03, 
+	0x1D, 0x00, 0x00, 0x70, 0x83, 0xFF, 0x03, 0x00, 0x10, 0x01, 0x00, 0x8F, 0xFF, 0x03, 0xDF, 0x01, 0x00, 0xC0, 0x83, 0xFF, 0x03, 0x00, 0x10, 0x01, 0x00, 0x90, 0xFF, 0x02, 0x4E, 0x20, 0xFA, 0x83, 0xFF, 0x03, 0x00, 0x10, 0x01, 0x00, 0x99, 0xFF, 0x03, 0x00, 0x10, 0x01, 0x00, 0x99, 0xFF, 0x03, 0x00, 0x10, 
+	0x01, 0x00, 0x99, 0xFF, 0x03, 0x00, 0x10, 0x01, 0x00, 0x99, 0xFF, 0x03, 0x00, 0x10, 0x01, 0x00, 0x99, 0xFF, 0x03, 0x00, 0x10, 0x01, 0x00, 0x81, 0x22, 0x00, 0xC3, 0x8F, 0xFF, 0x00, 0x3C, 0x81, 0x22, 0x02, 0x00, 0x10, 0x01, 0x82, 0x00, 0x00, 0x30, 0x8F, 0xFF, 0x00, 0x03, 0x82, 0x00, 0x01, 0x10, 0x03, 
+	0x82, 0x00, 0x00, 0x20, 0x8F, 0xFF, 0x00, 0x02, 0x82, 0x00, 0x01, 0x30, 0x2C, 0x82, 0x00, 0x00, 0xC2, 0x8F, 0xFF, 0x00, 0x2C, 0x82, 0x00, 0x00, 0xC2, 
 	};
+const Icon motionsensoron_icon = {motionsensoron_width, motionsensoron_height, sizeof(motionsensoron_data), motionsensoron_data, NULL};
@@ -1,102 +1,40 @@
-const uint8_t plantwateringlow_data[(100*100)/2] = {
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x47, 0x00, 0x10, 0x95, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8E, 0x02, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x01, 0x00, 0x00, 0x21, 0x02, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x03, 0x00, 0x40, 0xEA, 0xFF, 0xFF, 0x7D, 0x01, 0x00, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x60, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x30, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF6, 0xFF, 0xFF, 0x6C, 0x12, 0x31, 0xE8, 0xFF, 0xFF, 0x04, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0xFD, 0xFF, 0x3B, 0x00, 0x00, 0x00, 0x10, 0xF9, 0xFF, 0x6F, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0xB1, 0x6F, 0x00, 0x00, 0x10, 0x01, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x90, 0x03, 0x00, 0x01, 0x00, 0xA3, 0xFF, 0xDF, 0x06, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x02, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xFA, 0x5F, 0x00, 0x00, 0xA1, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x80, 0xFF, 0xEF, 0x12, 0xFD, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xA0, 0xFF, 0xFF, 0x07, 0x00, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0xFE, 0xBF, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xFA, 0xFF, 0xFF, 0xAF, 0x00, 0x20, 0xFD, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xF7, 0xEF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x51, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0x00, 0xB1, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0xF2, 0xFF, 0x03, 0xF0, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFA, 0x07, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0x04, 0xE0, 0xFF, 0x05, 0xD0, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x40, 0xFF, 0x7F, 0x00, 0x90, 0xFF, 0xFF, 0x6F, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0x07, 0xC0, 0xFF, 0x07, 0xB0, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0xC0, 0xFF, 0xFF, 0x07, 0x00, 0xF9, 0xFF, 0x06, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0xE4, 0xFF, 0xFF, 0x07, 0xC0, 0xFF, 0x07, 0xB0, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0xF2, 0xFF, 0xFF, 0x7F, 0x00, 0x90, 0x6F, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x20, 0xFC, 0xFF, 0x06, 0xC0, 0xFF, 0x06, 0xC0, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x04, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0xA1, 0xFF, 0x03, 0xE0, 0xFF, 0x04, 0xE0, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0xF8, 0x00, 0xF2, 0xFF, 0x02, 0xF1, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x30, 0x00, 0xF6, 0xEF, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0xFB, 0xAF, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0xFC, 0x5F, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0xFA, 0xFF, 0xFF, 0x6F, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0xA0, 0x0E, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF7, 0xFF, 0xFF, 0x06, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x04, 0x00, 0x03, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0xF4, 0xFF, 0x6F, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xE0, 0xFF, 0x06, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x90, 0x6F, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x01, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x20, 0x06, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0xC0, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x70, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x40, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x20, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x40, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7C, 0xC9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x80, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x00, 0x50, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x63, 0x01, 0x00, 0xF5, 0xFF, 0xFF, 0xEF, 0xBD, 0x69, 0x35, 0x01, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0xF7, 0x8F, 0x00, 0x50, 0x79, 0x35, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0xF9, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x42, 0x86, 0x09, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0xFA, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x31, 0x75, 0xCA, 0xFD, 0xFF, 0xFF, 0xAF, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xFC, 0xFF, 0x6F, 0x00, 0xB8, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xFD, 0xFF, 0x4F, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xFF, 0xFF, 0x3F, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x10, 0xFF, 0xFF, 0x2F, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x20, 0xFF, 0xFF, 0x0F, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x30, 0xFF, 0xFF, 0x0E, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x60, 0xFF, 0xFF, 0x0B, 0x00, 0x30, 0xA6, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x60, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0x00, 0x20, 0x95, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x30, 0x47, 0x01, 0x00, 0x74, 0x03, 0x00, 0x00, 0x00, 0x10, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0x7B, 0x13, 0x00, 0x00, 0xC0, 0xFF, 0x9F, 0xEB, 0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x51, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x15, 0xF3, 0xFF, 0x05, 0x00, 0x73, 0xEA, 0xFF, 0xFF, 0x0C, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x62, 0xD9, 0x9F, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x37, 0x00, 0x00, 0x00, 0x00, 0x41, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0x47, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x58, 0x55, 0x86, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9C, 0x57, 0x55, 0xD6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x48, 0x01, 0x00, 0x00, 0x40, 0xFE, 0xFF, 0xBF, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0xA3, 0xFF, 0xFF, 0xFF, 0xDF, 0x16, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x59, 0x02, 0x00, 0x61, 0x89, 0x04, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC2, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x01, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0xD8, 0xAD, 0x37, 0x00, 0x00, 0xFB, 0x5F, 0x00, 0x10, 0x95, 0xDB, 0x3D, 0x00, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6E, 0x00, 0x00, 0x20, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0xF9, 0xFF, 0xFF, 0x3C, 0x00, 0xD1, 0x06, 0x00, 0xF8, 0xFF, 0xFF, 0x1F, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0xBB, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0x05, 0x20, 0x00, 0xC1, 0xFF, 0xFF, 0xFF, 0x0F, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0x0C, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xE0, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x70, 0xFF, 0xFF, 0xFF, 0xEF, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xEF, 0x01, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0x02, 0xA0, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x70, 0xFE, 0xFF, 0xFF, 0x05, 0xD0, 0xFF, 0xFF, 0xBF, 0x02, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x50, 0xC9, 0xEE, 0x04, 0xC0, 0xDE, 0x7A, 0x03, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7E, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x69, 0x55, 0x01, 0x40, 0x55, 0xA8, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0xD0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x9F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x03, 0x20, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x01, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x02, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x02, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x02, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x03, 0x90, 0x99, 0x99, 0x99, 0xA9, 0xFF, 0xFF, 0x9D, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x99, 0x04, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xEF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xEF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x40, 0xAA, 0xAA, 0xBA, 0xFF, 0xFF, 0xAD, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9A, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0xE0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x00, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x12, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+#pragma once
+const uint32_t plantwateringlow_width = 100;
+const uint32_t plantwateringlow_height = 100;
+const uint8_t plantwateringlow_data[1689] = { // run length encoded
+0xA1, 0xFF, 0x05, 0xCF, 0x47, 0x00, 0x10, 0x95, 0xFE, 0xA8, 0xFF, 0x01, 0x8E, 0x02, 0x81, 0x00, 0x01, 0x50, 0xFC, 0xA6, 0xFF, 0x08, 0x9F, 0x01, 0x00, 0x00, 0x21, 0x02, 0x00, 0x00, 0x60, 0xA5, 0xFF, 0x0A, 0xDF, 0x03, 0x00, 0x40, 0xEA, 0xFF, 0xFF, 0x7D, 0x01, 0x00, 0xD2, 0xA4, 0xFF, 0x03, 0x0A, 0x00, 
+	0x60, 0xFD, 0x81, 0xFF, 0x03, 0x8F, 0x00, 0x10, 0xFD, 0xA2, 0xFF, 0x03, 0x7F, 0x00, 0x30, 0xFC, 0x83, 0xFF, 0x02, 0x2D, 0x00, 0xD1, 0xA2, 0xFF, 0x0C, 0x06, 0x00, 0xF6, 0xFF, 0xFF, 0x6C, 0x12, 0x31, 0xE8, 0xFF, 0xFF, 0x04, 0xA0, 0xA1, 0xFF, 0x05, 0x6F, 0x00, 0x00, 0xFD, 0xFF, 0x3B, 0x80, 0x00, 0x04, 
+	0x10, 0xF9, 0xFF, 0x6F, 0xF6, 0xA1, 0xFF, 0x0A, 0x06, 0x00, 0x00, 0xB1, 0x6F, 0x00, 0x00, 0x10, 0x01, 0x00, 0x60, 0xA3, 0xFF, 0x0C, 0x6F, 0x00, 0x90, 0x03, 0x00, 0x01, 0x00, 0xA3, 0xFF, 0xDF, 0x06, 0x00, 0xF5, 0x98, 0xFF, 0x02, 0xEF, 0x02, 0xF9, 0x84, 0xFF, 0x06, 0x06, 0x00, 0xFA, 0x5F, 0x00, 0x00, 
+	0xA1, 0x80, 0xFF, 0x06, 0xAF, 0x00, 0x80, 0xFF, 0xEF, 0x12, 0xFD, 0x94, 0xFF, 0x02, 0x3F, 0x00, 0x90, 0x83, 0xFF, 0x07, 0x6F, 0x00, 0xA0, 0xFF, 0xFF, 0x07, 0x00, 0xE3, 0x81, 0xFF, 0x05, 0x0B, 0x00, 0xFE, 0xBF, 0x00, 0xF7, 0x94, 0xFF, 0x03, 0x06, 0x00, 0x00, 0xF9, 0x82, 0xFF, 0x08, 0x06, 0x00, 0xFA, 
+	0xFF, 0xFF, 0xAF, 0x00, 0x20, 0xFD, 0x80, 0xFF, 0x05, 0x7F, 0x00, 0xF7, 0xEF, 0x00, 0xF2, 0x93, 0xFF, 0x04, 0xBF, 0x00, 0x51, 0x00, 0x90, 0x81, 0xFF, 0x02, 0x6F, 0x00, 0xA0, 0x81, 0xFF, 0x02, 0x1C, 0x00, 0xB1, 0x80, 0xFF, 0x05, 0xEF, 0x00, 0xF2, 0xFF, 0x03, 0xF0, 0x93, 0xFF, 0x05, 0x2F, 0x00, 0xFA, 
+	0x07, 0x00, 0xF9, 0x80, 0xFF, 0x02, 0x06, 0x00, 0xFA, 0x81, 0xFF, 0x03, 0xEF, 0x03, 0x00, 0xF9, 0x80, 0xFF, 0x04, 0x04, 0xE0, 0xFF, 0x05, 0xD0, 0x93, 0xFF, 0x0A, 0x0A, 0x40, 0xFF, 0x7F, 0x00, 0x90, 0xFF, 0xFF, 0x6F, 0x00, 0xA0, 0x83, 0xFF, 0x02, 0x5F, 0x00, 0x60, 0x80, 0xFF, 0x04, 0x07, 0xC0, 0xFF, 
+	0x07, 0xB0, 0x93, 0xFF, 0x0A, 0x04, 0xC0, 0xFF, 0xFF, 0x07, 0x00, 0xF9, 0xFF, 0x06, 0x00, 0xFA, 0x84, 0xFF, 0x09, 0x08, 0x00, 0xE4, 0xFF, 0xFF, 0x07, 0xC0, 0xFF, 0x07, 0xB0, 0x92, 0xFF, 0x0A, 0xEF, 0x00, 0xF2, 0xFF, 0xFF, 0x7F, 0x00, 0x90, 0x6F, 0x00, 0xA0, 0x85, 0xFF, 0x09, 0xAF, 0x00, 0x20, 0xFC, 
+	0xFF, 0x06, 0xC0, 0xFF, 0x06, 0xC0, 0x92, 0xFF, 0x02, 0xBF, 0x00, 0xF7, 0x80, 0xFF, 0x04, 0x07, 0x00, 0x04, 0x00, 0xFA, 0x86, 0xFF, 0x08, 0x1D, 0x00, 0xA1, 0xFF, 0x03, 0xE0, 0xFF, 0x04, 0xE0, 0x92, 0xFF, 0x02, 0x9F, 0x00, 0xFA, 0x80, 0xFF, 0x03, 0x7F, 0x00, 0x00, 0xA0, 0x87, 0xFF, 0x08, 0xEF, 0x03, 
+	0x00, 0xF8, 0x00, 0xF2, 0xFF, 0x02, 0xF1, 0x92, 0xFF, 0x02, 0x7F, 0x00, 0xFC, 0x81, 0xFF, 0x02, 0x02, 0x00, 0xFA, 0x88, 0xFF, 0x07, 0x5F, 0x00, 0x30, 0x00, 0xF6, 0xEF, 0x00, 0xF3, 0x92, 0xFF, 0x02, 0x6F, 0x00, 0xFD, 0x80, 0xFF, 0x02, 0x6F, 0x00, 0xA0, 0x8A, 0xFF, 0x06, 0x08, 0x00, 0x00, 0xFB, 0xAF, 
+	0x00, 0xF7, 0x92, 0xFF, 0x02, 0x7F, 0x00, 0xFC, 0x80, 0xFF, 0x02, 0x06, 0x00, 0xFA, 0x8A, 0xFF, 0x06, 0xBF, 0x00, 0x00, 0xFC, 0x5F, 0x00, 0xFC, 0x92, 0xFF, 0x07, 0x9F, 0x00, 0xFA, 0xFF, 0xFF, 0x6F, 0x00, 0xA0, 0x8C, 0xFF, 0x04, 0x2D, 0x00, 0xA0, 0x0E, 0x10, 0x93, 0xFF, 0x07, 0xBF, 0x00, 0xF7, 0xFF, 
+	0xFF, 0x06, 0x00, 0xFA, 0x8C, 0xFF, 0x04, 0xEF, 0x04, 0x00, 0x03, 0x70, 0x93, 0xFF, 0x06, 0xDF, 0x00, 0xF4, 0xFF, 0x6F, 0x00, 0xA0, 0x8E, 0xFF, 0x03, 0x6F, 0x00, 0x00, 0xD0, 0x94, 0xFF, 0x05, 0x02, 0xE0, 0xFF, 0x06, 0x00, 0xFA, 0x8F, 0xFF, 0x02, 0x08, 0x00, 0xE1, 0x94, 0xFF, 0x04, 0x07, 0x90, 0x6F, 
+	0x00, 0xA0, 0x90, 0xFF, 0x03, 0xBF, 0x01, 0x20, 0xFE, 0x93, 0xFF, 0x04, 0x0D, 0x20, 0x06, 0x00, 0xFA, 0x91, 0xFF, 0x02, 0x2D, 0x00, 0xF5, 0x93, 0xFF, 0x03, 0x4F, 0x00, 0x00, 0xA0, 0x92, 0xFF, 0x02, 0xEF, 0x01, 0xC0, 0x93, 0xFF, 0x03, 0xBF, 0x00, 0x00, 0xFA, 0x93, 0xFF, 0x01, 0x0A, 0x70, 0x94, 0xFF, 
+	0x01, 0x04, 0x20, 0x94, 0xFF, 0x01, 0x0E, 0x40, 0x94, 0xFF, 0x02, 0x1E, 0x00, 0xF6, 0x93, 0xFF, 0x01, 0x0F, 0x20, 0x94, 0xFF, 0x02, 0xDF, 0x00, 0x80, 0x93, 0xFF, 0x01, 0x0E, 0x40, 0x8A, 0xFF, 0x01, 0x7C, 0xC9, 0x86, 0xFF, 0x02, 0x0A, 0x00, 0xFB, 0x92, 0xFF, 0x01, 0x07, 0x80, 0x8A, 0xFF, 0x03, 0x01, 
+	0x00, 0x50, 0xFD, 0x84, 0xFF, 0x02, 0x8F, 0x00, 0xD1, 0x91, 0xFF, 0x02, 0xBF, 0x00, 0xE0, 0x89, 0xFF, 0x00, 0xEF, 0x80, 0x00, 0x00, 0x70, 0x84, 0xFF, 0x03, 0xEF, 0x03, 0x20, 0xFE, 0x90, 0xFF, 0x02, 0x0B, 0x00, 0xF7, 0x89, 0xFF, 0x0F, 0xDF, 0x00, 0x63, 0x01, 0x00, 0xF5, 0xFF, 0xFF, 0xEF, 0xBD, 0x69, 
+	0x35, 0x01, 0x00, 0x00, 0xF4, 0x8F, 0xFF, 0x02, 0xBF, 0x00, 0x40, 0x8A, 0xFF, 0x08, 0xBF, 0x00, 0xF7, 0x8F, 0x00, 0x50, 0x79, 0x35, 0x01, 0x83, 0x00, 0x00, 0x60, 0x8F, 0xFF, 0x02, 0x0B, 0x00, 0xF4, 0x8A, 0xFF, 0x04, 0x9F, 0x00, 0xF9, 0xFF, 0x0C, 0x84, 0x00, 0x04, 0x42, 0x86, 0x09, 0x00, 0xF9, 0x8D, 
+	0xFF, 0x02, 0xBF, 0x00, 0x40, 0x8B, 0xFF, 0x04, 0x8F, 0x00, 0xFA, 0xFF, 0x6F, 0x80, 0x00, 0x08, 0x31, 0x75, 0xCA, 0xFD, 0xFF, 0xFF, 0xAF, 0x00, 0xB0, 0x8D, 0xFF, 0x02, 0x0B, 0x00, 0xF4, 0x8B, 0xFF, 0x07, 0x6F, 0x00, 0xFC, 0xFF, 0x6F, 0x00, 0xB8, 0xFD, 0x84, 0xFF, 0x02, 0x07, 0x10, 0xFD, 0x8B, 0xFF, 
+	0x02, 0xBF, 0x00, 0x40, 0x8C, 0xFF, 0x06, 0x5F, 0x00, 0xFD, 0xFF, 0x4F, 0x00, 0xFE, 0x85, 0xFF, 0x02, 0x5F, 0x00, 0xE2, 0x8B, 0xFF, 0x02, 0x0B, 0x00, 0xF4, 0x8C, 0xFF, 0x05, 0x3F, 0x00, 0xFF, 0xFF, 0x3F, 0x00, 0x87, 0xFF, 0x01, 0x03, 0x40, 0x8A, 0xFF, 0x02, 0xBF, 0x00, 0x40, 0x8D, 0xFF, 0x05, 0x2F, 
+	0x10, 0xFF, 0xFF, 0x2F, 0x10, 0x87, 0xFF, 0x02, 0x1D, 0x00, 0xF7, 0x89, 0xFF, 0x02, 0x0B, 0x00, 0xF4, 0x8D, 0xFF, 0x05, 0x0F, 0x20, 0xFF, 0xFF, 0x0F, 0x20, 0x87, 0xFF, 0x02, 0xCF, 0x00, 0x90, 0x88, 0xFF, 0x02, 0xBF, 0x00, 0x40, 0x8E, 0xFF, 0x06, 0x0E, 0x30, 0xFF, 0xFF, 0x0E, 0x20, 0xFE, 0x87, 0xFF, 
+	0x02, 0x09, 0x00, 0xFB, 0x87, 0xFF, 0x02, 0x0B, 0x00, 0xF4, 0x8E, 0xFF, 0x08, 0x0D, 0x60, 0xFF, 0xFF, 0x0B, 0x00, 0x30, 0xA6, 0xFE, 0x85, 0xFF, 0x02, 0x7F, 0x00, 0xD1, 0x86, 0xFF, 0x02, 0xBF, 0x00, 0x40, 0x8F, 0xFF, 0x03, 0x0C, 0x60, 0xFF, 0x9F, 0x81, 0x00, 0x02, 0x20, 0x95, 0xFD, 0x84, 0xFF, 0x01, 
+	0x04, 0x20, 0x86, 0xFF, 0x02, 0x0B, 0x00, 0xF4, 0x8F, 0xFF, 0x06, 0x0A, 0x30, 0x47, 0x01, 0x00, 0x74, 0x03, 0x80, 0x00, 0x01, 0x10, 0xF6, 0x83, 0xFF, 0x02, 0x2F, 0x00, 0xF5, 0x84, 0xFF, 0x02, 0xBF, 0x00, 0x40, 0x90, 0xFF, 0x00, 0x09, 0x80, 0x00, 0x0A, 0x60, 0xFF, 0xFF, 0x7B, 0x13, 0x00, 0x00, 0xC0, 
+	0xFF, 0x9F, 0xEB, 0x80, 0xFF, 0x02, 0xDF, 0x01, 0x70, 0x84, 0xFF, 0x02, 0x0B, 0x00, 0xF4, 0x90, 0xFF, 0x04, 0x1D, 0x00, 0x00, 0x51, 0xFC, 0x81, 0xFF, 0x0C, 0x8C, 0x15, 0xF3, 0xFF, 0x05, 0x00, 0x73, 0xEA, 0xFF, 0xFF, 0x0C, 0x00, 0xFA, 0x82, 0xFF, 0x02, 0xBF, 0x00, 0x40, 0x92, 0xFF, 0x01, 0xCD, 0xEC, 
+	0x87, 0xFF, 0x00, 0x06, 0x80, 0x00, 0x04, 0x62, 0xD9, 0x9F, 0x00, 0xC0, 0x82, 0xFF, 0x02, 0x0B, 0x00, 0xF4, 0x9E, 0xFF, 0x01, 0xAF, 0x37, 0x81, 0x00, 0x03, 0x41, 0x00, 0x10, 0xFD, 0x80, 0xFF, 0x02, 0xBF, 0x00, 0x40, 0xA1, 0xFF, 0x01, 0xBE, 0x47, 0x82, 0x00, 0x00, 0xF3, 0x80, 0xFF, 0x02, 0x0B, 0x00, 
+	0xF4, 0x8E, 0xFF, 0x03, 0x58, 0x55, 0x86, 0xEB, 0x83, 0xFF, 0x03, 0x9C, 0x57, 0x55, 0xD6, 0x84, 0xFF, 0x0A, 0xCF, 0x48, 0x01, 0x00, 0x00, 0x40, 0xFE, 0xFF, 0xBF, 0x00, 0x40, 0x8E, 0xFF, 0x00, 0xBF, 0x81, 0x00, 0x00, 0xA3, 0x80, 0xFF, 0x01, 0xDF, 0x16, 0x80, 0x00, 0x00, 0x30, 0x86, 0xFF, 0x08, 0xDF, 
+	0x59, 0x02, 0x00, 0x61, 0x89, 0x04, 0x00, 0xF4, 0x8E, 0xFF, 0x00, 0x8F, 0x82, 0x00, 0x03, 0xC2, 0xFF, 0xFF, 0x07, 0x81, 0x00, 0x00, 0x10, 0x88, 0xFF, 0x01, 0xCF, 0x01, 0x80, 0x00, 0x00, 0x50, 0x8F, 0xFF, 0x0E, 0x8F, 0x00, 0xD8, 0xAD, 0x37, 0x00, 0x00, 0xFB, 0x5F, 0x00, 0x10, 0x95, 0xDB, 0x3D, 0x00, 
+	0x89, 0xFF, 0x04, 0x6E, 0x00, 0x00, 0x20, 0xFA, 0x8F, 0xFF, 0x0E, 0x9F, 0x00, 0xF9, 0xFF, 0xFF, 0x3C, 0x00, 0xD1, 0x06, 0x00, 0xF8, 0xFF, 0xFF, 0x1F, 0x10, 0x8A, 0xFF, 0x02, 0xBF, 0xBB, 0xFD, 0x90, 0xFF, 0x02, 0xAF, 0x00, 0xF8, 0x80, 0xFF, 0x03, 0x05, 0x20, 0x00, 0xC1, 0x80, 0xFF, 0x01, 0x0F, 0x30, 
+	0xA0, 0xFF, 0x02, 0xDF, 0x00, 0xF4, 0x80, 0xFF, 0x03, 0x2F, 0x00, 0x00, 0xF9, 0x80, 0xFF, 0x01, 0x0C, 0x50, 0xA1, 0xFF, 0x01, 0x02, 0xE0, 0x80, 0xFF, 0x02, 0x9F, 0x00, 0x20, 0x81, 0xFF, 0x01, 0x07, 0xA0, 0xA1, 0xFF, 0x01, 0x07, 0x70, 0x80, 0xFF, 0x02, 0xEF, 0x00, 0x60, 0x80, 0xFF, 0x02, 0xEF, 0x01, 
+	0xE0, 0xA1, 0xFF, 0x02, 0x0E, 0x00, 0xFA, 0x80, 0xFF, 0x01, 0x02, 0xA0, 0x80, 0xFF, 0x02, 0x3F, 0x00, 0xF6, 0xA1, 0xFF, 0x0D, 0x8F, 0x00, 0x70, 0xFE, 0xFF, 0xFF, 0x05, 0xD0, 0xFF, 0xFF, 0xBF, 0x02, 0x20, 0xFE, 0xA2, 0xFF, 0x0B, 0x06, 0x00, 0x50, 0xC9, 0xEE, 0x04, 0xC0, 0xDE, 0x7A, 0x03, 0x00, 0xD1, 
+	0xA3, 0xFF, 0x00, 0x8F, 0x86, 0x00, 0x01, 0x30, 0xFD, 0xA4, 0xFF, 0x01, 0x7E, 0x01, 0x83, 0x00, 0x01, 0x30, 0xFA, 0xA6, 0xFF, 0x07, 0xCF, 0x69, 0x55, 0x01, 0x40, 0x55, 0xA8, 0xFE, 0xAA, 0xFF, 0x01, 0x05, 0xD0, 0xAD, 0xFF, 0x01, 0x05, 0xD0, 0xAD, 0xFF, 0x01, 0x05, 0xD0, 0xAD, 0xFF, 0x01, 0x05, 0xD0, 
+	0xA5, 0xFF, 0x01, 0x9F, 0x01, 0x8B, 0x00, 0x01, 0x40, 0xFE, 0x9D, 0xFF, 0x00, 0x0A, 0x8D, 0x00, 0x00, 0xF3, 0x9D, 0xFF, 0x01, 0x03, 0x20, 0x8B, 0x22, 0x01, 0x01, 0xC0, 0x9D, 0xFF, 0x01, 0x02, 0xF1, 0x8B, 0xFF, 0x01, 0x08, 0xA0, 0x9D, 0xFF, 0x01, 0x02, 0xF1, 0x8B, 0xFF, 0x01, 0x08, 0xA0, 0x9D, 0xFF, 
+	0x01, 0x02, 0xF1, 0x8B, 0xFF, 0x01, 0x08, 0xA0, 0x9D, 0xFF, 0x01, 0x03, 0x90, 0x80, 0x99, 0x03, 0xA9, 0xFF, 0xFF, 0x9D, 0x84, 0x99, 0x01, 0x04, 0xB0, 0x9D, 0xFF, 0x00, 0x07, 0x82, 0x00, 0x02, 0xF6, 0xEF, 0x01, 0x85, 0x00, 0x00, 0xE0, 0x9D, 0xFF, 0x00, 0x3E, 0x82, 0x00, 0x01, 0xF6, 0xEF, 0x86, 0x00, 
+	0x00, 0xFA, 0x9E, 0xFF, 0x07, 0x08, 0x40, 0xAA, 0xAA, 0xBA, 0xFF, 0xFF, 0xAD, 0x82, 0xAA, 0x02, 0x9A, 0x00, 0xE2, 0x9F, 0xFF, 0x01, 0x0E, 0x40, 0x88, 0xFF, 0x02, 0xCF, 0x00, 0xF6, 0x9F, 0xFF, 0x01, 0x2F, 0x10, 0x88, 0xFF, 0x02, 0x8F, 0x00, 0xFA, 0x9F, 0xFF, 0x02, 0x5F, 0x00, 0xFC, 0x87, 0xFF, 0x02, 
+	0x5F, 0x00, 0xFD, 0x9F, 0xFF, 0x02, 0x9F, 0x00, 0xF9, 0x87, 0xFF, 0x01, 0x1F, 0x10, 0xA0, 0xFF, 0x02, 0xCF, 0x00, 0xF5, 0x87, 0xFF, 0x01, 0x0D, 0x40, 0xA1, 0xFF, 0x01, 0x00, 0xF2, 0x87, 0xFF, 0x01, 0x0A, 0x80, 0xA1, 0xFF, 0x01, 0x03, 0xE0, 0x87, 0xFF, 0x01, 0x06, 0xB0, 0xA1, 0xFF, 0x01, 0x07, 0xB0, 
+	0x87, 0xFF, 0x01, 0x03, 0xE0, 0xA1, 0xFF, 0x01, 0x0B, 0x70, 0x87, 0xFF, 0x01, 0x00, 0xF2, 0xA1, 0xFF, 0x01, 0x0E, 0x40, 0x86, 0xFF, 0x02, 0xCF, 0x00, 0xF6, 0xA1, 0xFF, 0x01, 0x2F, 0x10, 0x86, 0xFF, 0x02, 0x8F, 0x00, 0xFA, 0xA1, 0xFF, 0x02, 0x5F, 0x00, 0xFC, 0x85, 0xFF, 0x02, 0x4F, 0x00, 0xFD, 0xA1, 
+	0xFF, 0x02, 0xAF, 0x00, 0xD3, 0x85, 0xFF, 0x01, 0x09, 0x20, 0xA3, 0xFF, 0x01, 0x02, 0x00, 0x84, 0x22, 0x02, 0x12, 0x00, 0xA0, 0xA3, 0xFF, 0x00, 0x2D, 0x87, 0x00, 0x00, 0xF8, 0xA4, 0xFF, 0x00, 0x28, 0x85, 0x00, 0x00, 0xC5, 0x9E, 0xFF, 
 	};
+const Icon plantwateringlow_icon = {plantwateringlow_width, plantwateringlow_height, sizeof(plantwateringlow_data), plantwateringlow_data, NULL};
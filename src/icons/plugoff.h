@@ -1,104 +1,48 @@
+#pragma once
 const uint32_t plugoff_width = 100;
 const uint32_t plugoff_height = 100;
-const uint8_t plugoff_data[(100*100)/2] = {
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xBD, 0x79, 0x67, 0x45, 0x54, 0x65, 0x97, 0xDB, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x69, 0x14, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0x96, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6A, 0x13, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xA6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x16, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x54, 0x65, 0x56, 0x45, 0x12, 0x01, 0x00, 0x00, 0x00, 0x00, 0x61, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAE, 0x04, 0x00, 0x00, 0x00, 0x31, 0x86, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0x69, 0x13, 0x00, 0x00, 0x00, 0x40, 0xEA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x03, 0x00, 0x00, 0x20, 0x96, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x69, 0x02, 0x00, 0x00, 0x30, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x03, 0x00, 0x00, 0x50, 0xEB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBE, 0x05, 0x00, 0x00, 0x20, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x04, 0x00, 0x00, 0x82, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x28, 0x00, 0x00, 0x40, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x83, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x38, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4D, 0x00, 0x00, 0x91, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x19, 0x00, 0x00, 0xC3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x01, 0x00, 0x60, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x06, 0x00, 0x10, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x20, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x04, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x40, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x20, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x01, 0x00, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9A, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xA9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4E, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x01, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x08, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xEF, 0x02, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x02, 0x10, 0xFE, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x7F, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xF7, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x1D, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xD1, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x08, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x80, 0xFF, 0xFF, 
-	0xFF, 0xEF, 0x02, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x20, 0xFE, 0xFF, 
-	0xFF, 0xAF, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xFA, 0xFF, 
-	0xFF, 0x4F, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xF4, 0xFF, 
-	0xFF, 0x0D, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0xD0, 0xFF, 
-	0xFF, 0x08, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x67, 0x66, 0x66, 0x66, 0x26, 0x00, 0x61, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x16, 0x00, 0x62, 0x66, 0x66, 0x66, 0x76, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x80, 0xFF, 
-	0xFF, 0x04, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x40, 0xFF, 
-	0xDF, 0x01, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x10, 0xFD, 
-	0xAF, 0x00, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x55, 0x00, 0x20, 0x45, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x54, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0x00, 0xFA, 
-	0x6F, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xF7, 
-	0x3E, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xF4, 
-	0x1D, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0xD1, 
-	0x0C, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0xC0, 
-	0x09, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x90, 
-	0x07, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x70, 
-	0x05, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x50, 
-	0x03, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x30, 
-	0x02, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x20, 
-	0x01, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x10, 
-	0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 
-	0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 
-	0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 
-	0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x93, 
-	0x01, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 
-	0x01, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x03, 0x20, 0xCB, 0xCC, 0xCC, 0xEC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0x03, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0x04, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0x06, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0x08, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDE, 0xDD, 0xDD, 0xCD, 0x02, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0x0B, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0xFF, 
-	0x0D, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x03, 0xF8, 
-	0x2E, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0xE3, 
-	0x5F, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xF5, 
-	0x8F, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x23, 0xFC, 
-	0xBF, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEE, 0xFF, 
-	0xEF, 0x02, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0x05, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x02, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBD, 0xFF, 0xFF, 
-	0xFF, 0x0A, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1B, 0xB1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0xF7, 0xFF, 
-	0xFF, 0x1F, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xF2, 0xFF, 
-	0xFF, 0x6F, 0x00, 0xE1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0xF7, 0xFF, 
-	0xFF, 0xDF, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xFD, 0xFF, 
-	0xFF, 0xFF, 0x05, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x01, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x02, 0x50, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x0B, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0xB0, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x4F, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3B, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0xF4, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xAF, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x00, 0x94, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x49, 0x00, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xFA, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x04, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x02, 0x00, 0x00, 0x41, 0xA7, 0xCB, 0xBC, 0x7A, 0x14, 0x00, 0x00, 0x20, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8E, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xE8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xEF, 0x02, 0x10, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x59, 0x13, 0x00, 0x00, 0x31, 0x95, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0xDE, 0xED, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x22, 0x22, 0x22, 0x22, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0x00, 0x00, 0x00, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x88, 0x03, 0x30, 0x88, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x03, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x01, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0x00, 0x10, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3D, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5D, 0x00, 0x00, 0xD3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x01, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x03, 0x00, 0x20, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x03, 0x00, 0x00, 0xE6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8D, 0x02, 0x00, 0x00, 0xB3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x59, 0x00, 0x00, 0x00, 0x93, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0x40, 0xFD, 0xFF, 0xEF, 0x7A, 0x13, 0x00, 0x00, 0x00, 0xA3, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x30, 0x55, 0x02, 0x00, 0x00, 0x00, 0x10, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x41, 0xD8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x17, 0x00, 0x00, 0x00, 0x20, 0x96, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x69, 0x55, 0xB7, 0xED, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+const uint8_t plugoff_data[2057] = { // run length encoded
+0x91, 0xFF, 0x09, 0xEF, 0xBD, 0x79, 0x67, 0x45, 0x54, 0x65, 0x97, 0xDB, 0xFE, 0xA3, 0xFF, 0x02, 0xCF, 0x69, 0x14, 0x85, 0x00, 0x02, 0x41, 0x96, 0xFC, 0xA0, 0xFF, 0x01, 0x6A, 0x13, 0x89, 0x00, 0x01, 0x30, 0xA6, 0x9D, 0xFF, 0x01, 0xCF, 0x16, 0x82, 0x00, 0x06, 0x21, 0x54, 0x65, 0x56, 0x45, 0x12, 0x01, 
+	0x81, 0x00, 0x01, 0x61, 0xFC, 0x9A, 0xFF, 0x01, 0xAE, 0x04, 0x80, 0x00, 0x02, 0x31, 0x86, 0xDB, 0x83, 0xFF, 0x02, 0xBE, 0x69, 0x13, 0x80, 0x00, 0x01, 0x40, 0xEA, 0x98, 0xFF, 0x06, 0x9F, 0x03, 0x00, 0x00, 0x20, 0x96, 0xFC, 0x87, 0xFF, 0x06, 0xCF, 0x69, 0x02, 0x00, 0x00, 0x30, 0xF9, 0x96, 0xFF, 0x05, 
+	0xAF, 0x03, 0x00, 0x00, 0x50, 0xEB, 0x8B, 0xFF, 0x05, 0xBE, 0x05, 0x00, 0x00, 0x20, 0xFA, 0x94, 0xFF, 0x05, 0xDF, 0x04, 0x00, 0x00, 0x82, 0xFE, 0x8D, 0xFF, 0x05, 0xEF, 0x28, 0x00, 0x00, 0x40, 0xFC, 0x93, 0xFF, 0x03, 0x08, 0x00, 0x00, 0x83, 0x91, 0xFF, 0x03, 0x38, 0x00, 0x00, 0x80, 0x92, 0xFF, 0x04, 
+	0x4D, 0x00, 0x00, 0x91, 0xFE, 0x91, 0xFF, 0x04, 0xEF, 0x19, 0x00, 0x00, 0xC3, 0x90, 0xFF, 0x04, 0xAF, 0x01, 0x00, 0x60, 0xFE, 0x93, 0xFF, 0x04, 0xEF, 0x06, 0x00, 0x10, 0xF9, 0x8F, 0xFF, 0x03, 0x07, 0x00, 0x20, 0xFB, 0x95, 0xFF, 0x03, 0xBF, 0x02, 0x00, 0x70, 0x8E, 0xFF, 0x03, 0x5F, 0x00, 0x00, 0xE6, 
+	0x97, 0xFF, 0x03, 0x6F, 0x00, 0x00, 0xF5, 0x8C, 0xFF, 0x03, 0xEF, 0x04, 0x00, 0x90, 0x99, 0xFF, 0x03, 0x09, 0x00, 0x40, 0xFE, 0x8B, 0xFF, 0x03, 0x3E, 0x00, 0x20, 0xFC, 0x99, 0xFF, 0x03, 0xCF, 0x01, 0x00, 0xE3, 0x8A, 0xFF, 0x03, 0xEF, 0x03, 0x00, 0xD2, 0x85, 0xFF, 0x00, 0x9A, 0x88, 0xFF, 0x01, 0xEF, 
+	0xA9, 0x85, 0xFF, 0x03, 0x2D, 0x00, 0x30, 0xFE, 0x89, 0xFF, 0x03, 0x4F, 0x00, 0x30, 0xFE, 0x84, 0xFF, 0x02, 0x9F, 0x00, 0xF7, 0x87, 0xFF, 0x02, 0x7F, 0x00, 0xF9, 0x84, 0xFF, 0x03, 0xEF, 0x03, 0x00, 0xF4, 0x89, 0xFF, 0x02, 0x05, 0x00, 0xE4, 0x85, 0xFF, 0x02, 0x6F, 0x00, 0xF4, 0x87, 0xFF, 0x02, 0x4F, 
+	0x00, 0xF6, 0x85, 0xFF, 0x02, 0x4E, 0x00, 0x50, 0x88, 0xFF, 0x03, 0x7F, 0x00, 0x30, 0xFE, 0x85, 0xFF, 0x02, 0x6F, 0x00, 0xF4, 0x87, 0xFF, 0x02, 0x4F, 0x00, 0xF6, 0x85, 0xFF, 0x03, 0xEF, 0x03, 0x00, 0xF6, 0x87, 0xFF, 0x02, 0x09, 0x00, 0xD2, 0x86, 0xFF, 0x02, 0x6F, 0x00, 0xF4, 0x87, 0xFF, 0x02, 0x4F, 
+	0x00, 0xF6, 0x86, 0xFF, 0x02, 0x2D, 0x00, 0x90, 0x86, 0xFF, 0x03, 0xCF, 0x00, 0x10, 0xFC, 0x86, 0xFF, 0x02, 0x6F, 0x00, 0xF4, 0x87, 0xFF, 0x02, 0x4F, 0x00, 0xF6, 0x86, 0xFF, 0x03, 0xCF, 0x01, 0x00, 0xFC, 0x85, 0xFF, 0x02, 0x3F, 0x00, 0xA0, 0x87, 0xFF, 0x02, 0x6F, 0x00, 0xF4, 0x87, 0xFF, 0x02, 0x4F, 
+	0x00, 0xF6, 0x87, 0xFF, 0x02, 0x0A, 0x00, 0xE3, 0x85, 0xFF, 0x02, 0x07, 0x00, 0xF6, 0x87, 0xFF, 0x02, 0x6F, 0x00, 0xF4, 0x87, 0xFF, 0x02, 0x4F, 0x00, 0xF6, 0x87, 0xFF, 0x02, 0x6F, 0x00, 0x70, 0x84, 0xFF, 0x02, 0xCF, 0x00, 0x30, 0x88, 0xFF, 0x02, 0x6F, 0x00, 0xF4, 0x87, 0xFF, 0x02, 0x4F, 0x00, 0xF6, 
+	0x88, 0xFF, 0x02, 0x03, 0x00, 0xFC, 0x83, 0xFF, 0x02, 0x3F, 0x00, 0xC0, 0x88, 0xFF, 0x02, 0x6F, 0x00, 0xF4, 0x87, 0xFF, 0x02, 0x4F, 0x00, 0xF6, 0x88, 0xFF, 0x02, 0x0D, 0x00, 0xF3, 0x83, 0xFF, 0x02, 0x08, 0x00, 0xF7, 0x88, 0xFF, 0x02, 0x6F, 0x00, 0xF4, 0x87, 0xFF, 0x02, 0x4F, 0x00, 0xF6, 0x88, 0xFF, 
+	0x02, 0x7F, 0x00, 0x90, 0x82, 0xFF, 0x03, 0xEF, 0x02, 0x20, 0xFE, 0x88, 0xFF, 0x02, 0x6F, 0x00, 0xF4, 0x87, 0xFF, 0x02, 0x4F, 0x00, 0xF6, 0x88, 0xFF, 0x03, 0xEF, 0x02, 0x10, 0xFE, 0x81, 0xFF, 0x02, 0x7F, 0x00, 0xA0, 0x89, 0xFF, 0x02, 0x6F, 0x00, 0xF4, 0x87, 0xFF, 0x02, 0x4F, 0x00, 0xF6, 0x89, 0xFF, 
+	0x02, 0x0A, 0x00, 0xF7, 0x81, 0xFF, 0x02, 0x1D, 0x00, 0xF4, 0x89, 0xFF, 0x02, 0x6F, 0x00, 0xF4, 0x87, 0xFF, 0x02, 0x4F, 0x00, 0xF6, 0x89, 0xFF, 0x02, 0x4F, 0x00, 0xD1, 0x81, 0xFF, 0x02, 0x08, 0x00, 0xFA, 0x89, 0xFF, 0x02, 0x6F, 0x00, 0xF4, 0x87, 0xFF, 0x02, 0x4F, 0x00, 0xF6, 0x89, 0xFF, 0x02, 0xAF, 
+	0x00, 0x80, 0x80, 0xFF, 0x02, 0xEF, 0x02, 0x30, 0x8A, 0xFF, 0x02, 0x6F, 0x00, 0xF4, 0x87, 0xFF, 0x02, 0x4F, 0x00, 0xF6, 0x8A, 0xFF, 0x07, 0x03, 0x20, 0xFE, 0xFF, 0xFF, 0xAF, 0x00, 0xA0, 0x8A, 0xFF, 0x02, 0x6F, 0x00, 0xF4, 0x87, 0xFF, 0x02, 0x4F, 0x00, 0xF6, 0x8A, 0xFF, 0x07, 0x0A, 0x00, 0xFA, 0xFF, 
+	0xFF, 0x4F, 0x00, 0xF2, 0x8A, 0xFF, 0x02, 0x6F, 0x00, 0xF4, 0x87, 0xFF, 0x02, 0x4F, 0x00, 0xF6, 0x8A, 0xFF, 0x07, 0x2F, 0x00, 0xF4, 0xFF, 0xFF, 0x0D, 0x00, 0xF8, 0x8A, 0xFF, 0x02, 0x7F, 0x00, 0xF5, 0x87, 0xFF, 0x02, 0x5F, 0x00, 0xF7, 0x8A, 0xFF, 0x07, 0x8F, 0x00, 0xD0, 0xFF, 0xFF, 0x08, 0x00, 0xFC, 
+	0x85, 0xFF, 0x01, 0xDF, 0x67, 0x80, 0x66, 0x02, 0x26, 0x00, 0x61, 0x87, 0x66, 0x02, 0x16, 0x00, 0x62, 0x80, 0x66, 0x01, 0x76, 0xFD, 0x85, 0xFF, 0x06, 0xCF, 0x00, 0x80, 0xFF, 0xFF, 0x04, 0x40, 0x86, 0xFF, 0x00, 0x3F, 0x95, 0x00, 0x00, 0xF3, 0x86, 0xFF, 0x05, 0x04, 0x40, 0xFF, 0xDF, 0x01, 0x90, 0x86, 
+	0xFF, 0x00, 0x1F, 0x95, 0x00, 0x00, 0xF1, 0x86, 0xFF, 0x05, 0x09, 0x10, 0xFD, 0xAF, 0x00, 0xC1, 0x86, 0xFF, 0x04, 0xBF, 0x55, 0x00, 0x20, 0x45, 0x90, 0x44, 0x01, 0x54, 0xFB, 0x86, 0xFF, 0x05, 0x1C, 0x00, 0xFA, 0x6F, 0x00, 0xF3, 0x88, 0xFF, 0x01, 0x02, 0x80, 0x9C, 0xFF, 0x05, 0x3F, 0x00, 0xF7, 0x3E, 
+	0x00, 0xF5, 0x88, 0xFF, 0x01, 0x02, 0x80, 0x9C, 0xFF, 0x05, 0x5F, 0x00, 0xF4, 0x1D, 0x00, 0xF9, 0x88, 0xFF, 0x01, 0x02, 0x80, 0x9C, 0xFF, 0x05, 0x9F, 0x00, 0xD1, 0x0C, 0x00, 0xFC, 0x88, 0xFF, 0x01, 0x02, 0x80, 0x8F, 0xFF, 0x01, 0xDF, 0xFB, 0x88, 0xFF, 0x05, 0xCF, 0x00, 0xC0, 0x09, 0x10, 0xFE, 0x88, 
+	0xFF, 0x01, 0x02, 0x80, 0x8F, 0xFF, 0x01, 0x1C, 0x70, 0x89, 0xFF, 0x03, 0x01, 0x90, 0x07, 0x20, 0x89, 0xFF, 0x01, 0x02, 0x80, 0x85, 0xFF, 0x01, 0xDF, 0xFD, 0x85, 0xFF, 0x01, 0x09, 0x10, 0x89, 0xFF, 0x03, 0x02, 0x70, 0x05, 0x40, 0x89, 0xFF, 0x01, 0x02, 0x80, 0x85, 0xFF, 0x01, 0x0B, 0xA0, 0x85, 0xFF, 
+	0x01, 0x09, 0x10, 0x89, 0xFF, 0x03, 0x04, 0x50, 0x03, 0x60, 0x89, 0xFF, 0x01, 0x02, 0x80, 0x85, 0xFF, 0x01, 0x03, 0x50, 0x85, 0xFF, 0x01, 0x09, 0x10, 0x89, 0xFF, 0x03, 0x06, 0x30, 0x02, 0x80, 0x89, 0xFF, 0x01, 0x02, 0x80, 0x84, 0xFF, 0x02, 0xAF, 0x00, 0x90, 0x85, 0xFF, 0x01, 0x09, 0x10, 0x89, 0xFF, 
+	0x03, 0x08, 0x20, 0x01, 0x90, 0x89, 0xFF, 0x01, 0x02, 0x80, 0x84, 0xFF, 0x02, 0x3F, 0x00, 0xF3, 0x85, 0xFF, 0x01, 0x09, 0x10, 0x89, 0xFF, 0x03, 0x09, 0x10, 0x00, 0x90, 0x89, 0xFF, 0x01, 0x02, 0x80, 0x84, 0xFF, 0x02, 0x0A, 0x00, 0xFA, 0x85, 0xFF, 0x01, 0x09, 0x10, 0x89, 0xFF, 0x03, 0x09, 0x00, 0x00, 
+	0xA0, 0x89, 0xFF, 0x01, 0x02, 0x80, 0x84, 0xFF, 0x01, 0x02, 0x30, 0x86, 0xFF, 0x01, 0x09, 0x10, 0x89, 0xFF, 0x03, 0x0A, 0x00, 0x00, 0xA0, 0x89, 0xFF, 0x01, 0x02, 0x80, 0x83, 0xFF, 0x02, 0x9F, 0x00, 0xA0, 0x86, 0xFF, 0x01, 0x09, 0x10, 0x89, 0xFF, 0x03, 0x0B, 0x00, 0x00, 0xA0, 0x89, 0xFF, 0x01, 0x02, 
+	0x80, 0x83, 0xFF, 0x02, 0x3F, 0x00, 0xF3, 0x86, 0xFF, 0x01, 0x09, 0x10, 0x89, 0xFF, 0x03, 0x6F, 0x93, 0x01, 0x90, 0x89, 0xFF, 0x01, 0x02, 0x80, 0x83, 0xFF, 0x02, 0x09, 0x00, 0xFA, 0x86, 0xFF, 0x01, 0x09, 0x10, 0x8A, 0xFF, 0x02, 0xFE, 0x01, 0x80, 0x89, 0xFF, 0x01, 0x02, 0x80, 0x82, 0xFF, 0x06, 0xEF, 
+	0x03, 0x20, 0xCB, 0xCC, 0xCC, 0xEC, 0x83, 0xFF, 0x01, 0x09, 0x10, 0x8B, 0xFF, 0x01, 0x03, 0x70, 0x89, 0xFF, 0x01, 0x02, 0x80, 0x82, 0xFF, 0x00, 0xAF, 0x83, 0x00, 0x00, 0xFB, 0x82, 0xFF, 0x01, 0x09, 0x10, 0x8B, 0xFF, 0x01, 0x04, 0x50, 0x89, 0xFF, 0x01, 0x02, 0x80, 0x82, 0xFF, 0x00, 0x6F, 0x83, 0x00, 
+	0x00, 0xF6, 0x82, 0xFF, 0x01, 0x09, 0x10, 0x8B, 0xFF, 0x01, 0x06, 0x30, 0x89, 0xFF, 0x01, 0x02, 0x80, 0x82, 0xFF, 0x00, 0xBF, 0x83, 0x00, 0x00, 0xFA, 0x82, 0xFF, 0x01, 0x08, 0x20, 0x8B, 0xFF, 0x01, 0x08, 0x10, 0x89, 0xFF, 0x01, 0x02, 0x80, 0x83, 0xFF, 0x05, 0xDE, 0xDD, 0xDD, 0xCD, 0x02, 0x30, 0x83, 
+	0xFF, 0x01, 0x08, 0x20, 0x8B, 0xFF, 0x02, 0x0B, 0x10, 0xFD, 0x88, 0xFF, 0x01, 0x04, 0x60, 0x86, 0xFF, 0x02, 0xAF, 0x00, 0x90, 0x83, 0xFF, 0x01, 0x06, 0x30, 0x89, 0xFF, 0x04, 0xCE, 0xFF, 0x0D, 0x00, 0xFB, 0x88, 0xFF, 0x01, 0x06, 0x40, 0x86, 0xFF, 0x02, 0x3E, 0x00, 0xF3, 0x83, 0xFF, 0x01, 0x04, 0x60, 
+	0x88, 0xFF, 0x05, 0xDF, 0x03, 0xF8, 0x2E, 0x00, 0xF7, 0x88, 0xFF, 0x01, 0x08, 0x10, 0x86, 0xFF, 0x02, 0x0A, 0x00, 0xF9, 0x83, 0xFF, 0x01, 0x01, 0x80, 0x88, 0xFF, 0x05, 0x8F, 0x00, 0xE3, 0x5F, 0x00, 0xF4, 0x88, 0xFF, 0x02, 0x0C, 0x00, 0xFC, 0x85, 0xFF, 0x01, 0x02, 0x20, 0x83, 0xFF, 0x02, 0xCF, 0x00, 
+	0xC0, 0x88, 0xFF, 0x05, 0x6F, 0x00, 0xF5, 0x8F, 0x00, 0xE2, 0x88, 0xFF, 0x02, 0x1E, 0x00, 0xF6, 0x84, 0xFF, 0x02, 0x9F, 0x00, 0xA0, 0x83, 0xFF, 0x02, 0x6F, 0x00, 0xE1, 0x88, 0xFF, 0x05, 0xCF, 0x23, 0xFC, 0xBF, 0x00, 0xB0, 0x88, 0xFF, 0x02, 0x6F, 0x00, 0xF2, 0x84, 0xFF, 0x02, 0x2F, 0x00, 0xF3, 0x83, 
+	0xFF, 0x02, 0x2F, 0x00, 0xF6, 0x89, 0xFF, 0x04, 0xEE, 0xFF, 0xEF, 0x02, 0x70, 0x88, 0xFF, 0x02, 0xBF, 0x00, 0x90, 0x84, 0xFF, 0x02, 0x09, 0x00, 0xFA, 0x83, 0xFF, 0x02, 0x09, 0x00, 0xFB, 0x8C, 0xFF, 0x02, 0x05, 0x30, 0xFE, 0x88, 0xFF, 0x02, 0x04, 0x20, 0xFE, 0x83, 0xFF, 0x01, 0x05, 0x30, 0x83, 0xFF, 
+	0x02, 0xEF, 0x02, 0x40, 0x89, 0xFF, 0x00, 0xBD, 0x80, 0xFF, 0x02, 0x0A, 0x00, 0xFC, 0x88, 0xFF, 0x02, 0x0A, 0x00, 0xF7, 0x83, 0xFF, 0x01, 0x1B, 0xB1, 0x83, 0xFF, 0x02, 0x7F, 0x00, 0xA0, 0x88, 0xFF, 0x07, 0xDF, 0x01, 0xF7, 0xFF, 0xFF, 0x1F, 0x00, 0xF6, 0x88, 0xFF, 0x02, 0x4F, 0x00, 0xB0, 0x83, 0xFF, 
+	0x01, 0xEF, 0xFE, 0x83, 0xFF, 0x02, 0x0B, 0x00, 0xF4, 0x88, 0xFF, 0x07, 0x6F, 0x00, 0xF2, 0xFF, 0xFF, 0x6F, 0x00, 0xE1, 0x88, 0xFF, 0x03, 0xCF, 0x00, 0x10, 0xFD, 0x89, 0xFF, 0x03, 0xDF, 0x01, 0x00, 0xFC, 0x88, 0xFF, 0x07, 0x0E, 0x00, 0xF7, 0xFF, 0xFF, 0xDF, 0x00, 0x80, 0x89, 0xFF, 0x02, 0x09, 0x00, 
+	0xD2, 0x89, 0xFF, 0x02, 0x2D, 0x00, 0x90, 0x89, 0xFF, 0x02, 0x07, 0x00, 0xFD, 0x80, 0xFF, 0x01, 0x05, 0x20, 0x89, 0xFF, 0x03, 0x6F, 0x00, 0x10, 0xFC, 0x87, 0xFF, 0x03, 0xCF, 0x01, 0x00, 0xF6, 0x88, 0xFF, 0x02, 0xEF, 0x02, 0x50, 0x81, 0xFF, 0x02, 0x0B, 0x00, 0xF8, 0x89, 0xFF, 0x02, 0x05, 0x00, 0x80, 
+	0x87, 0xFF, 0x02, 0x08, 0x00, 0x50, 0x89, 0xFF, 0x02, 0x8F, 0x00, 0xB0, 0x81, 0xFF, 0x02, 0x4F, 0x00, 0xE2, 0x89, 0xFF, 0x03, 0x6F, 0x00, 0x00, 0xB3, 0x85, 0xFF, 0x03, 0x3B, 0x00, 0x00, 0xF6, 0x89, 0xFF, 0x02, 0x2E, 0x00, 0xF4, 0x81, 0xFF, 0x02, 0xAF, 0x00, 0x80, 0x8A, 0xFF, 0x04, 0x08, 0x00, 0x00, 
+	0x94, 0xFE, 0x81, 0xFF, 0x04, 0xEF, 0x49, 0x00, 0x00, 0x80, 0x8A, 0xFF, 0x02, 0x07, 0x00, 0xFA, 0x82, 0xFF, 0x02, 0x04, 0x00, 0xFD, 0x89, 0xFF, 0x0D, 0xBF, 0x02, 0x00, 0x00, 0x41, 0xA7, 0xCB, 0xBC, 0x7A, 0x14, 0x00, 0x00, 0x20, 0xFB, 0x89, 0xFF, 0x02, 0xCF, 0x00, 0x40, 0x83, 0xFF, 0x02, 0x0C, 0x00, 
+	0xF4, 0x8A, 0xFF, 0x01, 0x8F, 0x01, 0x85, 0x00, 0x01, 0x20, 0xF8, 0x8A, 0xFF, 0x02, 0x4F, 0x00, 0xC0, 0x83, 0xFF, 0x02, 0x7F, 0x00, 0x90, 0x8B, 0xFF, 0x01, 0x8E, 0x04, 0x83, 0x00, 0x01, 0x40, 0xE8, 0x8B, 0xFF, 0x02, 0x08, 0x00, 0xF7, 0x83, 0xFF, 0x03, 0xEF, 0x02, 0x10, 0xFD, 0x8B, 0xFF, 0x07, 0xCF, 
+	0x59, 0x13, 0x00, 0x00, 0x31, 0x95, 0xFC, 0x8B, 0xFF, 0x03, 0xCF, 0x00, 0x20, 0xFE, 0x84, 0xFF, 0x02, 0x0B, 0x00, 0xF3, 0x8D, 0xFF, 0x03, 0xEF, 0xDE, 0xED, 0xFE, 0x8D, 0xFF, 0x02, 0x3E, 0x00, 0xB0, 0x85, 0xFF, 0x02, 0x7F, 0x00, 0x60, 0xA1, 0xFF, 0x02, 0x06, 0x00, 0xF7, 0x86, 0xFF, 0x02, 0x03, 0x00, 
+	0xF8, 0x9F, 0xFF, 0x02, 0x8F, 0x00, 0x40, 0x87, 0xFF, 0x02, 0x1D, 0x00, 0x90, 0x9F, 0xFF, 0x02, 0x09, 0x00, 0xD1, 0x87, 0xFF, 0x03, 0xBF, 0x00, 0x00, 0xFA, 0x8A, 0xFF, 0x00, 0x8F, 0x81, 0x22, 0x00, 0xF8, 0x8A, 0xFF, 0x03, 0xAF, 0x00, 0x00, 0xFB, 0x88, 0xFF, 0x02, 0x0A, 0x00, 0xA0, 0x8A, 0xFF, 0x00, 
+	0x0C, 0x81, 0x00, 0x00, 0xC0, 0x8A, 0xFF, 0x02, 0x0A, 0x00, 0xA0, 0x89, 0xFF, 0x03, 0x9F, 0x00, 0x00, 0xF9, 0x89, 0xFF, 0x00, 0x2E, 0x81, 0x00, 0x00, 0xD2, 0x89, 0xFF, 0x03, 0x9F, 0x00, 0x00, 0xF9, 0x8A, 0xFF, 0x02, 0x08, 0x00, 0x80, 0x89, 0xFF, 0x05, 0xDF, 0x88, 0x03, 0x30, 0x88, 0xFD, 0x89, 0xFF, 
+	0x02, 0x08, 0x00, 0x90, 0x8B, 0xFF, 0x03, 0x9F, 0x00, 0x00, 0xF6, 0x8A, 0xFF, 0x01, 0x05, 0x50, 0x8A, 0xFF, 0x03, 0x6F, 0x00, 0x00, 0xF9, 0x8C, 0xFF, 0x02, 0x0A, 0x00, 0x50, 0x8A, 0xFF, 0x01, 0x05, 0x50, 0x89, 0xFF, 0x03, 0xDF, 0x03, 0x00, 0xA0, 0x8D, 0xFF, 0x03, 0xBF, 0x01, 0x00, 0xFD, 0x89, 0xFF, 
+	0x01, 0x05, 0x50, 0x89, 0xFF, 0x03, 0x1A, 0x00, 0x10, 0xFB, 0x8E, 0xFF, 0x01, 0x3D, 0x40, 0x8A, 0xFF, 0x01, 0x05, 0x50, 0x88, 0xFF, 0x03, 0x5D, 0x00, 0x00, 0xD3, 0x90, 0xFF, 0x00, 0xFC, 0x8A, 0xFF, 0x01, 0x05, 0x50, 0x87, 0xFF, 0x03, 0x8F, 0x01, 0x00, 0x60, 0x9F, 0xFF, 0x01, 0x06, 0x50, 0x86, 0xFF, 
+	0x04, 0xAF, 0x03, 0x00, 0x20, 0xFA, 0x9F, 0xFF, 0x01, 0x07, 0x40, 0x85, 0xFF, 0x04, 0xAF, 0x03, 0x00, 0x00, 0xE6, 0xA0, 0xFF, 0x02, 0x09, 0x00, 0xFC, 0x83, 0xFF, 0x04, 0x8D, 0x02, 0x00, 0x00, 0xB3, 0xA1, 0xFF, 0x02, 0x1E, 0x00, 0xF4, 0x81, 0xFF, 0x01, 0xDF, 0x59, 0x80, 0x00, 0x00, 0x93, 0xA2, 0xFF, 
+	0x07, 0x7F, 0x00, 0x40, 0xFD, 0xFF, 0xEF, 0x7A, 0x13, 0x80, 0x00, 0x01, 0xA3, 0xFE, 0xA3, 0xFF, 0x04, 0x03, 0x00, 0x30, 0x55, 0x02, 0x80, 0x00, 0x01, 0x10, 0xB4, 0xA5, 0xFF, 0x00, 0x3E, 0x83, 0x00, 0x01, 0x41, 0xD8, 0xA6, 0xFF, 0x01, 0xEF, 0x17, 0x80, 0x00, 0x02, 0x20, 0x96, 0xFC, 0xA8, 0xFF, 0x04, 
+	0xDF, 0x69, 0x55, 0xB7, 0xED, 0x90, 0xFF, 
 	};
+const Icon plugoff_icon = {plugoff_width, plugoff_height, sizeof(plugoff_data), plugoff_data, NULL};
@@ -1,104 +1,47 @@
+#pragma once
+#include "waterheateroff.h"
 const uint32_t waterheateron_width = 100;
 const uint32_t waterheateron_height = 100;
-const uint8_t waterheateron_data[(100*100)/2] = {
-0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7B, 0x35, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x43, 0x96, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF5, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2D, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x32, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x91, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xEF, 0xED, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFE, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x2F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x30, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0xA0, 0xFF, 0x08, 0x12, 0x11, 0x21, 0x31, 0xFF, 0x0F, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0xA0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x10, 0xFF, 0x0F, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0xA0, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x20, 0xFF, 0x0F, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0xA0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x10, 0xFF, 0x0F, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0xDD, 0xED, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0xA0, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x10, 0xFF, 0x0F, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8C, 0x13, 0x00, 0x20, 0xA6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0xA0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x10, 0xFF, 0x0F, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x01, 0x00, 0x00, 0x00, 0x00, 0xC4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0xA0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x10, 0xFF, 0x0F, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x03, 0x00, 0x00, 0x11, 0x00, 0x00, 0x00, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0xA0, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x20, 0xFF, 0x0F, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0x20, 0xC8, 0xFF, 0xAE, 0x05, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0xA0, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x0F, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xAF, 0x01, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0xA0, 0xFF, 0x7B, 0x78, 0x87, 0x87, 0x87, 0xFF, 0x0F, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1C, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xF5, 0xFF, 0x6D, 0x12, 0xB4, 0xFF, 0xAF, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0xFD, 0xCF, 0x01, 0x00, 0x00, 0xF7, 0xFF, 0x04, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x10, 0xA8, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x9A, 0x03, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x07, 0x50, 0xFF, 0x2E, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0x0A, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x05, 0x80, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x0D, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x04, 0x90, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x20, 0xFF, 0x0F, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x04, 0x90, 0xFF, 0x08, 0x00, 0x00, 0x00, 0x30, 0xFF, 0x0E, 0x00, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x06, 0x70, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x70, 0xFF, 0x0C, 0x10, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x09, 0x20, 0xFE, 0x6F, 0x00, 0x00, 0x00, 0xE2, 0xFF, 0x07, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x10, 0x11, 0x01, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0xFA, 0xFF, 0x17, 0x00, 0x40, 0xFD, 0xEF, 0x01, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x10, 0xD7, 0xFF, 0x9E, 0x03, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xD1, 0xFF, 0xCF, 0x99, 0xFB, 0xFF, 0x5F, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0xC2, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xDF, 0x00, 0x30, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x91, 0xFE, 0xFF, 0xFF, 0x4C, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x70, 0xFF, 0x9F, 0x01, 0xE5, 0xFF, 0x0C, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x62, 0x88, 0x47, 0x00, 0x00, 0xE3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0xC0, 0xFF, 0x09, 0x00, 0x40, 0xFF, 0x4F, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0xF1, 0xFF, 0x02, 0x00, 0x00, 0xFB, 0x6F, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x16, 0x00, 0x00, 0x00, 0x30, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0xF1, 0xFF, 0x01, 0x00, 0x00, 0xFB, 0x6F, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x7A, 0x55, 0x86, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0xD0, 0xFF, 0x06, 0x00, 0x20, 0xFE, 0x4F, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x80, 0xFF, 0x5E, 0x00, 0xC2, 0xFF, 0x1D, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x20, 0xFE, 0xFF, 0xCC, 0xFE, 0xFF, 0x06, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBB, 0xCC, 0xAB, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x04, 0x00, 0x00, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x30, 0xEB, 0xFF, 0xCF, 0x06, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x06, 0x00, 0x20, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x30, 0x55, 0x14, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x20, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x30, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x20, 0x28, 0x00, 0x00, 0x00, 0x70, 0x05, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0xD0, 0xDF, 0x00, 0x00, 0x00, 0xF8, 0x5F, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0xE0, 0xEF, 0x00, 0x00, 0x00, 0xF9, 0x5F, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x60, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x40, 0x3A, 0x00, 0x00, 0x00, 0x91, 0x07, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFD, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0D, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD0, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0E, 0x00, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA0, 0xFF, 0x5D, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0xA3, 0xFF, 0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x1E, 0x00, 0x90, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x09, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2E, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xDA, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xCD, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3F, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0x00, 0xC1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x50, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x00, 0xE2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0xF2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF1, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDD, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x30, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD1, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x32, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xD4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6D, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCE, 0xAB, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xDB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0x87, 0x87, 0x97, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x78, 0xE7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x10, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x00, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0x00, 0x00, 0x20, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x64, 0x55, 0x75, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x02, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xCF, 0xBC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x35, 0xD2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xF3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x00, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x00, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2F, 0x00, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x25, 0xFC, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x62, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 
+const uint8_t waterheateron_data[1983] = { // delta to waterheateroff, run length encoded
+0xFF, 0xFF, 0xEC, 0xBF, 0xFF, 0xBF, 0xFF, 0xCF, 0x80, 0xFF, 0x01, 0x7B, 0x35, 0x8C, 0x33, 0x02, 0x43, 0x96, 0xFE, 0x9A, 0xFF, 0x00, 0x18, 0x90, 0x00, 0x01, 0x50, 0xFD, 0x98, 0xFF, 0x00, 0x3D, 0x92, 0x00, 0x00, 0x90, 0x97, 0xFF, 0x01, 0xCF, 0x01, 0x93, 0x00, 0x00, 0xF7, 0x96, 0xFF, 0x00, 0x1D, 0x94, 
+	0x00, 0x00, 0x90, 0x96, 0xFF, 0x00, 0x04, 0x95, 0x00, 0x00, 0xFD, 0x94, 0xFF, 0x00, 0xAF, 0x96, 0x00, 0x00, 0xF5, 0x94, 0xFF, 0x00, 0x5F, 0x96, 0x00, 0x00, 0xE0, 0x94, 0xFF, 0x00, 0x2D, 0x96, 0x00, 0x00, 0x90, 0x94, 0xFF, 0x00, 0x0B, 0x96, 0x00, 0x00, 0x60, 0x94, 0xFF, 0x00, 0x0A, 0x96, 0x00, 0x00, 
+	0x40, 0x94, 0xFF, 0x00, 0x0A, 0x96, 0x00, 0x00, 0x30, 0x94, 0xFF, 0x00, 0x0A, 0x84, 0x00, 0x00, 0x32, 0x87, 0x33, 0x84, 0x00, 0x00, 0x30, 0x94, 0xFF, 0x00, 0x0A, 0x83, 0x00, 0x01, 0x91, 0xFE, 0x87, 0xFF, 0x00, 0x3B, 0x83, 0x00, 0x00, 0x30, 0x94, 0xFF, 0x00, 0x0A, 0x83, 0x00, 0x00, 0xFB, 0x89, 0xFF, 
+	0x00, 0x03, 0x82, 0x00, 0x00, 0x30, 0x94, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x03, 0x60, 0xFF, 0xEF, 0xED, 0x85, 0xEE, 0x02, 0xFE, 0xFF, 0x0B, 0x82, 0x00, 0x00, 0x30, 0x94, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x02, 0xC0, 0xFF, 0x09, 0x86, 0x00, 0x02, 0x50, 0xFF, 0x2F, 0x82, 0x00, 0x00, 0x30, 0x94, 0xFF, 0x00, 
+	0x0A, 0x82, 0x00, 0x02, 0xD0, 0xFF, 0x03, 0x87, 0x00, 0x01, 0xFE, 0x3F, 0x82, 0x00, 0x00, 0x30, 0x94, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x02, 0xE0, 0xFF, 0x03, 0x87, 0x00, 0x01, 0xFE, 0x3F, 0x82, 0x00, 0x00, 0x30, 0x94, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x04, 0xE0, 0xFF, 0x03, 0x30, 0xFD, 0x83, 0xFF, 0x03, 
+	0x07, 0x00, 0xFE, 0x3F, 0x82, 0x00, 0x00, 0x30, 0x94, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x03, 0xE0, 0xFF, 0x03, 0xA0, 0x84, 0xFF, 0x03, 0x0F, 0x00, 0xFE, 0x3F, 0x82, 0x00, 0x00, 0x30, 0x94, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x03, 0xE0, 0xFF, 0x03, 0xA0, 0x84, 0xFF, 0x03, 0x0F, 0x00, 0xFE, 0x3F, 0x82, 0x00, 
+	0x00, 0x30, 0x94, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x0E, 0xE0, 0xFF, 0x03, 0xA0, 0xFF, 0x08, 0x12, 0x11, 0x21, 0x31, 0xFF, 0x0F, 0x00, 0xFE, 0x3F, 0x82, 0x00, 0x00, 0x30, 0x94, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x05, 0xE0, 0xFF, 0x03, 0xA0, 0xFF, 0x07, 0x80, 0x00, 0x05, 0x10, 0xFF, 0x0F, 0x00, 0xFE, 0x3F, 
+	0x82, 0x00, 0x00, 0x30, 0x94, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x05, 0xE0, 0xFF, 0x03, 0xA0, 0xFF, 0x08, 0x80, 0x00, 0x05, 0x20, 0xFF, 0x0F, 0x00, 0xFE, 0x3F, 0x82, 0x00, 0x00, 0x30, 0x94, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x05, 0xE0, 0xFF, 0x03, 0xA0, 0xFF, 0x07, 0x80, 0x00, 0x05, 0x10, 0xFF, 0x0F, 0x00, 
+	0xFE, 0x3F, 0x82, 0x00, 0x00, 0x30, 0x87, 0xFF, 0x02, 0xDF, 0xDD, 0xED, 0x87, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x05, 0xE0, 0xFF, 0x03, 0xA0, 0xFF, 0x08, 0x80, 0x00, 0x05, 0x10, 0xFF, 0x0F, 0x00, 0xFE, 0x3F, 0x82, 0x00, 0x00, 0x30, 0x86, 0xFF, 0x04, 0x8C, 0x13, 0x00, 0x20, 0xA6, 0x86, 0xFF, 0x00, 0x0A, 
+	0x82, 0x00, 0x05, 0xE0, 0xFF, 0x03, 0xA0, 0xFF, 0x07, 0x80, 0x00, 0x05, 0x10, 0xFF, 0x0F, 0x00, 0xFE, 0x3F, 0x82, 0x00, 0x00, 0x30, 0x85, 0xFF, 0x01, 0x6F, 0x01, 0x81, 0x00, 0x00, 0xC4, 0x85, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x05, 0xE0, 0xFF, 0x03, 0xA0, 0xFF, 0x07, 0x80, 0x00, 0x05, 0x10, 0xFF, 0x0F, 
+	0x00, 0xFE, 0x3F, 0x82, 0x00, 0x00, 0x30, 0x84, 0xFF, 0x04, 0xDF, 0x03, 0x00, 0x00, 0x11, 0x80, 0x00, 0x00, 0xFA, 0x84, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x05, 0xE0, 0xFF, 0x03, 0xA0, 0xFF, 0x08, 0x80, 0x00, 0x05, 0x20, 0xFF, 0x0F, 0x00, 0xFE, 0x3F, 0x82, 0x00, 0x00, 0x30, 0x84, 0xFF, 0x08, 0x2E, 0x00, 
+	0x20, 0xC8, 0xFF, 0xAE, 0x05, 0x00, 0xA0, 0x84, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x05, 0xE0, 0xFF, 0x03, 0xA0, 0xFF, 0x07, 0x81, 0x00, 0x04, 0xFF, 0x0F, 0x00, 0xFE, 0x3F, 0x82, 0x00, 0x00, 0x30, 0x84, 0xFF, 0x02, 0x04, 0x00, 0xF7, 0x80, 0xFF, 0x03, 0xAF, 0x01, 0x00, 0xFC, 0x83, 0xFF, 0x00, 0x0A, 0x82, 
+	0x00, 0x06, 0xE0, 0xFF, 0x03, 0xA0, 0xFF, 0x7B, 0x78, 0x80, 0x87, 0x04, 0xFF, 0x0F, 0x00, 0xFE, 0x3F, 0x82, 0x00, 0x00, 0x30, 0x83, 0xFF, 0x02, 0x9F, 0x00, 0x80, 0x82, 0xFF, 0x02, 0x1C, 0x00, 0xF4, 0x83, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x03, 0xE0, 0xFF, 0x03, 0xA0, 0x84, 0xFF, 0x03, 0x0F, 0x00, 0xFE, 
+	0x3F, 0x82, 0x00, 0x00, 0x30, 0x83, 0xFF, 0x0A, 0x2F, 0x00, 0xF5, 0xFF, 0x6D, 0x12, 0xB4, 0xFF, 0xAF, 0x00, 0xB0, 0x83, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x03, 0xE0, 0xFF, 0x03, 0x80, 0x84, 0xFF, 0x03, 0x0D, 0x00, 0xFE, 0x3F, 0x82, 0x00, 0x00, 0x30, 0x83, 0xFF, 0x0A, 0x0B, 0x00, 0xFD, 0xCF, 0x01, 0x00, 
+	0x00, 0xF7, 0xFF, 0x04, 0x60, 0x83, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x04, 0xE0, 0xFF, 0x03, 0x10, 0xA8, 0x82, 0xAA, 0x04, 0x9A, 0x03, 0x00, 0xFE, 0x3F, 0x82, 0x00, 0x00, 0x30, 0x83, 0xFF, 0x03, 0x07, 0x50, 0xFF, 0x2E, 0x80, 0x00, 0x03, 0xB0, 0xFF, 0x0A, 0x30, 0x83, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x02, 
+	0xE0, 0xFF, 0x03, 0x87, 0x00, 0x01, 0xFE, 0x3F, 0x82, 0x00, 0x00, 0x30, 0x83, 0xFF, 0x03, 0x05, 0x80, 0xFF, 0x0A, 0x80, 0x00, 0x04, 0x50, 0xFF, 0x0D, 0x00, 0xFE, 0x82, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x02, 0xE0, 0xFF, 0x03, 0x87, 0x00, 0x01, 0xFE, 0x3F, 0x82, 0x00, 0x00, 0x30, 0x83, 0xFF, 0x03, 0x04, 
+	0x90, 0xFF, 0x08, 0x80, 0x00, 0x04, 0x20, 0xFF, 0x0F, 0x00, 0xFE, 0x82, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x02, 0xE0, 0xFF, 0x03, 0x87, 0x00, 0x01, 0xFE, 0x3F, 0x82, 0x00, 0x00, 0x30, 0x83, 0xFF, 0x03, 0x04, 0x90, 0xFF, 0x08, 0x80, 0x00, 0x04, 0x30, 0xFF, 0x0E, 0x00, 0xFE, 0x82, 0xFF, 0x00, 0x0A, 0x82, 
+	0x00, 0x02, 0xE0, 0xFF, 0x03, 0x87, 0x00, 0x01, 0xFE, 0x3F, 0x82, 0x00, 0x00, 0x30, 0x83, 0xFF, 0x03, 0x06, 0x70, 0xFF, 0x0C, 0x80, 0x00, 0x04, 0x70, 0xFF, 0x0C, 0x10, 0xFE, 0x82, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x02, 0xE0, 0xFF, 0x03, 0x87, 0x00, 0x01, 0xFE, 0x3F, 0x82, 0x00, 0x00, 0x30, 0x83, 0xFF, 
+	0x03, 0x09, 0x20, 0xFE, 0x6F, 0x80, 0x00, 0x03, 0xE2, 0xFF, 0x07, 0x40, 0x83, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x02, 0xE0, 0xFF, 0x03, 0x80, 0x00, 0x02, 0x10, 0x11, 0x01, 0x81, 0x00, 0x01, 0xFE, 0x3F, 0x82, 0x00, 0x00, 0x30, 0x83, 0xFF, 0x0A, 0x0E, 0x00, 0xFA, 0xFF, 0x17, 0x00, 0x40, 0xFD, 0xEF, 0x01, 
+	0x90, 0x83, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x09, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x10, 0xD7, 0xFF, 0x9E, 0x03, 0x80, 0x00, 0x01, 0xFE, 0x3F, 0x82, 0x00, 0x00, 0x30, 0x83, 0xFF, 0x0A, 0x6F, 0x00, 0xD1, 0xFF, 0xCF, 0x99, 0xFB, 0xFF, 0x5F, 0x00, 0xD1, 0x83, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x05, 0xE0, 0xFF, 
+	0x03, 0x00, 0x00, 0xC2, 0x80, 0xFF, 0x00, 0x6F, 0x80, 0x00, 0x01, 0xFE, 0x3F, 0x82, 0x00, 0x00, 0x30, 0x83, 0xFF, 0x03, 0xDF, 0x00, 0x30, 0xFD, 0x81, 0xFF, 0x02, 0x07, 0x00, 0xF8, 0x83, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x05, 0xE0, 0xFF, 0x03, 0x00, 0x10, 0xFC, 0x81, 0xFF, 0x04, 0x04, 0x00, 0x00, 0xFE, 
+	0x3F, 0x82, 0x00, 0x00, 0x30, 0x84, 0xFF, 0x08, 0x0A, 0x00, 0x91, 0xFE, 0xFF, 0xFF, 0x4C, 0x00, 0x40, 0x84, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x0E, 0xE0, 0xFF, 0x03, 0x00, 0x70, 0xFF, 0x9F, 0x01, 0xE5, 0xFF, 0x0C, 0x00, 0x00, 0xFE, 0x3F, 0x82, 0x00, 0x00, 0x30, 0x84, 0xFF, 0x08, 0x8F, 0x00, 0x00, 0x62, 
+	0x88, 0x47, 0x00, 0x00, 0xE3, 0x84, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x0E, 0xE0, 0xFF, 0x03, 0x00, 0xC0, 0xFF, 0x09, 0x00, 0x40, 0xFF, 0x4F, 0x00, 0x00, 0xFE, 0x3F, 0x82, 0x00, 0x00, 0x30, 0x85, 0xFF, 0x00, 0x1A, 0x82, 0x00, 0x00, 0x60, 0x85, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x0E, 0xE0, 0xFF, 0x03, 0x00, 
+	0xF1, 0xFF, 0x02, 0x00, 0x00, 0xFB, 0x6F, 0x00, 0x00, 0xFE, 0x3F, 0x82, 0x00, 0x00, 0x30, 0x85, 0xFF, 0x01, 0xEF, 0x16, 0x80, 0x00, 0x01, 0x30, 0xFB, 0x85, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x0E, 0xE0, 0xFF, 0x03, 0x00, 0xF1, 0xFF, 0x01, 0x00, 0x00, 0xFB, 0x6F, 0x00, 0x00, 0xFE, 0x3F, 0x82, 0x00, 0x00, 
+	0x30, 0x86, 0xFF, 0x04, 0xEF, 0x7A, 0x55, 0x86, 0xFC, 0x86, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x0E, 0xE0, 0xFF, 0x03, 0x00, 0xD0, 0xFF, 0x06, 0x00, 0x20, 0xFE, 0x4F, 0x00, 0x00, 0xFE, 0x3F, 0x82, 0x00, 0x00, 0x30, 0x94, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x0E, 0xE0, 0xFF, 0x03, 0x00, 0x80, 0xFF, 0x5E, 0x00, 
+	0xC2, 0xFF, 0x1D, 0x00, 0x00, 0xFE, 0x3F, 0x82, 0x00, 0x00, 0x30, 0x94, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x0E, 0xE0, 0xFF, 0x03, 0x00, 0x20, 0xFE, 0xFF, 0xCC, 0xFE, 0xFF, 0x06, 0x00, 0x00, 0xFE, 0x3F, 0x82, 0x00, 0x00, 0x30, 0x87, 0xFF, 0x03, 0xBB, 0xCC, 0xAB, 0xFE, 0x86, 0xFF, 0x00, 0x0A, 0x82, 0x00, 
+	0x05, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0xF4, 0x80, 0xFF, 0x00, 0x9F, 0x80, 0x00, 0x01, 0xFE, 0x3F, 0x82, 0x00, 0x00, 0x30, 0x87, 0xFF, 0x03, 0x04, 0x00, 0x00, 0xFD, 0x86, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x09, 0xE0, 0xFF, 0x03, 0x00, 0x00, 0x30, 0xEB, 0xFF, 0xCF, 0x06, 0x80, 0x00, 0x01, 0xFE, 0x3F, 0x82, 
+	0x00, 0x00, 0x30, 0x87, 0xFF, 0x03, 0x06, 0x00, 0x20, 0xFD, 0x86, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x02, 0xE0, 0xFF, 0x03, 0x80, 0x00, 0x02, 0x30, 0x55, 0x14, 0x81, 0x00, 0x01, 0xFE, 0x3F, 0x82, 0x00, 0x00, 0x30, 0x87, 0xFF, 0x03, 0x07, 0x00, 0x20, 0xFE, 0x86, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x02, 0xE0, 
+	0xFF, 0x03, 0x87, 0x00, 0x01, 0xFE, 0x3F, 0x82, 0x00, 0x00, 0x30, 0x87, 0xFF, 0x03, 0x07, 0x00, 0x30, 0xFE, 0x86, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x02, 0xE0, 0xFF, 0x03, 0x87, 0x00, 0x01, 0xFE, 0x3F, 0x82, 0x00, 0x00, 0x30, 0x87, 0xFF, 0x02, 0x08, 0x00, 0x40, 0x87, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x05, 
+	0xE0, 0xFF, 0x03, 0x00, 0x20, 0x28, 0x80, 0x00, 0x05, 0x70, 0x05, 0x00, 0x00, 0xFE, 0x3F, 0x82, 0x00, 0x00, 0x30, 0x87, 0xFF, 0x02, 0x09, 0x00, 0x40, 0x87, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x05, 0xE0, 0xFF, 0x03, 0x00, 0xD0, 0xDF, 0x80, 0x00, 0x05, 0xF8, 0x5F, 0x00, 0x00, 0xFE, 0x3F, 0x82, 0x00, 0x00, 
+	0x30, 0x87, 0xFF, 0x02, 0x0A, 0x00, 0x50, 0x87, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x05, 0xE0, 0xFF, 0x03, 0x00, 0xE0, 0xEF, 0x80, 0x00, 0x05, 0xF9, 0x5F, 0x00, 0x00, 0xFE, 0x3F, 0x82, 0x00, 0x00, 0x30, 0x87, 0xFF, 0x02, 0x0B, 0x00, 0x60, 0x87, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x05, 0xE0, 0xFF, 0x03, 0x00, 
+	0x40, 0x3A, 0x80, 0x00, 0x05, 0x91, 0x07, 0x00, 0x00, 0xFE, 0x3F, 0x82, 0x00, 0x00, 0x30, 0x87, 0xFF, 0x02, 0x0D, 0x00, 0x70, 0x87, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x02, 0xE0, 0xFF, 0x03, 0x87, 0x00, 0x01, 0xFD, 0x3F, 0x82, 0x00, 0x00, 0x30, 0x87, 0xFF, 0x02, 0x0D, 0x00, 0x70, 0x87, 0xFF, 0x00, 0x0A, 
+	0x82, 0x00, 0x02, 0xD0, 0xFF, 0x05, 0x87, 0x00, 0x01, 0xFE, 0x3F, 0x82, 0x00, 0x00, 0x30, 0x87, 0xFF, 0x02, 0x0E, 0x00, 0x80, 0x87, 0xFF, 0x00, 0x0A, 0x82, 0x00, 0x02, 0xA0, 0xFF, 0x5D, 0x86, 0x33, 0x02, 0xA3, 0xFF, 0x2E, 0x82, 0x00, 0x00, 0x30, 0x87, 0xFF, 0x02, 0x1E, 0x00, 0x90, 0x87, 0xFF, 0x00, 
+	0x0A, 0x82, 0x00, 0x00, 0x40, 0x8A, 0xFF, 0x00, 0x09, 0x82, 0x00, 0x00, 0x30, 0x87, 0xFF, 0x02, 0x2E, 0x00, 0xA0, 0x87, 0xFF, 0x00, 0x0A, 0x83, 0x00, 0x00, 0xF7, 0x88, 0xFF, 0x01, 0xBF, 0x01, 0x82, 0x00, 0x00, 0x30, 0x87, 0xFF, 0x02, 0x3E, 0x00, 0xA0, 0x87, 0xFF, 0x00, 0x0A, 0x83, 0x00, 0x01, 0x40, 
+	0xDA, 0x86, 0xEE, 0x01, 0xCD, 0x06, 0x83, 0x00, 0x00, 0x30, 0x87, 0xFF, 0x02, 0x3F, 0x00, 0xB0, 0x87, 0xFF, 0x00, 0x0A, 0x96, 0x00, 0x00, 0x30, 0x87, 0xFF, 0x02, 0x4F, 0x00, 0xC1, 0x87, 0xFF, 0x00, 0x0A, 0x96, 0x00, 0x00, 0x40, 0x87, 0xFF, 0x02, 0x5F, 0x00, 0xD1, 0x87, 0xFF, 0x00, 0x0B, 0x96, 0x00, 
+	0x00, 0x50, 0x87, 0xFF, 0x02, 0x6F, 0x00, 0xE2, 0x87, 0xFF, 0x00, 0x0C, 0x96, 0x00, 0x00, 0x70, 0x87, 0xFF, 0x02, 0x7F, 0x00, 0xE2, 0x87, 0xFF, 0x00, 0x3E, 0x96, 0x00, 0x00, 0xB0, 0x87, 0xFF, 0x02, 0x8F, 0x00, 0xF2, 0x87, 0xFF, 0x00, 0x6F, 0x96, 0x00, 0x00, 0xF1, 0x88, 0xFF, 0x01, 0xDD, 0xFE, 0x87, 
+	0xFF, 0x01, 0xDF, 0x01, 0x95, 0x00, 0x00, 0xF9, 0x95, 0xFF, 0x00, 0x07, 0x94, 0x00, 0x00, 0x30, 0x96, 0xFF, 0x00, 0x5F, 0x94, 0x00, 0x00, 0xD1, 0x88, 0xFF, 0x02, 0xBF, 0x32, 0xF6, 0x89, 0xFF, 0x00, 0x05, 0x92, 0x00, 0x01, 0x10, 0xFC, 0x88, 0xFF, 0x00, 0x9F, 0xCB, 0x03, 0xFF, 0xFF, 0x7F, 0x01, 0x91, 
+	0x00, 0x00, 0xD4, 0x89, 0xFF, 0xCC, 0x80, 0xFF, 0x01, 0x6D, 0x03, 0x8E, 0x00, 0x01, 0x20, 0xA5, 0x8A, 0xFF, 0xCD, 0x80, 0xFF, 0x01, 0xCE, 0xAB, 0x8D, 0xAA, 0x00, 0xDB, 0x8B, 0xFF, 0xCD, 0xA1, 0xFF, 0xCE, 0xA0, 0xFF, 0xD0, 0x04, 0xFF, 0xCF, 0x87, 0x87, 0x97, 0x87, 0xFF, 0x01, 0x78, 0xE7, 0x8D, 0xFF, 
+	0xD1, 0x03, 0x8F, 0x00, 0x00, 0x10, 0x87, 0xFF, 0x01, 0x00, 0xB0, 0x8D, 0xFF, 0xD1, 0x03, 0x8F, 0x00, 0x00, 0x20, 0x87, 0xFF, 0x01, 0x02, 0xC0, 0x8D, 0xFF, 0xD1, 0x03, 0xBF, 0x64, 0x55, 0x75, 0x87, 0xFF, 0x01, 0x01, 0xC0, 0x8D, 0xFF, 0xD1, 0x8B, 0xFF, 0x01, 0x02, 0xC0, 0x8D, 0xFF, 0xD1, 0x8B, 0xFF, 
+	0x01, 0x01, 0xC0, 0x8D, 0xFF, 0xD1, 0x02, 0xFF, 0xCF, 0xBC, 0x88, 0xFF, 0x01, 0x35, 0xD2, 0x8D, 0xFF, 0xD2, 0x02, 0x0F, 0x00, 0xFB, 0xC7, 0x91, 0xFF, 0xDD, 0x91, 0xFF, 0xDD, 0xBF, 0xFF, 0xFF, 0xE0, 
 	};
+const Icon waterheateron_icon = {waterheateron_width, waterheateron_height, sizeof(waterheateron_data), waterheateron_data, &waterheateroff_icon};
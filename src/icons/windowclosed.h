@@ -1,68 +1,32 @@
+#pragma once
 const uint32_t windowclosed_width = 64;
 const uint32_t windowclosed_height = 64;
-const uint8_t windowclosed_data[(64*64)/2] = {
-0xFF, 0xFF, 0x1A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xA1, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x03, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x30, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC3, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x04, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x40, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xFE, 0x8C, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xFE, 0xEF, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0xC8, 0xEF, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xDE, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x3F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0xED, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xAF, 0x50, 0x9A, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x3A, 0xD0, 0x0D, 0xA3, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xA9, 0x05, 0xFA, 0x21, 0xFF, 0x32, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xE0, 0x0E, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0x31, 0xFF, 0xDC, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xD0, 0x0D, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0x31, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xD0, 0x0D, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0x31, 0xFF, 0xEE, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xD0, 0x0D, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0x21, 0xFF, 0x53, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xD0, 0x0D, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xD0, 0x0D, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xD0, 0x0D, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xD0, 0x0D, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xD0, 0x0D, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xD0, 0x0D, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xD0, 0x0D, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xD0, 0x0D, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xD0, 0x0D, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xD0, 0x0D, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xD0, 0x0D, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xD0, 0x0D, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xD0, 0x0D, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xE0, 0x0E, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xAF, 0x70, 0xEF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0x4E, 0xD0, 0x0D, 0xE4, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFE, 0x07, 0xFA, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xCE, 0x00, 0x12, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x01, 0xE1, 0x1E, 0x10, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x21, 0x00, 0xEC, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xFE, 0x27, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0xF9, 0x9F, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x22, 0x72, 0xEF, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xFE, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xEF, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xFE, 0xEF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFF, 0xFF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFE, 0xEF, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xFE, 0x05, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0xF8, 0x8F, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x50, 0xEF, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xBE, 0x10, 0x34, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x03, 0xE1, 0x1E, 0x30, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x43, 0x01, 0xEB, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xD0, 0x0D, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xE0, 0x0E, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xD0, 0x0D, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xD0, 0x0D, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xD0, 0x0D, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xD0, 0x0D, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xD0, 0x0D, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xD0, 0x0D, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x02, 0xFE, 0x12, 0xAF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xD0, 0x0D, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x45, 0xFF, 0x12, 0xAF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xD0, 0x0D, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xEF, 0xFF, 0x12, 0xAF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xD0, 0x0D, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x13, 0xAF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xD0, 0x0D, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xBC, 0xFF, 0x13, 0xAF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xD0, 0x0D, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x13, 0xFF, 0x12, 0xAF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xD0, 0x0D, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xD0, 0x0D, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xD0, 0x0D, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xD0, 0x0D, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xD0, 0x0D, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4F, 0xE0, 0x0E, 0xF4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xAF, 0x40, 0x78, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x27, 0xD0, 0x0D, 0x72, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x87, 0x04, 0xFA, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x12, 0xFE, 0x12, 0xEE, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF4, 0x4F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0xEE, 0x21, 0xEF, 0x21, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0x13, 0xFF, 0x13, 0xFE, 0xBE, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xFF, 0xFF, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xEB, 0xEF, 0x31, 0xFF, 0x31, 0xFF, 0xFF, 
-	0xAF, 0x77, 0x01, 0x77, 0x01, 0x77, 0x87, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x77, 0x77, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x88, 0x78, 0x77, 0x10, 0x77, 0x10, 0x77, 0xFA, 
-	0x0B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xB0, 
-	0x07, 0xB7, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xBB, 0xAA, 0xBB, 0xAA, 0x7B, 0x70, 
-	0x08, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x80, 
-	0x07, 0xFA, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xAF, 0x70, 
-	0x08, 0x32, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x23, 0x80, 
-	0x4E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE4, 
+const uint8_t windowclosed_data[1274] = { // run length encoded
+0x02, 0xFF, 0xFF, 0x1A, 0x97, 0x00, 0x00, 0xA1, 0x81, 0xFF, 0x00, 0x03, 0x97, 0x33, 0x00, 0x30, 0x81, 0xFF, 0x01, 0x12, 0xFE, 0x95, 0xFF, 0x01, 0xEF, 0x21, 0x81, 0xFF, 0x02, 0x12, 0xFE, 0xFF, 0x93, 0xEE, 0x02, 0xFF, 0xEF, 0x21, 0x81, 0xFF, 0x02, 0x12, 0xFE, 0x3C, 0x93, 0x00, 0x02, 0xC3, 0xEF, 0x21, 
+	0x81, 0xFF, 0x02, 0x12, 0xFE, 0x04, 0x93, 0x33, 0x02, 0x40, 0xEF, 0x21, 0x81, 0xFF, 0x03, 0x12, 0xFE, 0x12, 0xFE, 0x91, 0xFF, 0x03, 0xEF, 0x21, 0xEF, 0x21, 0x81, 0xFF, 0x04, 0x12, 0xFE, 0x12, 0xFE, 0x8C, 0x85, 0x88, 0x01, 0xFE, 0xEF, 0x85, 0x88, 0x04, 0xC8, 0xEF, 0x21, 0xEF, 0x21, 0x81, 0xFF, 0x04, 
+	0x12, 0xFE, 0x12, 0xDE, 0x01, 0x85, 0x00, 0x01, 0xF3, 0x3F, 0x85, 0x00, 0x04, 0x10, 0xED, 0x21, 0xEF, 0x21, 0x81, 0xFF, 0x05, 0x12, 0xFE, 0x12, 0xAF, 0x50, 0x9A, 0x83, 0xAA, 0x03, 0x3A, 0xD0, 0x0D, 0xA3, 0x83, 0xAA, 0x05, 0xA9, 0x05, 0xFA, 0x21, 0xFF, 0x32, 0x81, 0xFF, 0x04, 0x12, 0xFE, 0x12, 0xAF, 
+	0x80, 0x84, 0xFF, 0x03, 0x4F, 0xE0, 0x0E, 0xF4, 0x84, 0xFF, 0x04, 0x08, 0xFA, 0x31, 0xFF, 0xDC, 0x81, 0xFF, 0x04, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0x84, 0xFF, 0x03, 0x4F, 0xD0, 0x0D, 0xF4, 0x84, 0xFF, 0x02, 0x08, 0xFA, 0x31, 0x83, 0xFF, 0x04, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0x84, 0xFF, 0x03, 0x4F, 0xD0, 
+	0x0D, 0xF4, 0x84, 0xFF, 0x04, 0x08, 0xFA, 0x31, 0xFF, 0xEE, 0x81, 0xFF, 0x04, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0x84, 0xFF, 0x03, 0x4F, 0xD0, 0x0D, 0xF4, 0x84, 0xFF, 0x04, 0x08, 0xFA, 0x21, 0xFF, 0x53, 0x81, 0xFF, 0x04, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0x84, 0xFF, 0x03, 0x4F, 0xD0, 0x0D, 0xF4, 0x84, 0xFF, 
+	0x04, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0x81, 0xFF, 0x04, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0x84, 0xFF, 0x03, 0x4F, 0xD0, 0x0D, 0xF4, 0x84, 0xFF, 0x04, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0x81, 0xFF, 0x04, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0x84, 0xFF, 0x03, 0x4F, 0xD0, 0x0D, 0xF4, 0x84, 0xFF, 0x04, 0x08, 0xFA, 0x21, 
+	0xEF, 0x21, 0x81, 0xFF, 0x04, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0x84, 0xFF, 0x03, 0x4F, 0xD0, 0x0D, 0xF4, 0x84, 0xFF, 0x04, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0x81, 0xFF, 0x04, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0x84, 0xFF, 0x03, 0x4F, 0xD0, 0x0D, 0xF4, 0x84, 0xFF, 0x04, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0x81, 0xFF, 
+	0x04, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0x84, 0xFF, 0x03, 0x4F, 0xD0, 0x0D, 0xF4, 0x84, 0xFF, 0x04, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0x81, 0xFF, 0x04, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0x84, 0xFF, 0x03, 0x4F, 0xD0, 0x0D, 0xF4, 0x84, 0xFF, 0x04, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0x81, 0xFF, 0x04, 0x12, 0xFE, 0x12, 
+	0xAF, 0x80, 0x84, 0xFF, 0x03, 0x4F, 0xD0, 0x0D, 0xF4, 0x84, 0xFF, 0x04, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0x81, 0xFF, 0x04, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0x84, 0xFF, 0x03, 0x4F, 0xD0, 0x0D, 0xF4, 0x84, 0xFF, 0x04, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0x81, 0xFF, 0x04, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0x84, 0xFF, 
+	0x03, 0x4F, 0xD0, 0x0D, 0xF4, 0x84, 0xFF, 0x04, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0x81, 0xFF, 0x04, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0x84, 0xFF, 0x03, 0x4F, 0xD0, 0x0D, 0xF4, 0x84, 0xFF, 0x04, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0x81, 0xFF, 0x04, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0x84, 0xFF, 0x03, 0x4F, 0xD0, 0x0D, 
+	0xF4, 0x84, 0xFF, 0x04, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0x81, 0xFF, 0x04, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0x84, 0xFF, 0x03, 0x4F, 0xD0, 0x0D, 0xF4, 0x84, 0xFF, 0x04, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0x81, 0xFF, 0x04, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0x84, 0xFF, 0x03, 0x4F, 0xE0, 0x0E, 0xF4, 0x84, 0xFF, 0x04, 
+	0x08, 0xFA, 0x21, 0xEF, 0x21, 0x81, 0xFF, 0x05, 0x12, 0xFE, 0x12, 0xAF, 0x70, 0xEF, 0x83, 0xEE, 0x03, 0x4E, 0xD0, 0x0D, 0xE4, 0x83, 0xEE, 0x05, 0xFE, 0x07, 0xFA, 0x21, 0xEF, 0x21, 0x81, 0xFF, 0x05, 0x12, 0xFE, 0x12, 0xCE, 0x00, 0x12, 0x83, 0x11, 0x03, 0x01, 0xE1, 0x1E, 0x10, 0x83, 0x11, 0x05, 0x21, 
+	0x00, 0xEC, 0x21, 0xEF, 0x21, 0x81, 0xFF, 0x04, 0x12, 0xFE, 0x12, 0xFE, 0x27, 0x85, 0x22, 0x01, 0xF9, 0x9F, 0x85, 0x22, 0x04, 0x72, 0xEF, 0x21, 0xEF, 0x21, 0x81, 0xFF, 0x03, 0x12, 0xFE, 0x12, 0xFE, 0x91, 0xFF, 0x03, 0xEF, 0x21, 0xEF, 0x21, 0x81, 0xFF, 0x04, 0x12, 0xFE, 0x12, 0xFE, 0xEF, 0x85, 0xEE, 
+	0x01, 0xFF, 0xFF, 0x85, 0xEE, 0x04, 0xFE, 0xEF, 0x21, 0xEF, 0x21, 0x81, 0xFF, 0x04, 0x12, 0xFE, 0x12, 0xFE, 0x05, 0x85, 0x11, 0x01, 0xF8, 0x8F, 0x85, 0x11, 0x04, 0x50, 0xEF, 0x21, 0xEF, 0x21, 0x81, 0xFF, 0x05, 0x12, 0xFE, 0x12, 0xBE, 0x10, 0x34, 0x83, 0x33, 0x03, 0x03, 0xE1, 0x1E, 0x30, 0x83, 0x33, 
+	0x05, 0x43, 0x01, 0xEB, 0x21, 0xEF, 0x21, 0x81, 0xFF, 0x04, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0x84, 0xFF, 0x03, 0x4F, 0xD0, 0x0D, 0xF4, 0x84, 0xFF, 0x04, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0x81, 0xFF, 0x04, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0x84, 0xFF, 0x03, 0x4F, 0xE0, 0x0E, 0xF4, 0x84, 0xFF, 0x04, 0x08, 0xFA, 
+	0x21, 0xEF, 0x21, 0x81, 0xFF, 0x04, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0x84, 0xFF, 0x03, 0x4F, 0xD0, 0x0D, 0xF4, 0x84, 0xFF, 0x04, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0x81, 0xFF, 0x04, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0x84, 0xFF, 0x03, 0x4F, 0xD0, 0x0D, 0xF4, 0x84, 0xFF, 0x04, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0x81, 
+	0xFF, 0x04, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0x84, 0xFF, 0x03, 0x4F, 0xD0, 0x0D, 0xF4, 0x84, 0xFF, 0x04, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0x81, 0xFF, 0x04, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0x84, 0xFF, 0x03, 0x4F, 0xD0, 0x0D, 0xF4, 0x84, 0xFF, 0x04, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0x81, 0xFF, 0x04, 0x12, 0xFE, 
+	0x12, 0xAF, 0x80, 0x84, 0xFF, 0x03, 0x4F, 0xD0, 0x0D, 0xF4, 0x84, 0xFF, 0x04, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0x81, 0xFF, 0x04, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0x84, 0xFF, 0x03, 0x4F, 0xD0, 0x0D, 0xF4, 0x84, 0xFF, 0x04, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0x81, 0xFF, 0x04, 0x02, 0xFE, 0x12, 0xAF, 0x80, 0x84, 
+	0xFF, 0x03, 0x4F, 0xD0, 0x0D, 0xF4, 0x84, 0xFF, 0x04, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0x81, 0xFF, 0x04, 0x45, 0xFF, 0x12, 0xAF, 0x80, 0x84, 0xFF, 0x03, 0x4F, 0xD0, 0x0D, 0xF4, 0x84, 0xFF, 0x04, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0x81, 0xFF, 0x04, 0xEF, 0xFF, 0x12, 0xAF, 0x80, 0x84, 0xFF, 0x03, 0x4F, 0xD0, 
+	0x0D, 0xF4, 0x84, 0xFF, 0x04, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0x83, 0xFF, 0x02, 0x13, 0xAF, 0x80, 0x84, 0xFF, 0x03, 0x4F, 0xD0, 0x0D, 0xF4, 0x84, 0xFF, 0x04, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0x81, 0xFF, 0x04, 0xBC, 0xFF, 0x13, 0xAF, 0x80, 0x84, 0xFF, 0x03, 0x4F, 0xD0, 0x0D, 0xF4, 0x84, 0xFF, 0x04, 0x08, 
+	0xFA, 0x21, 0xEF, 0x21, 0x81, 0xFF, 0x04, 0x13, 0xFF, 0x12, 0xAF, 0x80, 0x84, 0xFF, 0x03, 0x4F, 0xD0, 0x0D, 0xF4, 0x84, 0xFF, 0x04, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0x81, 0xFF, 0x04, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0x84, 0xFF, 0x03, 0x4F, 0xD0, 0x0D, 0xF4, 0x84, 0xFF, 0x04, 0x08, 0xFA, 0x21, 0xEF, 0x21, 
+	0x81, 0xFF, 0x04, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0x84, 0xFF, 0x03, 0x4F, 0xD0, 0x0D, 0xF4, 0x84, 0xFF, 0x04, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0x81, 0xFF, 0x04, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0x84, 0xFF, 0x03, 0x4F, 0xD0, 0x0D, 0xF4, 0x84, 0xFF, 0x04, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0x81, 0xFF, 0x04, 0x12, 
+	0xFE, 0x12, 0xAF, 0x80, 0x84, 0xFF, 0x03, 0x4F, 0xD0, 0x0D, 0xF4, 0x84, 0xFF, 0x04, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0x81, 0xFF, 0x04, 0x12, 0xFE, 0x12, 0xAF, 0x80, 0x84, 0xFF, 0x03, 0x4F, 0xE0, 0x0E, 0xF4, 0x84, 0xFF, 0x04, 0x08, 0xFA, 0x21, 0xEF, 0x21, 0x81, 0xFF, 0x05, 0x12, 0xFE, 0x12, 0xAF, 0x40, 
+	0x78, 0x83, 0x77, 0x03, 0x27, 0xD0, 0x0D, 0x72, 0x83, 0x77, 0x05, 0x87, 0x04, 0xFA, 0x21, 0xEF, 0x21, 0x81, 0xFF, 0x04, 0x12, 0xFE, 0x12, 0xEE, 0x02, 0x85, 0x00, 0x01, 0xF4, 0x4F, 0x85, 0x00, 0x04, 0x20, 0xEE, 0x21, 0xEF, 0x21, 0x81, 0xFF, 0x04, 0x13, 0xFF, 0x13, 0xFE, 0xBE, 0x85, 0xBB, 0x01, 0xFF, 
+	0xFF, 0x85, 0xBB, 0x0D, 0xEB, 0xEF, 0x31, 0xFF, 0x31, 0xFF, 0xFF, 0xAF, 0x77, 0x01, 0x77, 0x01, 0x77, 0x87, 0x85, 0x88, 0x01, 0x77, 0x77, 0x85, 0x88, 0x07, 0x78, 0x77, 0x10, 0x77, 0x10, 0x77, 0xFA, 0x0B, 0x9B, 0x00, 0x02, 0xB0, 0x07, 0xB7, 0x96, 0xBB, 0x06, 0xAA, 0xBB, 0xAA, 0x7B, 0x70, 0x08, 0xFB, 
+	0x99, 0xFF, 0x03, 0xBF, 0x80, 0x07, 0xFA, 0x99, 0xFF, 0x03, 0xAF, 0x70, 0x08, 0x32, 0x99, 0x33, 0x02, 0x23, 0x80, 0x4E, 0x9B, 0x00, 0x00, 0xE4, 
 	};
+const Icon windowclosed_icon = {windowclosed_width, windowclosed_height, sizeof(windowclosed_data), windowclosed_data, NULL};
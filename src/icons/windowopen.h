@@ -1,68 +1,38 @@
+#pragma once
+#include "windowclosed.h"
 const uint32_t windowopen_width = 64;
 const uint32_t windowopen_height = 64;
-const uint8_t windowopen_data[(64*64)/2] = {
-0xFF, 0xFF, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x60, 0xFF, 0xFF, 
-	0xFF, 0x9F, 0x10, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x01, 0xF9, 0xFF, 
-	0xFF, 0x6F, 0xB0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0B, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0xEF, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xEE, 0xFE, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x07, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0x00, 0x10, 0x44, 0x33, 0x43, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x44, 0x34, 0x33, 0x44, 0x01, 0x00, 0x40, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0x26, 0x00, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5C, 0x00, 0x62, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x29, 0x00, 0xC5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5C, 0x00, 0x92, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0xFF, 0x3A, 0x00, 0xB4, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x4B, 0x00, 0xA3, 0xFF, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0xFF, 0xFF, 0x4B, 0x00, 0xA3, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x3A, 0x00, 0xB4, 0xFF, 0xFF, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0xBD, 0xFF, 0xFF, 0x4B, 0x00, 0xA2, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x2A, 0x00, 0xB4, 0xFF, 0xFF, 0xDB, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x02, 0xB3, 0xFF, 0xFF, 0x5C, 0x00, 0xF9, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x9F, 0x00, 0xC5, 0xFF, 0xFF, 0x3A, 0x20, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x00, 0x00, 0xA3, 0xFF, 0xFF, 0x0B, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xB0, 0xFF, 0xFF, 0x3A, 0x00, 0x00, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0x4B, 0x00, 0xA3, 0xFF, 0x0D, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xD0, 0xFF, 0x3A, 0x00, 0xB4, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xFF, 0x4B, 0x00, 0xF9, 0x0C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xC0, 0x9F, 0x00, 0xC4, 0xFF, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xFF, 0xFF, 0x09, 0xF6, 0x0C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xC0, 0x6F, 0x90, 0xFF, 0xFF, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xFF, 0xFF, 0x0B, 0xF7, 0x0C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xC0, 0x7F, 0xB0, 0xFF, 0xFF, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xFF, 0xFF, 0x0B, 0xF7, 0x0C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xC0, 0x7F, 0xB0, 0xFF, 0xFF, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xFF, 0xFF, 0x0B, 0xF7, 0x0C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xC0, 0x7F, 0xB0, 0xFF, 0xFF, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xFF, 0xFF, 0x0B, 0xF7, 0x0C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xC0, 0x7F, 0xB0, 0xFF, 0xFF, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xFF, 0xFF, 0x0B, 0xF7, 0x0C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xC0, 0x7F, 0xB0, 0xFF, 0xFF, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xFF, 0xFF, 0x0B, 0xF7, 0x0C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xC0, 0x7F, 0xB0, 0xFF, 0xFF, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xFF, 0xFF, 0x0B, 0xF7, 0x0C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xC0, 0x7F, 0xB0, 0xFF, 0xFF, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xFF, 0xFF, 0x0B, 0xF7, 0x0C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xC0, 0x7F, 0xB0, 0xFF, 0xFF, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xFF, 0xFF, 0x0B, 0xF7, 0x0C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xC0, 0x7F, 0xB0, 0xFF, 0xFF, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xFF, 0xFF, 0x0B, 0xF7, 0x0C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xC0, 0x7F, 0xB0, 0xFF, 0xFF, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xFF, 0xFF, 0x0B, 0xF7, 0x0C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xC0, 0x7F, 0xB0, 0xFF, 0xFF, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xFF, 0xFF, 0x0B, 0xF7, 0x0C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xC0, 0x7F, 0xB0, 0xFF, 0xFF, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xFF, 0xFF, 0x0B, 0xF7, 0x0C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xC0, 0x7F, 0xC0, 0xFF, 0xFF, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x5F, 0xC0, 0xFF, 0x05, 0xFD, 0x10, 0x66, 0x66, 0x04, 0xF6, 0x0C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xC0, 0x6F, 0x40, 0x66, 0x66, 0x01, 0xDF, 0x50, 0xFF, 0x0C, 0xF5, 0xFF, 
-	0xFF, 0x7F, 0xD0, 0xFF, 0x05, 0xFD, 0x03, 0x00, 0x00, 0x00, 0xF9, 0x0C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xC0, 0x9F, 0x00, 0x00, 0x00, 0x30, 0xDF, 0x50, 0xFF, 0x0D, 0xF7, 0xFF, 
-	0xFF, 0xFF, 0xFD, 0xFF, 0x05, 0xFD, 0xCF, 0xDC, 0xDD, 0xED, 0xFF, 0x0C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xC0, 0xFF, 0xDE, 0xDD, 0xCD, 0xFC, 0xDF, 0x50, 0xFF, 0xDF, 0xFE, 0xFF, 
-	0xFF, 0xFF, 0xFF, 0xFF, 0x05, 0xFD, 0x9C, 0x99, 0x99, 0xA9, 0xFF, 0x0C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xC0, 0xFF, 0x9A, 0x99, 0x99, 0xC9, 0xDF, 0x50, 0xFF, 0xFF, 0xFF, 0xFF, 
-	0xFF, 0xFF, 0xFD, 0xFF, 0x05, 0xFD, 0x01, 0x00, 0x00, 0x00, 0xF8, 0x0C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xC0, 0x8F, 0x00, 0x00, 0x00, 0x10, 0xDF, 0x50, 0xFF, 0xDF, 0xFF, 0xFF, 
-	0xFF, 0x7F, 0xD0, 0xFF, 0x05, 0xFD, 0x20, 0x9A, 0xA9, 0x06, 0xF6, 0x0C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xC0, 0x6F, 0x60, 0x9A, 0xA9, 0x02, 0xDF, 0x50, 0xFF, 0x0D, 0xF7, 0xFF, 
-	0xFF, 0x5F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xFF, 0xFF, 0x0B, 0xF7, 0x0C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xC0, 0x7F, 0xC0, 0xFF, 0xFF, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF5, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xFF, 0xFF, 0x0B, 0xF7, 0x0C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xC0, 0x7F, 0xB0, 0xFF, 0xFF, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xFF, 0xFF, 0x0B, 0xF7, 0x0C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xC0, 0x7F, 0xB0, 0xFF, 0xFF, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xFF, 0xFF, 0x0B, 0xF7, 0x0C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xC0, 0x7F, 0xB0, 0xFF, 0xFF, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xFF, 0xFF, 0x0B, 0xF7, 0x0C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xC0, 0x7F, 0xB0, 0xFF, 0xFF, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xFF, 0xFF, 0x0B, 0xF7, 0x0C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xC0, 0x7F, 0xB0, 0xFF, 0xFF, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xFF, 0xFF, 0x0B, 0xF7, 0x0C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xC0, 0x7F, 0xB0, 0xFF, 0xFF, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xFF, 0xFF, 0x0B, 0xF7, 0x0C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xC0, 0x7F, 0xB0, 0xFF, 0xFF, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xFF, 0xFF, 0x0B, 0xF7, 0x0C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xC0, 0x7F, 0xB0, 0xFF, 0xFF, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xFF, 0xFF, 0x0B, 0xF7, 0x0C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xC0, 0x7F, 0xB0, 0xFF, 0xFF, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xFF, 0xFF, 0x0B, 0xF7, 0x0C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xC0, 0x7F, 0xB0, 0xFF, 0xFF, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xFF, 0xFF, 0x0B, 0xF7, 0x0C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xC0, 0x7F, 0xB0, 0xFF, 0xFF, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xFF, 0xFF, 0x0B, 0xF7, 0x0C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xC0, 0x7F, 0xB0, 0xFF, 0xFF, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xFF, 0xFF, 0x0B, 0xF7, 0x0C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xC0, 0x7F, 0xB0, 0xFF, 0xFF, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xFF, 0xAF, 0x04, 0xF7, 0x0C, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xC0, 0x7F, 0x40, 0xFA, 0xFF, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0x7D, 0x01, 0x30, 0xFC, 0x0C, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0xC0, 0xCF, 0x03, 0x10, 0xD7, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x00, 0x00, 0x60, 0xFB, 0xFF, 0x0D, 0xF5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5F, 0xD0, 0xFF, 0xBF, 0x06, 0x00, 0x00, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x02, 0x93, 0xFE, 0xFF, 0xBF, 0x04, 0xF6, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x6F, 0x40, 0xFB, 0xFF, 0xEF, 0x39, 0x20, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0xCD, 0xFF, 0xFF, 0x7C, 0x01, 0x30, 0xFD, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xDF, 0x03, 0x10, 0xC7, 0xFF, 0xFF, 0xDC, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0xFF, 0xDF, 0x38, 0x00, 0x50, 0xFB, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x05, 0x00, 0x83, 0xFD, 0xFF, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xFF, 
-	0xFF, 0x6F, 0xD0, 0xFF, 0x05, 0xFE, 0xAE, 0x05, 0x00, 0xA5, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x5B, 0x00, 0x50, 0xEA, 0xEF, 0x50, 0xFF, 0x0D, 0xF6, 0xFF, 
-	0xDF, 0x38, 0x60, 0x78, 0x02, 0x76, 0x01, 0x00, 0x50, 0x88, 0x78, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x77, 0x87, 0x88, 0x04, 0x00, 0x20, 0x67, 0x20, 0x87, 0x06, 0x83, 0xFD, 
-	0x2E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE2, 
-	0x0B, 0xB4, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0xAA, 0x4B, 0xB0, 
-	0x0B, 0xF8, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x8F, 0xB0, 
-	0x0A, 0xF7, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x7F, 0xA0, 
-	0x0C, 0x31, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x13, 0xC0, 
-	0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF7, 
+const uint8_t windowopen_data[1548] = { // delta to windowclosed, run length encoded
+0xC1, 0x00, 0x06, 0xD9, 0x00, 0x60, 0xC2, 0x01, 0x9F, 0x10, 0xD9, 0x01, 0x01, 0xF9, 0xC1, 0x01, 0x6F, 0xB0, 0x97, 0xFF, 0x01, 0x0B, 0xF6, 0xC1, 0x01, 0x6F, 0xC0, 0x97, 0xFF, 0x01, 0x0C, 0xF6, 0xC1, 0x03, 0x6F, 0xC0, 0xFF, 0xEF, 0x93, 0xEE, 0x03, 0xFE, 0xFF, 0x0C, 0xF6, 0xC1, 0x04, 0x6F, 0xC0, 0xFF, 
+	0x07, 0x01, 0x92, 0x00, 0x03, 0x80, 0xFF, 0x0C, 0xF6, 0xC1, 0x08, 0x6F, 0xC0, 0xFF, 0x05, 0x00, 0x10, 0x44, 0x33, 0x43, 0x89, 0x44, 0x08, 0x34, 0x33, 0x44, 0x01, 0x00, 0x40, 0xFF, 0x0C, 0xF6, 0xC1, 0x06, 0x6F, 0xC0, 0xFF, 0x05, 0x26, 0x00, 0xC5, 0x8D, 0xFF, 0x06, 0x5C, 0x00, 0x62, 0x50, 0xFF, 0x0C, 
+	0xF6, 0xC1, 0x07, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x29, 0x00, 0xC5, 0x8B, 0xFF, 0x07, 0x5C, 0x00, 0x92, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xC1, 0x08, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0xFF, 0x3A, 0x00, 0xB4, 0x89, 0xFF, 0x08, 0x4B, 0x00, 0xA3, 0xFF, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xC1, 0x09, 0x6F, 0xC0, 0xFF, 
+	0x05, 0xFD, 0xFF, 0xFF, 0x4B, 0x00, 0xA3, 0xC2, 0x84, 0xFF, 0x09, 0x3A, 0x00, 0xB4, 0xFF, 0xFF, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xC1, 0x05, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0xBD, 0xC1, 0x02, 0x4B, 0x00, 0xA2, 0xC1, 0x83, 0xFF, 0x02, 0x2A, 0x00, 0xB4, 0xC1, 0x05, 0xDB, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xC1, 
+	0x06, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x02, 0xB3, 0xC1, 0x02, 0x5C, 0x00, 0xF9, 0x83, 0xFF, 0x02, 0x9F, 0x00, 0xC5, 0xC1, 0x06, 0x3A, 0x20, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xC1, 0x07, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x00, 0x00, 0xA3, 0xC1, 0x01, 0x0B, 0xF5, 0x83, 0xFF, 0x01, 0x5F, 0xB0, 0xC1, 0x07, 0x3A, 
+	0x00, 0x00, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xC1, 0x0B, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0x4B, 0x00, 0xA3, 0xFF, 0x0D, 0xF6, 0x83, 0xFF, 0x0B, 0x5F, 0xD0, 0xFF, 0x3A, 0x00, 0xB4, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xC1, 0x0B, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xFF, 0x4B, 0x00, 0xF9, 0x0C, 0xF5, 
+	0x83, 0xFF, 0x0B, 0x6F, 0xC0, 0x9F, 0x00, 0xC4, 0xFF, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xC1, 0x05, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xC1, 0x03, 0x09, 0xF6, 0x0C, 0xF5, 0x83, 0xFF, 0x03, 0x5F, 0xC0, 0x6F, 0x90, 0xC1, 0x05, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xC1, 0x05, 0x6F, 0xC0, 0xFF, 0x05, 
+	0xFD, 0x30, 0xC1, 0x03, 0x0B, 0xF7, 0x0C, 0xF5, 0x83, 0xFF, 0x03, 0x5F, 0xC0, 0x7F, 0xB0, 0xC1, 0x05, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xC1, 0x05, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xC1, 0x03, 0x0B, 0xF7, 0x0C, 0xF5, 0x83, 0xFF, 0x03, 0x5F, 0xC0, 0x7F, 0xB0, 0xC1, 0x05, 0x03, 0xDF, 0x50, 0xFF, 
+	0x0C, 0xF6, 0xC1, 0x05, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xC1, 0x03, 0x0B, 0xF7, 0x0C, 0xF5, 0x83, 0xFF, 0x03, 0x5F, 0xC0, 0x7F, 0xB0, 0xC1, 0x05, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xC1, 0x05, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xC1, 0x03, 0x0B, 0xF7, 0x0C, 0xF5, 0x83, 0xFF, 0x03, 0x5F, 0xC0, 
+	0x7F, 0xB0, 0xC1, 0x05, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xC1, 0x05, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xC1, 0x03, 0x0B, 0xF7, 0x0C, 0xF5, 0x83, 0xFF, 0x03, 0x5F, 0xC0, 0x7F, 0xB0, 0xC1, 0x05, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xC1, 0x05, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xC1, 0x03, 0x0B, 
+	0xF7, 0x0C, 0xF5, 0x83, 0xFF, 0x03, 0x5F, 0xC0, 0x7F, 0xB0, 0xC1, 0x05, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xC1, 0x05, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xC1, 0x03, 0x0B, 0xF7, 0x0C, 0xF5, 0x83, 0xFF, 0x03, 0x5F, 0xC0, 0x7F, 0xB0, 0xC1, 0x05, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xC1, 0x05, 0x6F, 
+	0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xC1, 0x03, 0x0B, 0xF7, 0x0C, 0xF5, 0x83, 0xFF, 0x03, 0x5F, 0xC0, 0x7F, 0xB0, 0xC1, 0x05, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xC1, 0x05, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xC1, 0x03, 0x0B, 0xF7, 0x0C, 0xF5, 0x83, 0xFF, 0x03, 0x5F, 0xC0, 0x7F, 0xB0, 0xC1, 0x05, 0x03, 
+	0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xC1, 0x05, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xC1, 0x03, 0x0B, 0xF7, 0x0C, 0xF5, 0x83, 0xFF, 0x03, 0x5F, 0xC0, 0x7F, 0xB0, 0xC1, 0x05, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xC1, 0x05, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xC1, 0x03, 0x0B, 0xF7, 0x0C, 0xF5, 0x83, 0xFF, 
+	0x03, 0x5F, 0xC0, 0x7F, 0xB0, 0xC1, 0x05, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xC1, 0x0B, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xFF, 0xFF, 0x0B, 0xF7, 0x0C, 0xF5, 0x83, 0xFF, 0x0B, 0x5F, 0xC0, 0x7F, 0xB0, 0xFF, 0xFF, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xC1, 0x0B, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 
+	0xFF, 0xFF, 0x0B, 0xF7, 0x0C, 0xF5, 0x83, 0xFF, 0x0B, 0x5F, 0xC0, 0x7F, 0xC0, 0xFF, 0xFF, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xC1, 0x0B, 0x5F, 0xC0, 0xFF, 0x05, 0xFD, 0x10, 0x66, 0x66, 0x04, 0xF6, 0x0C, 0xF5, 0x83, 0xFF, 0x0B, 0x5F, 0xC0, 0x6F, 0x40, 0x66, 0x66, 0x01, 0xDF, 0x50, 0xFF, 0x0C, 0xF5, 
+	0xC1, 0x05, 0x7F, 0xD0, 0xFF, 0x05, 0xFD, 0x03, 0x80, 0x00, 0x02, 0xF9, 0x0C, 0xF5, 0xC5, 0x02, 0x5F, 0xC0, 0x9F, 0x80, 0x00, 0x05, 0x30, 0xDF, 0x50, 0xFF, 0x0D, 0xF7, 0xC2, 0x0A, 0xFD, 0xFF, 0x05, 0xFD, 0xCF, 0xDC, 0xDD, 0xED, 0xFF, 0x0C, 0xF5, 0x83, 0xFF, 0x0B, 0x5F, 0xC0, 0xFF, 0xDE, 0xDD, 0xCD, 
+	0xFC, 0xDF, 0x50, 0xFF, 0xDF, 0xFE, 0xC2, 0x0A, 0xFF, 0xFF, 0x05, 0xFD, 0x9C, 0x99, 0x99, 0xA9, 0xFF, 0x0C, 0xF5, 0x83, 0xFF, 0x08, 0x5F, 0xC0, 0xFF, 0x9A, 0x99, 0x99, 0xC9, 0xDF, 0x50, 0x83, 0xFF, 0x04, 0xFD, 0xFF, 0x05, 0xFD, 0x01, 0x80, 0x00, 0x02, 0xF8, 0x0C, 0xF5, 0x83, 0xFF, 0x02, 0x5F, 0xC0, 
+	0x8F, 0x80, 0x00, 0x04, 0x10, 0xDF, 0x50, 0xFF, 0xDF, 0xC2, 0x0B, 0x7F, 0xD0, 0xFF, 0x05, 0xFD, 0x20, 0x9A, 0xA9, 0x06, 0xF6, 0x0C, 0xF5, 0x83, 0xFF, 0x0B, 0x5F, 0xC0, 0x6F, 0x60, 0x9A, 0xA9, 0x02, 0xDF, 0x50, 0xFF, 0x0D, 0xF7, 0xC1, 0x05, 0x5F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xC1, 0x03, 0x0B, 0xF7, 
+	0x0C, 0xF5, 0x83, 0xFF, 0x03, 0x5F, 0xC0, 0x7F, 0xC0, 0xC1, 0x05, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF5, 0xC1, 0x05, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xC1, 0x03, 0x0B, 0xF7, 0x0C, 0xF5, 0x83, 0xFF, 0x03, 0x5F, 0xC0, 0x7F, 0xB0, 0xC1, 0x05, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xC1, 0x05, 0x6F, 0xC0, 
+	0xFF, 0x05, 0xFD, 0x30, 0xC1, 0x03, 0x0B, 0xF7, 0x0C, 0xF5, 0x83, 0xFF, 0x03, 0x5F, 0xC0, 0x7F, 0xB0, 0xC1, 0x05, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xC1, 0x05, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xC1, 0x03, 0x0B, 0xF7, 0x0C, 0xF5, 0x83, 0xFF, 0x03, 0x5F, 0xC0, 0x7F, 0xB0, 0xC1, 0x05, 0x03, 0xDF, 
+	0x50, 0xFF, 0x0C, 0xF6, 0xC1, 0x05, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xC1, 0x03, 0x0B, 0xF7, 0x0C, 0xF5, 0x83, 0xFF, 0x03, 0x5F, 0xC0, 0x7F, 0xB0, 0xC1, 0x05, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xC1, 0x05, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xC1, 0x03, 0x0B, 0xF7, 0x0C, 0xF5, 0x83, 0xFF, 0x03, 
+	0x5F, 0xC0, 0x7F, 0xB0, 0xC1, 0x05, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xC1, 0x05, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xC1, 0x03, 0x0B, 0xF7, 0x0C, 0xF5, 0x83, 0xFF, 0x03, 0x5F, 0xC0, 0x7F, 0xB0, 0xC1, 0x05, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xC1, 0x05, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xC1, 
+	0x03, 0x0B, 0xF7, 0x0C, 0xF5, 0x83, 0xFF, 0x03, 0x5F, 0xC0, 0x7F, 0xB0, 0xC1, 0x05, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xC1, 0x05, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xC1, 0x03, 0x0B, 0xF7, 0x0C, 0xF5, 0x83, 0xFF, 0x03, 0x5F, 0xC0, 0x7F, 0xB0, 0xC1, 0x05, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xC1, 
+	0x05, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xC1, 0x03, 0x0B, 0xF7, 0x0C, 0xF5, 0x83, 0xFF, 0x03, 0x5F, 0xC0, 0x7F, 0xB0, 0xC1, 0x05, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xC1, 0x05, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xC1, 0x03, 0x0B, 0xF7, 0x0C, 0xF5, 0x83, 0xFF, 0x03, 0x5F, 0xC0, 0x7F, 0xB0, 0xC1, 
+	0x05, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xC1, 0x05, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xC1, 0x03, 0x0B, 0xF7, 0x0C, 0xF5, 0x83, 0xFF, 0x03, 0x5F, 0xC0, 0x7F, 0xB0, 0xC1, 0x05, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xC1, 0x05, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xC1, 0x03, 0x0B, 0xF7, 0x0C, 0xF5, 
+	0x83, 0xFF, 0x03, 0x5F, 0xC0, 0x7F, 0xB0, 0xC1, 0x05, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xC1, 0x05, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0xC1, 0x03, 0x0B, 0xF7, 0x0C, 0xF5, 0x83, 0xFF, 0x03, 0x5F, 0xC0, 0x7F, 0xB0, 0xC1, 0x05, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xC1, 0x0B, 0x6F, 0xC0, 0xFF, 0x05, 
+	0xFD, 0x30, 0xFF, 0xAF, 0x04, 0xF7, 0x0C, 0xF5, 0x83, 0xFF, 0x0B, 0x5F, 0xC0, 0x7F, 0x40, 0xFA, 0xFF, 0x03, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xC1, 0x0B, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x30, 0x7D, 0x01, 0x30, 0xFC, 0x0C, 0xF6, 0x83, 0xFF, 0x0B, 0x6F, 0xC0, 0xCF, 0x03, 0x10, 0xD7, 0x03, 0xDF, 0x50, 0xFF, 
+	0x0C, 0xF6, 0xC1, 0x0B, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x00, 0x00, 0x60, 0xFB, 0xFF, 0x0D, 0xF5, 0x83, 0xFF, 0x0B, 0x5F, 0xD0, 0xFF, 0xBF, 0x06, 0x00, 0x00, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xC1, 0x0B, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0x02, 0x93, 0xFE, 0xFF, 0xBF, 0x04, 0xF6, 0x83, 0xFF, 0x0B, 0x6F, 0x40, 
+	0xFB, 0xFF, 0xEF, 0x39, 0x20, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xC1, 0x0B, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0xCD, 0xFF, 0xFF, 0x7C, 0x01, 0x30, 0xFD, 0x83, 0xFF, 0x0B, 0xDF, 0x03, 0x10, 0xC7, 0xFF, 0xFF, 0xDC, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xC1, 0x0A, 0x6F, 0xC0, 0xFF, 0x05, 0xFD, 0xFF, 0xDF, 0x38, 0x00, 
+	0x50, 0xFB, 0x85, 0xFF, 0x0A, 0xBF, 0x05, 0x00, 0x83, 0xFD, 0xFF, 0xDF, 0x50, 0xFF, 0x0C, 0xF6, 0xC1, 0x08, 0x6F, 0xD0, 0xFF, 0x05, 0xFE, 0xAE, 0x05, 0x00, 0xA5, 0x89, 0xFF, 0x14, 0x5B, 0x00, 0x50, 0xEA, 0xEF, 0x50, 0xFF, 0x0D, 0xF6, 0xFF, 0xDF, 0x38, 0x60, 0x78, 0x02, 0x76, 0x01, 0x00, 0x50, 0x88, 
+	0x78, 0x87, 0x77, 0x0B, 0x87, 0x88, 0x04, 0x00, 0x20, 0x67, 0x20, 0x87, 0x06, 0x83, 0xFD, 0x2E, 0xDD, 0x02, 0xE2, 0x0B, 0xB4, 0x99, 0xAA, 0x03, 0x4B, 0xB0, 0x0B, 0xF8, 0xDB, 0x03, 0x8F, 0xB0, 0x0A, 0xF7, 0xDB, 0x03, 0x7F, 0xA0, 0x0C, 0x31, 0xDB, 0x02, 0x13, 0xC0, 0x7F, 0xDD, 0x00, 0xF7, 
 	};
+const Icon windowopen_icon = {windowopen_width, windowopen_height, sizeof(windowopen_data), windowopen_data, &windowclosed_icon};
@@ -2,6 +2,7 @@
 
 // esp32 sdk imports
 #include "esp_heap_caps.h"
+#include "rom/miniz.h"
 #include "esp_log.h"
 
 // epd
@@ -13,82 +14,40 @@
 
 // deepsleep
 #include "esp_sleep.h"
+#include "esp_partition.h"
 
 // font
-#include "opensans8b.h"
-#include "opensans9b.h"
-#include "opensans10b.h"
-#include "opensans12b.h"
-#include "opensans18b.h"
-#include "opensans24b.h"
+#include "fonts.h"
 
 // wifi
 #include <WiFi.h>
 
 #include <HTTPClient.h>
 #include <WiFiClient.h>
+#include <WiFiClientSecure.h>
 #include <ArduinoJson.h>
+#include <WebSocketsClient.h>
+#include <PubSubClient.h>
 #include <NTPClient.h>
 #include <WiFiUdp.h>
 
 #include "configurations.h"
+#include "hastateparser.h"
+#include "haentitycache.h"
 #include "homeassistantapi.h"
+#include "homeassistantws.h"
+#include "mqttdatasource.h"
+#include "displaydigest.h"
+#include "spscqueue.h"
 #include "epd_drawing.h"
-
-// Icons for Home Assistant
-#include "icons/waterheateron.h"
-#include "icons/waterheateroff.h"
-#include "icons/lightbulbon.h"
-#include "icons/lightbulboff.h"
-#include "icons/exhaustfanon.h"
-#include "icons/exhaustfanoff.h"
-#include "icons/fanoff.h"
-#include "icons/fanon.h"
-#include "icons/airpurifieron.h"
-#include "icons/airpurifieroff.h"
-#include "icons/plugon.h"
-#include "icons/plugoff.h"
-#include "icons/switchon.h"
-#include "icons/switchoff.h"
-#include "icons/airconditioneron.h"
-#include "icons/airconditioneroff.h"
-#include "icons/warning.h"
-#include "icons/plantwateringlow.h"
-#include "icons/plantwateringok.h"
-#include "icons/batteryempty.h"
-
-// sensor icons
-#include "icons/dooropen.h"
-#include "icons/doorclosed.h"
-#include "icons/windowopen.h"
-#include "icons/windowclosed.h"
-#include "icons/motionsensoron.h"
-#include "icons/motionsensoroff.h"
-#include "icons/sensorerror.h"
-
-#define White 0xFF
-#define LightGrey 0xBB
-#define Grey 0x88
-#define DarkGrey 0x44
-#define Black 0x00
+#include "framecodec.h"
+#include "framestore.h"
+#include "wificonnect.h"
+#include "tilehash.h"
+#include "dashboard.h"
 
 #define BATT_PIN            36
 
-#define TILE_IMG_WIDTH  100
-#define TILE_IMG_HEIGHT 100
-#define TILE_WIDTH      160
-#define TILE_HEIGHT     160
-#define TILE_GAP        6
-#define SENSOR_TILE_WIDTH      120
-#define SENSOR_TILE_HEIGHT     110
-#define SENSOR_TILE_IMG_WIDTH  64
-#define SENSOR_TILE_IMG_HEIGHT 64
-#define BOTTOM_TILE_WIDTH      240 // 4x = 240, 3x = 320
-#define BOTTOM_TILE_HEIGHT     90
-
-// if below, plant icon is changed to watering can icon
-#define WATERING_SOIL_LIMIT 75
-
 // deep sleep configurations
 long SleepDuration   = 1; // Sleep time in minutes, aligned to the nearest minute boundary, so if 30 will always update at 00 or 30 past the hour
 int  WakeupHour      = 6;  // Wakeup after 06:00 to save battery power
@@ -96,57 +55,20 @@ int  SleepHour       = 23; // Sleep  after 23:00 to save battery power
 
 long StartTime       = 0;
 long SleepTimer      = 0;
-int  CurrentHour = 0, CurrentMin = 0, CurrentSec = 0, CurrentDay = 0;
+int  CurrentHour = 0, CurrentMin = 0, CurrentSec = 0;
 
 int vref = 1100; // default battery vref
-int wifi_signal = 0;
 
 // required for NTP time
 WiFiUDP ntpUDP;
 NTPClient timeClient(ntpUDP, "192.168.1.50", gmtOffset_sec);
 String formattedDate;
-String dateStamp;
-String timeStamp;
-
-// defualt strings
-String str_unavail = "unavail.";
 
 uint8_t StartWiFi() {
-  IPAddress dns(192,168,1,50); // Use tinman DNS
-  WiFi.disconnect();
+  WiFi.persistent(false); // the access point is kept in RTC memory, see wificonnect.h, not in NVS on every wake
   WiFi.mode(WIFI_STA); // switch off AP
-  WiFi.setAutoConnect(true);
   WiFi.setAutoReconnect(true);
-  unsigned long start = millis();
-  bool AttemptConnection = true;
-  while (AttemptConnection) {
-    Serial.println("\r\nConnecting to: " + String(ssid));
-    WiFi.begin(ssid, password);
-    if (WiFi.waitForConnectResult() != WL_CONNECTED) {
-      Serial.println("STA: Failed to connect to: " + String(ssid));
-      WiFi.disconnect(true); // delete SID/PWD
-      delay(500);
-
-      if (ssid2 != "") {
-        Serial.println("\r\nConnecting to: " + String(ssid2));
-        WiFi.begin(ssid2, password2);
-        if (WiFi.waitForConnectResult() != WL_CONNECTED) {
-          Serial.println("STA: Failed to connect to: " + String(ssid2));
-          WiFi.disconnect(true); // delete SID/PWD
-          delay(500);
-        }
-        else {
-          AttemptConnection = false;
-        }
-      }
-      if (millis() > start + 15000) { // Wait 15-secs maximum
-        AttemptConnection = false;
-      }
-    }
-    else {
-      AttemptConnection = false;
-    }
-  }
+  connectWiFi(ssid, password, ssid2, password2, 15000); // Wait 15-secs maximum
 
   if (WiFi.status() == WL_CONNECTED)
   {
@@ -161,444 +83,403 @@ uint8_t StartWiFi() {
   return WiFi.status();
 }
 
-void DrawBattery(int x, int y, uint8_t percentage)
-{
-  drawRect(x + 55, y - 15 , 40, 15, Black);
-  fillRect(x + 95, y - 9, 4, 6, Black);
-  if (percentage > 0)
-    fillRect(x + 57, y - 13, 36 * percentage / 100.0, 11, Black);
+// reads the battery once per wake, the voltage is 0 if there is no valid reading
+void ReadBattery() {
+  esp_adc_cal_characteristics_t adc_chars;
+  esp_adc_cal_value_t val_type = esp_adc_cal_characterize(ADC_UNIT_1, ADC_ATTEN_DB_11, ADC_WIDTH_BIT_12, 1100, &adc_chars);
+  if (val_type == ESP_ADC_CAL_VAL_EFUSE_VREF) {
+    Serial.printf("eFuse Vref:%u mV", adc_chars.vref);
+    vref = adc_chars.vref;
+  }
+  battery_voltage = analogRead(36) / 4096.0 * 6.566 * (vref / 1000.0);
+  battery_percentage = 100;
+  if (battery_voltage > 1 ) { // Only display if there is a valid reading
+    Serial.println("\nVoltage = " + String(battery_voltage));
+    battery_percentage = 2836.9625 * pow(battery_voltage, 4) - 43987.4889 * pow(battery_voltage, 3) + 255233.8134 * pow(battery_voltage, 2) - 656689.7123 * battery_voltage + 632041.7303;
+    if (battery_voltage >= 4.20) battery_percentage = 100;
+    if (battery_voltage <= 3.20) battery_percentage = 0;  // orig 3.5
+  }
+  else
+    battery_voltage = 0;
 }
 
-void DrawTileHigrow(int x, int y, int width, int height, const uint8_t *image_data, String label, String soil, String temp, String batt)
+// date and time of the status line from the NTP client
+void UpdateTimeStamps()
 {
-  drawRect(x, y, width, height, Black);
-  drawRect(x + 1, y + 1, width - 2, height - 2, Black);
-
-    // this assumes images are 100x100px size. make sure images are cropped to 100x100 before converting
-  int image_x = int((width - TILE_IMG_WIDTH)/2) + x;
-  int image_y = int((height - TILE_IMG_HEIGHT)/2) + y;
-  drawImage(image_x, image_y, TILE_IMG_WIDTH, TILE_IMG_HEIGHT, image_data);
+    formattedDate = timeClient.getFormattedDate();
+    int splitT = formattedDate.indexOf("T");
+    dateStamp = formattedDate.substring(0, splitT);
+    timeStamp = formattedDate.substring(splitT+1, formattedDate.length()-1);
+    CurrentDay = dateStamp.substring(8,10).toInt();
 
-  int label_txt_cursor_x = int(width / 2) + x;
-  int label_txt_cursor_y = y + 21;
-  drawString(label_txt_cursor_x, label_txt_cursor_y, label, CENTER);
+    CurrentHour = timeClient.getHours();
+    CurrentMin  = timeClient.getMinutes();
+    CurrentSec  = timeClient.getSeconds();
 
-  if (batt != "-1")
-  {
-    int state_txt_cursor_x = width / 2 + x - 1;
-    int state_txt_cursor_y = image_y + TILE_IMG_HEIGHT - 21;
-    if (soil.toInt() < WATERING_SOIL_LIMIT)
-      state_txt_cursor_x += 15;
-    drawString(state_txt_cursor_x, state_txt_cursor_y, soil + "%", CENTER);
-
-    state_txt_cursor_x = x + 5;
-    state_txt_cursor_y = image_y + TILE_IMG_HEIGHT + 22;
-    drawString(state_txt_cursor_x, state_txt_cursor_y, temp + "° C", LEFT);
-
-    state_txt_cursor_x = x + width - 105;
-    DrawBattery(state_txt_cursor_x, state_txt_cursor_y, batt.toInt());
-    state_txt_cursor_x = x + width - 5;
-    state_txt_cursor_y -= 20;
-    GFXfont lastFont = currentFont;
-    setFont(OpenSans8B);
-    drawString(state_txt_cursor_x, state_txt_cursor_y, batt + "%", RIGHT);
-    setFont(lastFont);
-  }
+    Serial.println("Current day: " + String(CurrentDay) + " hour: " + String(CurrentHour) + " min: " + String(CurrentMin) + " sec: " + String(CurrentSec));
 }
 
-// this will place a tile on screen that includes icon, staus and name of the HA entity, temperature and battery level
-void DrawTile(int x, int y, int width, int height, const uint8_t *image_data, String label, String state)
+void SetupTime()
 {
-  drawRect(x, y, width, height, Black);
-  drawRect(x + 1, y + 1, width - 2, height - 2, Black);
-
-  // this assumes images are 100x100px size. make sure images are cropped to 100x100 before converting
-  int image_x = int((width - TILE_IMG_WIDTH)/2) + x;
-  int image_y = int((height - TILE_IMG_HEIGHT)/2) + y;
-  drawImage(image_x, image_y, TILE_IMG_WIDTH, TILE_IMG_HEIGHT, image_data);
-
-  int label_txt_cursor_x = int(width / 2) + x;
-  int label_txt_cursor_y = y + 21;
-  drawString(label_txt_cursor_x, label_txt_cursor_y, label, CENTER);
+    Serial.println("Getting time...");
 
-  int state_txt_cursor_x = width / 2 + x;
-  int state_txt_cursor_y = image_y + TILE_IMG_HEIGHT + 10 + 12;
-  drawString(state_txt_cursor_x, state_txt_cursor_y, state, CENTER);
+    while(!timeClient.update()) {
+        timeClient.forceUpdate();
+    }
+    UpdateTimeStamps();
 }
 
-void DrawTempSensorTile(int x, int y, float temp, String label)
+void DrawWifiErrorScreen()
 {
-  int tile_width = SENSOR_TILE_WIDTH - TILE_GAP;
-  int tile_height = SENSOR_TILE_HEIGHT - TILE_GAP;
-  drawRect(x, y, tile_width, tile_height, Black);
-  drawRect(x + 1, y + 1, tile_width - 2, tile_height - 2, Black);
-
-  int temp_x = int(tile_width / 2) + x;
-  int temp_y = int(tile_height / 2) + y + 10;
-  if (temp != 0)
-  {
-    setFont(OpenSans18B);
-    drawString(temp_x, temp_y, String(temp, 1) + "°", CENTER);
-  }
-  else
-    drawString(temp_x, temp_y, str_unavail, CENTER);
-
-  int txt_cursor_x = int(tile_width / 2) + x;
-  int txt_cursor_y = y + 10 + SENSOR_TILE_IMG_HEIGHT + 10 + 12;
-  setFont(OpenSans9B);
-  drawString(txt_cursor_x, txt_cursor_y, label, CENTER);
+    invalidateDisplayDigest();
+    resetTileHashes();
+    DrawWifiErrorFrame();
+    epd_update();
 }
 
-// this will place a tile on screen that includes icon, staus and name of the HA entity
-void DrawSensorTile(int x, int y, int width, int height, const uint8_t* image_data, String label)
+// Fetch/render pipeline: the network task on core 0 loads the entities and queues a job for every tile as soon as
+// all of its entities are in the cache, the render stage in the loop task (core 1) draws the queued tiles into the
+// framebuffer meanwhile. All displayed entities are added to the cache before the first job is queued, so the
+// render side only ever reads cache entries that the network task has finished with.
+enum render_job_type {STATUS_JOB, SWITCH_TILE_JOB, SENSOR_TILE_JOB, BOTTOM_BAR_JOB, DONE_JOB};
+struct RenderJob{
+    uint8_t type;
+    uint8_t index;
+};
+
+#define SWITCH_TILES (sizeof(haEntities) / sizeof(haEntities[0]))
+#define SENSOR_TILES (sizeof(haSensors) / sizeof(haSensors[0]))
+#define PIPELINE_TILES (SWITCH_TILES + SENSOR_TILES + 1) // + bottom bar
+
+SpscQueue<RenderJob, PIPELINE_TILES + 3> renderQueue; // + status, done and the one slot a ring keeps free
+HAConfigurations pipelineHaConfigs;
+int pipelineNextTile = 0; // next tile the network task queues, in the order switches, sensors, bottom bar
+unsigned long pipelineStart = 0;
+unsigned long pipelineFirstTileMs = 0;
+unsigned long pipelineNetworkMs = 0;
+TaskHandle_t networkTask = NULL;
+
+RenderJob PipelineTileJob(int tile)
 {
-  drawRect(x, y, width, height, Black);
-  drawRect(x+1, y+1, width-2, height-2, Black);
-
-  // this assumes images are 128x128px size. make sure images are cropped to 128x128 before converting
-  int image_x = int((width - SENSOR_TILE_IMG_WIDTH)/2) + x;
-  int image_y = y + 10;
-  drawImage(image_x, image_y, SENSOR_TILE_IMG_WIDTH, SENSOR_TILE_IMG_HEIGHT, image_data);
-
-  int txt_cursor_x = int(width/2) + x;
-  int txt_cursor_y = image_y + SENSOR_TILE_IMG_HEIGHT + 10 + 12;
-  drawString(txt_cursor_x, txt_cursor_y, label, CENTER);
+    if (tile < SWITCH_TILES)
+        return {SWITCH_TILE_JOB, (uint8_t)tile};
+    if (tile < SWITCH_TILES + SENSOR_TILES)
+        return {SENSOR_TILE_JOB, (uint8_t)(tile - SWITCH_TILES)};
+    return {BOTTOM_BAR_JOB, 0};
 }
 
-void DrawTile(int x, int y, int state, int type, String name, String value)
+// An entity without a cache entry is not ready: the tile must not reach the render task, whose getters would fetch
+// the entity concurrently with the network task. The cache holds every configured entity, so this only fails if the
+// tile shows one that was not collected.
+bool VisitTileEntity(const String& entity, bool (*visit)(HAEntityCacheEntry* entry))
 {
-    int tile_width = TILE_WIDTH - TILE_GAP;
-    int tile_height = TILE_HEIGHT - TILE_GAP;
+    HAEntityCacheEntry* entry = addCachedEntity(entity);
+    if (entry == NULL)
+        Serial.println("No cache entry for " + entity);
+    return entry != NULL && visit(entry);
+}
 
-    String state_txt = "OFF";
-    if (state == entity_state::ON) state_txt = "ON";
-    else if (state == entity_state::UNAVAILABLE) state_txt = "UNAVAILABLE";
-    switch (type)
+// calls visit for every cached entity the tile shows, false as soon as one visit returns false
+bool ForEachTileEntity(const RenderJob& job, bool (*visit)(HAEntityCacheEntry* entry))
+{
+    if (job.type == SWITCH_TILE_JOB)
     {
-      case entity_type::SWITCH:
-        if (state == entity_state::ON) DrawTile(x,y,tile_width,tile_height,switchon_data, name, state_txt);
-        else if (state == entity_state::OFF) DrawTile(x,y,tile_width,tile_height,switchoff_data, name, state_txt);
-        else DrawTile(x,y,tile_width,tile_height,warning_data, name, "SWITCH");
-        break;
-      case entity_type::LIGHT:
-        if (state == entity_state::ON)  DrawTile(x,y,tile_width,tile_height,lightbulbon_data,name, state_txt);
-        else if (state == entity_state::OFF)  DrawTile(x,y,tile_width,tile_height,lightbulboff_data,name, state_txt);
-        else DrawTile(x,y,tile_width,tile_height,warning_data, name, "LIGHT");
-        break;
-      case entity_type::FAN:
-        if (state == entity_state::ON)  DrawTile(x,y,tile_width,tile_height,fanon_data,name, state_txt);
-        else if (state == entity_state::OFF)  DrawTile(x,y,tile_width,tile_height,fanoff_data,name, state_txt);
-        else DrawTile(x,y,tile_width,tile_height,warning_data, name, "FAN");
-        break;
-    case entity_type::EXFAN:
-        if (state == entity_state::ON)  DrawTile(x,y,tile_width,tile_height,exhaustfanon_data,name, state_txt);
-        else if (state == entity_state::OFF)  DrawTile(x,y,tile_width,tile_height,exhaustfanoff_data,name, state_txt);
-        else DrawTile(x,y,tile_width,tile_height,warning_data, name, "EXHAUST FAN");
-        break;
-      case entity_type::AIRPURIFIER:
-        if (state == entity_state::ON)  DrawTile(x,y,tile_width,tile_height,airpurifieron_data,name, state_txt);
-        else if (state == entity_state::OFF)  DrawTile(x,y,tile_width,tile_height,airpurifieroff_data,name, state_txt);
-        else DrawTile(x,y,tile_width,tile_height,warning_data, name, "AIR PURIFIER");
-        break;
-      case entity_type::WATERHEATER:
-        if (state == entity_state::ON)  DrawTile(x,y,tile_width,tile_height,waterheateron_data,name, state_txt);
-        else if (state == entity_state::OFF)  DrawTile(x,y,tile_width,tile_height,waterheateroff_data,name, state_txt);
-        else DrawTile(x,y,tile_width,tile_height,warning_data, name, "WATER HEATER");
-        break;
-      case entity_type::PLUG:
-        if (state == entity_state::ON)  DrawTile(x,y,tile_width,tile_height,plugon_data,name, state_txt);
-        else if (state == entity_state::OFF)  DrawTile(x,y,tile_width,tile_height,plugoff_data,name, state_txt);
-        else DrawTile(x,y,tile_width,tile_height,warning_data, name, "PLUG");
-        break;
-      case entity_type::AIRCONDITIONER:
-        if (state == entity_state::ON)  DrawTile(x,y,tile_width,tile_height,airconditioneron_data,name, state_txt);
-        else if (state == entity_state::OFF)  DrawTile(x,y,tile_width,tile_height,airconditioneroff_data,name, state_txt);
-        else DrawTile(x,y,tile_width,tile_height,warning_data, name, "AIR CONDITIONER");
-        break;
-      case entity_type::PLANT:
-        if (value.toInt() >= WATERING_SOIL_LIMIT) DrawTile(x, y, tile_width, tile_height, plantwateringok_data, name, value + "%");
-        else if (value.toInt() > 5) DrawTile(x, y, tile_width, tile_height, plantwateringlow_data, name, value + "%");
-        else DrawTile(x, y, tile_width, tile_height, warning_data, name, value + "%");
-        break;
-      default:
-        break;
+        const HAEntities& tile = haEntities[job.index];
+        if (tile.entityName == "")
+            return true;
+        if (tile.entityType != entity_type::HIGROW)
+            return VisitTileEntity(tile.entityID, visit);
+        for (int s = 0; s < sizeof(haHigrowSuffixes) / sizeof(haHigrowSuffixes[0]); s++)
+        {
+            if (!VisitTileEntity(tile.entityID + haHigrowSuffixes[s], visit))
+                return false;
+        }
     }
+    else if (job.type == SENSOR_TILE_JOB && haSensors[job.index].entityName != "")
+        return VisitTileEntity(haSensors[job.index].entityID, visit);
+    else if (job.type == BOTTOM_BAR_JOB && !haAggregates.valid)
+    {
+        for (int i = 0; i < sizeof(haFloatSensors) / sizeof(haFloatSensors[0]); i++)
+        {
+            if (!VisitTileEntity(haFloatSensors[i].entityID, visit))
+                return false;
+        }
+    }
+    return true;
 }
 
-void DrawTileHigrow(int x, int y, int state, int type, String name, String soil, String temp, String batt)
+bool EntityLoaded(HAEntityCacheEntry* entry)
 {
-    int tile_width = TILE_WIDTH - TILE_GAP;
-    int tile_height = TILE_HEIGHT - TILE_GAP;
+    return entry->loaded;
+}
 
-    if (batt.toInt() == -1) DrawTileHigrow(x, y, tile_width, tile_height, batteryempty_data, name, soil, temp, batt);
-    else if (soil.toInt() >= WATERING_SOIL_LIMIT) DrawTileHigrow(x, y, tile_width, tile_height, plantwateringok_data, name, soil, temp, batt);
-    else if (soil.toInt() > 5) DrawTileHigrow(x, y, tile_width, tile_height, plantwateringlow_data, name, soil, temp, batt);
-    else DrawTileHigrow(x, y, tile_width, tile_height, warning_data, name, soil, temp, batt);
+bool LoadEntity(HAEntityCacheEntry* entry)
+{
+    if (!entry->loaded)
+        haDataSource->fetch(entry);
+    return true;
 }
 
-void DrawSensorTile(int x, int y, int state, int type, String name)
+void QueueRenderJob(const RenderJob& job)
 {
-    int tile_width = SENSOR_TILE_WIDTH - TILE_GAP;
-    int tile_height = SENSOR_TILE_HEIGHT - TILE_GAP;
-    switch (type)
-    {
-      case sensor_type::DOOR:
-        if (state == entity_state::ON) DrawSensorTile(x,y,tile_width,tile_height,dooropen_data, name);
-        else if (state == entity_state::OFF) DrawSensorTile(x,y,tile_width,tile_height,doorclosed_data, name);
-        else DrawSensorTile(x,y,tile_width,tile_height,sensorerror_data, name);
-        break;
-      case sensor_type::WINDOW:
-        if (state == entity_state::ON) DrawSensorTile(x,y,tile_width,tile_height,windowopen_data, name);
-        else if (state == entity_state::OFF) DrawSensorTile(x,y,tile_width,tile_height,windowclosed_data, name);
-        else DrawSensorTile(x,y,tile_width,tile_height,sensorerror_data, name);
-        break;
-      case sensor_type::MOTION:
-        if (state == entity_state::ON) DrawSensorTile(x,y,tile_width,tile_height,motionsensoron_data, name);
-        else if (state == entity_state::OFF) DrawSensorTile(x,y,tile_width,tile_height,motionsensoroff_data, name);
-        else DrawSensorTile(x,y,tile_width,tile_height,sensorerror_data, name);
-        break;
-      default:
-        break;
-    }
+    if (pipelineFirstTileMs == 0 && job.type != STATUS_JOB)
+        pipelineFirstTileMs = millis() - pipelineStart;
+    while (!renderQueue.push(job))
+        vTaskDelay(1);
 }
 
-void DrawBottomTile(int x, int y, String value, String name)
+// queues the tiles whose entities are all loaded, called by the data source whenever it loaded more entities
+void QueueReadyTiles()
 {
-    int tile_width = BOTTOM_TILE_WIDTH - TILE_GAP;
-    int tile_height = BOTTOM_TILE_HEIGHT - TILE_GAP;
-    drawRect(x, y, tile_width, tile_height, Black);
-    drawRect(x+1, y+1, tile_width-2, tile_height-2, Black);
-    setFont(OpenSans24B);
-    drawString(int(tile_width/2) + x, 508, value, CENTER);
-    setFont(OpenSans9B);
-    drawString(int(tile_width/2) + x, 532, name, CENTER);
+    while (pipelineNextTile < PIPELINE_TILES && ForEachTileEntity(PipelineTileJob(pipelineNextTile), EntityLoaded))
+        QueueRenderJob(PipelineTileJob(pipelineNextTile++));
 }
 
-void DrawBottomBar()
+void NetworkTask(void* parameter)
 {
-    int tiles = sizeof(haFloatSensors);
-    float totalEnergy = 0;
-    float totalPower  = 0;
-    String totalEnergyName;
-    String totaPowerName;
-    for (int i = 0; i < (sizeof(haFloatSensors) / sizeof(haFloatSensors[0])); i++){
-        if (haFloatSensors[i].entityType == sensor_type::ENERGYMETER)
-        {
-            totalEnergy = totalEnergy + getSensorFloatValue(haFloatSensors[i].entityID);
-            totalEnergyName = haFloatSensors[i].entityName;
-        }
-        else if (haFloatSensors[i].entityType == sensor_type::ENERGYMETERPWR)
-        {
-            totalPower = totalPower + getSensorFloatValue(haFloatSensors[i].entityID);
-            totaPowerName = haFloatSensors[i].entityName;
-        }
-    }
-    int x = 3;
-    int y = 456;
-    // first one
-    if (totalEnergy != 0)
-    {
-        DrawBottomTile(x, y, String(totalEnergy) + " kWh", totalEnergyName);
-        x = x + BOTTOM_TILE_WIDTH;
-        tiles--;
-    }
-    if (totalPower != 0)
+    if (ha_template_aggregation && !ha_push_mode) // aggregates are not pushed
     {
-        DrawBottomTile(x, y, String((int)totalPower) + " W", totaPowerName);
-        x = x + BOTTOM_TILE_WIDTH;
-        tiles--;
+        Serial.println("Fetching aggregates...");
+        fetchAggregates();
     }
+    Serial.println("Getting haStatus...");
+    pipelineHaConfigs = getHaStatus();
+    dropFastWiFi(haClient.getFirstResult());
+    QueueRenderJob({STATUS_JOB, 0});
 
-    for (int i = 0; i < (sizeof(haFloatSensors) / sizeof(haFloatSensors[0])); i++){
-        if (haFloatSensors[i].entityType == sensor_type::TEMP && tiles >= 1)
-        {
-            float temp = getSensorAttributeValue(haFloatSensors[i].entityID, "current_temperature").toFloat();
-            if (temp == 0)
-                temp = getSensorFloatValue(haFloatSensors[i].entityID);
-            if (temp != 0)
-              DrawBottomTile(x, y, String(temp, 1) + "° C", haFloatSensors[i].entityName);
-            else
-              DrawBottomTile(x, y, str_unavail, haFloatSensors[i].entityName);
-            x = x + BOTTOM_TILE_WIDTH;
-            tiles--;
-        }
+    collectCachedEntities(!haAggregates.valid);
+    unsigned long prefetchStart = millis();
+    haDataSource->prefetch(QueueReadyTiles);
+    Serial.println("Prefetched states via " + String(haDataSource->name()) + " in " + String(millis() - prefetchStart) + "ms");
+
+    // whatever the prefetch could not load is fetched one by one
+    while (pipelineNextTile < PIPELINE_TILES)
+    {
+        RenderJob job = PipelineTileJob(pipelineNextTile++);
+        ForEachTileEntity(job, LoadEntity);
+        QueueRenderJob(job);
     }
+    pipelineNetworkMs = millis() - pipelineStart;
+    QueueRenderJob({DONE_JOB, 0});
+    networkTask = NULL;
+    vTaskDelete(NULL);
 }
 
-void DrawSwitchBar()
+void RenderTileJob(const RenderJob& job)
 {
-    setFont(OpenSans9B);
-    int x = 3;
-    int y = 23;
-    for (int i = 0; i < sizeof(haEntities) / sizeof(haEntities[0]); i++){
-        if (haEntities[i].entityName != "") {
-          if (haEntities[i].entityType == entity_type::SWITCH ||
-              haEntities[i].entityType == entity_type::LIGHT ||
-              haEntities[i].entityType == entity_type::PLUG ||
-              haEntities[i].entityType == entity_type::EXFAN ||
-              haEntities[i].entityType == entity_type::FAN ||
-              haEntities[i].entityType == entity_type::AIRPURIFIER ||
-              haEntities[i].entityType == entity_type::WATERHEATER ||
-              haEntities[i].entityType == entity_type::AIRCONDITIONER)
-          {
-              DrawTile(x, y, checkOnOffState(haEntities[i].entityID), haEntities[i].entityType, haEntities[i].entityName, "");
-          }
-          else if (haEntities[i].entityType == entity_type::HIGROW)
-          {
-              String soilVal = getSensorValue(haEntities[i].entityID+"_soil");
-              String tempVal = String(getSensorFloatValue(haEntities[i].entityID+"_temperature"), 1);
-              String battVal = getSensorValue(haEntities[i].entityID+"_battery");
-
-              String lastUpdate = getSensorValue(haEntities[i].entityID+"_updated");
-              int splitT = lastUpdate.indexOf("T");
-              String lastUpdateDate = lastUpdate.substring(0, splitT);
-              String lastUpdateDayStr = lastUpdateDate.substring(8,10);
-              int lastUpdateDay = lastUpdateDayStr.toInt();
-              if (lastUpdateDay != CurrentDay && lastUpdateDay != CurrentDay-1) // todo: what about end of month? Let's ignore that for now
-              {
-                Serial.println("Batt of " + haEntities[i].entityID + " last value " + battVal + ", last update on day " + lastUpdateDay + " != today (" + CurrentDay + ") or yesterday (" + (CurrentDay - 1) + ") - battery might be empty");
-                DrawTileHigrow(x, y, 0, haEntities[i].entityType, haEntities[i].entityName, soilVal, tempVal, "-1"); // presume battery empty
-              }
-              else
-              {
-                DrawTileHigrow(x, y, 0, haEntities[i].entityType, haEntities[i].entityName, soilVal, tempVal, battVal);
-              }
-          }
-          else
-          {
-              String val = getSensorValue(haEntities[i].entityID);
-              DrawTile(x, y, 0, haEntities[i].entityType, haEntities[i].entityName, val);
-          }
-        }
-
-        x = x + TILE_WIDTH; // move column right
-        if (i == 5) { // move row down
-            x = 3;
-            y = y + TILE_HEIGHT;
-        }
+    switch (job.type)
+    {
+        case STATUS_JOB:
+            DisplayGeneralInfoSection(pipelineHaConfigs);
+            break;
+        case SWITCH_TILE_JOB:
+            DrawSwitchBarTile(job.index);
+            break;
+        case SENSOR_TILE_JOB:
+            DrawSensorBarTile(job.index);
+            break;
+        case BOTTOM_BAR_JOB:
+            DrawBottomBar();
+            break;
     }
 }
 
-void DrawSensorBar()
+void DrawHAScreen()
 {
-    setFont(OpenSans9B);
-    int x = 3;
-    int y = 345;
-    for (int i = 0; i < sizeof(haSensors) / sizeof(haSensors[0]); i++){
-        if ((haSensors[i].entityType == sensor_type::DOOR ||
-            haSensors[i].entityType == sensor_type::WINDOW ||
-            haSensors[i].entityType == sensor_type::MOTION ) && haSensors[i].entityName != "")
-        {
-            DrawSensorTile(x,y,checkOnOffState(haSensors[i].entityID),haSensors[i].entityType, haSensors[i].entityName);
-        }
-        if (haSensors[i].entityType == sensor_type::TEMP && haSensors[i].entityName != "")
+    resetEntityCache();
+    pipelineNextTile = 0;
+    pipelineFirstTileMs = 0;
+    pipelineStart = millis();
+    xTaskCreatePinnedToCore(NetworkTask, "network", 8192, NULL, 1, &networkTask, 0);
+
+    unsigned long renderBusyMs = 0;
+    unsigned long start = millis();
+    beginDisplayList(); // the jobs only record, the whole screen is rasterised in bands once all tiles are in
+    fillRect(0, 0, EPD_WIDTH, 23, White); // the status line above the tiles is drawn on every wake
+    DisplayStatusSection();
+    renderBusyMs += millis() - start;
+    RenderJob job;
+    while (true)
+    {
+        if (!renderQueue.pop(job))
         {
-            float temp = getSensorAttributeValue(haSensors[i].entityID, "current_temperature").toFloat();
-            if (temp == 0)
-                temp = getSensorFloatValue(haSensors[i].entityID);
-            DrawTempSensorTile(x, y, temp, haSensors[i].entityName);
+            vTaskDelay(1);
+            continue;
         }
-        x = x + SENSOR_TILE_WIDTH;
+        if (job.type == DONE_JOB)
+            break;
+        start = millis();
+        RenderTileJob(job);
+        renderBusyMs += millis() - start;
+    }
+    start = millis();
+    endDisplayList();
+    renderBusyMs += millis() - start;
+    unsigned long renderMs = millis() - pipelineStart;
+    printEntityCacheStats();
+    printTileStats();
+    printGlyphCacheStats();
+    haClient.printStats();
+
+    // battery in 5% steps, so ADC noise alone does not cause a redraw
+    uint32_t digest = computeDisplayDigest(pipelineHaConfigs, battery_percentage / 5, RSSIBars(wifi_signal));
+    unsigned long epoch = timeClient.getEpochTime();
+    // a tile redrawn over the restored frame changed, even if its inputs are not in the digest (the HIGROW battery
+    // icon depends on the day)
+    bool changed = ha_push_mode || (tileHashesValid && tilesDrawn > 0) || displayChanged(digest, epoch);
+    unsigned long updateMs = 0;
+    if (changed)
+    {
+        start = millis();
+        epd_update();
+        updateMs = millis() - start;
+        storeDisplayDigest(digest, epoch);
     }
+    else
+        Serial.println("Nothing changed since the last redraw, skipping it");
+    Serial.println("Pipeline: network " + String(pipelineNetworkMs) + "ms (first tile after " + String(pipelineFirstTileMs) +
+                   "ms), render " + String(renderBusyMs) + "ms busy / " + String(renderMs) + "ms, panel update " + String(updateMs) +
+                   "ms, total " + String(millis() - pipelineStart) + "ms");
 }
 
-void DrawRSSI(int x, int y, int rssi) {
-  int WIFIsignal = 0;
-  int xpos = 1;
-  for (int _rssi = -100; _rssi <= rssi; _rssi = _rssi + 20) {
-    if (_rssi <= -20)  WIFIsignal = 20; //            <-20dbm displays 5-bars
-    if (_rssi <= -40)  WIFIsignal = 16; //  -40dbm to  -21dbm displays 4-bars
-    if (_rssi <= -60)  WIFIsignal = 12; //  -60dbm to  -41dbm displays 3-bars
-    if (_rssi <= -80)  WIFIsignal = 8; //  -80dbm to  -61dbm displays 2-bars
-    if (_rssi <= -100) WIFIsignal = 4;  // -100dbm to  -81dbm displays 1-bar
-
-    if (rssi != 0)
-      fillRect(x + xpos * 8, y - WIFIsignal, 6, WIFIsignal, Black);
-    else // draw empty bars
-      drawRect(x + xpos * 8, y - WIFIsignal, 6, WIFIsignal, Black);
-    xpos++;
-  }
-  if (rssi == 0)
-    drawString(x , y, "x", LEFT);
-}
+#define PUSH_STATUS_INTERVAL_MS 60000
 
-void DrawBattery(int x, int y) {
-  uint8_t percentage = 100;
-  esp_adc_cal_characteristics_t adc_chars;
-  esp_adc_cal_value_t val_type = esp_adc_cal_characterize(ADC_UNIT_1, ADC_ATTEN_DB_11, ADC_WIDTH_BIT_12, 1100, &adc_chars);
-  if (val_type == ESP_ADC_CAL_VAL_EFUSE_VREF) {
-    Serial.printf("eFuse Vref:%u mV", adc_chars.vref);
-    vref = adc_chars.vref;
-  }
-  float voltage = analogRead(36) / 4096.0 * 6.566 * (vref / 1000.0);
-  if (voltage > 1 ) { // Only display if there is a valid reading
-    Serial.println("\nVoltage = " + String(voltage));
-    percentage = 2836.9625 * pow(voltage, 4) - 43987.4889 * pow(voltage, 3) + 255233.8134 * pow(voltage, 2) - 656689.7123 * voltage + 632041.7303;
-    if (voltage >= 4.20) percentage = 100;
-    if (voltage <= 3.20) percentage = 0;  // orig 3.5
-    DrawBattery(x, y, percentage);
-    drawString(x, y, String(percentage) + "%", LEFT);
-    drawString(x + 130, y,  String(voltage, 2) + "v", CENTER);
-  }
-}
+// tiles that have to be redrawn in push mode because one of their entities changed
+bool switchTileDirty[sizeof(haEntities) / sizeof(haEntities[0])];
+bool sensorTileDirty[sizeof(haSensors) / sizeof(haSensors[0])];
+bool bottomBarDirty = false;
+unsigned long pushStatusDrawnAt = 0;
 
-void SetupTime()
+bool TileShowsEntity(const HAEntities& tile, const char* entity)
 {
-    Serial.println("Getting time...");
-
-    while(!timeClient.update()) {
-        timeClient.forceUpdate();
+    if (tile.entityID == entity)
+        return true;
+    if (tile.entityType != entity_type::HIGROW || strncmp(tile.entityID.c_str(), entity, tile.entityID.length()) != 0)
+        return false;
+    for (int s = 0; s < sizeof(haHigrowSuffixes) / sizeof(haHigrowSuffixes[0]); s++)
+    {
+        if (strcmp(entity + tile.entityID.length(), haHigrowSuffixes[s]) == 0)
+            return true;
     }
-    formattedDate = timeClient.getFormattedDate();
-    int splitT = formattedDate.indexOf("T");
-    dateStamp = formattedDate.substring(0, splitT);
-    timeStamp = formattedDate.substring(splitT+1, formattedDate.length()-1);
-    CurrentDay = dateStamp.substring(8,10).toInt();
-
-    CurrentHour = timeClient.getHours();
-    CurrentMin  = timeClient.getMinutes();
-    CurrentSec  = timeClient.getSeconds();
+    return false;
+}
 
-    Serial.println("Current day: " + String(CurrentDay) + " hour: " + String(CurrentHour) + " min: " + String(CurrentMin) + " sec: " + String(CurrentSec));
+void MarkEntityTilesDirty(const char* entity)
+{
+    for (int i = 0; i < sizeof(haEntities) / sizeof(haEntities[0]); i++)
+        switchTileDirty[i] |= TileShowsEntity(haEntities[i], entity);
+    for (int i = 0; i < sizeof(haSensors) / sizeof(haSensors[0]); i++)
+        sensorTileDirty[i] |= TileShowsEntity(haSensors[i], entity);
+    for (int i = 0; i < sizeof(haFloatSensors) / sizeof(haFloatSensors[0]); i++)
+        bottomBarDirty |= TileShowsEntity(haFloatSensors[i], entity);
 }
 
-void DisplayGeneralInfoSection()
+// redraw the tiles of all changed entities, epd_update() pushes only the pixels of these tiles that changed
+void RedrawDirtyTiles()
 {
-    setFont(OpenSans8B);
-    Serial.println("Getting haStatus...");
-    HAConfigurations haConfigs = getHaStatus();
-    Serial.println("drawing status line...");
-    drawString(EPD_WIDTH/2, 18, dateStamp + " - " +  timeStamp + " (HA Ver:" + haConfigs.version + "/" + haConfigs.haStatus + ", TZ:" + haConfigs.timeZone + ")", CENTER);
+    Rect_t areas[sizeof(haEntities) / sizeof(haEntities[0]) + sizeof(haSensors) / sizeof(haSensors[0]) + 1];
+    int count = 0;
+    beginDisplayList(); // the area a tile clears is cleared again by the tile itself, the list culls the first clear
+    for (int i = 0; i < sizeof(haEntities) / sizeof(haEntities[0]); i++)
+    {
+        if (!switchTileDirty[i])
+            continue;
+        switchTileDirty[i] = false;
+        areas[count] = {.x = 3 + (i % 6) * TILE_WIDTH, .y = 23 + (i / 6) * TILE_HEIGHT, .width = TILE_WIDTH - TILE_GAP, .height = TILE_HEIGHT - TILE_GAP};
+        clearTileArea(areas[count++]);
+        DrawSwitchBarTile(i);
+    }
+    for (int i = 0; i < sizeof(haSensors) / sizeof(haSensors[0]); i++)
+    {
+        if (!sensorTileDirty[i])
+            continue;
+        sensorTileDirty[i] = false;
+        areas[count] = {.x = 3 + i * SENSOR_TILE_WIDTH, .y = 345, .width = SENSOR_TILE_WIDTH - TILE_GAP, .height = SENSOR_TILE_HEIGHT - TILE_GAP};
+        clearTileArea(areas[count++]);
+        DrawSensorBarTile(i);
+    }
+    if (bottomBarDirty)
+    {
+        bottomBarDirty = false;
+        areas[count] = {.x = 0, .y = 456, .width = EPD_WIDTH, .height = EPD_HEIGHT - 456};
+        clearTileArea(areas[count++]);
+        DrawBottomBar();
+    }
+    endDisplayList();
+    if (count == 0)
+        return;
+
+    epd_poweron();
+    epd_update(); // only the cleared and redrawn tile areas are damaged
+    epd_poweroff();
+    Serial.println("Redrew " + String(count) + " tiles, update to pixel latency: " + String(millis() - haWsLastEventMs) + "ms");
 }
 
-void DisplayStatusSection() {
-  setFont(OpenSans8B);
-  DrawBattery(5, 18);
-  DrawRSSI(900, 18, wifi_signal);
+// push mode replaces the deep sleep cycle: the screen is drawn once, afterwards loop() applies pushed state changes
+void BeginPushMode()
+{
+    haEntityChangedCallback = MarkEntityTilesDirty;
+    tileHashesValid = true; // the framebuffer keeps all tiles from here on
+    pushStatusDrawnAt = millis();
+    beginHaWebSocket();
 }
 
-void DrawWifiErrorScreen()
+// Nothing is pushed for the status line, it is redrawn on a timer with the current clock, battery, WiFi signal and
+// HA status
+void RedrawStatusLine()
 {
-    epd_clear();
+    timeClient.update();
+    UpdateTimeStamps();
+    ReadBattery();
+    wifi_signal = WiFi.RSSI();
+    HAConfigurations haConfigs = getHaStatus();
+    Rect_t area = {.x = 0, .y = 0, .width = EPD_WIDTH, .height = 23};
+    beginDisplayList();
+    clearTileArea(area);
     DisplayStatusSection();
+    DisplayGeneralInfoSection(haConfigs);
+    endDisplayList();
+    epd_poweron();
     epd_update();
+    epd_poweroff();
 }
 
-void DrawHAScreen()
+void HandlePushMode()
 {
-    epd_clear();
+    haWebSocket.loop();
+    RedrawDirtyTiles();
+    if (millis() - pushStatusDrawnAt >= PUSH_STATUS_INTERVAL_MS)
+    {
+        pushStatusDrawnAt = millis();
+        RedrawStatusLine();
+    }
+}
 
-    DisplayStatusSection();
-    DisplayGeneralInfoSection();
-    Serial.println("Drawing (large icon) switchBar...");
-    DrawSwitchBar();
-    Serial.println("Drawing (small icon) sensorBar...");
-    DrawSensorBar();
-    Serial.println("Drawing (wide value) bottomBar...");
-    DrawBottomBar();
+#ifdef ASSET_PACK
+bool assetPackLoaded = false;
 
-    epd_update();
+// maps the "assets" partition with the fonts and icons, the mapping is kept until the next reset
+bool openAssetPack()
+{
+    unsigned long start = millis();
+    const esp_partition_t* partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, (esp_partition_subtype_t)ASSET_PARTITION_SUBTYPE, "assets");
+    if (partition == NULL)
+    {
+        Serial.println("No assets partition, flash partitions.csv");
+        return false;
+    }
+    const void* pack;
+    spi_flash_mmap_handle_t handle;
+    if (esp_partition_mmap(partition, 0, partition->size, SPI_FLASH_MMAP_DATA, &pack, &handle) != ESP_OK)
+    {
+        Serial.println("Mapping the assets partition failed");
+        return false;
+    }
+    bool loaded = loadAssetPack((const uint8_t*)pack, partition->size);
+    Serial.println("Asset pack mapped in " + String(millis() - start) + "ms");
+    return loaded;
 }
+#endif
 
 void InitialiseSystem() {
   StartTime = millis();
@@ -609,12 +490,31 @@ void InitialiseSystem() {
   framebuffer = (uint8_t *)ps_calloc(sizeof(uint8_t), EPD_WIDTH * EPD_HEIGHT / 2);
   if (!framebuffer) Serial.println("Memory alloc failed!");
   memset(framebuffer, 0xFF, EPD_WIDTH * EPD_HEIGHT / 2);
+  previousFramebuffer = (uint8_t *)ps_malloc(EPD_WIDTH * EPD_HEIGHT / 2);
+  if (previousFramebuffer && esp_sleep_get_wakeup_cause() == ESP_SLEEP_WAKEUP_TIMER)
+    previousFramebufferValid = restoreFrame(previousFramebuffer);
+  if (previousFramebufferValid) {
+    // unchanged tiles are not drawn again, they are taken over from the previous frame
+    memcpy(framebuffer, previousFramebuffer, EPD_WIDTH * EPD_HEIGHT / 2);
+    restoreTileHashes();
+  }
+  else
+    resetTileHashes();
 
+#ifdef ASSET_PACK
+  assetPackLoaded = openAssetPack();
+#endif
   setFont(OpenSans9B);
+  ReadBattery();
 }
 
 void BeginSleep() {
   epd_poweroff_all();
+  // the tile hashes only go with the frame they were taken of, a skipped redraw keeps the stored pair
+  if (panelUpdated && previousFramebufferValid) {
+    if (storeFrame(previousFramebuffer, timeClient.getEpochTime()))
+      storeTileHashes();
+  }
   // SleepTimer = (SleepDuration * 60 - ((CurrentMin % SleepDuration) * 60 + CurrentSec));
   SleepTimer = 30;
   esp_sleep_enable_timer_wakeup(SleepTimer * 1000000LL); // in Secs, 1000000LL converts to Secs as unit = 1uSec
@@ -626,6 +526,12 @@ void BeginSleep() {
 
 void setup() {
   InitialiseSystem();
+#ifdef ASSET_PACK
+  if (!assetPackLoaded) {
+    Serial.println("Flash the asset pack with: pio run -e esp32dev_assets -t uploadassets");
+    BeginSleep();
+  }
+#endif
 
   if (StartWiFi() == WL_CONNECTED) {
       SetupTime();
@@ -637,9 +543,18 @@ void setup() {
         WakeUp = (CurrentHour >= WakeupHour && CurrentHour <= SleepHour);
       // Just fuckin' wake up ffs.
       WakeUp = true;
+      // push mode keeps the cache up to date over the WebSocket, MQTT is only read once per wake
+      if (mqtt_enabled && !ha_push_mode)
+          haDataSource = &haMqttDataSource;
+      else
+          haDataSource = &haRestDataSource;
       if (WakeUp) {
           DrawHAScreen();
       }
+      if (ha_push_mode) {
+          BeginPushMode();
+          return; // no deep sleep, loop() handles the updates
+      }
   }
   else {
     DrawWifiErrorScreen();
@@ -648,6 +563,9 @@ void setup() {
 }
 
 void loop() {
-  // nothing to do here
+  // only used in push mode, otherwise the device is in deep sleep
+  if (ha_push_mode) {
+    HandlePushMode();
+  }
 }
 
@@ -0,0 +1,135 @@
+// MQTT as data source: entities listed in mqttTopics are read from the retained messages on the broker instead of
+// asking HA. One connect + subscribe delivers the state of all of them in a single burst, everything else
+// (and every topic without a retained message) falls back to the REST API.
+
+WiFiClient mqttTcp;
+PubSubClient mqttClient(mqttTcp);
+int mqttReceived = 0;
+
+// The state as HA would report it, "on"/"off" for topics with an onValue, otherwise the payload (or its jsonKey).
+// False if the payload holds no state: empty, not JSON or without the jsonKey (null included), the entity is then
+// left to the REST API.
+bool mqttTopicState(const HAMqttTopic& topic, char* payload, unsigned int length, char* state, size_t size)
+{
+    char value[HA_STATE_LENGTH];
+    memset(value, 0, sizeof(value));
+    if (topic.jsonKey == "")
+        strncpy(value, payload, min((size_t)length, sizeof(value) - 1));
+    else
+    {
+        StaticJsonDocument<512> doc;
+        StaticJsonDocument<64> filter;
+        filter[topic.jsonKey] = true;
+        DeserializationError error = deserializeJson(doc, payload, length, DeserializationOption::Filter(filter));
+        if (error)
+        {
+            Serial.print(F("deserializeJson() failed: "));
+            Serial.println(error.f_str());
+            return false;
+        }
+        if (doc[topic.jsonKey].isNull())
+        {
+            Serial.println("No " + topic.jsonKey + " in " + topic.topic);
+            return false;
+        }
+        copyJsonValue(value, sizeof(value), doc[topic.jsonKey]);
+    }
+    if (value[0] == '\0')
+        return false;
+    memset(state, 0, size);
+    if (topic.onValue != "")
+        strncpy(state, topic.onValue == value ? "on" : "off", size - 1);
+    else
+        strncpy(state, value, size - 1);
+    return true;
+}
+
+void onMqttMessage(char* topic, byte* payload, unsigned int length)
+{
+    for (int i = 0; i < ARRAY_SIZE(mqttTopics); i++)
+    {
+        if (mqttTopics[i].topic != topic)
+            continue;
+        HAEntityCacheEntry* entry = findCachedEntity(mqttTopics[i].entityID);
+        if (entry == NULL || entry->loaded)
+            continue;
+        mqttReceived++;
+        char state[HA_STATE_LENGTH];
+        if (!mqttTopicState(mqttTopics[i], (char*)payload, length, state, sizeof(state)))
+            continue;
+        memset(&entry->value, 0, sizeof(entry->value));
+        strncpy(entry->value.entityID, entry->entityID.c_str(), sizeof(entry->value.entityID) - 1);
+        memcpy(entry->value.state, state, sizeof(state));
+        entry->loaded = true;
+        entry->found = true;
+    }
+}
+
+class HAMqttDataSource : public HADataSource
+{
+public:
+    const char* name() override
+    {
+        return "MQTT";
+    }
+
+    bool prefetch(void (*progress)()) override
+    {
+        unsigned long start = millis();
+        collectCachedEntities(!haAggregates.valid);
+        mqttReceived = 0;
+        int subscribed = subscribe();
+        // the broker sends the retained messages right after the subscriptions, wait for all of them
+        int reported = 0;
+        while (subscribed > 0 && mqttReceived < subscribed && millis() - start < mqtt_timeout_ms && mqttClient.loop())
+        {
+            if (progress != NULL && mqttReceived > reported)
+            {
+                reported = mqttReceived;
+                progress();
+            }
+        }
+        mqttClient.disconnect();
+        Serial.println("Received " + String(mqttReceived) + "/" + String(subscribed) + " MQTT topics in " + String(millis() - start) + "ms");
+
+        for (int i = 0; i < haCacheCount; i++)
+        {
+            if (!haCache[i].loaded)
+                return haRestDataSource.prefetch(progress);
+        }
+        if (progress != NULL)
+            progress();
+        return true;
+    }
+
+    void fetch(HAEntityCacheEntry* entry) override
+    {
+        haRestDataSource.fetch(entry);
+    }
+
+private:
+    // returns the number of topics subscribed for entities on screen
+    int subscribe()
+    {
+        mqttClient.setServer(mqtt_server, mqtt_port);
+        mqttClient.setCallback(onMqttMessage);
+        mqttClient.setBufferSize(1024); // zigbee2mqtt payloads are larger than the default 256 bytes
+        String clientID = "lilygo-t5-47-" + String((uint32_t)ESP.getEfuseMac(), HEX);
+        bool connected = strlen(mqtt_user) > 0 ? mqttClient.connect(clientID.c_str(), mqtt_user, mqtt_password)
+                                               : mqttClient.connect(clientID.c_str());
+        if (!connected)
+        {
+            Serial.println("Error '" + String(mqttClient.state()) + "' connecting to MQTT broker at " + mqtt_server);
+            return 0;
+        }
+        int subscribed = 0;
+        for (int i = 0; i < ARRAY_SIZE(mqttTopics); i++)
+        {
+            if (findCachedEntity(mqttTopics[i].entityID) != NULL && mqttClient.subscribe(mqttTopics[i].topic.c_str()))
+                subscribed++;
+        }
+        return subscribed;
+    }
+};
+
+HAMqttDataSource haMqttDataSource;
@@ -0,0 +1,565 @@
+// Micro-benchmarks of the drawing code (--benchmark). Host timings do not carry over to the ESP32 one to one, the
+// ratio between two implementations usually does.
+
+#define BENCHMARK_REPEAT  200
+#define BENCHMARK_BATCHES 10
+
+typedef void (*BenchmarkFunction)(int i);
+
+// us per call of function, the fastest of BENCHMARK_BATCHES batches of BENCHMARK_REPEAT calls, so the scheduler
+// and cache noise of the host do not decide the comparison. Serial is muted meanwhile.
+double Benchmark(BenchmarkFunction function)
+{
+    Serial.muted = true;
+    double fastest = 0;
+    for (int batch = 0; batch < BENCHMARK_BATCHES; batch++)
+    {
+        unsigned long start = micros();
+        for (int i = 0; i < BENCHMARK_REPEAT; i++)
+            function(i);
+        double us = (double)(micros() - start) / BENCHMARK_REPEAT;
+        if (batch == 0 || us < fastest)
+            fastest = us;
+    }
+    Serial.muted = false;
+    return fastest;
+}
+
+void PrintBenchmark(const char* name, double us, double baselineUs)
+{
+    printf("  %-34s %9.2fus", name, us);
+    if (baselineUs > 0)
+        printf("  %5.2fx", baselineUs / us);
+    printf("\n");
+}
+
+// the labels and states that are drawn on the dashboard with the configured entities
+String benchmarkLabels[ARRAY_SIZE(haEntities) + ARRAY_SIZE(haSensors) + ARRAY_SIZE(haFloatSensors) + 4];
+int    benchmarkLabelCount = 0;
+
+void CollectBenchmarkLabels()
+{
+    benchmarkLabelCount = 0;
+    for (int i = 0; i < ARRAY_SIZE(haEntities); i++)
+        benchmarkLabels[benchmarkLabelCount++] = haEntities[i].entityName;
+    for (int i = 0; i < ARRAY_SIZE(haSensors); i++)
+        benchmarkLabels[benchmarkLabelCount++] = haSensors[i].entityName;
+    for (int i = 0; i < ARRAY_SIZE(haFloatSensors); i++)
+        benchmarkLabels[benchmarkLabelCount++] = haFloatSensors[i].entityName;
+    benchmarkLabels[benchmarkLabelCount++] = "ON";
+    benchmarkLabels[benchmarkLabelCount++] = "OFF";
+    benchmarkLabels[benchmarkLabelCount++] = "21.5° C";
+    benchmarkLabels[benchmarkLabelCount++] = str_unavail;
+}
+
+// the two pass layout of the library: get_text_bounds, then write_string
+void LibraryLabels(int i)
+{
+    for (int l = 0; l < benchmarkLabelCount; l++)
+    {
+        String text = benchmarkLabels[l];
+        char* data = const_cast<char*>(text.c_str());
+        int x = 80, y = 40, xx = x, yy = y, x1, y1, w, h;
+        get_text_bounds(&currentFont, data, &xx, &yy, &x1, &y1, &w, &h, NULL);
+        x = x - w / 2;
+        write_string(&currentFont, data, &x, &y, framebuffer);
+    }
+}
+
+void DrawStringLabels(int i)
+{
+    for (int l = 0; l < benchmarkLabelCount; l++)
+        drawString(80, 40, benchmarkLabels[l], CENTER);
+}
+
+void BenchmarkText()
+{
+    CollectBenchmarkLabels();
+    const GFXfont* fonts[] = {&OpenSans9B, &OpenSans24B};
+    const char* fontNames[] = {"OpenSans9B", "OpenSans24B"};
+    for (int f = 0; f < ARRAY_SIZE(fonts); f++)
+    {
+        setFont(*fonts[f]);
+        printf("Text, %d labels in %s:\n", benchmarkLabelCount, fontNames[f]);
+        double library = Benchmark(LibraryLabels);
+        damageCount = 0;
+        double single = Benchmark(DrawStringLabels);
+        damageCount = 0;
+        PrintBenchmark("get_text_bounds + write_string", library, 0);
+        PrintBenchmark("drawString", single, library);
+    }
+}
+
+struct BenchmarkIcon{
+    const char* name;
+    const Icon* icon;
+};
+
+BenchmarkIcon benchmarkIcons[] = {
+    {"airconditioneroff", &airconditioneroff_icon},
+    {"airconditioneron", &airconditioneron_icon},
+    {"airpurifieroff", &airpurifieroff_icon},
+    {"airpurifieron", &airpurifieron_icon},
+    {"batteryempty", &batteryempty_icon},
+    {"doorclosed", &doorclosed_icon},
+    {"dooropen", &dooropen_icon},
+    {"exhaustfanoff", &exhaustfanoff_icon},
+    {"exhaustfanon", &exhaustfanon_icon},
+    {"fanoff", &fanoff_icon},
+    {"fanon", &fanon_icon},
+    {"lightbulboff", &lightbulboff_icon},
+    {"lightbulbon", &lightbulbon_icon},
+    {"motionsensoroff", &motionsensoroff_icon},
+    {"motionsensoron", &motionsensoron_icon},
+    {"plantwateringlow", &plantwateringlow_icon},
+    {"plantwateringok", &plantwateringok_icon},
+    {"plugoff", &plugoff_icon},
+    {"plugon", &plugon_icon},
+    {"sensorerror", &sensorerror_icon},
+    {"switchoff", &switchoff_icon},
+    {"switchon", &switchon_icon},
+    {"warning", &warning_icon},
+    {"waterheateroff", &waterheateroff_icon},
+    {"waterheateron", &waterheateron_icon},
+    {"windowclosed", &windowclosed_icon},
+    {"windowopen", &windowopen_icon},
+};
+
+uint8_t* benchmarkRaw[ARRAY_SIZE(benchmarkIcons)];
+
+// every icon, decoded to the raw 4bpp data the library takes
+void RawIcons(int i)
+{
+    for (int n = 0; n < ARRAY_SIZE(benchmarkIcons); n++)
+        epd_copy_to_framebuffer({.x = 30, .y = 50, .width = benchmarkIcons[n].icon->width, .height = benchmarkIcons[n].icon->height}, benchmarkRaw[n], framebuffer);
+}
+
+void RLEIcons(int i)
+{
+    for (int n = 0; n < ARRAY_SIZE(benchmarkIcons); n++)
+        drawIcon(30, 50, *benchmarkIcons[n].icon);
+}
+
+// every icon with a base, drawn after its base and the base again
+void DrawPairIcons(int i)
+{
+    for (int n = 0; n < ARRAY_SIZE(benchmarkIcons); n++)
+    {
+        const Icon& icon = *benchmarkIcons[n].icon;
+        if (icon.base != NULL)
+        {
+            drawIcon(30, 50, icon);
+            drawIcon(30, 50, *icon.base);
+        }
+    }
+}
+
+void PatchIcons(int i)
+{
+    for (int n = 0; n < ARRAY_SIZE(benchmarkIcons); n++)
+    {
+        const Icon& icon = *benchmarkIcons[n].icon;
+        if (icon.base != NULL)
+        {
+            patchIcon(30, 50, icon, *icon.base);
+            patchIcon(30, 50, *icon.base, icon);
+        }
+    }
+}
+
+void BenchmarkIcons()
+{
+    size_t raw = 0;
+    size_t encoded = 0;
+    size_t deltas = 0;
+    for (int n = 0; n < ARRAY_SIZE(benchmarkIcons); n++)
+    {
+        const Icon& icon = *benchmarkIcons[n].icon;
+        size_t size = icon.width * icon.height / 2;
+        benchmarkRaw[n] = (uint8_t*)malloc(size);
+        RLEDecoder base = {icon.base != NULL ? icon.base->data : icon.data, false, 0, RLE_LITERAL, 0};
+        decodeRLERow(base, benchmarkRaw[n], size);
+        if (icon.base != NULL)
+        {
+            RLEDecoder delta = {icon.data, true, 0, RLE_LITERAL, 0};
+            decodeRLERow(delta, benchmarkRaw[n], size);
+            deltas++;
+        }
+        raw += size;
+        encoded += icon.size;
+    }
+    printf("Icons, %d icons, %d of them deltas: %u bytes encoded instead of %u raw, %u bytes (%.0f%%) less flash\n", (int)ARRAY_SIZE(benchmarkIcons),
+           (int)deltas, (unsigned)encoded, (unsigned)raw, (unsigned)(raw - encoded), 100.0 * (raw - encoded) / raw);
+    double library = Benchmark(RawIcons);
+    damageCount = 0;
+    double rle = Benchmark(RLEIcons);
+    damageCount = 0;
+    double pairs = Benchmark(DrawPairIcons);
+    damageCount = 0;
+    double patch = Benchmark(PatchIcons);
+    damageCount = 0;
+    PrintBenchmark("epd_copy_to_framebuffer (raw)", library, 0);
+    PrintBenchmark("drawIcon", rle, library);
+    printf("On/off flips of the %d pairs:\n", (int)deltas);
+    PrintBenchmark("drawIcon", pairs, 0);
+    PrintBenchmark("patchIcon", patch, pairs);
+    for (int n = 0; n < ARRAY_SIZE(benchmarkIcons); n++)
+        free(benchmarkRaw[n]);
+}
+
+// rects at even and odd x, of even and odd width, partly off screen as well
+Rect_t benchmarkRects[] = {
+    {0, 0, EPD_WIDTH, 1},
+    {3, 23, TILE_WIDTH - TILE_GAP, TILE_HEIGHT - TILE_GAP},
+    {4, 345, SENSOR_TILE_WIDTH - TILE_GAP, SENSOR_TILE_HEIGHT - TILE_GAP},
+    {113, 130, 101, 77},
+    {250, 300, 1, 40},
+    {-7, -3, 66, 35},
+    {EPD_WIDTH - 31, EPD_HEIGHT - 20, 64, 64},
+};
+
+uint8_t* benchmarkImage;
+
+void LibraryFillRects(int i)
+{
+    for (int r = 0; r < ARRAY_SIZE(benchmarkRects); r++)
+        epd_fill_rect(benchmarkRects[r].x, benchmarkRects[r].y, benchmarkRects[r].width, benchmarkRects[r].height, i & 1 ? Grey : DarkGrey, framebuffer);
+}
+
+void FillRects(int i)
+{
+    for (int r = 0; r < ARRAY_SIZE(benchmarkRects); r++)
+        fillRect(benchmarkRects[r].x, benchmarkRects[r].y, benchmarkRects[r].width, benchmarkRects[r].height, i & 1 ? Grey : DarkGrey);
+}
+
+void LibraryDrawRects(int i)
+{
+    for (int r = 0; r < ARRAY_SIZE(benchmarkRects); r++)
+        epd_draw_rect(benchmarkRects[r].x, benchmarkRects[r].y, benchmarkRects[r].width, benchmarkRects[r].height, i & 1 ? Black : LightGrey, framebuffer);
+}
+
+void DrawRects(int i)
+{
+    for (int r = 0; r < ARRAY_SIZE(benchmarkRects); r++)
+        drawRect(benchmarkRects[r].x, benchmarkRects[r].y, benchmarkRects[r].width, benchmarkRects[r].height, i & 1 ? Black : LightGrey);
+}
+
+void LibraryHLines(int i)
+{
+    for (int r = 0; r < ARRAY_SIZE(benchmarkRects); r++)
+        epd_draw_hline(benchmarkRects[r].x, benchmarkRects[r].y, benchmarkRects[r].width, i & 1 ? Black : Grey, framebuffer);
+}
+
+void HLines(int i)
+{
+    for (int r = 0; r < ARRAY_SIZE(benchmarkRects); r++)
+        drawFastHLine(benchmarkRects[r].x, benchmarkRects[r].y, benchmarkRects[r].width, i & 1 ? Black : Grey);
+}
+
+void LibraryImages(int i)
+{
+    for (int r = 0; r < ARRAY_SIZE(benchmarkRects); r++)
+        epd_copy_to_framebuffer(benchmarkRects[r], benchmarkImage + (i & 1), framebuffer);
+}
+
+void Images(int i)
+{
+    for (int r = 0; r < ARRAY_SIZE(benchmarkRects); r++)
+        drawImage(benchmarkRects[r].x, benchmarkRects[r].y, benchmarkRects[r].width, benchmarkRects[r].height, benchmarkImage + (i & 1));
+}
+
+// Times the library call against the 4bpp primitive and checks that both leave the same framebuffer, starting from
+// a framebuffer with a pattern, so nibbles next to the edges that must be kept are checked as well.
+void ComparePrimitive(const char* libraryName, BenchmarkFunction library, const char* name, BenchmarkFunction primitive)
+{
+    const size_t frameSize = EPD_WIDTH * EPD_HEIGHT / 2;
+    uint8_t* expected = (uint8_t*)malloc(frameSize);
+    bool identical = true;
+    for (int i = 0; i < 2; i++)
+    {
+        for (size_t b = 0; b < frameSize; b++)
+            framebuffer[b] = b * 37;
+        library(i);
+        memcpy(expected, framebuffer, frameSize);
+        for (size_t b = 0; b < frameSize; b++)
+            framebuffer[b] = b * 37;
+        primitive(i);
+        identical &= memcmp(expected, framebuffer, frameSize) == 0;
+    }
+    free(expected);
+    double libraryUs = Benchmark(library);
+    double us = Benchmark(primitive);
+    damageCount = 0;
+    PrintBenchmark(libraryName, libraryUs, 0);
+    PrintBenchmark(name, us, libraryUs);
+    if (!identical)
+        printf("  %s DIFFERS FROM %s\n", name, libraryName);
+}
+
+void BenchmarkPrimitives()
+{
+    benchmarkImage = (uint8_t*)malloc(EPD_WIDTH * EPD_HEIGHT / 2 + 1);
+    for (int b = 0; b < EPD_WIDTH * EPD_HEIGHT / 2 + 1; b++)
+        benchmarkImage[b] = b * 101 + (b >> 7);
+    printf("Primitives, %d rects at even and odd x:\n", (int)ARRAY_SIZE(benchmarkRects));
+    ComparePrimitive("epd_fill_rect", LibraryFillRects, "fillRect", FillRects);
+    ComparePrimitive("epd_draw_rect", LibraryDrawRects, "drawRect", DrawRects);
+    ComparePrimitive("epd_draw_hline", LibraryHLines, "drawFastHLine", HLines);
+    ComparePrimitive("epd_copy_to_framebuffer", LibraryImages, "drawImage", Images);
+    free(benchmarkImage);
+    memset(framebuffer, 0xFF, EPD_WIDTH * EPD_HEIGHT / 2);
+}
+
+// the link to HA the fetch benchmark models, a WiFi connection in a home network
+#define BENCHMARK_RTT_MS           10
+#define BENCHMARK_BYTES_PER_SECOND 1000000
+
+std::string benchmarkStates; // /api/states of the stand-in
+
+// a state object like HA returns it for a sensor, about 400 bytes
+std::string BenchmarkStateObject(const std::string& entity, int i)
+{
+    char object[512];
+    snprintf(object, sizeof(object),
+             "{\"entity_id\":\"%s\",\"state\":\"%d.%d\",\"attributes\":{\"state_class\":\"measurement\",\"unit_of_measurement\":\"°C\","
+             "\"device_class\":\"temperature\",\"friendly_name\":\"Sensor %d\",\"current_temperature\":%d.5},"
+             "\"last_changed\":\"2024-06-01T11:58:01.123456+00:00\",\"last_updated\":\"2024-06-01T11:58:01.123456+00:00\","
+             "\"context\":{\"id\":\"01HZ8X3B6J0000000000%06d\",\"parent_id\":null,\"user_id\":null}}",
+             entity.c_str(), 15 + i % 10, i % 10, i, 15 + i % 10, i);
+    return object;
+}
+
+// /api/states of a HA instance with count entities, the configured ones spread over the array
+void BuildBenchmarkStates(int count)
+{
+    resetEntityCache();
+    collectCachedEntities(true);
+    benchmarkStates = "[";
+    for (int i = 0, configured = 0; i < count; i++)
+    {
+        std::string entity = "sensor.benchmark_" + std::to_string(i);
+        if (configured < haCacheCount && i % (count / haCacheCount) == 0)
+            entity = haCache[configured++].entityID.c_str();
+        benchmarkStates += (i > 0 ? "," : "") + BenchmarkStateObject(entity, i);
+    }
+    benchmarkStates += "]";
+}
+
+void BenchmarkStatesHandler(const StandInRequest& request, StandInResponse& response)
+{
+    if (request.path == "/api/states")
+        response.body = benchmarkStates;
+    else if (request.path.compare(0, 12, "/api/states/") == 0)
+        response.body = BenchmarkStateObject(request.path.substr(12), 1);
+    else
+        response.code = 404;
+}
+
+// us of fetching the configured entities one way, with its peak heap use in bytes
+double TimeFetch(void (*fetch)(), size_t& peakHeap)
+{
+    resetEntityCache();
+    size_t used = hostHeapUsed;
+    resetHostHeapPeak();
+    unsigned long start = micros();
+    fetch();
+    double us = micros() - start;
+    peakHeap = hostHeapPeak - used;
+    haClient.stop();
+    return us;
+}
+
+void FetchBulk()
+{
+    fetchAllStates();
+}
+
+void FetchPipelined()
+{
+    fetchEntitiesPipelined();
+}
+
+void FetchOneByOne()
+{
+    collectCachedEntities(true);
+    for (int i = 0; i < haCacheCount; i++)
+        fetchEntity(&haCache[i]);
+}
+
+// Awake time and peak heap of fetching the dashboard entities from HA instances of 100, 1000 and 5000 entities:
+// the whole /api/states against the requests for the configured entities, over the stand-in server with the round
+// trip time and bandwidth of a WiFi link. Only the heap allocated with new counts (see shim/Esp.h), which is all the
+// fetch code uses besides the stack.
+void BenchmarkFetch()
+{
+    resetEntityCache();
+    collectCachedEntities(true);
+    printf("Fetch, %d configured entities, %dms round trip, %ld bytes/s:\n", haCacheCount, BENCHMARK_RTT_MS, (long)BENCHMARK_BYTES_PER_SECOND);
+    const int counts[] = {0, 100, 1000, 5000};
+    for (int c = 0; c < ARRAY_SIZE(counts); c++)
+    {
+        // the stand-in is forked with the states it serves
+        if (counts[c] > 0)
+            BuildBenchmarkStates(counts[c]);
+        StandInServer server(BenchmarkStatesHandler, BENCHMARK_RTT_MS, BENCHMARK_BYTES_PER_SECOND);
+        if (!server.start())
+            return;
+        Serial.muted = true;
+        if (counts[c] == 0)
+        {
+            size_t oneByOneHeap, pipelinedHeap;
+            double oneByOne = TimeFetch(FetchOneByOne, oneByOneHeap);
+            double pipelined = TimeFetch(FetchPipelined, pipelinedHeap);
+            Serial.muted = false;
+            printf("  %-34s %9.0fms  peak heap %6u bytes\n", "one request per entity", oneByOne / 1000, (unsigned)oneByOneHeap);
+            printf("  %-34s %9.0fms  peak heap %6u bytes\n", ("pipelined, depth " + String(ha_pipeline_depth)).c_str(), pipelined / 1000,
+                   (unsigned)pipelinedHeap);
+            continue;
+        }
+        size_t bulkHeap;
+        double bulk = TimeFetch(FetchBulk, bulkHeap);
+        int found = 0;
+        for (int i = 0; i < haCacheCount; i++)
+            found += haCache[i].found;
+        Serial.muted = false;
+        String name = "/api/states, " + String(counts[c]) + " entities";
+        printf("  %-34s %9.0fms  peak heap %6u bytes, %u bytes streamed, %d/%d found\n", name.c_str(), bulk / 1000, (unsigned)bulkHeap,
+               (unsigned)benchmarkStates.length(), found, haCacheCount);
+    }
+    benchmarkStates.clear();
+    benchmarkStates.shrink_to_fit();
+}
+
+bool benchmarkRetained = true; // whether the stand-in broker holds retained messages
+
+const char* BenchmarkRetained(const std::string& topic)
+{
+    if (!benchmarkRetained)
+        return NULL;
+    if (topic.compare(0, 5, "stat/") == 0)
+        return "ON";
+    return "{\"battery\":90,\"contact\":true,\"occupancy\":false,\"linkquality\":120}";
+}
+
+// ms of a prefetch from a fresh cache
+double TimePrefetch(HADataSource& source)
+{
+    resetEntityCache();
+    Serial.muted = true;
+    unsigned long start = micros();
+    source.prefetch(NULL);
+    double ms = (micros() - start) / 1000.0;
+    Serial.muted = false;
+    haClient.stop();
+    return ms;
+}
+
+// Awake time of the prefetch from the REST API against MQTT (for the entities with a topic) plus the REST API for
+// the rest, from an instance of 1000 entities and a broker with the same round trip time
+void BenchmarkMqtt()
+{
+    BuildBenchmarkStates(1000);
+    StandInServer server(BenchmarkStatesHandler, BENCHMARK_RTT_MS, BENCHMARK_BYTES_PER_SECOND);
+    if (!server.start())
+        return;
+    printf("Prefetch, %d configured entities (%d with a topic), %dms round trip:\n", haCacheCount, (int)ARRAY_SIZE(mqttTopics),
+           BENCHMARK_RTT_MS);
+    double rest = TimePrefetch(haRestDataSource);
+    printf("  %-34s %9.0fms\n", "REST API", rest);
+    for (int retained = 1; retained >= 0; retained--)
+    {
+        benchmarkRetained = retained;
+        StandInBroker broker(BenchmarkRetained, mqtt_port, BENCHMARK_RTT_MS);
+        if (!broker.start())
+            return;
+        double mqtt = TimePrefetch(haMqttDataSource);
+        printf("  %-34s %9.0fms\n", retained ? "MQTT, retained messages" : "MQTT, no retained messages", mqtt);
+    }
+    benchmarkRetained = true;
+    benchmarkStates.clear();
+    benchmarkStates.shrink_to_fit();
+}
+
+// a stream over bytes in memory, e.g. a saved response
+class MemoryStream : public Stream
+{
+public:
+    MemoryStream(const char* data, size_t length) : data(data), length(length)
+    {
+        setTimeout(0);
+    }
+
+    int available() override
+    {
+        return length - position;
+    }
+
+    int read() override
+    {
+        return position < length ? (uint8_t)data[position++] : -1;
+    }
+
+    int peek() override
+    {
+        return position < length ? (uint8_t)data[position] : -1;
+    }
+
+    size_t write(uint8_t c) override
+    {
+        return 0;
+    }
+
+    size_t consumed()
+    {
+        return position;
+    }
+
+private:
+    const char* data;
+    size_t      length;
+    size_t      position = 0;
+};
+
+// Throughput and heap of the state parser on a /api/states of 5000 entities held in memory, without the network
+void BenchmarkParser()
+{
+    const int count = 5000;
+    BuildBenchmarkStates(count);
+    double fastest = 0;
+    size_t peakHeap = 0;
+    int entities = 0;
+    int matched = 0;
+    Serial.muted = true;
+    for (int batch = 0; batch < BENCHMARK_BATCHES; batch++)
+    {
+        resetEntityCache();
+        collectCachedEntities(true);
+        MemoryStream stream(benchmarkStates.data(), benchmarkStates.length());
+        size_t used = hostHeapUsed;
+        resetHostHeapPeak();
+        entities = matched = 0;
+        unsigned long start = micros();
+        cacheStatesArray(stream, entities, matched);
+        double us = micros() - start;
+        peakHeap = hostHeapPeak - used;
+        if (batch == 0 || us < fastest)
+            fastest = us;
+    }
+    Serial.muted = false;
+    printf("State parser, /api/states of %d entities (%u bytes) from memory:\n", count, (unsigned)benchmarkStates.length());
+    printf("  %-34s %9.0fus  %.2fus per entity, %.1f MB/s, peak heap %u bytes, %d/%d found\n", "cacheStatesArray", fastest,
+           fastest / entities, benchmarkStates.length() / fastest, (unsigned)peakHeap, matched, haCacheCount);
+    benchmarkStates.clear();
+    benchmarkStates.shrink_to_fit();
+}
+
+void RunBenchmarks()
+{
+    memset(framebuffer, 0xFF, EPD_WIDTH * EPD_HEIGHT / 2);
+    BenchmarkText();
+    BenchmarkIcons();
+    BenchmarkPrimitives();
+    BenchmarkParser();
+    BenchmarkFetch();
+    BenchmarkMqtt();
+}
@@ -0,0 +1,712 @@
+// Host checks (--test): assertions on the parts of the dashboard that run without a board. Every failed check is
+// printed with its line, the run fails if a single check failed.
+
+int testChecks = 0;
+int testFailures = 0;
+
+#define CHECK(condition) Check((condition), #condition, __LINE__)
+#define CHECK_STRING(actual, expected) CheckString((actual), (expected), #actual, __LINE__)
+
+bool Check(bool ok, const char* condition, int line)
+{
+    testChecks++;
+    if (!ok)
+    {
+        testFailures++;
+        printf("  FAILED line %d: %s\n", line, condition);
+    }
+    return ok;
+}
+
+bool CheckString(const String& actual, const char* expected, const char* expression, int line)
+{
+    bool ok = Check(actual == expected, expression, line);
+    if (!ok)
+        printf("    \"%s\" instead of \"%s\"\n", actual.c_str(), expected);
+    return ok;
+}
+
+// renders the text centered into a white framebuffer and returns a copy of it
+uint8_t* RenderLabel(const String& text)
+{
+    const size_t frameSize = EPD_WIDTH * EPD_HEIGHT / 2;
+    memset(framebuffer, 0xFF, frameSize);
+    setFont(OpenSans24B);
+    drawString(EPD_WIDTH / 2, 100, text, CENTER);
+    damageCount = 0;
+    uint8_t* frame = (uint8_t*)malloc(frameSize);
+    memcpy(frame, framebuffer, frameSize);
+    return frame;
+}
+
+bool SameLabel(const String& text, const String& expected)
+{
+    uint8_t* actual = RenderLabel(text);
+    uint8_t* reference = RenderLabel(expected);
+    bool same = memcmp(actual, reference, EPD_WIDTH * EPD_HEIGHT / 2) == 0;
+    free(actual);
+    free(reference);
+    return same;
+}
+
+// the bottom bar and the temperature tiles format floats with String(value, decimals)
+void TestFloatLabels()
+{
+    printf("Float labels\n");
+    CHECK_STRING(String(9.7f), "9.70");
+    CHECK_STRING(String(23.4f, 1), "23.4");
+    CHECK_STRING(String(4.0f, 2), "4.00");
+    CHECK_STRING(String(21.5, 1), "21.5");
+    CHECK_STRING(String(-0.5f, 1), "-0.5");
+    CHECK_STRING(String(1542), "1542");
+    CHECK_STRING(String(255, HEX), "ff");
+    CHECK(SameLabel(String(9.7f) + " kWh", "9.70 kWh"));
+    CHECK(SameLabel(String(23.4f, 1) + "° C", "23.4° C"));
+    CHECK(!SameLabel(String(23.4f, 1) + "° C", "23° C"));
+}
+
+// non-white pixels of the text drawn centered into a white framebuffer, straight or through the display list
+int InkPixels(const String& text, bool banded)
+{
+    const size_t frameSize = EPD_WIDTH * EPD_HEIGHT / 2;
+    memset(framebuffer, 0xFF, frameSize);
+    setFont(OpenSans9B);
+    if (banded)
+        beginDisplayList();
+    drawString(EPD_WIDTH / 2, 100, text, CENTER);
+    Serial.muted = true;
+    endDisplayList();
+    Serial.muted = false;
+    damageCount = 0;
+    int ink = 0;
+    for (size_t i = 0; i < frameSize; i++)
+        ink += ((framebuffer[i] & 0x0F) != 0x0F) + ((framebuffer[i] >> 4) != 0x0F);
+    return ink;
+}
+
+// strings of more glyphs than drawString() keeps for the blit are drawn completely
+void TestLongLabels()
+{
+    printf("Long labels\n");
+    String half, whole;
+    for (int i = 0; i < MAX_TEXT_GLYPHS * 3 / 4; i++)
+        half += "i";
+    whole = half + half;
+    for (int banded = 0; banded <= 1; banded++)
+    {
+        int ink = InkPixels(half, banded);
+        CHECK(ink > 0 && InkPixels(whole, banded) == 2 * ink);
+    }
+}
+
+// the bottom bar tiles, drawn into a white framebuffer with font set before, returns a copy of the framebuffer
+uint8_t* RenderBottomTiles(const GFXfont& font)
+{
+    const size_t frameSize = EPD_WIDTH * EPD_HEIGHT / 2;
+    memset(framebuffer, 0xFF, frameSize);
+    setFont(font);
+    DrawBottomTile(3, 456, "12.5", "TOTAL ENERGY TODAY");
+    DrawTempSensorTile(3 + BOTTOM_TILE_WIDTH, 456, 21.5, "ROOM 1 TEMP");
+    DrawTempSensorTile(3 + 2 * BOTTOM_TILE_WIDTH, 456, 0, "ROOM 2 TEMP");
+    damageCount = 0;
+    uint8_t* frame = (uint8_t*)malloc(frameSize);
+    memcpy(frame, framebuffer, frameSize);
+    return frame;
+}
+
+// tiles that set their own fonts neither look nor hash differently after a tile that left another font set
+void TestTileHashFonts()
+{
+    printf("Tile hash fonts\n");
+    resetTileHashes();
+    uint8_t* first = RenderBottomTiles(OpenSans8B);
+    tileHashesValid = true;
+    int skipped = tilesSkipped;
+    uint8_t* second = RenderBottomTiles(OpenSans24B);
+    CHECK(tilesSkipped == skipped + 3);
+    resetTileHashes();
+    free(second);
+    second = RenderBottomTiles(OpenSans24B);
+    CHECK(memcmp(first, second, EPD_WIDTH * EPD_HEIGHT / 2) == 0);
+    resetTileHashes();
+    free(first);
+    free(second);
+}
+
+// the frame store as after a power cycle, on an erased partition
+void ResetFrameStore()
+{
+    resetHostFlash();
+    frameKey.location = FRAME_NONE;
+    frameStored.location = FRAME_NONE;
+    frameLogHead = frameLogErased = 0;
+    frameBudget = FRAME_FLASH_BURST;
+    frameBudgetEpoch = 0;
+    free(frameKeyPixels);
+    frameKeyPixels = NULL;
+}
+
+// lines of text over the whole framebuffer, too much for RTC memory; shift moves them, label changes one line
+void DrawTextFrame(int shift, const String& label)
+{
+    memset(framebuffer, 0xFF, EPD_WIDTH * EPD_HEIGHT / 2);
+    setFont(OpenSans9B);
+    for (int y = 40; y < EPD_HEIGHT; y += 22)
+        drawString(10 + shift, y, "Line " + String(y) + ": the quick brown fox jumps over the lazy dog 0123456789", LEFT);
+    drawString(EPD_WIDTH / 2, 18, label, CENTER);
+    damageCount = 0;
+}
+
+// stores the framebuffer, then restores it as a wake from deep sleep would
+bool StoreAndRestore(unsigned long epoch)
+{
+    const size_t frameSize = EPD_WIDTH * EPD_HEIGHT / 2;
+    if (!storeFrame(framebuffer, epoch))
+        return false;
+    free(frameKeyPixels);
+    frameKeyPixels = NULL;
+    uint8_t* restored = (uint8_t*)malloc(frameSize);
+    bool ok = restoreFrame(restored) && memcmp(restored, framebuffer, frameSize) == 0;
+    free(restored);
+    return ok;
+}
+
+// Key frames and differences in flash and RTC memory restore the stored frame, also after the log wrapped; a
+// corrupt record is not restored and the flash budget holds back stores
+void TestFrameStore()
+{
+    printf("Frame store\n");
+    Serial.muted = true;
+    ResetFrameStore();
+    unsigned long epoch = 1700000000;
+    DrawTextFrame(0, "12:00");
+    CHECK(StoreAndRestore(epoch));
+    CHECK(frameStored.location == FRAME_KEY);
+    size_t written = hostFlashWritten;
+    DrawTextFrame(0, "12:01");
+    CHECK(StoreAndRestore(epoch += 30));
+    CHECK(frameStored.location == FRAME_RTC && frameStored.onKey);
+    CHECK(hostFlashWritten == written);
+    DrawWifiErrorFrame();
+    CHECK(StoreAndRestore(epoch += 30));
+    CHECK(frameStored.location == FRAME_RTC && !frameStored.onKey);
+
+    // a day of moved frames goes round the partition several times
+    int keys = 0;
+    bool ok = true;
+    for (int i = 0; i < 60; i++)
+    {
+        DrawTextFrame(1 + i % 7, String(i));
+        ok &= StoreAndRestore(epoch += 3600);
+        keys += frameStored.location == FRAME_KEY;
+    }
+    CHECK(ok);
+    CHECK(keys > 2 * (int)(hostFramePartition.size / frameKey.header.length));
+    DrawTextFrame(0, "13:00");
+    CHECK(StoreAndRestore(epoch += 3600));
+
+    // a flipped bit in the key frame
+    hostFlash[frameKey.offset + sizeof(FrameHeader) + 100] ^= 0x04;
+    free(frameKeyPixels);
+    frameKeyPixels = NULL;
+    CHECK(!restoreFrame(framebuffer));
+    CHECK(frameKey.location == FRAME_NONE);
+
+    // without time passing only the burst can be written
+    ResetFrameStore();
+    ok = true;
+    for (int i = 0; i < 20; i++)
+    {
+        DrawTextFrame(i % 7, String(i));
+        ok &= storeFrame(framebuffer, epoch);
+    }
+    CHECK(!ok);
+    CHECK(hostFlashWritten <= FRAME_FLASH_BURST);
+    ResetFrameStore();
+    Serial.muted = false;
+}
+
+const char* testStatesBody = "";
+
+void TestStatesHandler(const StandInRequest& request, StandInResponse& response)
+{
+    response.body = testStatesBody;
+}
+
+// fetchAllStates() of a given /api/states body, the stand-in is forked with it
+bool FetchTestStates(const char* body)
+{
+    testStatesBody = body;
+    StandInServer server(TestStatesHandler);
+    if (!server.start())
+        return false;
+    resetEntityCache();
+    Serial.muted = true;
+    bool ok = fetchAllStates();
+    Serial.muted = false;
+    haClient.stop();
+    return ok;
+}
+
+int LoadedEntities()
+{
+    int loaded = 0;
+    for (int i = 0; i < haCacheCount; i++)
+        loaded += haCache[i].loaded;
+    return loaded;
+}
+
+int FoundEntities()
+{
+    int found = 0;
+    for (int i = 0; i < haCacheCount; i++)
+        found += haCache[i].found;
+    return found;
+}
+
+// an empty instance is a valid snapshot: every entity is loaded and none of them exists
+void TestBulkFetch()
+{
+    printf("Bulk fetch\n");
+    CHECK(FetchTestStates("[]"));
+    CHECK(haCacheCount > 0 && LoadedEntities() == haCacheCount && FoundEntities() == 0);
+    CHECK(FetchTestStates(" [ \r\n ] "));
+    CHECK(haCacheCount > 0 && LoadedEntities() == haCacheCount && FoundEntities() == 0);
+    CHECK(FetchTestStates("[{\"entity_id\":\"switch.pond_filter\",\"state\":\"on\"},{\"entity_id\":\"light.other\",\"state\":\"off\"}]"));
+    CHECK(LoadedEntities() == haCacheCount && FoundEntities() == 1);
+    CHECK_STRING(findCachedEntity("switch.pond_filter")->value.state, "on");
+    // a cut off response leaves the entities to the single requests
+    CHECK(!FetchTestStates("[{\"entity_id\":\"switch.pond_filter\",\"state\":\"on\"},{\"entity_id\""));
+    CHECK(LoadedEntities() == 0);
+}
+
+void TestEntityHandler(const StandInRequest& request, StandInResponse& response)
+{
+    if (request.path.compare(0, 12, "/api/states/") == 0)
+        response.body = "{\"entity_id\":\"" + request.path.substr(12) + "\",\"state\":\"on\"}";
+    else
+        response.code = 404;
+}
+
+void FetchEntitiesOneByOne()
+{
+    resetEntityCache();
+    collectCachedEntities(true);
+    Serial.muted = true;
+    for (int i = 0; i < haCacheCount; i++)
+        fetchEntity(&haCache[i]);
+    Serial.muted = false;
+}
+
+// ms of fetchEntitiesPipelined() from a fresh cache
+double FetchEntitiesPipelined()
+{
+    resetEntityCache();
+    Serial.muted = true;
+    unsigned long start = micros();
+    fetchEntitiesPipelined();
+    double ms = (micros() - start) / 1000.0;
+    Serial.muted = false;
+    return ms;
+}
+
+// all requests of a wake share one keep-alive connection, a closed one is reopened for the next request
+void TestConnectionReuse()
+{
+    printf("Connection reuse\n");
+    StandInServer server(TestEntityHandler);
+    CHECK(server.start());
+    FetchEntitiesOneByOne();
+    CHECK(FoundEntities() == haCacheCount);
+    CHECK(server.getStats().requests == haCacheCount);
+    CHECK(server.getStats().connections == 1);
+    haClient.stop();
+    server.stop();
+
+    StandInServer closing(TestEntityHandler, 0, 0, 3);
+    CHECK(closing.start());
+    FetchEntitiesOneByOne();
+    CHECK(FoundEntities() == haCacheCount);
+    CHECK(closing.getStats().connections == (haCacheCount + 2) / 3);
+    haClient.stop();
+}
+
+// with a WiFi round trip time the pipelined requests wait for one round trip per batch instead of one per entity;
+// a request that was written only in part is sent again with its batch on a new connection
+void TestPipelining()
+{
+    printf("Pipelining\n");
+    const int rttMs = 40;
+    StandInServer server(TestEntityHandler, rttMs);
+    CHECK(server.start());
+    unsigned long start = micros();
+    FetchEntitiesOneByOne();
+    double oneByOne = (micros() - start) / 1000.0;
+    haClient.stop();
+    server.resetStats();
+    double pipelined = FetchEntitiesPipelined();
+    int batches = (haCacheCount + ha_pipeline_depth - 1) / ha_pipeline_depth;
+    CHECK(FoundEntities() == haCacheCount);
+    CHECK(server.getStats().maxPipelined == std::min(haCacheCount, ha_pipeline_depth));
+    CHECK(server.getStats().connections == 1);
+    CHECK(oneByOne >= haCacheCount * rttMs);
+    CHECK(pipelined < (batches + 1) * rttMs * 1.5);
+    printf("  %d entities with %dms round trip time: %.0fms one by one, %.0fms pipelined\n", haCacheCount, rttMs, oneByOne, pipelined);
+    haClient.stop();
+
+    server.resetStats();
+    wifiClientShortWrites = 1;
+    FetchEntitiesPipelined();
+    CHECK(wifiClientShortWrites == 0);
+    CHECK(FoundEntities() == haCacheCount);
+    CHECK(server.getStats().connections == 2);
+    haClient.stop();
+    server.stop();
+
+    // a response that starts later than the 1s stream timeout is still read
+    StandInServer slow(TestEntityHandler, 1200);
+    CHECK(slow.start());
+    long length;
+    CHECK(haClient.sendGET("/api/states/switch.slow"));
+    CHECK(haClient.readResponseHeaders(length) == HTTP_CODE_OK && length > 0);
+    haClient.stop();
+}
+
+// retained messages of the stand-in broker, the main door sensor one is set by the check
+const char* testMainDoorMessage = NULL;
+
+const char* TestRetained(const std::string& topic)
+{
+    if (topic == "stat/tasmota_2/POWER")
+        return "OFF";
+    if (topic == "zigbee2mqtt/stairs_2_motion_sensor")
+        return "{\"battery\":90,\"occupancy\":false}";
+    if (topic == "zigbee2mqtt/main_door_sensor")
+        return testMainDoorMessage;
+    return NULL;
+}
+
+// prefetch over the stand-in broker (forked with the current testMainDoorMessage) and the REST stand-in
+void MqttPrefetch(int& subscriptions)
+{
+    StandInBroker broker(TestRetained, mqtt_port);
+    CHECK(broker.start());
+    resetEntityCache();
+    Serial.muted = true;
+    haMqttDataSource.prefetch(NULL);
+    Serial.muted = false;
+    subscriptions = broker.getStats().subscriptions;
+    haClient.stop();
+}
+
+// the topics with a state take it from the broker; a topic without a retained message, or whose payload is not JSON
+// or lacks the key, leaves its entity to the REST API (which answers "on" for everything)
+void TestMqtt()
+{
+    printf("MQTT\n");
+    StandInServer server(TestEntityHandler);
+    CHECK(server.start());
+    int subscriptions = 0;
+    testMainDoorMessage = "{\"contact\":true}";
+    MqttPrefetch(subscriptions);
+    CHECK(subscriptions == ARRAY_SIZE(mqttTopics));
+    CHECK(LoadedEntities() == haCacheCount && FoundEntities() == haCacheCount);
+    CHECK_STRING(findCachedEntity("switch.tasmota_2")->value.state, "off");
+    CHECK_STRING(findCachedEntity("switch.tasmota_3")->value.state, "on");
+    CHECK_STRING(findCachedEntity("binary_sensor.stairs_2_motion_sensor_ias_zone")->value.state, "off");
+    CHECK_STRING(findCachedEntity("binary_sensor.main_door_sensor_ias_zone")->value.state, "off");
+
+    const char* withoutState[] = {"{\"battery\":90}", "{\"contact\":null}", "{\"contact\":", "closed", ""};
+    for (int i = 0; i < ARRAY_SIZE(withoutState); i++)
+    {
+        testMainDoorMessage = withoutState[i];
+        MqttPrefetch(subscriptions);
+        CHECK(FoundEntities() == haCacheCount);
+        CHECK_STRING(findCachedEntity("binary_sensor.main_door_sensor_ias_zone")->value.state, "on");
+        CHECK_STRING(findCachedEntity("switch.tasmota_2")->value.state, "off");
+    }
+}
+
+// POST /api/template answers only a template of the bottom bar values, the HA status comes from GET /api/config
+void TestAggregatesHandler(const StandInRequest& request, StandInResponse& response)
+{
+    if (request.method == "POST" && request.path == "/api/template")
+    {
+        if (request.body.find("states('") == std::string::npos || request.body.find("installed_version") != std::string::npos)
+        {
+            response.code = 400;
+            return;
+        }
+        std::string temperatures;
+        for (int i = 0; i < ARRAY_SIZE(haFloatSensors); i++)
+        {
+            if (haFloatSensors[i].entityType == sensor_type::TEMP)
+                temperatures += (temperatures.empty() ? "" : ",") + std::to_string(20 + i) + ".5";
+        }
+        response.body = "{\"energy\":12.25,\"power\":340.0,\"temp\":[" + temperatures + "]}";
+    }
+    else if (request.method == "GET" && request.path == "/api/config")
+        response.body = "{\"components\":[\"http\",\"api\"],\"state\":\"RUNNING\",\"time_zone\":\"Europe/Berlin\","
+                        "\"unit_system\":{\"temperature\":\"°C\"},\"version\":\"2024.6.1\"}";
+    else
+        response.code = 404;
+}
+
+void TestAggregates()
+{
+    printf("Aggregates\n");
+    StandInServer server(TestAggregatesHandler);
+    CHECK(server.start());
+    Serial.muted = true;
+    bool ok = fetchAggregates();
+    HAConfigurations config = getHaStatus();
+    Serial.muted = false;
+    CHECK(ok && haAggregates.valid);
+    CHECK(haAggregates.totalEnergy == 12.25f && haAggregates.totalPower == 340.0f);
+    bool temperatures = true;
+    for (int i = 0; i < ARRAY_SIZE(haFloatSensors); i++)
+        temperatures &= haAggregates.temperatures[i] == (haFloatSensors[i].entityType == sensor_type::TEMP ? 20 + i + 0.5f : 0);
+    CHECK(temperatures);
+    CHECK_STRING(config.haStatus, "RUNNING");
+    CHECK_STRING(config.timeZone, "Europe/Berlin");
+    CHECK_STRING(config.version, "2024.6.1");
+    CHECK(server.getStats().requests == 2 && server.getStats().connections == 1);
+    haClient.stop();
+    server.stop();
+
+    // if neither endpoint answers, the bottom bar falls back to the entities and the status shows the error
+    StandInServer missing(TestEntityHandler);
+    CHECK(missing.start());
+    Serial.muted = true;
+    ok = fetchAggregates();
+    config = getHaStatus();
+    Serial.muted = false;
+    CHECK(!ok && !haAggregates.valid);
+    CHECK_STRING(config.haStatus, "ERROR");
+    haClient.stop();
+}
+
+std::vector<std::string> testChangedEntities;
+
+void RecordChangedEntity(const char* entity)
+{
+    testChangedEntities.push_back(entity);
+}
+
+// Push mode after a first draw over REST: the WebSocket shim plays HA, from the authentication to the state diffs
+void TestPushMode()
+{
+    printf("Push mode\n");
+    haAggregates.valid = false;
+    CHECK(FetchTestStates("[{\"entity_id\":\"binary_sensor.main_door_sensor_ias_zone\",\"state\":\"off\",\"attributes\":{\"device_class\":\"door\"},"
+                          "\"last_changed\":\"2024-06-01T11:58:01.123456+00:00\",\"last_updated\":\"2024-06-01T11:58:01.123456+00:00\"},"
+                          "{\"entity_id\":\"sensor.xiaomi_airpurifier_temp\",\"state\":\"21\",\"attributes\":{\"current_temperature\":21.5},"
+                          "\"last_changed\":\"2024-06-01T11:00:00+00:00\",\"last_updated\":\"2024-06-01T11:59:30+00:00\"}]"));
+    HAEntityCacheEntry* door = findCachedEntity("binary_sensor.main_door_sensor_ias_zone");
+    HAEntityCacheEntry* temperature = findCachedEntity("sensor.xiaomi_airpurifier_temp");
+    if (!CHECK(door != NULL && door->found && temperature != NULL && temperature->found))
+        return;
+
+    testChangedEntities.clear();
+    haWebSocket.sent.clear();
+    haEntityChangedCallback = RecordChangedEntity;
+    Serial.muted = true;
+    beginHaWebSocket();
+    CHECK(haWebSocket.port == haClient.getPort() && haWebSocket.url == "/api/websocket" && !haWebSocket.secure);
+    haWebSocket.receive("{\"type\":\"auth_required\",\"ha_version\":\"2024.6.1\"}");
+    CHECK(haWebSocket.sent.size() == 1 && haWebSocket.sent[0].indexOf("\"type\":\"auth\"") >= 0 && haWebSocket.sent[0].indexOf(ha_token) >= 0);
+    haWebSocket.receive("{\"type\":\"auth_ok\",\"ha_version\":\"2024.6.1\"}");
+    CHECK(haWebSocket.sent.size() == 2 && haWebSocket.sent[1].indexOf("\"type\":\"subscribe_entities\"") >= 0 &&
+          haWebSocket.sent[1].indexOf("\"binary_sensor.main_door_sensor_ias_zone\"") >= 0);
+    haWebSocket.receive("{\"id\":1,\"type\":\"result\",\"success\":true,\"result\":null}");
+
+    // the states of the subscription are those REST returned, with epoch timestamps: nothing to redraw
+    haWebSocket.receive("{\"id\":1,\"type\":\"event\",\"event\":{\"a\":{"
+                        "\"binary_sensor.main_door_sensor_ias_zone\":{\"s\":\"off\",\"a\":{\"device_class\":\"door\"},\"c\":\"01HZ8X\",\"lc\":1717243081.123456},"
+                        "\"sensor.xiaomi_airpurifier_temp\":{\"s\":\"21\",\"a\":{\"current_temperature\":21.5},\"c\":\"01HZ8Y\",\"lc\":1717239600.0,\"lu\":1717243170.0}}}}");
+    CHECK(testChangedEntities.empty());
+    CHECK_STRING(door->value.lastChanged, "2024-06-01T11:58:01.123456+00:00");
+    CHECK_STRING(door->value.lastUpdated, "2024-06-01T11:58:01.123456+00:00");
+    CHECK_STRING(temperature->value.lastUpdated, "2024-06-01T11:59:30+00:00");
+
+    // a sensor that reports the same value again only moves "lu"
+    haWebSocket.receive("{\"id\":1,\"type\":\"event\",\"event\":{\"c\":{\"sensor.xiaomi_airpurifier_temp\":{\"+\":{\"lu\":1717243200.5,\"c\":\"01HZ8Z\"}}}}}");
+    CHECK(testChangedEntities.empty());
+    CHECK_STRING(temperature->value.lastUpdated, "2024-06-01T12:00:00.500000+00:00");
+
+    // a new state and a new value of a cached attribute redraw
+    haWebSocket.receive("{\"id\":1,\"type\":\"event\",\"event\":{\"c\":{"
+                        "\"binary_sensor.main_door_sensor_ias_zone\":{\"+\":{\"s\":\"on\",\"lc\":1717243210.25,\"c\":\"01HZ90\"}},"
+                        "\"sensor.xiaomi_airpurifier_temp\":{\"+\":{\"a\":{\"current_temperature\":22},\"lu\":1717243220,\"c\":\"01HZ91\"}}}}}");
+    CHECK(testChangedEntities.size() == 2);
+    CHECK_STRING(door->value.state, "on");
+    CHECK_STRING(temperature->value.attributes[0], "22");
+
+    testChangedEntities.clear();
+    haWebSocket.receive("{\"id\":1,\"type\":\"event\",\"event\":{\"r\":[\"binary_sensor.main_door_sensor_ias_zone\"]}}");
+    CHECK(testChangedEntities.size() == 1 && !door->found);
+    Serial.muted = false;
+    haEntityChangedCallback = NULL;
+
+    // https takes TLS and its default port, for the REST API and the WebSocket
+    HAClient secure("https://ha.example.org", "token");
+    CHECK(secure.isSecure() && secure.getHost() == "ha.example.org" && secure.getPort() == 443);
+    HAClient securePort("https://ha.example.org:8443/", "token");
+    CHECK(securePort.isSecure() && securePort.getPort() == 8443);
+    HAClient plain("http://192.168.2.138", "token");
+    CHECK(!plain.isSecure() && plain.getPort() == 80);
+}
+
+// parser corpus of --test: <case>.json is parsed as one state object and has to give <case>.expected
+const char* parserCorpus = "src/native/fixtures/parser";
+
+// the parse result as text, control characters and backslashes escaped
+String DumpStateObject(bool ok, HAStateParser& parser, const HAStateObject& object)
+{
+    if (!ok)
+        return "error\n";
+    const char* names[] = {"entity_id", "state", "last_changed", "last_updated", haCachedAttributes[0]};
+    const char* values[] = {object.entityID, object.state, object.lastChanged, object.lastUpdated, object.attributes[0]};
+    String dump;
+    for (int i = 0; i < ARRAY_SIZE(names); i++)
+    {
+        dump += String(names[i]) + ": ";
+        for (const char* c = values[i]; *c != '\0'; c++)
+        {
+            char escaped[8];
+            if (*c == '\\')
+                dump += "\\\\";
+            else if ((uint8_t)*c < 0x20)
+            {
+                snprintf(escaped, sizeof(escaped), "\\x%02x", (uint8_t)*c);
+                dump += escaped;
+            }
+            else
+                dump += *c;
+        }
+        dump += "\n";
+    }
+    return dump + "truncated: " + String(parser.truncated()) + "\n";
+}
+
+bool ReadFile(const String& path, std::string& content)
+{
+    FILE* file = fopen(path.c_str(), "rb");
+    if (file == NULL)
+        return false;
+    char buffer[4096];
+    size_t count;
+    content.clear();
+    while ((count = fread(buffer, 1, sizeof(buffer), file)) > 0)
+        content.append(buffer, count);
+    fclose(file);
+    return true;
+}
+
+String ParseToDump(const std::string& input)
+{
+    MemoryStream stream(input.data(), input.length());
+    HAStateParser parser(stream, haCachedAttributes, HA_CACHED_ATTRIBUTES);
+    HAStateObject object;
+    bool ok = parser.parseObject(object);
+    return DumpStateObject(ok, parser, object);
+}
+
+// every field of the result ends within its buffer and the parser reads no further than the end of the input
+bool ParsesSafely(const std::string& input)
+{
+    MemoryStream stream(input.data(), input.length());
+    HAStateParser parser(stream, haCachedAttributes, HA_CACHED_ATTRIBUTES);
+    HAStateObject object;
+    memset(&object, 0x55, sizeof(object));
+    parser.parseObject(object);
+    const char* fields[] = {object.entityID, object.state, object.lastChanged, object.lastUpdated, object.attributes[0]};
+    const size_t sizes[] = {HA_ENTITY_ID_LENGTH, HA_STATE_LENGTH, HA_TIMESTAMP_LENGTH, HA_TIMESTAMP_LENGTH, HA_ATTRIBUTE_LENGTH};
+    for (int i = 0; i < ARRAY_SIZE(fields); i++)
+    {
+        if (memchr(fields[i], '\0', sizes[i]) == NULL)
+            return false;
+    }
+    return stream.consumed() <= input.length();
+}
+
+void TestParserCorpus()
+{
+    printf("State parser corpus\n");
+    DIR* directory = opendir(parserCorpus);
+    if (!CHECK(directory != NULL))
+    {
+        printf("    cannot open %s\n", parserCorpus);
+        return;
+    }
+    std::vector<std::string> cases;
+    while (dirent* file = readdir(directory))
+    {
+        std::string name = file->d_name;
+        if (name.length() > 5 && name.compare(name.length() - 5, 5, ".json") == 0)
+            cases.push_back(name.substr(0, name.length() - 5));
+    }
+    closedir(directory);
+    std::sort(cases.begin(), cases.end());
+    CHECK(cases.size() > 0);
+
+    uint32_t random = 0x2545F491;
+    int mutations = 0;
+    int unsafe = 0;
+    for (const std::string& name : cases)
+    {
+        String path = String(parserCorpus) + "/" + name.c_str();
+        std::string input, expected;
+        if (!CHECK(ReadFile(path + ".json", input) && ReadFile(path + ".expected", expected)))
+        {
+            printf("    %s\n", name.c_str());
+            continue;
+        }
+        String dump = ParseToDump(input);
+        if (!CHECK(dump == expected.c_str()))
+            printf("    %s:\n%s", name.c_str(), dump.c_str());
+
+        // deterministic mutations of the case: replaced, inserted and removed bytes (preferably JSON syntax) and cuts
+        const char syntax[] = "{}[]\",:\\u0e \xc3\xa9";
+        for (int m = 0; m < 2000; m++, mutations++)
+        {
+            std::string mutated = input;
+            for (int edits = 1 + m % 3; edits > 0; edits--)
+            {
+                random ^= random << 13;
+                random ^= random >> 17;
+                random ^= random << 5;
+                size_t at = mutated.empty() ? 0 : random % mutated.length();
+                char c = (random >> 8) % 4 == 0 ? (char)(random >> 16) : syntax[(random >> 16) % (sizeof(syntax) - 1)];
+                switch ((random >> 24) % 4)
+                {
+                    case 0: if (!mutated.empty()) mutated[at] = c; break;
+                    case 1: mutated.insert(at, 1, c); break;
+                    case 2: if (!mutated.empty()) mutated.erase(at, 1); break;
+                    case 3: mutated.resize(at); break;
+                }
+            }
+            unsafe += !ParsesSafely(mutated);
+        }
+    }
+    CHECK(unsafe == 0);
+    printf("  %d cases, %d mutations, %d unsafe\n", (int)cases.size(), mutations, unsafe);
+}
+
+bool RunTests()
+{
+    TestFloatLabels();
+    TestLongLabels();
+    TestTileHashFonts();
+    TestFrameStore();
+    TestBulkFetch();
+    TestConnectionReuse();
+    TestPipelining();
+    TestAggregates();
+    TestPushMode();
+    TestMqtt();
+    TestParserCorpus();
+    memset(framebuffer, 0xFF, EPD_WIDTH * EPD_HEIGHT / 2);
+    printf("%d/%d checks passed\n", testChecks - testFailures, testChecks);
+    return testFailures == 0;
+}
@@ -0,0 +1,420 @@
+// Host build of the dashboard renderer (pio run -e native). Renders the dashboard from a saved /api/states
+// response into a PGM image, without a board, panel or network. The epd_driver and Arduino shims are in shim/.
+//
+//   .pio/build/native/program <states.json> [output.pgm] [--repeat N] [--banded] [--wear]
+//   .pio/build/native/program --catalogue <directory> [--banded]
+//   .pio/build/native/program --check <directory> [--tolerance percent | --no-timing] [--banded]
+//   .pio/build/native/program --benchmark
+//   .pio/build/native/program --test [--corpus <directory>]
+//
+// The native_assets build reads the fonts and icons from an asset pack, add --assets <assets.bin> to every command.
+// --banded renders through the display list in bands of band_height rows instead of straight into the framebuffer.
+// --repeat renders the frame N times both ways with Serial muted and reports the time per frame, to profile the
+// renderer.
+// --wear stores a day of redraws of the dashboard in the frame store and reports the flash wear.
+// --catalogue and --check render every tile type in every state, see tilecatalogue.h.
+// --test runs the host checks of hosttests.h, --corpus is the state parser corpus (src/native/fixtures/parser).
+
+#include <Arduino.h>
+
+#include "esp_heap_caps.h"
+#include "rom/miniz.h"
+#include "esp_sleep.h"
+#include "esp_partition.h"
+#include "epd_driver.h"
+
+#include "fonts.h"
+
+#include <WiFiClient.h>
+#include <WiFiClientSecure.h>
+#include <HTTPClient.h>
+#include <ArduinoJson.h>
+#include <WebSocketsClient.h>
+#include <PubSubClient.h>
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "configurations.h"
+#include "hastateparser.h"
+#include "haentitycache.h"
+#include "homeassistantapi.h"
+#include "homeassistantws.h"
+#include "mqttdatasource.h"
+#include "displaydigest.h"
+#include "epd_drawing.h"
+#include "framecodec.h"
+#include "framestore.h"
+#include "tilehash.h"
+#include "dashboard.h"
+#include "tilecatalogue.h"
+#include "standin.h"
+#include "benchmarks.h"
+#include "hosttests.h"
+
+class FileStream : public Stream
+{
+public:
+    FileStream(FILE* file) : file(file)
+    {
+        setTimeout(0);
+    }
+
+    int available() override
+    {
+        return peek() < 0 ? 0 : 1;
+    }
+
+    int read() override
+    {
+        return fgetc(file);
+    }
+
+    int peek() override
+    {
+        int c = fgetc(file);
+        if (c >= 0)
+            ungetc(c, file);
+        return c;
+    }
+
+    size_t write(uint8_t c) override
+    {
+        return 0;
+    }
+
+private:
+    FILE* file;
+};
+
+// Serves the entities from a /api/states fixture, e.g. saved with
+// curl -H "Authorization: Bearer $TOKEN" http://homeassistant.local:8123/api/states > states.json
+class FixtureDataSource : public HADataSource
+{
+public:
+    FixtureDataSource(const char* path) : path(path) {}
+
+    const char* name() override
+    {
+        return "fixture";
+    }
+
+    bool prefetch(void (*progress)()) override
+    {
+        collectCachedEntities(true);
+        FILE* file = fopen(path, "rb");
+        if (file == NULL)
+        {
+            Serial.println("Cannot open " + String(path));
+            return false;
+        }
+        FileStream stream(file);
+        int entities = 0;
+        int matched = 0;
+        bool ok = cacheStatesArray(stream, entities, matched);
+        fclose(file);
+        Serial.println("Loaded " + String(matched) + "/" + String(haCacheCount) + " entities out of " + String(entities) + " from " + path);
+        return ok;
+    }
+
+    void fetch(HAEntityCacheEntry* entry) override
+    {
+        // everything in the fixture was prefetched
+        entry->loaded = true;
+        entry->found = false;
+    }
+
+private:
+    const char* path;
+};
+
+#ifdef ASSET_PACK
+// maps the pack file like the firmware maps the assets partition
+bool MapAssetPack(const char* path)
+{
+    int file = open(path, O_RDONLY);
+    struct stat info;
+    if (file < 0 || fstat(file, &info) != 0)
+    {
+        fprintf(stderr, "Cannot open %s\n", path);
+        return false;
+    }
+    void* pack = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, file, 0);
+    close(file);
+    return pack != MAP_FAILED && loadAssetPack((const uint8_t*)pack, info.st_size);
+}
+#endif
+
+void RenderDashboard(const HAConfigurations& haConfigs, bool banded)
+{
+    memset(framebuffer, 0xFF, EPD_WIDTH * EPD_HEIGHT / 2);
+    resetTileHashes();
+    damageCount = 0;
+    if (banded)
+        beginDisplayList();
+    DisplayStatusSection();
+    DisplayGeneralInfoSection(haConfigs);
+    for (int i = 0; i < ARRAY_SIZE(haEntities); i++)
+        DrawSwitchBarTile(i);
+    for (int i = 0; i < ARRAY_SIZE(haSensors); i++)
+        DrawSensorBarTile(i);
+    DrawBottomBar();
+    endDisplayList();
+}
+
+// us per frame of rendering the dashboard repeat times
+double TimeDashboard(const HAConfigurations& haConfigs, bool banded, int repeat)
+{
+    Serial.muted = true;
+    unsigned long start = micros();
+    for (int i = 0; i < repeat; i++)
+        RenderDashboard(haConfigs, banded);
+    unsigned long elapsed = micros() - start;
+    Serial.muted = false;
+    return (double)elapsed / repeat;
+}
+
+// Size and encode/decode time (the fastest of BENCHMARK_BATCHES) of the frame store encoding (framecodec.h), and
+// whether framestore.h could keep the whole frame in RTC memory or writes it to flash as a key frame
+void PrintCodecStats(const char* name, const uint8_t* frame)
+{
+    const size_t frameSize = EPD_WIDTH * EPD_HEIGHT / 2;
+    uint8_t* encoded = (uint8_t*)malloc(frameSize);
+    uint8_t* decoded = (uint8_t*)malloc(frameSize);
+    size_t length = 0;
+    bool ok = true;
+    double encodeUs = 0, decodeUs = 0;
+    for (int batch = 0; batch < BENCHMARK_BATCHES; batch++)
+    {
+        unsigned long start = micros();
+        length = encodeFrame(frame, frameSize, encoded, frameSize);
+        double us = micros() - start;
+        encodeUs = batch == 0 ? us : std::min(encodeUs, us);
+        start = micros();
+        ok &= length > 0 && decodeFrame(encoded, length, decoded, frameSize);
+        us = micros() - start;
+        decodeUs = batch == 0 ? us : std::min(decodeUs, us);
+        ok &= memcmp(decoded, frame, frameSize) == 0;
+    }
+    printf("Frame codec, %s: %u -> %u bytes (%.1f%%), encode %.0fus, decode %.0fus, round trip %s, stored in %s\n", name,
+           (unsigned)frameSize, (unsigned)length, 100.0 * length / frameSize, encodeUs, decodeUs, ok ? "ok" : "FAILED",
+           length <= FRAME_RTC_SIZE ? "RTC memory" : "flash as a key frame");
+    free(encoded);
+    free(decoded);
+}
+
+// the dashboard in the framebuffer and the WiFi error screen, the framebuffer is left as it was
+void PrintCodecStats()
+{
+    const size_t frameSize = EPD_WIDTH * EPD_HEIGHT / 2;
+    PrintCodecStats("dashboard", framebuffer);
+    uint8_t* dashboard = (uint8_t*)malloc(frameSize);
+    memcpy(dashboard, framebuffer, frameSize);
+    int damaged = damageCount;
+    DrawWifiErrorFrame();
+    PrintCodecStats("WiFi error screen", framebuffer);
+    memcpy(framebuffer, dashboard, frameSize);
+    damageCount = damaged;
+    free(dashboard);
+}
+
+#define WEAR_WAKES (86400 / 30) // a day of wakes at the 30s sleep of BeginSleep
+
+// sets the state of the entity in the cache, if it was loaded
+void SetCachedState(const String& entity, const String& state)
+{
+    HAEntityCacheEntry* entry = findCachedEntity(entity);
+    if (entry != NULL)
+        snprintf(entry->value.state, sizeof(entry->value.state), "%s", state.c_str());
+}
+
+// Stores a day of dashboard frames in the frame store (framestore.h) as BeginSleep would, with a redraw on every
+// wake, and reports where they went and the erases of the most worn sector of the frames partition. changes picks
+// what is new on a wake: the time and the power reading, plus a switch every 10 minutes, or the whole dashboard moved
+// by a few rows, which leaves the flash budget to bound the wear.
+void SimulateFrameStore(const HAConfigurations& haConfigs, const char* name, int changes)
+{
+    const size_t frameSize = EPD_WIDTH * EPD_HEIGHT / 2;
+    uint8_t* restored = (uint8_t*)malloc(frameSize);
+    int stored[FRAME_KEY + 1] = {0}; // by frameStored.location
+    size_t rtcBytes = 0;
+    bool ok = true;
+    resetHostFlash();
+    frameKey.location = frameStored.location = FRAME_NONE;
+    frameLogHead = frameLogErased = 0;
+    frameBudget = FRAME_FLASH_BURST;
+    frameBudgetEpoch = 0;
+    unsigned long epoch = 1717243200; // Sat 01-Jun-24 12:00:00
+    Serial.muted = true;
+    for (int wake = 0; wake < WEAR_WAKES; wake++, epoch += 30)
+    {
+        char clock[16];
+        snprintf(clock, sizeof(clock), "%02lu:%02lu:%02lu", epoch / 3600 % 24, epoch / 60 % 60, epoch % 60);
+        timeStamp = clock;
+        SetCachedState(haFloatSensors[3].entityID, String(800 + wake * 37 % 1500));
+        if (changes > 0 && wake % 20 == 0)
+            SetCachedState(haEntities[wake / 20 % ARRAY_SIZE(haEntities)].entityID, wake / 20 / ARRAY_SIZE(haEntities) % 2 ? "off" : "on");
+        RenderDashboard(haConfigs, false);
+        if (changes > 1)
+        {
+            int rows = 1 + wake % 7;
+            memmove(framebuffer + rows * EPD_WIDTH / 2, framebuffer, frameSize - rows * EPD_WIDTH / 2);
+        }
+        // the next wake decodes the key frame again
+        free(frameKeyPixels);
+        frameKeyPixels = NULL;
+        if (storeFrame(framebuffer, epoch))
+            ok &= restoreFrame(restored) && memcmp(restored, framebuffer, frameSize) == 0;
+        stored[frameStored.location]++;
+        if (frameStored.location == FRAME_RTC)
+            rtcBytes += frameStored.header.length;
+    }
+    Serial.muted = false;
+    int maxErases = *std::max_element(hostFlashErases.begin(), hostFlashErases.end());
+    printf("Frame store, a day of %s: %d wakes, %d in RTC memory (%u bytes on average), %d key frames in flash, "
+           "%d not stored, %.1f MB written, %d erases of the most worn sector, restores %s\n", name, WEAR_WAKES,
+           stored[FRAME_RTC], stored[FRAME_RTC] > 0 ? (unsigned)(rtcBytes / stored[FRAME_RTC]) : 0,
+           stored[FRAME_KEY], stored[FRAME_NONE], hostFlashWritten / 1048576.0, maxErases, ok ? "ok" : "FAILED");
+    free(restored);
+    free(frameKeyPixels);
+    frameKeyPixels = NULL;
+}
+
+int main(int argc, char** argv)
+{
+    const char* statesPath = NULL;
+    const char* outputPath = "dashboard.pgm";
+    const char* catalogueDirectory = NULL;
+    const char* checkDirectory = NULL;
+    const char* assetsPath = NULL;
+    bool benchmark = false;
+    bool test = false;
+    bool banded = false;
+    bool wear = false;
+    int repeat = 0;
+    int tolerance = 100;
+    for (int i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--repeat") == 0 && i + 1 < argc)
+            repeat = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--catalogue") == 0 && i + 1 < argc)
+            catalogueDirectory = argv[++i];
+        else if (strcmp(argv[i], "--check") == 0 && i + 1 < argc)
+            checkDirectory = argv[++i];
+        else if (strcmp(argv[i], "--tolerance") == 0 && i + 1 < argc)
+            tolerance = atoi(argv[++i]);
+        else if (strcmp(argv[i], "--no-timing") == 0)
+            tolerance = -1;
+        else if (strcmp(argv[i], "--benchmark") == 0)
+            benchmark = true;
+        else if (strcmp(argv[i], "--test") == 0)
+            test = true;
+        else if (strcmp(argv[i], "--corpus") == 0 && i + 1 < argc)
+            parserCorpus = argv[++i];
+        else if (strcmp(argv[i], "--banded") == 0)
+            banded = true;
+        else if (strcmp(argv[i], "--wear") == 0)
+            wear = true;
+        else if (strcmp(argv[i], "--assets") == 0 && i + 1 < argc)
+            assetsPath = argv[++i];
+        else if (statesPath == NULL)
+            statesPath = argv[i];
+        else
+            outputPath = argv[i];
+    }
+    if (statesPath == NULL && catalogueDirectory == NULL && checkDirectory == NULL && !benchmark && !test)
+    {
+        fprintf(stderr, "usage: %s <states.json> [output.pgm] [--repeat N] [--banded] [--wear]\n"
+                        "       %s --catalogue <directory> [--banded]\n"
+                        "       %s --check <directory> [--tolerance percent | --no-timing] [--banded]\n"
+                        "       %s --benchmark\n"
+                        "       %s --test [--corpus <directory>]\n", argv[0], argv[0], argv[0], argv[0], argv[0]);
+        return 2;
+    }
+
+    // fixed status values, so renders of the same fixture are identical
+    wifi_signal = -60;
+    battery_voltage = 4.0;
+    battery_percentage = 80;
+    dateStamp = "Sat 01-Jun-24";
+    timeStamp = "12:00:00";
+    CurrentDay = 1;
+    HAConfigurations haConfigs = {"UTC", "native", "RUNNING"};
+
+#ifdef ASSET_PACK
+    if (assetsPath == NULL || !MapAssetPack(assetsPath))
+    {
+        fprintf(stderr, "This build needs an asset pack: --assets <assets.bin>\n");
+        return 2;
+    }
+#else
+    if (assetsPath != NULL)
+        fprintf(stderr, "--assets is ignored, the fonts and icons are compiled in (see pio run -e native_assets)\n");
+#endif
+    framebuffer = (uint8_t*)ps_calloc(sizeof(uint8_t), EPD_WIDTH * EPD_HEIGHT / 2);
+    catalogueBanded = banded;
+    if (catalogueDirectory != NULL)
+        return WriteCatalogue(catalogueDirectory) ? 0 : 1;
+    if (checkDirectory != NULL)
+        return CheckCatalogue(checkDirectory, tolerance) ? 0 : 1;
+    if (benchmark)
+    {
+        RunBenchmarks();
+        return 0;
+    }
+    if (test)
+        return RunTests() ? 0 : 1;
+
+    FixtureDataSource fixture(statesPath);
+    haDataSource = &fixture;
+    resetEntityCache();
+    if (!fixture.prefetch(NULL))
+        return 1;
+
+    RenderDashboard(haConfigs, banded);
+    printEntityCacheStats();
+    printTileStats();
+    printGlyphCacheStats();
+    uint32_t digest = computeDisplayDigest(haConfigs, battery_percentage / 5, RSSIBars(wifi_signal));
+    printf("Display digest: %08x, %d damaged areas\n", digest, damageCount);
+    PrintCodecStats();
+
+    if (repeat > 0)
+    {
+        // both ways, the frames have to be identical
+        const size_t frameSize = EPD_WIDTH * EPD_HEIGHT / 2;
+        uint8_t* frame = (uint8_t*)malloc(frameSize);
+        memcpy(frame, framebuffer, frameSize);
+        double immediateUs = TimeDashboard(haConfigs, false, repeat);
+        bool identical = memcmp(frame, framebuffer, frameSize) == 0;
+        double bandedUs = TimeDashboard(haConfigs, true, repeat);
+        identical &= memcmp(frame, framebuffer, frameSize) == 0;
+        free(frame);
+        printf("Rendered %d frames, %.1fus per frame straight into the framebuffer, %.1fus per frame in bands of %d rows%s\n",
+               repeat, immediateUs, bandedUs, band_height, identical ? "" : ", THE FRAMES DIFFER");
+    }
+
+    if (wear)
+    {
+        SimulateFrameStore(haConfigs, "new values", 0);
+        SimulateFrameStore(haConfigs, "new values and switches", 1);
+        SimulateFrameStore(haConfigs, "moved frames", 2);
+        // the fixture frame again for the image
+        resetEntityCache();
+        timeStamp = "12:00:00";
+        if (!fixture.prefetch(NULL))
+            return 1;
+        RenderDashboard(haConfigs, banded);
+    }
+
+    if (!WritePGM(outputPath, epd_full_screen()))
+    {
+        fprintf(stderr, "Cannot write %s\n", outputPath);
+        return 1;
+    }
+    printf("Wrote %s\n", outputPath);
+    return 0;
+}
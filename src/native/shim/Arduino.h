@@ -0,0 +1,243 @@
+// Host shim of the parts of the Arduino core that the dashboard code uses: String, Print/Stream, Serial and timing.
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <climits>
+#include <cmath>
+#include <cctype>
+#include <cstdarg>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <type_traits>
+
+using std::min;
+using std::max;
+
+typedef uint8_t byte;
+
+#define HEX 16
+#define DEC 10
+#define F(string_literal) (string_literal)
+#define constrain(amt, low, high) ((amt) < (low) ? (low) : ((amt) > (high) ? (high) : (amt)))
+
+inline unsigned long millis()
+{
+    static const auto start = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+inline unsigned long micros()
+{
+    static const auto start = std::chrono::steady_clock::now();
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count();
+}
+
+inline void delay(unsigned long ms)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(ms));
+}
+
+class String
+{
+public:
+    String(const char* text = "") : text(text != NULL ? text : "") {}
+    String(const std::string& text) : text(text) {}
+    explicit String(char c) : text(1, c) {}
+    String(unsigned char value, unsigned char base = 10) : text(number(value, base)) {}
+    String(int value, unsigned char base = 10) : text(number(value, base)) {}
+    String(unsigned int value, unsigned char base = 10) : text(number(value, base)) {}
+    String(long value, unsigned char base = 10) : text(number(value, base)) {}
+    String(unsigned long value, unsigned char base = 10) : text(number(value, base)) {}
+    String(float value, unsigned char decimals = 2) : text(number(value, decimals)) {}
+    String(double value, unsigned char decimals = 2) : text(number(value, decimals)) {}
+
+    const char* c_str() const { return text.c_str(); }
+    unsigned int length() const { return text.length(); }
+    bool reserve(unsigned int size) { text.reserve(size); return true; }
+    char operator[](unsigned int index) const { return index < text.length() ? text[index] : 0; }
+    char& operator[](unsigned int index) { return text[index]; }
+    char charAt(unsigned int index) const { return (*this)[index]; }
+
+    String& operator+=(const String& other) { text += other.text; return *this; }
+    String& operator+=(const char* other) { text += other; return *this; }
+    String& operator+=(char c) { text += c; return *this; }
+    template <typename T, typename = typename std::enable_if<std::is_arithmetic<T>::value>::type>
+    String& operator+=(T value) { return *this += String(value); }
+    bool concat(const String& other) { text += other.text; return true; }
+
+    bool operator==(const String& other) const { return text == other.text; }
+    bool operator==(const char* other) const { return text == (other != NULL ? other : ""); }
+    bool operator!=(const String& other) const { return !(*this == other); }
+    bool operator!=(const char* other) const { return !(*this == other); }
+    bool operator<(const String& other) const { return text < other.text; }
+    bool equals(const String& other) const { return *this == other; }
+
+    long toInt() const { return atol(text.c_str()); }
+    float toFloat() const { return atof(text.c_str()); }
+
+    int indexOf(char c, unsigned int from = 0) const { return find(text.find(c, from)); }
+    int indexOf(const String& s, unsigned int from = 0) const { return find(text.find(s.text, from)); }
+    int lastIndexOf(char c) const { return find(text.rfind(c)); }
+    String substring(unsigned int from) const { return from < text.length() ? String(text.substr(from)) : String(); }
+    String substring(unsigned int from, unsigned int to) const
+    {
+        if (from > to)
+            std::swap(from, to);
+        return from < text.length() ? String(text.substr(from, to - from)) : String();
+    }
+    bool startsWith(const String& prefix) const { return text.compare(0, prefix.text.length(), prefix.text) == 0; }
+    bool endsWith(const String& suffix) const
+    {
+        return text.length() >= suffix.text.length() && text.compare(text.length() - suffix.text.length(), suffix.text.length(), suffix.text) == 0;
+    }
+    void trim()
+    {
+        size_t first = text.find_first_not_of(" \t\r\n");
+        size_t last = text.find_last_not_of(" \t\r\n");
+        text = first == std::string::npos ? "" : text.substr(first, last - first + 1);
+    }
+    void toLowerCase() { std::transform(text.begin(), text.end(), text.begin(), ::tolower); }
+    void toUpperCase() { std::transform(text.begin(), text.end(), text.begin(), ::toupper); }
+
+private:
+    static int find(size_t position) { return position == std::string::npos ? -1 : (int)position; }
+
+    // integers only, floats take the overload below with its decimals
+    template <typename T, typename = typename std::enable_if<std::is_integral<T>::value>::type>
+    static std::string number(T value, unsigned char base)
+    {
+        char buffer[72];
+        if (base == 16)
+            snprintf(buffer, sizeof(buffer), "%llx", (unsigned long long)value);
+        else if (std::is_signed<T>::value)
+            snprintf(buffer, sizeof(buffer), "%lld", (long long)value);
+        else
+            snprintf(buffer, sizeof(buffer), "%llu", (unsigned long long)value);
+        return buffer;
+    }
+
+    static std::string number(double value, unsigned char decimals)
+    {
+        char buffer[72];
+        snprintf(buffer, sizeof(buffer), "%.*f", decimals, value);
+        return buffer;
+    }
+
+    std::string text;
+};
+
+inline String operator+(const String& a, const String& b) { String result(a); result += b; return result; }
+inline String operator+(const String& a, const char* b) { String result(a); result += b; return result; }
+inline String operator+(const char* a, const String& b) { String result(a); result += b; return result; }
+inline String operator+(const String& a, char b) { String result(a); result += b; return result; }
+template <typename T, typename = typename std::enable_if<std::is_arithmetic<T>::value && !std::is_same<T, char>::value>::type>
+inline String operator+(const String& a, T b) { String result(a); result += String(b); return result; }
+inline bool operator==(const char* a, const String& b) { return b == a; }
+inline bool operator!=(const char* a, const String& b) { return b != a; }
+
+class Print
+{
+public:
+    virtual ~Print() {}
+    virtual size_t write(uint8_t c) = 0;
+    virtual size_t write(const uint8_t* buffer, size_t size)
+    {
+        size_t count = 0;
+        while (count < size && write(buffer[count]) == 1)
+            count++;
+        return count;
+    }
+    size_t print(const String& text) { return write((const uint8_t*)text.c_str(), text.length()); }
+    size_t print(const char* text) { return write((const uint8_t*)text, strlen(text)); }
+};
+
+// Like the Arduino Stream, readBytes() and readStringUntil() wait up to the timeout (1s by default) for every byte,
+// streams that end (files, memory) set it to 0
+class Stream : public Print
+{
+public:
+    virtual int available() = 0;
+    virtual int read() = 0;
+    virtual int peek() = 0;
+
+    void setTimeout(unsigned long timeout) { this->timeout = timeout; }
+    unsigned long getTimeout() const { return timeout; }
+
+    size_t readBytes(char* buffer, size_t length)
+    {
+        size_t count = 0;
+        while (count < length)
+        {
+            int c = timedRead();
+            if (c < 0)
+                break;
+            buffer[count++] = c;
+        }
+        return count;
+    }
+
+    String readStringUntil(char terminator)
+    {
+        std::string text;
+        int c = timedRead();
+        while (c >= 0 && c != terminator)
+        {
+            text += (char)c;
+            c = timedRead();
+        }
+        return text;
+    }
+
+protected:
+    int timedRead()
+    {
+        unsigned long start = millis();
+        do
+        {
+            int c = read();
+            if (c >= 0)
+                return c;
+            if (timeout > 0)
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+        } while (millis() - start < timeout);
+        return -1;
+    }
+
+    unsigned long timeout = 1000;
+};
+
+// Serial goes to stdout, unless it is muted (e.g. while profiling)
+class HardwareSerial
+{
+public:
+    void begin(unsigned long) {}
+    operator bool() const { return true; }
+
+    void print(const String& text) { if (!muted) fputs(text.c_str(), stdout); }
+    void print(const char* text) { if (!muted) fputs(text, stdout); }
+    template <typename T>
+    void print(T value) { print(String(value)); }
+    void println() { print("\n"); }
+    template <typename T>
+    void println(const T& value) { print(value); println(); }
+    void printf(const char* format, ...)
+    {
+        if (muted)
+            return;
+        va_list arguments;
+        va_start(arguments, format);
+        vprintf(format, arguments);
+        va_end(arguments);
+    }
+
+    bool muted = false;
+};
+
+inline HardwareSerial Serial;
+
+#include "Esp.h"
@@ -0,0 +1,51 @@
+// Host shim of the ESP object. The heap figures count what is allocated with new (String, std::string) against a
+// heap of HOST_HEAP_SIZE bytes, so the host program can report the peak heap use of a code path. The replacement
+// operators are defined here, the host program is a single translation unit.
+#pragma once
+
+#include <malloc.h>
+#include <new>
+
+#define HOST_HEAP_SIZE (320 * 1024)
+
+inline size_t hostHeapUsed = 0;
+inline size_t hostHeapPeak = 0;
+
+// starts a new peak, e.g. before the code path that is measured
+inline void resetHostHeapPeak()
+{
+    hostHeapPeak = hostHeapUsed;
+}
+
+void* operator new(size_t size)
+{
+    void* pointer = malloc(size > 0 ? size : 1);
+    if (pointer == NULL)
+        throw std::bad_alloc();
+    hostHeapUsed += malloc_usable_size(pointer);
+    hostHeapPeak = std::max(hostHeapPeak, hostHeapUsed);
+    return pointer;
+}
+
+void operator delete(void* pointer) noexcept
+{
+    if (pointer == NULL)
+        return;
+    hostHeapUsed -= malloc_usable_size(pointer);
+    free(pointer);
+}
+
+void operator delete(void* pointer, size_t) noexcept
+{
+    operator delete(pointer);
+}
+
+class EspClass
+{
+public:
+    uint32_t getFreeHeap() { return HOST_HEAP_SIZE - std::min(hostHeapUsed, (size_t)HOST_HEAP_SIZE); }
+    uint32_t getMinFreeHeap() { return HOST_HEAP_SIZE - std::min(hostHeapPeak, (size_t)HOST_HEAP_SIZE); }
+    uint64_t getEfuseMac() { return 0x0000a1b2c3d4e5f6ULL; }
+};
+
+inline EspClass ESP;
@@ -0,0 +1,154 @@
+// Host shim of the HTTPClient parts HAClient uses: a request on a given WiFiClient whose response body is left in
+// the client for the caller to read. Like the ESP32 client, end() keeps the connection open if reuse is on and the
+// server did not close it, and discards whatever of the body is left in the receive buffer.
+#pragma once
+
+#include "WiFiClient.h"
+
+#define HTTP_CODE_OK 200
+
+#define HTTPC_ERROR_CONNECTION_REFUSED  (-1)
+#define HTTPC_ERROR_SEND_HEADER_FAILED  (-2)
+#define HTTPC_ERROR_SEND_PAYLOAD_FAILED (-3)
+#define HTTPC_ERROR_NOT_CONNECTED       (-4)
+#define HTTPC_ERROR_CONNECTION_LOST     (-5)
+#define HTTPC_ERROR_NO_STREAM           (-6)
+#define HTTPC_ERROR_NO_HTTP_SERVER      (-7)
+#define HTTPC_ERROR_TOO_LESS_RAM        (-8)
+#define HTTPC_ERROR_ENCODING            (-9)
+#define HTTPC_ERROR_STREAM_WRITE        (-10)
+#define HTTPC_ERROR_READ_TIMEOUT        (-11)
+
+#define HTTPCLIENT_DEFAULT_TCP_TIMEOUT 5000
+
+class HTTPClient
+{
+public:
+    void setReuse(bool reuse)
+    {
+        this->reuse = reuse;
+    }
+
+    bool begin(WiFiClient& client, const String& host, uint16_t port, const String& uri)
+    {
+        this->client = &client;
+        this->host = host;
+        this->port = port;
+        this->uri = uri;
+        headers = "";
+        return true;
+    }
+
+    void addHeader(const String& name, const String& value)
+    {
+        headers += name + ": " + value + "\r\n";
+    }
+
+    int GET()
+    {
+        return sendRequest("GET", NULL);
+    }
+
+    int POST(const String& payload)
+    {
+        return sendRequest("POST", &payload);
+    }
+
+    void end()
+    {
+        if (client == NULL)
+            return;
+        while (client->available() > 0)
+            client->read();
+        if (!reuse || !canReuse)
+            client->stop();
+        client = NULL;
+    }
+
+    static String errorToString(int error)
+    {
+        switch (error)
+        {
+            case HTTPC_ERROR_CONNECTION_REFUSED: return "connection refused";
+            case HTTPC_ERROR_SEND_HEADER_FAILED: return "send header failed";
+            case HTTPC_ERROR_SEND_PAYLOAD_FAILED: return "send payload failed";
+            case HTTPC_ERROR_NOT_CONNECTED: return "not connected";
+            case HTTPC_ERROR_CONNECTION_LOST: return "connection lost";
+            case HTTPC_ERROR_NO_STREAM: return "no stream";
+            case HTTPC_ERROR_NO_HTTP_SERVER: return "no HTTP server";
+            case HTTPC_ERROR_TOO_LESS_RAM: return "too less ram";
+            case HTTPC_ERROR_ENCODING: return "Transfer-Encoding not supported";
+            case HTTPC_ERROR_STREAM_WRITE: return "Stream write error";
+            case HTTPC_ERROR_READ_TIMEOUT: return "read Timeout";
+            default: return String();
+        }
+    }
+
+private:
+    int sendRequest(const char* method, const String* payload)
+    {
+        if (!client->connected() && !client->connect(host.c_str(), port))
+            return HTTPC_ERROR_CONNECTION_REFUSED;
+        String request = String(method) + " " + uri + " HTTP/1.1\r\nHost: " + host + "\r\n" + headers +
+                         "Connection: " + (reuse ? "keep-alive" : "close") + "\r\n";
+        if (payload != NULL)
+            request += "Content-Length: " + String(payload->length()) + "\r\n";
+        request += "\r\n";
+        if (client->print(request) != request.length())
+            return HTTPC_ERROR_SEND_HEADER_FAILED;
+        if (payload != NULL && client->print(*payload) != payload->length())
+            return HTTPC_ERROR_SEND_PAYLOAD_FAILED;
+        return readHeaders();
+    }
+
+    // the status line and headers, the body is left in the client
+    int readHeaders()
+    {
+        canReuse = reuse;
+        int code = 0;
+        unsigned long lastData = millis();
+        String line;
+        while (client->connected())
+        {
+            int c = client->read();
+            if (c < 0)
+            {
+                if (millis() - lastData > HTTPCLIENT_DEFAULT_TCP_TIMEOUT)
+                    return HTTPC_ERROR_READ_TIMEOUT;
+                std::this_thread::sleep_for(std::chrono::microseconds(50));
+                continue;
+            }
+            lastData = millis();
+            if (c != '\n')
+            {
+                if (c != '\r')
+                    line += (char)c;
+                continue;
+            }
+            if (code == 0)
+            {
+                if (!line.startsWith("HTTP/1."))
+                    return HTTPC_ERROR_NO_HTTP_SERVER;
+                code = line.substring(9, 12).toInt();
+            }
+            else if (line.length() == 0)
+                return code;
+            else
+            {
+                line.toLowerCase();
+                if (line.startsWith("connection:") && line.indexOf("close") >= 0)
+                    canReuse = false;
+            }
+            line = "";
+        }
+        return HTTPC_ERROR_CONNECTION_LOST;
+    }
+
+    WiFiClient* client = NULL;
+    String      host;
+    uint16_t    port = 80;
+    String      uri;
+    String      headers;
+    bool        reuse = true;
+    bool        canReuse = true;
+};
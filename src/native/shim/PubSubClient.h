@@ -0,0 +1,195 @@
+// Host shim of the PubSubClient parts the MQTT data source uses: MQTT 3.1.1 over a WiFiClient, QoS 0 only. Like the
+// library, connect() waits for the CONNACK, subscribe() only sends the request and loop() hands every PUBLISH that
+// arrived to the callback.
+#pragma once
+
+#include "WiFiClient.h"
+
+#define MQTT_CONNECTION_TIMEOUT -4
+#define MQTT_CONNECTION_LOST    -3
+#define MQTT_CONNECT_FAILED     -2
+#define MQTT_DISCONNECTED       -1
+#define MQTT_CONNECTED           0
+
+#define MQTT_SOCKET_TIMEOUT_MS 15000
+
+class PubSubClient
+{
+public:
+    typedef void (*Callback)(char* topic, uint8_t* payload, unsigned int length);
+
+    PubSubClient(WiFiClient& client) : client(client) {}
+
+    PubSubClient& setServer(const char* host, uint16_t port)
+    {
+        this->host = host;
+        this->port = port;
+        return *this;
+    }
+
+    PubSubClient& setCallback(Callback callback)
+    {
+        this->callback = callback;
+        return *this;
+    }
+
+    bool setBufferSize(uint16_t size)
+    {
+        bufferSize = size;
+        return true;
+    }
+
+    bool connect(const char* id)
+    {
+        return connect(id, NULL, NULL);
+    }
+
+    bool connect(const char* id, const char* user, const char* password)
+    {
+        if (!client.connect(host.c_str(), port))
+        {
+            status = MQTT_CONNECT_FAILED;
+            return false;
+        }
+        std::string body("\x00\x04MQTT\x04", 7);
+        body += (char)(0x02 | (user != NULL ? 0x80 : 0) | (password != NULL ? 0x40 : 0)); // clean session
+        body += std::string("\x00\x0F", 2); // keep alive 15s
+        body += field(id);
+        if (user != NULL)
+            body += field(user);
+        if (password != NULL)
+            body += field(password);
+        status = MQTT_CONNECTED;
+        if (!write(0x10, body))
+            return false;
+        uint8_t type;
+        std::string answer;
+        unsigned long start = millis();
+        while (!readPacket(type, answer))
+        {
+            if (!client.connected() || millis() - start > MQTT_SOCKET_TIMEOUT_MS)
+            {
+                client.stop();
+                status = MQTT_CONNECTION_TIMEOUT;
+                return false;
+            }
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+        }
+        if (type != 0x20 || answer.length() < 2 || answer[1] != 0)
+        {
+            client.stop();
+            status = type == 0x20 && answer.length() >= 2 ? answer[1] : MQTT_CONNECT_FAILED;
+            return false;
+        }
+        return true;
+    }
+
+    bool subscribe(const char* topic)
+    {
+        if (!connected())
+            return false;
+        packetID++;
+        std::string body;
+        body += (char)(packetID >> 8);
+        body += (char)(packetID & 0xFF);
+        body += field(topic);
+        body += '\0'; // QoS 0
+        return write(0x82, body);
+    }
+
+    bool loop()
+    {
+        if (!connected())
+            return false;
+        uint8_t type;
+        std::string body;
+        if (!readPacket(type, body))
+        {
+            std::this_thread::sleep_for(std::chrono::microseconds(50));
+            return connected();
+        }
+        if ((type & 0xF0) == 0x30 && body.length() >= 2 && callback != NULL)
+        {
+            size_t length = (uint8_t)body[0] << 8 | (uint8_t)body[1];
+            std::string topic = body.substr(2, length);
+            std::string payload = body.substr(2 + length);
+            callback((char*)topic.c_str(), (uint8_t*)payload.data(), payload.length());
+        }
+        return true;
+    }
+
+    void disconnect()
+    {
+        if (client.connected())
+            write(0xE0, "");
+        client.stop();
+        status = MQTT_DISCONNECTED;
+    }
+
+    bool connected()
+    {
+        if (status == MQTT_CONNECTED && !client.connected())
+            status = MQTT_CONNECTION_LOST;
+        return status == MQTT_CONNECTED;
+    }
+
+    int state()
+    {
+        return status;
+    }
+
+private:
+    static std::string field(const char* value)
+    {
+        size_t length = strlen(value);
+        return std::string(1, (char)(length >> 8)) + (char)(length & 0xFF) + value;
+    }
+
+    bool write(uint8_t type, const std::string& body)
+    {
+        std::string packet(1, (char)type);
+        size_t length = body.length();
+        do
+        {
+            uint8_t digit = length % 128;
+            length /= 128;
+            packet += (char)(digit | (length > 0 ? 0x80 : 0));
+        } while (length > 0);
+        packet += body;
+        return client.write((const uint8_t*)packet.data(), packet.length()) == packet.length();
+    }
+
+    // takes the next complete packet off the received bytes, packets larger than the buffer are dropped
+    bool readPacket(uint8_t& type, std::string& body)
+    {
+        int c;
+        while ((c = client.read()) >= 0)
+            received += (char)c;
+        size_t length = 0;
+        size_t header = 1;
+        for (int shift = 0; ; shift += 7, header++)
+        {
+            if (header >= received.length())
+                return false;
+            length |= (size_t)((uint8_t)received[header] & 0x7F) << shift;
+            if (((uint8_t)received[header] & 0x80) == 0)
+                break;
+        }
+        header++;
+        if (received.length() < header + length)
+            return false;
+        type = (uint8_t)received[0];
+        body = received.substr(header, length);
+        received.erase(0, header + length);
+        return header + length <= bufferSize || readPacket(type, body);
+    }
+
+    WiFiClient& client;
+    String      host;
+    uint16_t    port = 1883;
+    Callback    callback = NULL;
+    uint16_t    bufferSize = 256;
+    uint16_t    packetID = 0;
+    int         status = MQTT_DISCONNECTED;
+    std::string received;
+};
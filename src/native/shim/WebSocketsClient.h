@@ -0,0 +1,71 @@
+// Host shim of the WebSocketsClient parts the push mode uses. There is no connection: the host checks play the server,
+// they hand its messages to the client with receive() and read what the client sent from sent.
+#pragma once
+
+#include <Arduino.h>
+#include <vector>
+
+typedef enum {
+    WStype_ERROR,
+    WStype_DISCONNECTED,
+    WStype_CONNECTED,
+    WStype_TEXT,
+    WStype_BIN,
+} WStype_t;
+
+class WebSocketsClient
+{
+public:
+    typedef void (*WebSocketClientEvent)(WStype_t type, uint8_t* payload, size_t length);
+
+    void begin(const String& host, uint16_t port, const String& url = "/")
+    {
+        this->host = host;
+        this->port = port;
+        this->url = url;
+        secure = false;
+    }
+
+    void beginSSL(const String& host, uint16_t port, const String& url = "/")
+    {
+        begin(host, port, url);
+        secure = true;
+    }
+
+    void beginSslWithCA(const char* host, uint16_t port, const char* url, const char* rootCA)
+    {
+        beginSSL(host, port, url);
+    }
+
+    void onEvent(WebSocketClientEvent callback)
+    {
+        this->callback = callback;
+    }
+
+    void setReconnectInterval(unsigned long interval) {}
+
+    void loop() {}
+
+    bool sendTXT(const String& payload)
+    {
+        sent.push_back(payload);
+        return true;
+    }
+
+    // a message of the server, the payload is handed over writable like the library does
+    void receive(const std::string& message)
+    {
+        std::vector<uint8_t> payload(message.begin(), message.end());
+        payload.push_back('\0');
+        callback(WStype_TEXT, payload.data(), message.length());
+    }
+
+    std::vector<String> sent;
+    String              host;
+    uint16_t            port = 0;
+    String              url;
+    bool                secure = false;
+
+private:
+    WebSocketClientEvent callback = NULL;
+};
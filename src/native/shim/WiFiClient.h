@@ -0,0 +1,151 @@
+// Host shim: WiFiClient over a TCP socket. Like the ESP32 client, read() and available() do not block and
+// connected() stays true while received data is left to read. While stand-ins (native/standin.h) run, every client
+// connects to them on localhost, whatever host it is given: to the one registered for its port in
+// wifiClientStandInPorts, otherwise to wifiClientStandInPort.
+#pragma once
+
+#include <Arduino.h>
+#include <arpa/inet.h>
+#include <errno.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+#include <map>
+
+inline uint16_t wifiClientStandInPort = 0;
+inline std::map<uint16_t, uint16_t> wifiClientStandInPorts; // port asked for, port of the stand-in
+inline int      wifiClientShortWrites = 0; // test hook: the next writes send only half of their bytes
+
+class WiFiClient : public Stream
+{
+public:
+    WiFiClient() {}
+    WiFiClient(const WiFiClient&) = delete;
+    WiFiClient& operator=(const WiFiClient&) = delete;
+
+    virtual ~WiFiClient()
+    {
+        stop();
+    }
+
+    virtual int connect(const char* host, uint16_t port)
+    {
+        stop();
+        addrinfo hints = {};
+        hints.ai_family = AF_INET;
+        hints.ai_socktype = SOCK_STREAM;
+        addrinfo* addresses = NULL;
+        uint16_t standIn = wifiClientStandInPorts.count(port) > 0 ? wifiClientStandInPorts[port] : wifiClientStandInPort;
+        String service = String((unsigned int)(standIn != 0 ? standIn : port));
+        if (getaddrinfo(standIn != 0 ? "127.0.0.1" : host, service.c_str(), &hints, &addresses) != 0)
+            return 0;
+        socketFd = socket(AF_INET, SOCK_STREAM, 0);
+        if (socketFd >= 0 && ::connect(socketFd, addresses->ai_addr, addresses->ai_addrlen) != 0)
+            stop();
+        freeaddrinfo(addresses);
+        if (socketFd < 0)
+            return 0;
+        int one = 1;
+        setsockopt(socketFd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+        return 1;
+    }
+
+    virtual uint8_t connected()
+    {
+        if (socketFd < 0)
+            return 0;
+        if (fill() > 0)
+            return 1;
+        if (closed)
+            stop();
+        return socketFd >= 0;
+    }
+
+    virtual void stop()
+    {
+        if (socketFd >= 0)
+            close(socketFd);
+        socketFd = -1;
+        closed = false;
+        received.clear();
+        position = 0;
+    }
+
+    int available() override
+    {
+        return fill();
+    }
+
+    int read() override
+    {
+        if (fill() == 0)
+            return -1;
+        return (uint8_t)received[position++];
+    }
+
+    int peek() override
+    {
+        if (fill() == 0)
+            return -1;
+        return (uint8_t)received[position];
+    }
+
+    size_t write(uint8_t c) override
+    {
+        return write(&c, 1);
+    }
+
+    size_t write(const uint8_t* buffer, size_t size) override
+    {
+        if (socketFd < 0)
+            return 0;
+        if (wifiClientShortWrites > 0 && size > 1)
+        {
+            wifiClientShortWrites--;
+            size /= 2;
+        }
+        size_t sent = 0;
+        while (sent < size)
+        {
+            ssize_t count = send(socketFd, buffer + sent, size - sent, MSG_NOSIGNAL);
+            if (count <= 0)
+                break;
+            sent += count;
+        }
+        return sent;
+    }
+
+    void flush() {}
+
+    operator bool()
+    {
+        return connected();
+    }
+
+private:
+    // bytes received and not read yet, once they are read takes whatever arrived since without waiting
+    int fill()
+    {
+        if (position < received.size())
+            return received.size() - position;
+        received.clear();
+        position = 0;
+        if (socketFd >= 0 && !closed)
+        {
+            char buffer[4096];
+            ssize_t count = recv(socketFd, buffer, sizeof(buffer), MSG_DONTWAIT);
+            if (count > 0)
+                received.assign(buffer, count);
+            else if (count == 0 || (errno != EAGAIN && errno != EWOULDBLOCK))
+                closed = true;
+        }
+        return received.size();
+    }
+
+    int         socketFd = -1;
+    bool        closed = false; // the server closed the connection, what it sent is still in received
+    std::string received;
+    size_t      position = 0;
+};
@@ -0,0 +1,12 @@
+// Host shim: WiFiClientSecure without TLS, the stand-in server (native/standin.h) speaks plain HTTP. The certificate
+// settings are taken and ignored.
+#pragma once
+
+#include "WiFiClient.h"
+
+class WiFiClientSecure : public WiFiClient
+{
+public:
+    void setCACert(const char* rootCA) {}
+    void setInsecure() {}
+};
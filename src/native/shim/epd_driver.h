@@ -0,0 +1,306 @@
+// Host shim of the LilyGo epd_driver: the framebuffer primitives and the font renderer behave like the library
+// (4bpp, even x in the low nibble, compressed glyphs inflated on every draw), the panel functions only count what
+// would be pushed.
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "rom/miniz.h"
+
+#define EPD_WIDTH  960
+#define EPD_HEIGHT 540
+
+typedef struct {
+  int x;
+  int y;
+  int width;
+  int height;
+} Rect_t;
+
+typedef struct {
+  uint8_t  width;
+  uint8_t  height;
+  uint8_t  advance_x;
+  int16_t  left;
+  int16_t  top;
+  uint16_t compressed_size;
+  uint32_t data_offset;
+} GFXglyph;
+
+typedef struct {
+  uint32_t first;
+  uint32_t last;
+  uint32_t offset;
+} UnicodeInterval;
+
+typedef struct {
+  uint8_t         *bitmap;
+  GFXglyph        *glyph;
+  UnicodeInterval *intervals;
+  uint32_t         interval_count;
+  bool             compressed;
+  uint8_t          advance_y;
+  int              ascender;
+  int              descender;
+} GFXfont;
+
+struct EpdPanelStats {
+  int  clears;
+  int  updates;
+  long pixels; // pixels pushed to the panel
+};
+
+inline EpdPanelStats epdPanelStats;
+
+inline Rect_t epd_full_screen() { return {0, 0, EPD_WIDTH, EPD_HEIGHT}; }
+
+inline void epd_init() {}
+inline void epd_poweron() {}
+inline void epd_poweroff() {}
+inline void epd_poweroff_all() {}
+inline void epd_clear() { epdPanelStats.clears++; }
+inline void epd_clear_area(Rect_t area) { epdPanelStats.clears++; }
+inline void epd_clear_area_cycles(Rect_t area, int cycles, int cycle_time) { epdPanelStats.clears++; }
+
+inline void epd_draw_grayscale_image(Rect_t area, uint8_t *data) {
+  epdPanelStats.updates++;
+  epdPanelStats.pixels += (long)area.width * area.height;
+}
+
+inline void epd_draw_pixel(int x, int y, uint8_t color, uint8_t *framebuffer) {
+  if (x < 0 || x >= EPD_WIDTH || y < 0 || y >= EPD_HEIGHT)
+    return;
+  uint8_t *buf_ptr = &framebuffer[y * EPD_WIDTH / 2 + x / 2];
+  if (x % 2)
+    *buf_ptr = (*buf_ptr & 0x0F) | (color & 0xF0);
+  else
+    *buf_ptr = (*buf_ptr & 0xF0) | (color >> 4);
+}
+
+inline void epd_draw_hline(int x, int y, int length, uint8_t color, uint8_t *framebuffer) {
+  for (int i = 0; i < length; i++)
+    epd_draw_pixel(x + i, y, color, framebuffer);
+}
+
+inline void epd_draw_vline(int x, int y, int length, uint8_t color, uint8_t *framebuffer) {
+  for (int i = 0; i < length; i++)
+    epd_draw_pixel(x, y + i, color, framebuffer);
+}
+
+inline void epd_draw_circle(int x0, int y0, int r, uint8_t color, uint8_t *framebuffer) {
+  int f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r;
+  epd_draw_pixel(x0, y0 + r, color, framebuffer);
+  epd_draw_pixel(x0, y0 - r, color, framebuffer);
+  epd_draw_pixel(x0 + r, y0, color, framebuffer);
+  epd_draw_pixel(x0 - r, y0, color, framebuffer);
+  while (x < y) {
+    if (f >= 0) {
+      y--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+    epd_draw_pixel(x0 + x, y0 + y, color, framebuffer);
+    epd_draw_pixel(x0 - x, y0 + y, color, framebuffer);
+    epd_draw_pixel(x0 + x, y0 - y, color, framebuffer);
+    epd_draw_pixel(x0 - x, y0 - y, color, framebuffer);
+    epd_draw_pixel(x0 + y, y0 + x, color, framebuffer);
+    epd_draw_pixel(x0 - y, y0 + x, color, framebuffer);
+    epd_draw_pixel(x0 + y, y0 - x, color, framebuffer);
+    epd_draw_pixel(x0 - y, y0 - x, color, framebuffer);
+  }
+}
+
+inline void epd_fill_circle(int x0, int y0, int r, uint8_t color, uint8_t *framebuffer) {
+  epd_draw_vline(x0, y0 - r, 2 * r + 1, color, framebuffer);
+  int f = 1 - r, ddF_x = 1, ddF_y = -2 * r, x = 0, y = r, px = x, py = y;
+  while (x < y) {
+    if (f >= 0) {
+      y--;
+      ddF_y += 2;
+      f += ddF_y;
+    }
+    x++;
+    ddF_x += 2;
+    f += ddF_x;
+    if (x < y + 1) {
+      epd_draw_vline(x0 + x, y0 - y, 2 * y + 1, color, framebuffer);
+      epd_draw_vline(x0 - x, y0 - y, 2 * y + 1, color, framebuffer);
+    }
+    if (y != py) {
+      epd_draw_vline(x0 + py, y0 - px, 2 * px + 1, color, framebuffer);
+      epd_draw_vline(x0 - py, y0 - px, 2 * px + 1, color, framebuffer);
+      py = y;
+    }
+    px = x;
+  }
+}
+
+inline void epd_draw_rect(int x, int y, int w, int h, uint8_t color, uint8_t *framebuffer) {
+  epd_draw_hline(x, y, w, color, framebuffer);
+  epd_draw_hline(x, y + h - 1, w, color, framebuffer);
+  epd_draw_vline(x, y, h, color, framebuffer);
+  epd_draw_vline(x + w - 1, y, h, color, framebuffer);
+}
+
+inline void epd_fill_rect(int x, int y, int w, int h, uint8_t color, uint8_t *framebuffer) {
+  for (int i = y; i < y + h; i++)
+    epd_draw_hline(x, i, w, color, framebuffer);
+}
+
+inline void epd_write_line(int x0, int y0, int x1, int y1, uint8_t color, uint8_t *framebuffer) {
+  int dx = x1 > x0 ? x1 - x0 : x0 - x1, sx = x0 < x1 ? 1 : -1;
+  int dy = y1 > y0 ? y0 - y1 : y1 - y0, sy = y0 < y1 ? 1 : -1;
+  int err = dx + dy;
+  while (true) {
+    epd_draw_pixel(x0, y0, color, framebuffer);
+    if (x0 == x1 && y0 == y1)
+      break;
+    int e2 = 2 * err;
+    if (e2 >= dy) {
+      err += dy;
+      x0 += sx;
+    }
+    if (e2 <= dx) {
+      err += dx;
+      y0 += sy;
+    }
+  }
+}
+
+inline void epd_fill_triangle(int x0, int y0, int x1, int y1, int x2, int y2, uint8_t color, uint8_t *framebuffer) {
+  // sort the corners by y, then fill every scanline between the long edge and the two short ones
+  int t;
+  if (y0 > y1) { t = y0; y0 = y1; y1 = t; t = x0; x0 = x1; x1 = t; }
+  if (y1 > y2) { t = y1; y1 = y2; y2 = t; t = x1; x1 = x2; x2 = t; }
+  if (y0 > y1) { t = y0; y0 = y1; y1 = t; t = x0; x0 = x1; x1 = t; }
+  if (y0 == y2) {
+    int a = x0 < x1 ? (x0 < x2 ? x0 : x2) : (x1 < x2 ? x1 : x2);
+    int b = x0 > x1 ? (x0 > x2 ? x0 : x2) : (x1 > x2 ? x1 : x2);
+    epd_draw_hline(a, y0, b - a + 1, color, framebuffer);
+    return;
+  }
+  for (int y = y0; y <= y2; y++) {
+    int a = x0 + (x2 - x0) * (y - y0) / (y2 - y0);
+    int b = y < y1 || y1 == y2 ? (y1 == y0 ? x1 : x0 + (x1 - x0) * (y - y0) / (y1 - y0))
+                               : x1 + (x2 - x1) * (y - y1) / (y2 - y1);
+    if (a > b) { t = a; a = b; b = t; }
+    epd_draw_hline(a, y, b - a + 1, color, framebuffer);
+  }
+}
+
+inline void epd_copy_to_framebuffer(Rect_t image_area, uint8_t *image_data, uint8_t *framebuffer) {
+  for (int i = 0; i < image_area.width * image_area.height; i++) {
+    int value_index = i;
+    // for images of uneven width, consume an additional nibble per row
+    if (image_area.width % 2)
+      value_index += i / image_area.width;
+    uint8_t val = (value_index % 2) ? (image_data[value_index / 2] & 0xF0) >> 4 : image_data[value_index / 2] & 0x0F;
+    epd_draw_pixel(image_area.x + i % image_area.width, image_area.y + i / image_area.width, val << 4, framebuffer);
+  }
+}
+
+// next UTF-8 code point of *string, advances the pointer
+inline uint32_t next_cp(const uint8_t **string) {
+  uint32_t cp = *(*string)++;
+  int follow = cp >= 0xF0 ? 3 : cp >= 0xE0 ? 2 : cp >= 0xC0 ? 1 : 0;
+  if (follow)
+    cp &= 0x3F >> follow;
+  while (follow-- && (**string & 0xC0) == 0x80)
+    cp = (cp << 6) | (*(*string)++ & 0x3F);
+  return cp;
+}
+
+inline void get_glyph(const GFXfont *font, uint32_t code_point, GFXglyph **glyph) {
+  for (uint32_t i = 0; i < font->interval_count; i++) {
+    const UnicodeInterval *interval = &font->intervals[i];
+    if (code_point >= interval->first && code_point <= interval->last) {
+      *glyph = &font->glyph[interval->offset + (code_point - interval->first)];
+      return;
+    }
+    if (code_point < interval->first) {
+      *glyph = NULL;
+      return;
+    }
+  }
+  *glyph = NULL;
+}
+
+inline void draw_char(const GFXfont *font, uint8_t *framebuffer, int *cursor_x, int cursor_y, uint32_t cp) {
+  GFXglyph *glyph;
+  get_glyph(font, cp, &glyph);
+  if (!glyph)
+    get_glyph(font, '?', &glyph);
+  if (!glyph)
+    return;
+  const uint8_t *bitmap = &font->bitmap[glyph->data_offset];
+  int byte_width = glyph->width / 2 + glyph->width % 2;
+  uint8_t *inflated = NULL;
+  if (font->compressed) {
+    // like the library: a decompressor and a bitmap per glyph
+    size_t in = glyph->compressed_size, out = byte_width * glyph->height;
+    tinfl_decompressor *decomp = (tinfl_decompressor *)malloc(sizeof(tinfl_decompressor));
+    inflated = (uint8_t *)malloc(out);
+    tinfl_init(decomp);
+    tinfl_decompress(decomp, bitmap, &in, inflated, inflated, &out, TINFL_FLAG_PARSE_ZLIB_HEADER | TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF);
+    free(decomp);
+    bitmap = inflated;
+  }
+  for (int y = 0; y < glyph->height; y++) {
+    int yy = cursor_y - glyph->top + y;
+    for (int x = 0; x < glyph->width; x++) {
+      uint8_t bm = bitmap[y * byte_width + x / 2];
+      bm = (x % 2) ? bm >> 4 : bm & 0x0F;
+      if (bm)
+        epd_draw_pixel(*cursor_x + glyph->left + x, yy, (15 - bm) << 4, framebuffer);
+    }
+  }
+  free(inflated);
+  *cursor_x += glyph->advance_x;
+}
+
+inline void get_text_bounds(const GFXfont *font, const char *string, int *x, int *y, int *x1, int *y1, int *w, int *h,
+                            const void *props) {
+  int minx = 100000, miny = 100000, maxx = -1, maxy = -1;
+  int original_x = *x;
+  const uint8_t *s = (const uint8_t *)string;
+  while (*s) {
+    uint32_t cp = next_cp(&s);
+    GFXglyph *glyph;
+    get_glyph(font, cp, &glyph);
+    if (!glyph)
+      get_glyph(font, '?', &glyph);
+    if (!glyph)
+      continue;
+    int gx1 = *x + glyph->left, gy1 = *y + (glyph->top - glyph->height);
+    int gx2 = gx1 + glyph->width, gy2 = gy1 + glyph->height;
+    if (gx1 < minx) minx = gx1;
+    if (gy1 < miny) miny = gy1;
+    if (gx2 > maxx) maxx = gx2;
+    if (gy2 > maxy) maxy = gy2;
+    *x += glyph->advance_x;
+  }
+  *x1 = original_x < minx ? original_x : minx;
+  *w = maxx - *x1;
+  *y1 = miny;
+  *h = maxy - miny;
+}
+
+inline void write_string(const GFXfont *font, const char *string, int *cursor_x, int *cursor_y, uint8_t *framebuffer) {
+  int line_start = *cursor_x;
+  const uint8_t *s = (const uint8_t *)string;
+  while (*s) {
+    if (*s == '\n') {
+      s++;
+      *cursor_x = line_start;
+      *cursor_y += font->advance_y;
+      continue;
+    }
+    draw_char(font, framebuffer, cursor_x, *cursor_y, next_cp(&s));
+  }
+}
@@ -0,0 +1,13 @@
+// Host shim: PSRAM and internal allocations come from the normal heap.
+#pragma once
+
+#include <stdint.h>
+#include <stdlib.h>
+
+inline void* ps_malloc(size_t size) { return malloc(size); }
+inline void* ps_calloc(size_t count, size_t size) { return calloc(count, size); }
+
+#define MALLOC_CAP_8BIT     (1 << 2)
+#define MALLOC_CAP_INTERNAL (1 << 11)
+
+inline void* heap_caps_malloc(size_t size, uint32_t caps) { return malloc(size); }
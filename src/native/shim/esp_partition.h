@@ -0,0 +1,74 @@
+// Host shim of the partition API for the frame store: the "frames" partition of partitions.csv in memory, with the
+// semantics of NOR flash. Erasing sets whole sectors to 0xFF, writing can only clear bits. Erases and written bytes
+// are counted per sector, so the host program can report the flash wear of a sequence of stores.
+#pragma once
+
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+typedef int esp_err_t;
+#define ESP_OK              0
+#define ESP_ERR_INVALID_ARG 0x102
+
+#define SPI_FLASH_SEC_SIZE 4096
+
+typedef enum {ESP_PARTITION_TYPE_APP = 0, ESP_PARTITION_TYPE_DATA = 1} esp_partition_type_t;
+typedef int esp_partition_subtype_t;
+
+struct esp_partition_t{
+    esp_partition_type_t    type;
+    esp_partition_subtype_t subtype;
+    uint32_t                address;
+    uint32_t                size;
+    char                    label[17];
+    bool                    encrypted;
+};
+
+inline esp_partition_t      hostFramePartition = {ESP_PARTITION_TYPE_DATA, 0x40, 0xc90000, 0x80000, "frames", false};
+inline std::vector<uint8_t> hostFlash(hostFramePartition.size, 0xFF);
+inline std::vector<int>     hostFlashErases(hostFramePartition.size / SPI_FLASH_SEC_SIZE);
+inline size_t               hostFlashWritten = 0;
+
+// erased, without wear
+inline void resetHostFlash()
+{
+    std::fill(hostFlash.begin(), hostFlash.end(), 0xFF);
+    std::fill(hostFlashErases.begin(), hostFlashErases.end(), 0);
+    hostFlashWritten = 0;
+}
+
+inline const esp_partition_t* esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype, const char* label)
+{
+    if (type == hostFramePartition.type && subtype == hostFramePartition.subtype && strcmp(label, hostFramePartition.label) == 0)
+        return &hostFramePartition;
+    return NULL;
+}
+
+inline esp_err_t esp_partition_read(const esp_partition_t* partition, size_t offset, void* data, size_t size)
+{
+    if (offset + size > partition->size)
+        return ESP_ERR_INVALID_ARG;
+    memcpy(data, hostFlash.data() + offset, size);
+    return ESP_OK;
+}
+
+inline esp_err_t esp_partition_write(const esp_partition_t* partition, size_t offset, const void* data, size_t size)
+{
+    if (offset + size > partition->size)
+        return ESP_ERR_INVALID_ARG;
+    for (size_t i = 0; i < size; i++)
+        hostFlash[offset + i] &= ((const uint8_t*)data)[i];
+    hostFlashWritten += size;
+    return ESP_OK;
+}
+
+inline esp_err_t esp_partition_erase_range(const esp_partition_t* partition, size_t offset, size_t size)
+{
+    if (offset % SPI_FLASH_SEC_SIZE != 0 || size % SPI_FLASH_SEC_SIZE != 0 || offset + size > partition->size)
+        return ESP_ERR_INVALID_ARG;
+    memset(hostFlash.data() + offset, 0xFF, size);
+    for (size_t sector = offset / SPI_FLASH_SEC_SIZE; sector < (offset + size) / SPI_FLASH_SEC_SIZE; sector++)
+        hostFlashErases[sector]++;
+    return ESP_OK;
+}
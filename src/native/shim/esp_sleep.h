@@ -0,0 +1,4 @@
+// Host shim: there is no RTC memory, a process run is a single wake.
+#pragma once
+
+#define RTC_DATA_ATTR
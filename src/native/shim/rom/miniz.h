@@ -0,0 +1,31 @@
+// Host shim of the tinfl inflater in the ESP32 ROM, backed by zlib (-lz). Only inflates whole zlib streams into a
+// buffer that holds all of the output, like the compressed glyphs of a font.
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+#include <zlib.h>
+
+#define TINFL_FLAG_PARSE_ZLIB_HEADER             1
+#define TINFL_FLAG_USING_NON_WRAPPING_OUTPUT_BUF 4
+
+typedef enum {
+  TINFL_STATUS_FAILED = -1,
+  TINFL_STATUS_DONE = 0,
+} tinfl_status;
+
+typedef struct {
+  int state;
+} tinfl_decompressor;
+
+#define tinfl_init(r) ((r)->state = 0)
+
+inline tinfl_status tinfl_decompress(tinfl_decompressor *r, const uint8_t *in, size_t *in_size, uint8_t *out_start,
+                                     uint8_t *out_next, size_t *out_size, uint32_t flags)
+{
+  uLongf length = *out_size;
+  if (uncompress(out_next, &length, in, *in_size) != Z_OK)
+    return TINFL_STATUS_FAILED;
+  *out_size = length;
+  return TINFL_STATUS_DONE;
+}
@@ -0,0 +1,436 @@
+// Stand-in HA server for the host checks and benchmarks: a forked process that answers HTTP/1.1 requests on a
+// localhost port with keep-alive and pipelining, like HA behind its web server. The WiFiClient shim connects to it
+// instead of ha_server while it runs. The round trip time and the bandwidth of a WiFi link can be set, the
+// connections and requests it saw are counted in memory shared with the host program. StandInBroker does the same
+// for an MQTT broker with retained messages.
+
+#include <poll.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <vector>
+
+struct StandInRequest{
+    std::string method;
+    std::string path;
+    std::string body;
+};
+
+struct StandInResponse{
+    int         code;
+    std::string body;
+    bool        close;   // close the connection after the response
+    bool        chunked; // announce Transfer-Encoding: chunked (the body is sent as one chunk)
+};
+
+struct StandInStats{
+    int connections;
+    int requests;
+    int maxPipelined; // most requests that arrived before the first of them was answered
+};
+
+typedef void (*StandInHandler)(const StandInRequest& request, StandInResponse& response);
+
+class StandInServer
+{
+public:
+    // round trip time in ms added to every response, 0 for none; bandwidth in bytes per second, 0 for unlimited;
+    // the connection is closed after closeAfter responses, like an idle keep-alive timeout, 0 for never
+    StandInServer(StandInHandler handler, int rttMs = 0, long bytesPerSecond = 0, int closeAfter = 0)
+        : handler(handler), rttMs(rttMs), bytesPerSecond(bytesPerSecond), closeAfter(closeAfter) {}
+
+    ~StandInServer()
+    {
+        stop();
+    }
+
+    bool start()
+    {
+        stats = (StandInStats*)mmap(NULL, sizeof(StandInStats), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+        listener = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t length = sizeof(address);
+        if (stats == MAP_FAILED || listener < 0 || bind(listener, (sockaddr*)&address, length) != 0 || listen(listener, 4) != 0 ||
+            getsockname(listener, (sockaddr*)&address, &length) != 0)
+        {
+            fprintf(stderr, "Cannot start the stand-in server: %s\n", strerror(errno));
+            return false;
+        }
+        memset(stats, 0, sizeof(StandInStats));
+        fflush(stdout);
+        child = fork();
+        if (child == 0)
+        {
+            serve();
+            _exit(0);
+        }
+        close(listener);
+        listener = -1;
+        wifiClientStandInPort = ntohs(address.sin_port);
+        return child > 0;
+    }
+
+    void stop()
+    {
+        if (child > 0)
+        {
+            kill(child, SIGTERM);
+            waitpid(child, NULL, 0);
+            child = -1;
+        }
+        if (stats != NULL)
+            munmap(stats, sizeof(StandInStats));
+        stats = NULL;
+        if (listener >= 0)
+            close(listener);
+        listener = -1;
+        wifiClientStandInPort = 0;
+    }
+
+    // counters of the stand-in, reset with resetStats()
+    const StandInStats& getStats()
+    {
+        return *stats;
+    }
+
+    void resetStats()
+    {
+        memset(stats, 0, sizeof(StandInStats));
+    }
+
+private:
+    struct Pending{
+        unsigned long due;
+        std::string   response;
+        bool          close;
+    };
+
+    void serve()
+    {
+        while (true)
+        {
+            int connection = accept(listener, NULL, NULL);
+            if (connection < 0)
+                continue;
+            int one = 1;
+            setsockopt(connection, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+            stats->connections++;
+            serveConnection(connection);
+            close(connection);
+        }
+    }
+
+    // reads requests as they arrive and answers each of them rttMs after its arrival, in order
+    void serveConnection(int connection)
+    {
+        std::string received;
+        std::vector<Pending> pending;
+        int answered = 0;
+        while (true)
+        {
+            int wait = -1;
+            if (!pending.empty())
+                wait = std::max(0L, (long)pending.front().due - (long)millis());
+            pollfd descriptor = {connection, POLLIN, 0};
+            if (poll(&descriptor, 1, wait) > 0)
+            {
+                char buffer[4096];
+                ssize_t count = recv(connection, buffer, sizeof(buffer), 0);
+                if (count <= 0)
+                    return; // closed by the client, the pending responses have no one to go to
+                received.append(buffer, count);
+                StandInRequest request;
+                while (parseRequest(received, request))
+                {
+                    stats->requests++;
+                    StandInResponse response = {200, "", false, false};
+                    handler(request, response);
+                    pending.push_back({millis() + rttMs, formatResponse(response), response.close});
+                    stats->maxPipelined = std::max(stats->maxPipelined, (int)pending.size());
+                }
+                continue;
+            }
+            if (pending.empty() || (long)pending.front().due > (long)millis())
+                continue;
+            Pending next = pending.front();
+            pending.erase(pending.begin());
+            if (!sendPaced(connection, next.response))
+                return;
+            answered++;
+            if (next.close || (closeAfter > 0 && answered >= closeAfter))
+                return;
+        }
+    }
+
+    // takes the first complete request off the buffer
+    static bool parseRequest(std::string& buffer, StandInRequest& request)
+    {
+        size_t end = buffer.find("\r\n\r\n");
+        if (end == std::string::npos)
+            return false;
+        std::string head = buffer.substr(0, end);
+        size_t contentLength = 0;
+        size_t header = head.find("\r\n");
+        while (header != std::string::npos)
+        {
+            size_t next = head.find("\r\n", header + 2);
+            std::string line = head.substr(header + 2, next == std::string::npos ? std::string::npos : next - header - 2);
+            if (strncasecmp(line.c_str(), "Content-Length:", 15) == 0)
+                contentLength = atol(line.c_str() + 15);
+            header = next;
+        }
+        if (buffer.length() < end + 4 + contentLength)
+            return false;
+        size_t space = head.find(' ');
+        size_t space2 = head.find(' ', space + 1);
+        request.method = head.substr(0, space);
+        request.path = head.substr(space + 1, space2 - space - 1);
+        request.body = buffer.substr(end + 4, contentLength);
+        buffer.erase(0, end + 4 + contentLength);
+        return true;
+    }
+
+    static std::string formatResponse(const StandInResponse& response)
+    {
+        char head[256];
+        if (response.chunked)
+        {
+            snprintf(head, sizeof(head), "HTTP/1.1 %d X\r\nContent-Type: application/json\r\nTransfer-Encoding: chunked\r\n%s\r\n%zx\r\n",
+                     response.code, response.close ? "Connection: close\r\n" : "", response.body.length());
+            return head + response.body + "\r\n0\r\n\r\n";
+        }
+        snprintf(head, sizeof(head), "HTTP/1.1 %d X\r\nContent-Type: application/json\r\nContent-Length: %zu\r\n%s\r\n",
+                 response.code, response.body.length(), response.close ? "Connection: close\r\n" : "");
+        return head + response.body;
+    }
+
+    // sends at bytesPerSecond, in packets of a WiFi MTU
+    bool sendPaced(int connection, const std::string& data)
+    {
+        const size_t packet = bytesPerSecond > 0 ? 1460 : data.length();
+        unsigned long start = micros();
+        for (size_t sent = 0; sent < data.length(); )
+        {
+            ssize_t count = send(connection, data.data() + sent, std::min(packet, data.length() - sent), MSG_NOSIGNAL);
+            if (count <= 0)
+                return false;
+            sent += count;
+            if (bytesPerSecond > 0)
+            {
+                long due = (long)(sent * 1000000.0 / bytesPerSecond) - (long)(micros() - start);
+                if (due > 0)
+                    std::this_thread::sleep_for(std::chrono::microseconds(due));
+            }
+        }
+        return true;
+    }
+
+    StandInHandler handler;
+    int           rttMs;
+    long          bytesPerSecond;
+    int           closeAfter;
+    StandInStats* stats = NULL;
+    int           listener = -1;
+    pid_t         child = -1;
+};
+
+struct StandInBrokerStats{
+    int connections;
+    int subscriptions;
+    int published; // retained messages sent
+};
+
+// the retained message of a topic, NULL if there is none
+typedef const char* (*StandInRetained)(const std::string& topic);
+
+// MQTT 3.1.1 broker that answers CONNECT, SUBSCRIBE (with the retained message of every topic), PINGREQ and DISCONNECT
+// rttMs after they arrived. It stands in for connections to port, HTTP stand-ins can run alongside.
+class StandInBroker
+{
+public:
+    StandInBroker(StandInRetained retained, uint16_t port, int rttMs = 0) : retained(retained), port(port), rttMs(rttMs) {}
+
+    ~StandInBroker()
+    {
+        stop();
+    }
+
+    bool start()
+    {
+        stats = (StandInBrokerStats*)mmap(NULL, sizeof(StandInBrokerStats), PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+        listener = socket(AF_INET, SOCK_STREAM, 0);
+        sockaddr_in address = {};
+        address.sin_family = AF_INET;
+        address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+        socklen_t length = sizeof(address);
+        if (stats == MAP_FAILED || listener < 0 || bind(listener, (sockaddr*)&address, length) != 0 || listen(listener, 4) != 0 ||
+            getsockname(listener, (sockaddr*)&address, &length) != 0)
+        {
+            fprintf(stderr, "Cannot start the stand-in broker: %s\n", strerror(errno));
+            return false;
+        }
+        memset(stats, 0, sizeof(StandInBrokerStats));
+        fflush(stdout);
+        child = fork();
+        if (child == 0)
+        {
+            serve();
+            _exit(0);
+        }
+        close(listener);
+        listener = -1;
+        wifiClientStandInPorts[port] = ntohs(address.sin_port);
+        return child > 0;
+    }
+
+    void stop()
+    {
+        if (child > 0)
+        {
+            kill(child, SIGTERM);
+            waitpid(child, NULL, 0);
+            child = -1;
+        }
+        if (stats != NULL)
+            munmap(stats, sizeof(StandInBrokerStats));
+        stats = NULL;
+        if (listener >= 0)
+            close(listener);
+        listener = -1;
+        wifiClientStandInPorts.erase(port);
+    }
+
+    const StandInBrokerStats& getStats()
+    {
+        return *stats;
+    }
+
+private:
+    struct Pending{
+        unsigned long due;
+        std::string   packet;
+    };
+
+    void serve()
+    {
+        while (true)
+        {
+            int connection = accept(listener, NULL, NULL);
+            if (connection < 0)
+                continue;
+            int one = 1;
+            setsockopt(connection, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+            stats->connections++;
+            serveConnection(connection);
+            close(connection);
+        }
+    }
+
+    void serveConnection(int connection)
+    {
+        std::string received;
+        std::vector<Pending> pending;
+        while (true)
+        {
+            int wait = -1;
+            if (!pending.empty())
+                wait = std::max(0L, (long)pending.front().due - (long)millis());
+            pollfd descriptor = {connection, POLLIN, 0};
+            if (poll(&descriptor, 1, wait) > 0)
+            {
+                char buffer[4096];
+                ssize_t count = recv(connection, buffer, sizeof(buffer), 0);
+                if (count <= 0)
+                    return;
+                received.append(buffer, count);
+                uint8_t type;
+                std::string body;
+                while (takePacket(received, type, body))
+                {
+                    if (type == 0xE0) // DISCONNECT
+                        return;
+                    std::string answer = answerPacket(type, body);
+                    if (!answer.empty())
+                        pending.push_back({millis() + rttMs, answer});
+                }
+                continue;
+            }
+            if (pending.empty() || (long)pending.front().due > (long)millis())
+                continue;
+            const std::string& packet = pending.front().packet;
+            if (send(connection, packet.data(), packet.length(), MSG_NOSIGNAL) != (ssize_t)packet.length())
+                return;
+            pending.erase(pending.begin());
+        }
+    }
+
+    std::string answerPacket(uint8_t type, const std::string& body)
+    {
+        if (type == 0x10) // CONNECT: accepted
+            return std::string("\x20\x02\x00\x00", 4);
+        if (type == 0xC0) // PINGREQ
+            return std::string("\xD0\x00", 2);
+        if (type != 0x82 || body.length() < 2) // SUBSCRIBE
+            return "";
+        std::string subscriptions;
+        std::string granted;
+        for (size_t at = 2; at + 2 <= body.length(); )
+        {
+            size_t length = (uint8_t)body[at] << 8 | (uint8_t)body[at + 1];
+            std::string topic = body.substr(at + 2, length);
+            at += 2 + length + 1; // and the QoS
+            granted += '\0';
+            stats->subscriptions++;
+            const char* message = retained(topic);
+            if (message == NULL)
+                continue;
+            std::string publish = std::string(1, (char)(topic.length() >> 8)) + (char)(topic.length() & 0xFF) + topic + message;
+            subscriptions += packet(0x31, publish); // retained, QoS 0
+            stats->published++;
+        }
+        return packet(0x90, body.substr(0, 2) + granted) + subscriptions;
+    }
+
+    static std::string packet(uint8_t type, const std::string& body)
+    {
+        std::string packet(1, (char)type);
+        size_t length = body.length();
+        do
+        {
+            uint8_t digit = length % 128;
+            length /= 128;
+            packet += (char)(digit | (length > 0 ? 0x80 : 0));
+        } while (length > 0);
+        return packet + body;
+    }
+
+    // takes the first complete packet off the buffer
+    static bool takePacket(std::string& buffer, uint8_t& type, std::string& body)
+    {
+        size_t length = 0;
+        size_t header = 1;
+        for (int shift = 0; ; shift += 7, header++)
+        {
+            if (header >= buffer.length())
+                return false;
+            length |= (size_t)((uint8_t)buffer[header] & 0x7F) << shift;
+            if (((uint8_t)buffer[header] & 0x80) == 0)
+                break;
+        }
+        header++;
+        if (buffer.length() < header + length)
+            return false;
+        type = (uint8_t)buffer[0];
+        body = buffer.substr(header, length);
+        buffer.erase(0, header + length);
+        return true;
+    }
+
+    StandInRetained     retained;
+    uint16_t            port;
+    int                 rttMs;
+    StandInBrokerStats* stats = NULL;
+    int                 listener = -1;
+    pid_t               child = -1;
+};
@@ -0,0 +1,311 @@
+// Tile catalogue: every tile type in every state, each rendered on its own and cropped to the tile. --catalogue
+// writes the tiles and their render times as reference, --check renders them again and compares pixel by pixel
+// and the time against the reference, so layout changes and slow downs of the drawing code show up per tile.
+
+#define CATALOGUE_MAX_CASES 64
+#define CATALOGUE_REPEAT    50
+#define CATALOGUE_BATCHES   8
+
+enum tile_case_kind {SWITCH_CASE, HIGROW_CASE, SENSOR_CASE, TEMP_CASE, BOTTOM_CASE};
+
+const char* entityStateNames[] = {"on", "off", "error", "unavailable"};
+const char* entityTypeNames[]  = {"switch", "light", "exfan", "fan", "airpurifier", "waterheater", "plug", "airconditioner", "plant", "higrow"};
+const char* sensorTypeNames[]  = {"door", "window", "motion", "energymeter", "temp", "energymeterpwr"};
+
+struct TileCase{
+    String name;
+    int    kind;
+    int    type;
+    int    state;
+    String value; // soil for HIGROW_CASE, temperature for TEMP_CASE
+    String batt;
+};
+
+TileCase tileCases[CATALOGUE_MAX_CASES];
+int      tileCaseCount = 0;
+bool     catalogueBanded = false; // render the tiles through the display list
+
+void AddTileCase(String name, int kind, int type, int state, String value = "", String batt = "")
+{
+    if (tileCaseCount < CATALOGUE_MAX_CASES)
+        tileCases[tileCaseCount++] = {name, kind, type, state, value, batt};
+}
+
+void CollectTileCases()
+{
+    tileCaseCount = 0;
+    for (int type = entity_type::SWITCH; type <= entity_type::AIRCONDITIONER; type++)
+    {
+        for (int state = entity_state::ON; state <= entity_state::UNAVAILABLE; state++)
+            AddTileCase(String(entityTypeNames[type]) + "_" + entityStateNames[state], SWITCH_CASE, type, state);
+    }
+    // the soil thresholds: watering ok, watering low and the warning below 5%
+    AddTileCase("plant_ok", SWITCH_CASE, entity_type::PLANT, 0, String(WATERING_SOIL_LIMIT));
+    AddTileCase("plant_low", SWITCH_CASE, entity_type::PLANT, 0, String(WATERING_SOIL_LIMIT - 1));
+    AddTileCase("plant_warning", SWITCH_CASE, entity_type::PLANT, 0, "5");
+    AddTileCase("higrow_ok", HIGROW_CASE, entity_type::HIGROW, 0, String(WATERING_SOIL_LIMIT), "87");
+    AddTileCase("higrow_low", HIGROW_CASE, entity_type::HIGROW, 0, String(WATERING_SOIL_LIMIT - 1), "45");
+    AddTileCase("higrow_warning", HIGROW_CASE, entity_type::HIGROW, 0, "5", "3");
+    AddTileCase("higrow_battery_empty", HIGROW_CASE, entity_type::HIGROW, 0, "60", "-1");
+    for (int type = sensor_type::DOOR; type <= sensor_type::MOTION; type++)
+    {
+        for (int state = entity_state::ON; state <= entity_state::UNAVAILABLE; state++)
+            AddTileCase(String(sensorTypeNames[type]) + "_" + entityStateNames[state], SENSOR_CASE, type, state);
+    }
+    AddTileCase("temp", TEMP_CASE, sensor_type::TEMP, 0, "21.5");
+    AddTileCase("temp_unavailable", TEMP_CASE, sensor_type::TEMP, 0, "0");
+    AddTileCase("bottom_energy", BOTTOM_CASE, sensor_type::ENERGYMETER, 0, "9.70 kWh");
+    AddTileCase("bottom_power", BOTTOM_CASE, sensor_type::ENERGYMETERPWR, 0, "1542 W");
+    AddTileCase("bottom_temp", BOTTOM_CASE, sensor_type::TEMP, 0, "23.4° C");
+    AddTileCase("bottom_unavailable", BOTTOM_CASE, sensor_type::TEMP, 0, str_unavail);
+}
+
+// the tiles are drawn at the position of the first tile of their row, the bottom tiles depend on it
+Rect_t TileCaseArea(const TileCase& tile)
+{
+    switch (tile.kind)
+    {
+        case SWITCH_CASE:
+        case HIGROW_CASE:
+            return {3, 23, TILE_WIDTH - TILE_GAP, TILE_HEIGHT - TILE_GAP};
+        case SENSOR_CASE:
+        case TEMP_CASE:
+            return {3, 345, SENSOR_TILE_WIDTH - TILE_GAP, SENSOR_TILE_HEIGHT - TILE_GAP};
+        default:
+            return {3, 456, BOTTOM_TILE_WIDTH - TILE_GAP, BOTTOM_TILE_HEIGHT - TILE_GAP};
+    }
+}
+
+void DrawTileCase(const TileCase& tile)
+{
+    Rect_t area = TileCaseArea(tile);
+    setFont(OpenSans9B);
+    if (catalogueBanded)
+        beginDisplayList();
+    switch (tile.kind)
+    {
+        case SWITCH_CASE:
+            DrawTile(area.x, area.y, tile.state, tile.type, "LABEL", tile.value);
+            break;
+        case HIGROW_CASE:
+            DrawTileHigrow(area.x, area.y, tile.state, tile.type, "LABEL", tile.value, "21.5", tile.batt);
+            break;
+        case SENSOR_CASE:
+            DrawSensorTile(area.x, area.y, tile.state, tile.type, "LABEL");
+            break;
+        case TEMP_CASE:
+            DrawTempSensorTile(area.x, area.y, tile.value.toFloat(), "LABEL");
+            break;
+        case BOTTOM_CASE:
+            DrawBottomTile(area.x, area.y, tile.value, "LABEL");
+            break;
+    }
+    endDisplayList();
+}
+
+// Renders the tile into a white framebuffer, returns the render time in us. The tile is rendered in batches and
+// the fastest batch counts, which keeps the scheduler and cache noise of the host out of the comparison.
+double RenderTileCase(const TileCase& tile)
+{
+    Serial.muted = true;
+    double fastest = 0;
+    for (int batch = 0; batch < CATALOGUE_BATCHES; batch++)
+    {
+        unsigned long elapsed = 0;
+        for (int i = 0; i < CATALOGUE_REPEAT; i++)
+        {
+            memset(framebuffer, 0xFF, EPD_WIDTH * EPD_HEIGHT / 2);
+            resetTileHashes();
+            damageCount = 0;
+            unsigned long start = micros();
+            DrawTileCase(tile);
+            elapsed += micros() - start;
+        }
+        double us = (double)elapsed / CATALOGUE_REPEAT;
+        if (batch == 0 || us < fastest)
+            fastest = us;
+    }
+    Serial.muted = false;
+    return fastest;
+}
+
+// Renders the tile over the framebuffer with the other state of its on/off pair in it, like a tile that flipped
+// since the last wake, where the icon is patched instead of drawn. False if the tile has no such pair.
+bool RenderTileFlip(const TileCase& tile)
+{
+    if ((tile.kind != SWITCH_CASE && tile.kind != SENSOR_CASE) || tile.state > entity_state::OFF)
+        return false;
+    TileCase flipped = tile;
+    flipped.state = tile.state == entity_state::ON ? entity_state::OFF : entity_state::ON;
+    Serial.muted = true;
+    memset(framebuffer, 0xFF, EPD_WIDTH * EPD_HEIGHT / 2);
+    resetTileHashes();
+    DrawTileCase(flipped);
+    tileHashesValid = true;
+    DrawTileCase(tile);
+    tileHashesValid = false;
+    damageCount = 0;
+    Serial.muted = false;
+    return true;
+}
+
+uint8_t FramebufferPixel(int x, int y)
+{
+    uint8_t pixels = framebuffer[y * EPD_WIDTH / 2 + x / 2];
+    return ((x % 2) ? pixels >> 4 : pixels & 0x0F) * 17;
+}
+
+// 8 bit PGM of an area of the framebuffer, with the 16 gray levels of the panel
+bool WritePGM(const char* path, Rect_t area)
+{
+    FILE* file = fopen(path, "wb");
+    if (file == NULL)
+        return false;
+    fprintf(file, "P5\n%d %d\n255\n", area.width, area.height);
+    for (int y = area.y; y < area.y + area.height; y++)
+    {
+        for (int x = area.x; x < area.x + area.width; x++)
+            fputc(FramebufferPixel(x, y), file);
+    }
+    return fclose(file) == 0;
+}
+
+// number of pixels of the area that differ from the PGM, -1 if it cannot be read or has another size
+long ComparePGM(const char* path, Rect_t area)
+{
+    FILE* file = fopen(path, "rb");
+    if (file == NULL)
+        return -1;
+    int width = 0, height = 0, maxValue = 0;
+    long differences = -1;
+    if (fscanf(file, "P5 %d %d %d", &width, &height, &maxValue) == 3 && fgetc(file) >= 0 &&
+        width == area.width && height == area.height && maxValue == 255)
+    {
+        differences = 0;
+        for (int y = area.y; y < area.y + area.height && differences >= 0; y++)
+        {
+            for (int x = area.x; x < area.x + area.width; x++)
+            {
+                int c = fgetc(file);
+                if (c < 0)
+                {
+                    differences = -1;
+                    break;
+                }
+                if (c != FramebufferPixel(x, y))
+                    differences++;
+            }
+        }
+    }
+    fclose(file);
+    return differences;
+}
+
+String CataloguePath(const char* directory, const String& name, const char* suffix)
+{
+    return String(directory) + "/" + name + suffix;
+}
+
+// the render times of the two modes differ, each has its own reference
+const char* TimingsName()
+{
+    return catalogueBanded ? "timings_banded" : "timings";
+}
+
+// creates the directory and its parents, like mkdir -p
+bool MakeDirectories(const char* directory)
+{
+    String path = directory;
+    for (int slash = path.indexOf('/', 1); ; slash = path.indexOf('/', slash + 1))
+    {
+        String parent = slash >= 0 ? path.substring(0, slash) : path;
+        if (mkdir(parent.c_str(), 0755) != 0 && errno != EEXIST)
+        {
+            fprintf(stderr, "Cannot create %s: %s\n", parent.c_str(), strerror(errno));
+            return false;
+        }
+        if (slash < 0)
+            return true;
+    }
+}
+
+// writes every tile as <directory>/<case>.pgm and the render times to <directory>/timings.txt (timings_banded.txt
+// with --banded), the directory is created if it does not exist
+bool WriteCatalogue(const char* directory)
+{
+    CollectTileCases();
+    if (!MakeDirectories(directory))
+        return false;
+    FILE* timings = fopen(CataloguePath(directory, TimingsName(), ".txt").c_str(), "w");
+    if (timings == NULL)
+    {
+        fprintf(stderr, "Cannot write to %s\n", directory);
+        return false;
+    }
+    bool ok = true;
+    for (int i = 0; i < tileCaseCount; i++)
+    {
+        double us = RenderTileCase(tileCases[i]);
+        ok &= WritePGM(CataloguePath(directory, tileCases[i].name, ".pgm").c_str(), TileCaseArea(tileCases[i]));
+        fprintf(timings, "%s %.1f\n", tileCases[i].name.c_str(), us);
+        printf("%-28s %8.1fus\n", tileCases[i].name.c_str(), us);
+    }
+    fclose(timings);
+    printf("Wrote %d tiles to %s\n", tileCaseCount, directory);
+    return ok;
+}
+
+double ReferenceTiming(FILE* timings, const String& name)
+{
+    char caseName[64];
+    double us;
+    rewind(timings);
+    while (fscanf(timings, "%63s %lf", caseName, &us) == 2)
+    {
+        if (name == caseName)
+            return us;
+    }
+    return 0;
+}
+
+// Compares every tile with <directory>/<case>.pgm and fails if a single pixel differs (the tile is written as
+// <case>.actual.pgm then) or the tile takes more than tolerance percent longer to render than in the timings of
+// its mode.
+// A negative tolerance compares the pixels only, for references written on another machine.
+// Tiles of on/off pairs are checked a second time as flipped from the other state (<case>.flip.pgm on a difference).
+bool CheckCatalogue(const char* directory, int tolerance)
+{
+    CollectTileCases();
+    FILE* timings = tolerance >= 0 ? fopen(CataloguePath(directory, TimingsName(), ".txt").c_str(), "r") : NULL;
+    int failed = 0;
+    for (int i = 0; i < tileCaseCount; i++)
+    {
+        const TileCase& tile = tileCases[i];
+        double us = RenderTileCase(tile);
+        long differences = ComparePGM(CataloguePath(directory, tile.name, ".pgm").c_str(), TileCaseArea(tile));
+        double reference = timings != NULL ? ReferenceTiming(timings, tile.name) : 0;
+        // a microsecond of slack, so tiles that render in next to no time do not fail on timer noise
+        bool slow = reference > 0 && us > reference * (100 + tolerance) / 100 + 1;
+        if (differences != 0)
+            WritePGM(CataloguePath(directory, tile.name, ".actual.pgm").c_str(), TileCaseArea(tile));
+        if (differences == 0 && RenderTileFlip(tile))
+        {
+            differences = ComparePGM(CataloguePath(directory, tile.name, ".pgm").c_str(), TileCaseArea(tile));
+            if (differences != 0)
+                WritePGM(CataloguePath(directory, tile.name, ".flip.pgm").c_str(), TileCaseArea(tile));
+        }
+        if (differences != 0 || slow)
+            failed++;
+        printf("%-28s %8.1fus (reference %8.1fus) ", tile.name.c_str(), us, reference);
+        if (differences < 0)
+            printf("NO REFERENCE\n");
+        else if (differences > 0)
+            printf("%ld PIXELS DIFFER\n", differences);
+        else
+            printf(slow ? "SLOW\n" : "ok\n");
+    }
+    if (timings != NULL)
+        fclose(timings);
+    printf("%d/%d tiles passed\n", tileCaseCount - failed, tileCaseCount);
+    return failed == 0;
+}
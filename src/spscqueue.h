@@ -0,0 +1,37 @@
+#include <atomic>
+
+// Lock-free queue for exactly one producer and one consumer task, which may run on different cores.
+// The producer only writes head, the consumer only writes tail. The release store of an index publishes
+// the element (and everything the producer wrote before pushing it) to the other side.
+template <typename T, size_t N>
+class SpscQueue
+{
+public:
+    // false if the queue is full
+    bool push(const T& item)
+    {
+        size_t head = this->head.load(std::memory_order_relaxed);
+        size_t next = (head + 1) % N;
+        if (next == tail.load(std::memory_order_acquire))
+            return false;
+        items[head] = item;
+        this->head.store(next, std::memory_order_release);
+        return true;
+    }
+
+    // false if the queue is empty
+    bool pop(T& item)
+    {
+        size_t tail = this->tail.load(std::memory_order_relaxed);
+        if (tail == head.load(std::memory_order_acquire))
+            return false;
+        item = items[tail];
+        this->tail.store((tail + 1) % N, std::memory_order_release);
+        return true;
+    }
+
+private:
+    T items[N];
+    std::atomic<size_t> head{0};
+    std::atomic<size_t> tail{0};
+};
@@ -0,0 +1,140 @@
+// Tile level change detection: every tile draw hashes its inputs (icon, texts, font) and compares the hash with the one
+// of the tile at the same position in the frame on the panel. Unchanged tiles are neither rasterised nor pushed.
+// This needs the framebuffer to start out as the previous frame, so the hashes are only used after it was restored.
+// The hashes of a wake are taken in RAM and kept in RTC memory together with the frame they belong to, only when
+// that frame was pushed to the panel and stored (storeTileHashes()), so a skipped redraw keeps the pair consistent.
+// A tile that only switched between the two icons of an on/off pair keeps its icon in the framebuffer, the icon is
+// patched with the delta instead of being cleared and drawn again.
+
+#define MAX_TILE_HASHES 40
+
+struct TileHashEntry{
+    int16_t  x;
+    int16_t  y;
+    uint32_t hash;
+    const Icon* icon; // icon the tile was drawn with, NULL if none
+};
+
+TileHashEntry tileHashes[MAX_TILE_HASHES]; // of the tiles in the framebuffer
+int           tileHashCount = 0;
+RTC_DATA_ATTR TileHashEntry storedTileHashes[MAX_TILE_HASHES]; // of the tiles in the stored frame
+RTC_DATA_ATTR int           storedTileHashCount = 0;
+bool tileHashesValid = false; // the framebuffer holds the tiles the hashes were taken of
+int  tilesDrawn   = 0;
+int  tilesSkipped = 0;
+
+// textFont is the font the tile draws its texts with, given by the tile: the current font at the call is whatever an
+// earlier tile left set
+uint32_t tileHash(const GFXfont& textFont, int width, int height, const void* image, const String& text1, const String& text2 = "", const String& text3 = "", const String& text4 = "")
+{
+    uint32_t hash = FNV_OFFSET_BASIS;
+    const void* font = textFont.bitmap;
+    hash = fnv1a(hash, &width, sizeof(width));
+    hash = fnv1a(hash, &height, sizeof(height));
+    hash = fnv1a(hash, &image, sizeof(image));
+    hash = fnv1a(hash, &font, sizeof(font));
+    hash = fnv1a(hash, text1);
+    hash = fnv1a(hash, text2);
+    hash = fnv1a(hash, text3);
+    return fnv1a(hash, text4);
+}
+
+TileHashEntry* findTileHash(int x, int y)
+{
+    for (int i = 0; i < tileHashCount; i++)
+    {
+        if (tileHashes[i].x == x && tileHashes[i].y == y)
+            return &tileHashes[i];
+    }
+    return NULL;
+}
+
+// clears the tile except the area of its icon
+void clearTileExcept(int x, int y, int width, int height, Rect_t keep)
+{
+    fillRect(x, y, width, keep.y - y, 0xFF); // white
+    fillRect(x, keep.y, keep.x - x, keep.height, 0xFF);
+    fillRect(keep.x + keep.width, keep.y, x + width - keep.x - keep.width, keep.height, 0xFF);
+    fillRect(x, keep.y + keep.height, width, y + height - keep.y - keep.height, 0xFF);
+}
+
+// True if the tile at x/y was drawn with the same inputs before and is still in the framebuffer. Otherwise the new
+// hash is recorded and the tile area is cleared, so the tile can be drawn on top of the previous frame. If patchFrom
+// is given and the framebuffer holds the tile with icon or the other icon of its pair at iconArea, that area is left
+// alone and *patchFrom is set to the icon it holds, otherwise *patchFrom is NULL.
+bool tileUnchanged(int x, int y, int width, int height, uint32_t hash, const Icon* icon = NULL, const Icon** patchFrom = NULL, Rect_t iconArea = {})
+{
+    TileHashEntry* entry = findTileHash(x, y);
+    if (patchFrom != NULL)
+        *patchFrom = NULL;
+    if (tileHashesValid && entry != NULL && entry->hash == hash)
+    {
+        tilesSkipped++;
+        return true;
+    }
+    const Icon* previousIcon = entry != NULL ? entry->icon : NULL;
+    if (entry == NULL && tileHashCount < MAX_TILE_HASHES)
+    {
+        entry = &tileHashes[tileHashCount++];
+        entry->x = x;
+        entry->y = y;
+    }
+    if (entry != NULL)
+    {
+        entry->hash = hash;
+        entry->icon = icon;
+    }
+    if (tileHashesValid)
+    {
+        if (patchFrom != NULL && previousIcon != NULL &&
+            (previousIcon == icon || previousIcon == icon->base || previousIcon->base == icon))
+        {
+            *patchFrom = previousIcon;
+            clearTileExcept(x, y, width, height, iconArea);
+        }
+        else
+            fillRect(x, y, width, height, 0xFF); // white
+    }
+    tilesDrawn++;
+    return false;
+}
+
+// clears an area of the framebuffer and forgets the tiles in it, so they are drawn again
+void clearTileArea(Rect_t area)
+{
+    fillRect(area.x, area.y, area.width, area.height, 0xFF); // white
+    for (int i = 0; i < tileHashCount; i++)
+    {
+        if (tileHashes[i].x >= area.x && tileHashes[i].x < area.x + area.width &&
+            tileHashes[i].y >= area.y && tileHashes[i].y < area.y + area.height)
+        {
+            tileHashes[i--] = tileHashes[--tileHashCount];
+        }
+    }
+}
+
+void resetTileHashes()
+{
+    tileHashCount = 0;
+    tileHashesValid = false;
+}
+
+// takes over the hashes of the stored frame after it was restored into the framebuffer
+void restoreTileHashes()
+{
+    tileHashCount = constrain(storedTileHashCount, 0, MAX_TILE_HASHES);
+    memcpy(tileHashes, storedTileHashes, tileHashCount * sizeof(TileHashEntry));
+    tileHashesValid = true;
+}
+
+// keeps the hashes for the next wake, call it once the frame in the framebuffer was stored
+void storeTileHashes()
+{
+    memcpy(storedTileHashes, tileHashes, tileHashCount * sizeof(TileHashEntry));
+    storedTileHashCount = tileHashCount;
+}
+
+void printTileStats()
+{
+    Serial.println("Tiles: " + String(tilesDrawn) + " drawn, " + String(tilesSkipped) + " skipped");
+}
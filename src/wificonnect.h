@@ -0,0 +1,134 @@
+// WiFi connection: the first connect after power on scans for the network and gets its address by DHCP. The access
+// point (BSSID, channel) and the lease (IP, gateway, subnet, DNS) are then kept in RTC memory, and the next wakes
+// connect straight to that access point with a static configuration, without scan and DHCP. If that fails, or every
+// WIFI_DHCP_RENEW_WAKES fast connects to renew the lease, the full connect follows. A lease that was given to another
+// device meanwhile still associates, the cache is then dropped when the first HA request fails (dropFastWiFi()). Every
+// attempt logs the time it took to associate and to get an IP.
+
+#define WIFI_CACHE_MAGIC      0x57494649 // "WIFI"
+#define WIFI_FAST_TIMEOUT_MS  3000
+#define WIFI_TIMEOUT_MS       10000      // of one connect with scan and DHCP
+#define WIFI_DHCP_RENEW_WAKES 120        // one hour of 30 second wakes
+
+struct WiFiCache{
+    uint32_t magic;
+    uint8_t  network; // 0 for ssid, 1 for ssid2
+    uint8_t  bssid[6];
+    int32_t  channel;
+    uint32_t ip;
+    uint32_t gateway;
+    uint32_t subnet;
+    uint32_t dns1;
+    uint32_t dns2;
+};
+
+RTC_DATA_ATTR WiFiCache wifiCache;
+RTC_DATA_ATTR int       wifiFastConnects = 0; // since the last connect with DHCP
+bool                    wifiFastConnected = false; // this wake connected with the cached lease
+
+volatile unsigned long wifiAssociatedAt = 0;
+volatile unsigned long wifiGotIPAt = 0;
+bool                   wifiEventsRegistered = false;
+
+void WiFiConnectEvent(WiFiEvent_t event)
+{
+    if (event == ARDUINO_EVENT_WIFI_STA_CONNECTED)
+        wifiAssociatedAt = millis();
+    else if (event == ARDUINO_EVENT_WIFI_STA_GOT_IP)
+        wifiGotIPAt = millis();
+}
+
+// waits for the connection and logs how long it took from start
+bool waitForWiFi(const String& attempt, unsigned long start, unsigned long timeout)
+{
+    bool connected = WiFi.waitForConnectResult(timeout) == WL_CONNECTED;
+    String associated = wifiAssociatedAt >= start ? String(wifiAssociatedAt - start) + "ms" : "-";
+    String gotIP = connected && wifiGotIPAt >= start ? String(wifiGotIPAt - start) + "ms" : "-";
+    Serial.println("WiFi " + attempt + (connected ? " connected" : " failed") + ", associated in " + associated + ", IP in " + gotIP);
+    return connected;
+}
+
+// connects to the access point of the last wake with its lease, false if there is none or it does not answer
+bool connectCachedWiFi(const char* const ssids[], const char* const passwords[], unsigned long timeout)
+{
+    if (wifiCache.magic != WIFI_CACHE_MAGIC || wifiFastConnects >= WIFI_DHCP_RENEW_WAKES)
+        return false;
+    char bssid[18];
+    snprintf(bssid, sizeof(bssid), "%02x:%02x:%02x:%02x:%02x:%02x", wifiCache.bssid[0], wifiCache.bssid[1], wifiCache.bssid[2],
+             wifiCache.bssid[3], wifiCache.bssid[4], wifiCache.bssid[5]);
+    unsigned long start = millis();
+    WiFi.config(IPAddress(wifiCache.ip), IPAddress(wifiCache.gateway), IPAddress(wifiCache.subnet), IPAddress(wifiCache.dns1),
+                IPAddress(wifiCache.dns2));
+    WiFi.begin(ssids[wifiCache.network], passwords[wifiCache.network], wifiCache.channel, wifiCache.bssid);
+    if (waitForWiFi("fast connect to " + String(bssid) + " on channel " + String(wifiCache.channel), start, timeout))
+    {
+        wifiFastConnects++;
+        wifiFastConnected = true;
+        return true;
+    }
+    // the access point or the lease changed, scan and ask DHCP again
+    wifiCache.magic = 0;
+    WiFi.disconnect();
+    WiFi.config(INADDR_NONE, INADDR_NONE, INADDR_NONE);
+    return false;
+}
+
+// connects with scan and DHCP, keeps the access point and the lease for the next wakes
+bool connectWiFi(const char* const ssids[], const char* const passwords[], int network, unsigned long timeout)
+{
+    unsigned long start = millis();
+    WiFi.begin(ssids[network], passwords[network]);
+    if (!waitForWiFi("connect to " + String(ssids[network]), start, timeout))
+    {
+        WiFi.disconnect();
+        return false;
+    }
+    wifiCache.magic = WIFI_CACHE_MAGIC;
+    wifiCache.network = network;
+    memcpy(wifiCache.bssid, WiFi.BSSID(), sizeof(wifiCache.bssid));
+    wifiCache.channel = WiFi.channel();
+    wifiCache.ip = WiFi.localIP();
+    wifiCache.gateway = WiFi.gatewayIP();
+    wifiCache.subnet = WiFi.subnetMask();
+    wifiCache.dns1 = WiFi.dnsIP(0);
+    wifiCache.dns2 = WiFi.dnsIP(1);
+    wifiFastConnects = 0;
+    return true;
+}
+
+// the cached access point first, then ssid and ssid2 in turn, all within timeout
+bool connectWiFi(const char* ssid, const char* password, const char* ssid2, const char* password2, unsigned long timeout)
+{
+    const char* const ssids[] = {ssid, ssid2};
+    const char* const passwords[] = {password, password2};
+    if (!wifiEventsRegistered)
+    {
+        WiFi.onEvent(WiFiConnectEvent);
+        wifiEventsRegistered = true;
+    }
+    unsigned long start = millis();
+    wifiFastConnected = false;
+    if (connectCachedWiFi(ssids, passwords, min((unsigned long)WIFI_FAST_TIMEOUT_MS, timeout)))
+        return true;
+    int networks = ssid2[0] != '\0' ? 2 : 1;
+    for (int attempt = 0; ; attempt++)
+    {
+        long remaining = (long)timeout - (long)(millis() - start);
+        if (remaining <= 0)
+            return false;
+        if (connectWiFi(ssids, passwords, attempt % networks, min((long)WIFI_TIMEOUT_MS, remaining)))
+            return true;
+        delay(500);
+    }
+}
+
+// called with the result of the first HA request: if it could not reach HA over a fast connect, the cached lease
+// may be in use by another device, the next wake connects with scan and DHCP again
+void dropFastWiFi(int firstResult)
+{
+    if (!wifiFastConnected || firstResult >= 0)
+        return;
+    Serial.println("First HA request after the fast connect failed (" + String(firstResult) + "), dropping the cached lease");
+    wifiCache.magic = 0;
+    wifiFastConnected = false;
+}